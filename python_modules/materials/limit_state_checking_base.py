@@ -31,6 +31,10 @@ class LimitStateControllerBase(object):
         '''
         self.limitStateLabel= limitStateLabel
         self.fakeSection= fakeSection
+        # True if the checking needs only the interaction diagrams of
+        # the sections (no phantom model is built, see 
+        # RCMaterialDistribution.checkCapacityFactors).
+        self.interactionDiagramChecking= False
         #Linear analysis by default.
         self.analysisToPerform= predefined_solutions.simple_static_linear
         self.preprocessor=None   
@@ -56,6 +56,7 @@ class BiaxialBendingNormalStressController(lsc.LimitStateControllerBase):
 
   def __init__(self,limitStateLabel):
     super(BiaxialBendingNormalStressController,self).__init__(limitStateLabel)
+    self.interactionDiagramChecking= True
 
   def initControlVars(self,elements):
     '''Initialize control variables over elements.
@@ -90,6 +91,7 @@ class UniaxialBendingNormalStressController(lsc.LimitStateControllerBase):
 
   def __init__(self,limitStateLabel):
     super(UniaxialBendingNormalStressController,self).__init__(limitStateLabel)
+    self.interactionDiagramChecking= True
 
   def initControlVars(self,elements):
     '''Initialize control variables over elements.
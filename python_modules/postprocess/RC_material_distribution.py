@@ -2,6 +2,7 @@
 
 import element_section_map
 import pickle
+import csv
 from miscUtils import LogMessages as lmsg
 import xc_base
 import geom
@@ -9,6 +10,7 @@ import xc
 # Macros
 from solution import predefined_solutions
 from postprocess import phantom_model as phm
+from postprocess import control_vars as cv
 from materials.sections import RCsectionsContainer as sc
 from model.sets import sets_mng as sUtils
 
@@ -132,11 +134,77 @@ class RCMaterialDistribution(object):
       self.sectionDefinition.calcInteractionDiagrams(preprocessor,matDiagType)
     else:
       self.sectionDefinition.calcInteractionDiagrams(preprocessor,matDiagType,'NMy')
+    if(limitStateData.controller.interactionDiagramChecking):
+      # Only the interaction diagrams are needed (normal stresses), so the
+      # capacity factors are computed without building a phantom model.
+      result= self.checkCapacityFactors(limitStateData,threeDim,setCalc)
+      return (feProblem, result)
     limitStateData.controller.analysis= limitStateData.controller.analysisToPerform(feProblem)
     phantomModel= phm.PhantomModel(preprocessor,self)
     result= phantomModel.runChecking(limitStateData,setCalc)
     return (feProblem, result)
 
+  def checkCapacityFactors(self,limitStateData,threeDim= True,setCalc=None,numThreads= 0):
+    '''Normal stresses checking using the interaction diagrams of the
+       sections (see calcInteractionDiagrams) without building a phantom
+       model (see xc.CapacityFactorChecker).
+
+    :param limitStateData: object that contains the name of the file
+                           containing the internal forces 
+                           obtained for each element 
+                           for the combinations analyzed and the
+                           controller to use for the checking.
+    :param threeDim: true if it's 3D (N,My,Mz) false if it's 2D (N,My).
+    :param setCalc: set of elements to be analyzed (defaults to None which 
+                    means that all the elements with an assigned section 
+                    are analyzed) 
+    :param numThreads: number of threads (0: one for each hardware thread).
+    '''
+    mapInteractionDiagrams= self.sectionDefinition.mapInteractionDiagrams
+    checker= xc.CapacityFactorChecker()
+    setElTags= None
+    if(setCalc!=None):
+      setElTags= setCalc.getElementTags()
+    for tagElem in self.sectionDistribution.keys():
+      if (setElTags==None) or (tagElem in setElTags):
+        sectionNames= self.sectionDistribution[tagElem]
+        for i in range(0,len(sectionNames)):
+          diagInt= mapInteractionDiagrams[sectionNames[i]]
+          if(threeDim):
+            checker.setInteractionDiagram(tagElem,i,diagInt)
+          else:
+            checker.setInteractionDiagram2d(tagElem,i,diagInt)
+    intForcCombFileName= limitStateData.getInternalForcesFileName()
+    if(intForcCombFileName.endswith('.xcrs')):
+      checker.readResultStore(intForcCombFileName)
+    else:
+      f= open(intForcCombFileName,"r")
+      internalForcesListing= csv.reader(f)
+      internalForcesListing.next() #skip first line (head)
+      for lst in internalForcesListing:
+        if(len(lst)>0):
+          checker.addInternalForces(lst[0].strip(),int(lst[1]),int(lst[2]),xc.Vector([float(x) for x in lst[3:9]]))
+      f.close()
+    if((setCalc==None) and (checker.numSkippedRows>0)):
+      lmsg.warning(str(checker.numSkippedRows)+' internal forces rows correspond to elements without section.')
+    checker.run(numThreads)
+    if(checker.numControlPointsWithoutResults>0):
+      lmsg.warning(str(checker.numControlPointsWithoutResults)+' sections without internal forces are not reported.')
+    controlVarName= limitStateData.controller.limitStateLabel
+    controlVars= list()
+    for i in range(0,checker.numControlPoints):
+      if(not checker.hasResults(i)): # No internal forces for this section.
+        continue
+      tagElem= checker.getElementTag(i)
+      sectionIndex= checker.getSectionIndex(i)
+      sectionName= self.sectionDistribution[tagElem][sectionIndex]
+      if(threeDim):
+        controlVar= cv.BiaxialBendingControlVars(sectionName,checker.getCombinationName(i),checker.getCapacityFactor(i),checker.getN(i),checker.getMy(i),checker.getMz(i))
+      else:
+        controlVar= cv.UniaxialBendingControlVars(sectionName,checker.getCombinationName(i),checker.getCapacityFactor(i),checker.getN(i),checker.getMy(i))
+      controlVars.append((tagElem,sectionIndex+1,controlVar))
+    return cv.writeControlVars(controlVarName,controlVars,limitStateData.getOutputDataBaseFileName())
+
   def internalForcesVerification3D(self,limitStateData,matDiagType,setCalc=None):
     '''Limit state verification based on internal force (Fx,Fy,Fz,Mx,My,Mz) values.
 
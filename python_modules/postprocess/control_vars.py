@@ -594,6 +594,21 @@ def writeControlVarsFromElements(controlVarName,preprocessor,outputFileName):
   :param preprocessor:    preprocessor from FEA model.
   :param outputFileName: name of the files to write (.py and .tex)
   '''
+  controlVars= list()
+  elementos= preprocessor.getSets["total"].getElements
+  for e in elementos:
+    controlVars.append((e.getProp("idElem"),e.getProp("dir"),e.getProp(controlVarName)))
+  return writeControlVars(controlVarName,controlVars,outputFileName)
+
+def writeControlVars(controlVarName,controlVars,outputFileName):
+  '''Writes control var values into a file for doing graphics and 
+     into a latex file.
+
+  :param controlVarName: name of the control var. 
+  :param controlVars: list of tuples (element tag, section (1 or 2), 
+                      control vars).
+  :param outputFileName: name of the files to write (.py and .tex)
+  '''
   texOutput1= open("/tmp/texOutput1.tmp","w")
   texOutput1.write("Section 1\n")
   texOutput2= open("/tmp/texOutput2.tmp","w")
@@ -603,13 +618,9 @@ def writeControlVarsFromElements(controlVarName,preprocessor,outputFileName):
   #printCabeceraListadoCapacityFactor("texOutput2","2 ("+ sectionName2 +")")
   fcs1= [] #Capacity factors at section 1.
   fcs2= [] #Capacity factors at section 2.
-  elementos= preprocessor.getSets["total"].getElements
-  for e in elementos:
-    eTag= e.getProp("idElem")
-    idSection= e.getProp("idSection")
-    controlVar= e.getProp(controlVarName)
+  for (eTag,sectionIndex,controlVar) in controlVars:
     outStr= controlVar.getLaTeXString(eTag,1e-3)
-    if(e.getProp("dir")==1):
+    if(sectionIndex==1):
       fcs1.append(controlVar.getCF())
       texOutput1.write(outStr)
       xcOutput.write(controlVar.strElementProp(eTag,controlVarName+'Sect1',1e-3))
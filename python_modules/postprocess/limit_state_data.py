@@ -19,9 +19,22 @@ def defaultAnalysis(feProb,steps= 1):
   result= analysis.analyze(steps) #Same with the number of steps.
   return result
 
+class SuperpositionAnalysis(object):
+  '''Linear analysis of the combinations by superposition of the responses
+     to their load patterns; the stiffness matrix is factorized only once.
+     Use a new object for each call to saveAll (i.e:
+     saveAll(feProblem,combContainer,setCalc,analysisToPerform= SuperpositionAnalysis()).'''
+  def __init__(self):
+    self.analysis= None
+  def __call__(self,feProb,steps= 1):
+    if(not self.analysis):
+      self.analysis= predefined_solutions.simple_static_linear_superposition(feProb)
+    return self.analysis.analyze(steps)
+
 class LimitStateData(object):
   check_results_directory= './' #Path to verifRsl* files.
   internal_forces_results_directory= './' #Path to esf_el* f
+  binary_results_store= False #If true write the results in a binary store (xc.ResultStore) instead of CSV text files.
   def __init__(self,limitStateLabel,outputDataBaseFileName):
     '''Limit state data constructor
     label; limit state check label; Something like "Fatigue" or "CrackControl"
@@ -31,13 +44,21 @@ class LimitStateData(object):
     self.label= limitStateLabel
     self.outputDataBaseFileName= outputDataBaseFileName
     self.controller= None
+  def getResultsStoreFileName(self):
+    '''Return the name of the binary file that contains the internal 
+    forces and the displacements for each combination.'''
+    return self.internal_forces_results_directory+'results_'+ self.label +'.xcrs'
   def getInternalForcesFileName(self):
     '''Return the file name to read: combination name, element number and 
     internal forces.'''
+    if(self.binary_results_store):
+      return self.getResultsStoreFileName()
     return self.internal_forces_results_directory+'intForce_'+ self.label +'.csv'
   def getDisplacementsFileName(self):
     '''Return the file name to read: combination name, node number and 
     displacements (ux,uy,uz,rotX,rotY,rotZ).'''
+    if(self.binary_results_store):
+      return self.getResultsStoreFileName()
     return self.internal_forces_results_directory+'displ_'+ self.label +'.csv'
   def getOutputDataBaseFileName(self):
     '''Return the output file name without extension.'''
@@ -67,6 +88,9 @@ class LimitStateData(object):
     loadCombinations= preprocessor.getLoadHandler.getLoadCombinations
     #Putting combinations inside XC.
     loadCombinations= self.dumpCombinations(combContainer,loadCombinations)
+    if(self.binary_results_store):
+      self.saveAllInResultsStore(feProblem,loadCombinations,setCalc,analysisToPerform)
+      return
     elemSet= setCalc.getElements
     nodSet= setCalc.getNodes
     fNameInfForc= self.getInternalForcesFileName()
@@ -94,6 +118,20 @@ class LimitStateData(object):
       fDisp.close()
       comb.removeFromDomain() #Remove combination from the model.
 
+  def saveAllInResultsStore(self,feProblem,loadCombinations,setCalc,analysisToPerform= defaultAnalysis):
+    '''Write internal forces and displacements for each combination
+       in the binary results store (see getResultsStoreFileName).'''
+    store= feProblem.getResultStore
+    store.open(self.getResultsStoreFileName(),False)
+    for key in loadCombinations.getKeys():
+      comb= loadCombinations[key]
+      feProblem.getPreprocessor.resetLoadCase()
+      comb.addToDomain() #Combination to analyze.
+      result= analysisToPerform(feProblem)
+      feProblem.dumpCombinationResults(comb.getName,setCalc)
+      comb.removeFromDomain() #Remove combination from the model.
+    store.close()
+
 class NormalStressesRCLimitStateData(LimitStateData):
   ''' Reinforced concrete normal stresses data for limit state checking.'''
   def __init__(self):
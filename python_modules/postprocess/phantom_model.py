@@ -62,8 +62,11 @@ class PhantomModel(object):
     '''
     self.elementTags= set()
     self.idCombs= set()
-    f= open(intForcCombFileName,"r")
     self.internalForcesValues= defaultdict(list)
+    if(intForcCombFileName.endswith('.xcrs')):
+      self.readResultsStore(intForcCombFileName,setCalc)
+      return
+    f= open(intForcCombFileName,"r")
     internalForcesListing= csv.reader(f)
     internalForcesListing.next()    #skip first line (head)
     if setCalc==None:
@@ -99,6 +102,40 @@ class PhantomModel(object):
             self.internalForcesValues[tagElem].append(crossSectionInternalForces)
     f.close()
 
+  def readResultsStore(self,storeFileName,setCalc=None):
+    '''Extracts element and combination identifiers from the binary 
+       results store (see xc.ResultStore) without parsing any text.
+
+    :param storeFileName: name of the file containing the internal
+                          forces obtained for each element for 
+                          the combinations analyzed
+    :param setCalc: set of elements to be analyzed (defaults to None which 
+                    means that all the elements in the file are analyzed) 
+    '''
+    setElTags= None
+    if setCalc!=None:
+      setElTags= setCalc.getElementTags()
+    reader= xc.ResultStoreReader()
+    if(not reader.open(storeFileName)):
+      lmsg.error("can't read results store: '"+storeFileName+"'")
+      return
+    while(reader.nextOfKind(1)): # Internal forces chunks.
+      idComb= reader.combinationName
+      tags= reader.getTags()
+      sections= reader.getSections()
+      for i in range(0,reader.numRows):
+        tagElem= tags[i]
+        if (setElTags==None) or (tagElem in setElTags):
+          self.idCombs.add(idComb)
+          self.elementTags.add(tagElem)
+          row= reader.getRow(i) # N, Vy, Vz, T, My, Mz
+          crossSectionInternalForces= internal_forces.CrossSectionInternalForces(row[0],row[1],row[2],row[3],row[4],row[5])
+          crossSectionInternalForces.idComb= idComb
+          crossSectionInternalForces.tagElem= tagElem
+          crossSectionInternalForces.idSection= sections[i]
+          self.internalForcesValues[tagElem].append(crossSectionInternalForces)
+    reader.close()
+
   def createPhantomElement(self,idElem,sectionName,sectionDefinition,sectionIndex,interactionDiagram,fakeSection):
     '''Creates a phantom element (that represents a section to check) 
 
@@ -63,7 +63,7 @@ class SolutionProcedure(object):
     self.printFlag= 0
   def clear(self):
     self.solu.clear()
-  def simpleStaticLinear(self,prb):
+  def simpleStaticLinear(self,prb,solAlgoType= "linear_soln_algo"):
     self.solu= prb.getSoluProc
     self.solCtrl= self.solu.getSoluControl
     solModels= self.solCtrl.getModelWrapperContainer
@@ -75,12 +75,18 @@ class SolutionProcedure(object):
     self.cHandler.alphaMP= 1.0e15
     analysisAggregations= self.solCtrl.getAnalysisAggregationContainer
     self.analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
-    self.solAlgo= self.analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+    self.solAlgo= self.analysisAggregation.newSolutionAlgorithm(solAlgoType)
     self.integ= self.analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
     self.soe= self.analysisAggregation.newSystemOfEqn("band_spd_lin_soe")
     self.solver= self.soe.newSolver("band_spd_lin_lapack_solver")
     self.analysis= self.solu.newAnalysis("static_analysis","analysisAggregation","")
     return self.analysis;
+  def simpleStaticLinearSuperposition(self,prb):
+    '''Linear static analysis that factorizes the stiffness matrix once
+       and obtains the response to each load combination by superposition
+       of the (stored) responses to its load patterns. The analysis object
+       must be reused for all the combinations.'''
+    return self.simpleStaticLinear(prb,"linear_superposition_soln_algo")
   def plainLinearNewmark(self,prb):
     self.solu= prb.getSoluProc
     self.solCtrl= self.solu.getSoluControl
@@ -260,6 +266,11 @@ def simple_static_linear(prb):
   solution= SolutionProcedure()
   return solution.simpleStaticLinear(prb)
 
+#Linear static analysis of load combinations by superposition.
+def simple_static_linear_superposition(prb):
+  solution= SolutionProcedure()
+  return solution.simpleStaticLinearSuperposition(prb)
+
 #Linear static analysis.
 def simple_newton_raphson(prb):
   solution= SolutionProcedure()
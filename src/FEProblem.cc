@@ -42,6 +42,7 @@
 #include "utility/database/MySqlDatastore.h"
 #include "utility/database/BerkeleyDbDatastore.h"
 #include "utility/database/SQLiteDatastore.h"
+#include "utility/database/MemoryDatastore.h"
 
 #include "domain/mesh/Mesh.h"
 #include "domain/domain/Domain.h"
@@ -53,7 +54,7 @@ XC::Domain *XC::FEProblem::theActiveDomain= nullptr;
 
 //! @brief Default constructor.
 XC::FEProblem::FEProblem(void)
-  : preprocessor(this,&output_handlers),proc_solu(this), dataBase(nullptr) {}
+  : preprocessor(this,&output_handlers),proc_solu(this), resultStore(this), dataBase(nullptr) {}
 
 //! @brief Database definition.
 XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &type, const std::string &nombre)
@@ -71,6 +72,8 @@ XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &type, const s
       dataBase= new BerkeleyDbDatastore(nombre, preprocessor, theBroker);
     else if(type == "SQLite")
       dataBase= new SQLiteDatastore(nombre, preprocessor, theBroker);
+    else if(type == "Memory")
+      dataBase= new MemoryDatastore(preprocessor, theBroker);
     else
       {  
         std::cerr << "WARNING No database type exists ";
@@ -81,6 +84,15 @@ XC::FE_Datastore *XC::FEProblem::defineDatabase(const std::string &type, const s
     return dataBase; 
   }
 
+//! @brief Write the element internal forces and the nodal displacements
+//! of the set for the current state of the model in the result store
+//! (see ResultStore).
+//!
+//! @param combName: name of the combination (or load case).
+//! @param s: set of nodes and elements.
+int XC::FEProblem::dumpCombinationResults(const std::string &combName,const Set &s)
+  { return resultStore.dump(combName,s); }
+
 XC::FEProblem::~FEProblem(void)
   { clearAll(); }
 
@@ -93,6 +105,7 @@ void XC::FEProblem::clearAll(void)
         if(tmp) delete tmp;
       }
     output_handlers.clear();
+    resultStore.close();
     fields.clearAll();
     proc_solu.clearAll();
     preprocessor.clearAll();
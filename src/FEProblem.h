@@ -34,6 +34,7 @@
 #include "preprocessor/Preprocessor.h"
 #include "solution/ProcSolu.h"
 #include "post_process/MapFields.h"
+#include "post_process/ResultStore.h"
 #include "utility/handler/DataOutputHandler.h"
 
 //! @brief Open source finite element program for structural analysis
@@ -41,6 +42,7 @@ namespace XC {
 class Domain;
 class FE_Datastore;
 class FEM_ObjectBrokerAllClasses;
+class Set;
 
 //! @mainpage <a href="https://sites.google.com/site/xcfemanalysis/" target="_new">XC</a> Open source finite element analysis program.
 //! @author Luis C. Pérez Tato/Ana Ortega.
@@ -85,6 +87,7 @@ class FEProblem: public CommandEntity
     Preprocessor preprocessor; //!< Object that manages the model.
     ProcSolu proc_solu; //!< Solution procedure.
     MapFields fields; //!< Definition of fields for results output.
+    ResultStore resultStore; //!< Binary store for combination results.
     FE_Datastore *dataBase; //!< database to save states in.
     static FEM_ObjectBrokerAllClasses theBroker;
 
@@ -100,6 +103,8 @@ class FEProblem: public CommandEntity
     FE_Datastore *defineDatabase(const std::string &, const std::string &);
     inline FE_Datastore *getDataBase(void)
       { return dataBase; }
+    static inline FEM_ObjectBrokerAllClasses &getObjectBroker(void)
+      { return theBroker; }
     inline const Preprocessor &getPreprocessor(void) const
       { return preprocessor; }
     inline Preprocessor &getPreprocessor(void)
@@ -114,6 +119,9 @@ class FEProblem: public CommandEntity
       { return proc_solu; }
     inline const MapFields &getFields(void) const
       { return fields; }
+    inline ResultStore &getResultStore(void)
+      { return resultStore; }
+    int dumpCombinationResults(const std::string &,const Set &);
     inline DataOutputHandler::map_output_handlers *getOutputHandlers(void) const
       { return &output_handlers; }
   };
@@ -29,6 +29,7 @@
 #include "ContinuaReprComponent.h"
 
 #include "utility/matrix/ID.h"
+#include "domain/domain/Domain.h"
 
 XC::ContinuaReprComponent::ContinuaReprComponent(int classTag)
   : DomainComponent(0,classTag), dead(false){}
@@ -36,6 +37,35 @@ XC::ContinuaReprComponent::ContinuaReprComponent(int classTag)
 XC::ContinuaReprComponent::ContinuaReprComponent(int tag, int classTag)
   : DomainComponent(tag,classTag), dead(false){}
 
+//! @brief Notifies the domain that its stiffness has changed
+//! (see Domain::stiffnessChange).
+void XC::ContinuaReprComponent::stiffness_changed(void)
+  {
+    Domain *dom= getDomain();
+    if(dom)
+      dom->stiffnessChange();
+  }
+
+//! @brief Deactivates the component.
+void XC::ContinuaReprComponent::kill(void)
+  {
+    if(!dead)
+      {
+        dead= true;
+        stiffness_changed();
+      }
+  }
+
+//! @brief Activates the component.
+void XC::ContinuaReprComponent::alive(void)
+  {
+    if(dead)
+      {
+        dead= false;
+        stiffness_changed();
+      }
+  }
+
 //! @brief Send members through the channel being passed as parameter.
 int XC::ContinuaReprComponent::sendData(CommParameters &cp)
   {
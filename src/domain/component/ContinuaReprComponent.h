@@ -37,6 +37,7 @@ namespace XC {
 class ContinuaReprComponent: public DomainComponent
   {
     bool dead; //!< True if domain component is not active.
+    void stiffness_changed(void);
   protected:
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -48,10 +49,8 @@ class ContinuaReprComponent: public DomainComponent
       { return dead; }
     virtual const bool isAlive(void) const
       { return !dead; }
-    virtual void kill(void)
-      { dead= true; }
-    virtual void alive(void)
-      { dead= false; }
+    virtual void kill(void);
+    virtual void alive(void);
   };
 
 } // end of XC namespace
@@ -94,9 +94,10 @@
 #include "solution/graph/graph/Graph.h"
 #include "domain/mesh/region/MeshRegion.h"
 #include "domain/mesh/region/DqMeshRegion.h"
+#include "DomainSnapshots.h"
 #include <solution/analysis/analysis/Analysis.h>
 #include "utility/database/FE_Datastore.h"
-#include "utility/actor/objectBroker/FEM_ObjectBroker.h"
+#include "utility/actor/objectBroker/FEM_ObjectBrokerAllClasses.h"
 
 #include "preprocessor/Preprocessor.h"
 
@@ -118,8 +119,9 @@ void XC::Domain::free_mem(void)
 //! @param owr: object that contains this one.
 XC::Domain::Domain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(),CallbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0),
-   mesh(this), constraints(this), theRegions(nullptr),
+   currentGeoTag(0), hasDomainChangedFlag(false), currentStructureTag(0),
+   hasStructureChangedFlag(false), currentStiffnessTag(0), commitTag(0),
+   mesh(this), constraints(this), theRegions(nullptr), snapshots(nullptr),
    nmbCombActual(""), lastChannel(0), lastGeoSendTag(-1) {}
 
 //! @brief Constructor.
@@ -136,9 +138,10 @@ XC::Domain::Domain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh
 //! @param numNodeLockers: number of node lockers.
 XC::Domain::Domain(CommandEntity *owr,int numNodes, int numElements, int numSPs, int numMPs, int numLoadPatterns,int numNodeLockers,DataOutputHandler::map_output_handlers *oh)
   :ObjWithRecorders(owr,oh),timeTracker(), CallbackCommit(""), dbTag(0),
-   currentGeoTag(0), hasDomainChangedFlag(false), commitTag(0), mesh(this),
-   constraints(this), theRegions(nullptr), nmbCombActual(""), lastChannel(0),
-   lastGeoSendTag(-1) {}
+   currentGeoTag(0), hasDomainChangedFlag(false), currentStructureTag(0),
+   hasStructureChangedFlag(false), currentStiffnessTag(0), commitTag(0), mesh(this),
+   constraints(this), theRegions(nullptr), snapshots(nullptr), nmbCombActual(""),
+   lastChannel(0), lastGeoSendTag(-1) {}
 
 //! @brief Removes all components from domain (nodes, elements, loads &
 //! constraints).
@@ -169,6 +172,11 @@ void XC::Domain::clearAll(void)
         delete theRegions;
         theRegions= nullptr;
       }
+    if(snapshots)
+      {
+        delete snapshots;
+        snapshots= nullptr;
+      }
     nmbCombActual= "";
 
     // set the time back to 0.0
@@ -176,8 +184,10 @@ void XC::Domain::clearAll(void)
 
     // rest the flag to be as initial
     hasDomainChangedFlag = false;
+    hasStructureChangedFlag= false;
 
     currentGeoTag = 0;
+    currentStructureTag= 0;
     lastGeoSendTag = -1;
     lastChannel = 0;
   }
@@ -201,6 +211,34 @@ void XC::Domain::resetLoadCase(void)
     timeTracker.Zero();
   }
 
+//! @brief Return the in-memory snapshots of the domain state.
+XC::DomainSnapshots &XC::Domain::getSnapshots(void)
+  {
+    if(!snapshots)
+      {
+        Preprocessor *prep= getPreprocessor();
+        if(!prep)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; preprocessor not set." << std::endl;
+        assert(prep);
+        snapshots= new DomainSnapshots(*prep,FEProblem::getObjectBroker());
+      }
+    return *snapshots;
+  }
+
+//! @brief Store the current state of the domain in memory (see
+//! DomainSnapshots).
+//!
+//! @param tag: identifier of the snapshot.
+int XC::Domain::takeSnapshot(const int &tag)
+  { return getSnapshots().take(tag); }
+
+//! @brief Restore the state of the domain stored by takeSnapshot.
+//!
+//! @param tag: identifier of the snapshot.
+int XC::Domain::restoreSnapshot(const int &tag)
+  { return getSnapshots().restore(tag); }
+
 //! @brief Assigns Stress Reduction Factor for element deactivation.
 void XC::Domain::setDeadSRF(const double &d)
   { Element::setDeadSRF(d); }
@@ -425,14 +463,22 @@ bool XC::Domain::removeMRMFreedom_Constraint(int tag)
 //! addComponent(theLd)} on the container for the LoadPatterns. The domain
 //! is responsible for invoking {\em setDomain(this)} on the load. The
 //! call returns \p true if the load was added, otherwise a warning is
-//! raised and \p false is returned.
+//! raised and \p false is returned. The domain is marked as having
+//! changed (the integrators must compute again their reference load)
+//! but, unless the pattern has single freedom constraints, the
+//! structure stamp (see getStructureStamp) is not modified, so a static
+//! analysis doesn't need to renumber the DOFs and the system of equations
+//! keeps its factorization.
 bool XC::Domain::addLoadPattern(LoadPattern *load)
   {
     bool result= constraints.addLoadPattern(load);
     if(result)
       {
         load->setDomain(this);
+        const bool sameStructure= (load->getNumSPs()==0) && !hasStructureChangedFlag;
         domainChange();
+        if(sameStructure) // the constraint handlers don't need to be redone.
+          hasStructureChangedFlag= false;
       }
     else
       {
@@ -869,6 +915,15 @@ int XC::Domain::update(void)
     return mesh.update();
   }
 
+//! @brief Updates the state of the domain using the threads
+//! of the pool being passed as parameter.
+int XC::Domain::update(ThreadPool &pool)
+  {
+    // set the global constants
+    FEProblem::theActiveDomain= this;
+    return mesh.update(pool);
+  }
+
 //! @brief Actualiza el estado del domain.
 int XC::Domain::update(double newTime, double dT)
   {
@@ -997,15 +1052,29 @@ void XC::Domain::setDomainChangeStamp(int newStamp)
 //! invoked whenever a Node, Element or Constraint object is added to the
 //! domain.  
 void XC::Domain::domainChange(void)
-  { hasDomainChangedFlag= true; }
+  {
+    hasDomainChangedFlag= true;
+    hasStructureChangedFlag= true;
+  }
+
+//! @brief Increments the stiffness stamp (see getStiffnessStamp).
+//!
+//! Invoked when the stiffness of the model changes without changing
+//! its structure (elements killed or reactivated,...) so the objects
+//! that keep a factored tangent stiffness (see Linear::setReuseTangent)
+//! can discard it.
+void XC::Domain::stiffnessChange(void)
+  { currentStiffnessTag++; }
 
 //! @brief Returns true if the model has changed.
 //!
 //! To return an integer stamp indicating the state of the
 //! domain. Initially \f$0\f$, this integer is incremented by \f$1\f$ if  {\em
 //! domainChange()} has been invoked since the last invocation of the
-//! method. If the domain has changed it marks the element and node graph
-//! flags as not having been built.  
+//! method. If the structure of the model has changed (i.e. the change
+//! is not only the addition of a load pattern without single freedom
+//! constraints) it increments the structure stamp and it marks the
+//! element and node graph flags as not having been built.  
 int XC::Domain::hasDomainChanged(void)
   {
     // if the flag indicating the domain has changed since the
@@ -1016,7 +1085,12 @@ int XC::Domain::hasDomainChanged(void)
     if(result)
       {
         currentGeoTag++;
-        mesh.setGraphBuiltFlags(false);
+        if(hasStructureChangedFlag)
+          {
+            currentStructureTag++;
+            hasStructureChangedFlag= false;
+            mesh.setGraphBuiltFlags(false);
+          }
       }
     // return the integer so user can determine if domain has changed
     // since their last call to this method
@@ -89,6 +89,8 @@ class NodeGraph;
 class ElementGraph;
 class FEM_ObjectBroker;
 class RayleighDampingFactors;
+class ThreadPool;
+class DomainSnapshots;
 
 //!  @defgroup Dom Domain of the finite element problem.
 //
@@ -122,12 +124,16 @@ class Domain: public ObjWithRecorders, public DistributedBase
     int dbTag; //!< Tag for the database.
     int currentGeoTag; //!< an integer used to mark if domain has changed
     bool hasDomainChangedFlag; //!< a bool flag used to indicate if GeoTag needs to be ++
+    int currentStructureTag; //!< an integer used to mark if the model (nodes, elements, constraints,...) has changed.
+    bool hasStructureChangedFlag; //!< a bool flag used to indicate if StructureTag needs to be ++
+    int currentStiffnessTag; //!< an integer incremented each time the stiffness of the model changes without changing its structure (see stiffnessChange).
     int commitTag;
     Mesh mesh; //!< Nodes and element container.
     ConstrContainer constraints;//!< Constraint container.
     Vector theEigenvalues; //!< Eigenvalues.
     Vector modalParticipationFactors; //!< Modal participation factors.
     DqMeshRegion *theRegions;
+    DomainSnapshots *snapshots; //!< In-memory snapshots of the domain state.
     std::string nmbCombActual;//!< Current load combination.
 
     int lastChannel;
@@ -212,6 +218,14 @@ class Domain: public ObjWithRecorders, public DistributedBase
       { return timeTracker; }
     inline int getCurrentGeoTag(void) const
       { return currentGeoTag; }
+    //! @brief Return the stamp that marks the changes of the model
+    //! itself (see hasDomainChanged).
+    inline int getStructureStamp(void) const
+      { return currentStructureTag; }
+    //! @brief Return the stamp that marks the changes of the stiffness
+    //! of the model (see stiffnessChange).
+    inline int getStiffnessStamp(void) const
+      { return currentStiffnessTag; }
     virtual int getCommitTag(void) const;
     virtual int getNumElements(void) const;
     virtual int getNumNodes(void) const;
@@ -236,11 +250,17 @@ class Domain: public ObjWithRecorders, public DistributedBase
     virtual int revertToLastCommit(void);
     virtual int revertToStart(void);
     virtual int update(void);
+    virtual int update(ThreadPool &);
     virtual int update(double newTime, double dT);
     virtual int newStep(double dT);
 
     void resetLoadCase(void);
 
+     // methods to save/restore the domain state in memory
+    DomainSnapshots &getSnapshots(void);
+    int takeSnapshot(const int &);
+    int restoreSnapshot(const int &);
+
      // methods for eigenvalue analysis
     int getNumModes(void) const;
     virtual int setEigenvalues(const Vector &);
@@ -263,6 +283,7 @@ class Domain: public ObjWithRecorders, public DistributedBase
     virtual void domainChange(void);
     virtual int hasDomainChanged(void);
     virtual void setDomainChangeStamp(int newStamp);
+    void stiffnessChange(void);
 
     virtual int addRegion(MeshRegion &theRegion);
     virtual MeshRegion *getRegion(int region);
@@ -0,0 +1,232 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DomainSnapshots.cc
+
+#include "DomainSnapshots.h"
+#include "Domain.h"
+#include "preprocessor/Preprocessor.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/ElementIter.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
+#include "domain/load/pattern/LoadPattern.h"
+#include "utility/actor/actor/CommParameters.h"
+
+//! @brief Default constructor.
+XC::DomainSnapshots::Snapshot::Snapshot(void)
+  : numNodes(0), numElements(0), currentTime(0.0), committedTime(0.0), commitTag(0) {}
+
+//! @brief Constructor.
+//!
+//! @param preprocessor: preprocessor that owns the domain.
+//! @param theObjectBroker: deals with object serialization.
+XC::DomainSnapshots::DomainSnapshots(Preprocessor &preprocessor, FEM_ObjectBroker &theObjectBroker)
+  :MemoryDatastore(preprocessor, theObjectBroker) {}
+
+//! @brief Return a pointer to the domain.
+XC::Domain *XC::DomainSnapshots::getDomain(void)
+  {
+    Domain *retval= nullptr;
+    Preprocessor *prep= getPreprocessor();
+    if(prep)
+      retval= prep->getDomain();
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; preprocessor not set." << std::endl;
+    return retval;
+  }
+
+//! @brief Store the current state of the domain in the snapshot
+//! identified by the tag being passed as parameter (if the snapshot
+//! already exists it's overwritten).
+//!
+//! @param tag: snapshot identifier.
+int XC::DomainSnapshots::take(const int &tag)
+  {
+    Domain *dom= getDomain();
+    if(!dom)
+      return -1;
+    int res= 0;
+    Snapshot &snapshot= snapshots[tag];
+
+    // Nodal state.
+    size_t numNodes= 0;
+    size_t sz= 0;
+    Node *theNode= nullptr;
+    NodeIter &theNodes= dom->getNodes();
+    while((theNode= theNodes()) != nullptr)
+      {
+        sz+= theNode->getStateSize();
+        numNodes++;
+      }
+    snapshot.numNodes= numNodes;
+    snapshot.nodalState.resize(sz);
+    double *pos= snapshot.nodalState.data();
+    NodeIter &theNodes2= dom->getNodes();
+    while((theNode= theNodes2()) != nullptr)
+      pos= theNode->copyStateTo(pos);
+
+    // Element state.
+    clearDbTags();
+    CommParameters cp(tag,*this);
+    size_t numElements= 0;
+    Element *theElement= nullptr;
+    ElementIter &theElements= dom->getElements();
+    while((theElement= theElements()) != nullptr)
+      {
+        if(theElement->sendSelf(cp)<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; element: " << theElement->getTag()
+                      << " failed to send its state." << std::endl;
+            res= -1;
+          }
+        numElements++;
+      }
+    snapshot.numElements= numElements;
+
+    // Load patterns.
+    const std::map<int,LoadPattern *> &lPatterns= dom->getConstraints().getLoadPatterns();
+    snapshot.patternTags.resize(lPatterns.size());
+    snapshot.patternFactors.resize(2*lPatterns.size());
+    size_t i= 0;
+    for(std::map<int,LoadPattern *>::const_iterator j= lPatterns.begin();j!=lPatterns.end();j++,i++)
+      {
+        snapshot.patternTags[i]= j->first;
+        snapshot.patternFactors[2*i]= j->second->getLoadFactor();
+        snapshot.patternFactors[2*i+1]= j->second->GammaF();
+      }
+
+    // Pseudo time.
+    const PseudoTimeTracker &tt= dom->getTimeTracker();
+    snapshot.currentTime= tt.getCurrentTime();
+    snapshot.committedTime= tt.getCommittedTime();
+    snapshot.commitTag= dom->getCommitTag();
+    return res;
+  }
+
+//! @brief Restore the state of the domain stored in the snapshot
+//! identified by the tag being passed as parameter.
+//!
+//! @param tag: snapshot identifier.
+int XC::DomainSnapshots::restore(const int &tag)
+  {
+    map_snapshots::const_iterator isnp= snapshots.find(tag);
+    if(isnp==snapshots.end())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; snapshot: " << tag << " not found." << std::endl;
+        return -1;
+      }
+    Domain *dom= getDomain();
+    if(!dom)
+      return -1;
+    const Snapshot &snapshot= isnp->second;
+    if((size_t(dom->getNumNodes())!=snapshot.numNodes) || (size_t(dom->getNumElements())!=snapshot.numElements))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the domain has changed since the snapshot: "
+                  << tag << " was taken." << std::endl;
+        return -1;
+      }
+
+    // Nodal state.
+    size_t sz= 0;
+    Node *theNode= nullptr;
+    NodeIter &theNodes= dom->getNodes();
+    while((theNode= theNodes()) != nullptr)
+      sz+= theNode->getStateSize();
+    if(sz!=snapshot.nodalState.size())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; the number of degrees of freedom has changed"
+                  << " since the snapshot: " << tag
+                  << " was taken." << std::endl;
+        return -1;
+      }
+    int res= 0;
+    const double *pos= snapshot.nodalState.data();
+    NodeIter &theNodes2= dom->getNodes();
+    while((theNode= theNodes2()) != nullptr)
+      pos= theNode->setStateFrom(pos);
+
+    // Element state.
+    clearDbTags();
+    CommParameters cp(tag,*this,*getObjectBroker());
+    Element *theElement= nullptr;
+    ElementIter &theElements= dom->getElements();
+    while((theElement= theElements()) != nullptr)
+      if(theElement->recvSelf(cp)<0)
+        {
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; element: " << theElement->getTag()
+                    << " failed to restore its state." << std::endl;
+          res= -1;
+        }
+
+    // Load patterns.
+    std::map<int,LoadPattern *> &lPatterns= dom->getConstraints().getLoadPatterns();
+    const size_t numPatterns= snapshot.patternTags.size();
+    for(size_t i= 0;i<numPatterns;i++)
+      {
+        std::map<int,LoadPattern *>::iterator j= lPatterns.find(snapshot.patternTags[i]);
+        if(j!=lPatterns.end())
+          {
+            j->second->setLoadFactor(snapshot.patternFactors[2*i]);
+            j->second->setGammaF(snapshot.patternFactors[2*i+1]);
+          }
+      }
+
+    // Pseudo time.
+    dom->setTime(snapshot.committedTime);
+    dom->setCurrentTime(snapshot.currentTime);
+    dom->setCommitTag(snapshot.commitTag);
+    return res;
+  }
+
+//! @brief Return true if the snapshot exists.
+bool XC::DomainSnapshots::exists(const int &tag) const
+  { return (snapshots.find(tag)!=snapshots.end()); }
+
+//! @brief Remove the snapshot identified by the tag being passed
+//! as parameter.
+void XC::DomainSnapshots::remove(const int &tag)
+  {
+    snapshots.erase(tag);
+    removeState(tag);
+  }
+
+//! @brief Remove all the snapshots.
+void XC::DomainSnapshots::clearAll(void)
+  {
+    snapshots.clear();
+    clear();
+  }
+
+//! @brief Return the number of stored snapshots.
+size_t XC::DomainSnapshots::getNumSnapshots(void) const
+  { return snapshots.size(); }
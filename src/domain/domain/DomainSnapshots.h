@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//DomainSnapshots.h
+
+#ifndef DomainSnapshots_h
+#define DomainSnapshots_h
+
+#include "utility/database/MemoryDatastore.h"
+#include <map>
+#include <vector>
+
+namespace XC {
+class Domain;
+
+//! @ingroup Dom
+//
+//! @brief In-memory snapshots of the state of the domain.
+//!
+//! Stores the state of the domain (nodal displacements, velocities
+//! and accelerations, state of the elements and its materials, load
+//! pattern factors and pseudo-time) so it can be restored later
+//! without rebuilding the model. This way many load combinations can
+//! be analyzed starting from the same state (i.e. the one obtained
+//! after the dead load analysis).
+//!
+//! The nodal state is copied into a contiguous buffer and the
+//! element state is kept in memory by means of the elements sendSelf
+//! and recvSelf methods. When a snapshot is taken again with the same
+//! tag, the memory already reserved is reused. The snapshots don't
+//! store the topology of the model, so they can be restored only while
+//! the domain has the same nodes and elements it had when the snapshot
+//! was taken. The set of active load patterns is not modified by the
+//! restore (only the factors of the patterns that were active).
+class DomainSnapshots: public MemoryDatastore
+  {
+  private:
+    //! @brief State of the domain not stored by means of sendSelf.
+    struct Snapshot
+      {
+        size_t numNodes; //!< number of nodes of the domain.
+        size_t numElements; //!< number of elements of the domain.
+        std::vector<double> nodalState; //!< trial and committed displacements, velocities,... of the nodes.
+        std::vector<int> patternTags; //!< tags of the active load patterns.
+        std::vector<double> patternFactors; //!< load factor and partial safety factor of the active load patterns.
+        double currentTime; //!< current pseudo time.
+        double committedTime; //!< committed pseudo time.
+        int commitTag; //!< domain commit tag.
+        Snapshot(void);
+      };
+    typedef std::map<int,Snapshot> map_snapshots;
+    map_snapshots snapshots; //!< Snapshots indexed by its tag.
+
+    Domain *getDomain(void);
+  public:
+    DomainSnapshots(Preprocessor &, FEM_ObjectBroker &);
+
+    int take(const int &);
+    int restore(const int &);
+    bool exists(const int &) const;
+    void remove(const int &);
+    void clearAll(void);
+    size_t getNumSnapshots(void) const;
+  };
+} // end of XC namespace
+
+#endif
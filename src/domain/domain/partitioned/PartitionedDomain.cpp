@@ -79,12 +79,18 @@
 #include <domain/domain/partitioned/PartitionedDomainSubIter.h>
 #include <domain/domain/single/SingleDomEleIter.h>
 #include <solution/graph/graph/Vertex.h>
+#include "solution/graph/partitioner/Metis.h"
 #include <domain/load/pattern/LoadPattern.h>
 #include <domain/load/NodalLoad.h>
 #include <domain/load/ElementalLoad.h>
 #include <domain/constraints/SFreedom_Constraint.h>
 #include <utility/recorder/Recorder.h>
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "domain/mesh/Mesh.h"
+#include "utility/ThreadPool.h"
+#include "FEProblem.h"
+#include <atomic>
+#include <vector>
 
 void XC::PartitionedDomain::free_mem(void)
   {
@@ -98,6 +104,15 @@ void XC::PartitionedDomain::free_mem(void)
     theEleIter= nullptr;
   }
 
+//! @brief Frees the partitioner used when none has been set.
+void XC::PartitionedDomain::free_default_partitioner(void)
+  {
+    if(defaultDomainPartitioner) delete defaultDomainPartitioner;
+    defaultDomainPartitioner= nullptr;
+    if(defaultGraphPartitioner) delete defaultGraphPartitioner;
+    defaultGraphPartitioner= nullptr;
+  }
+
 //! @brief Allocates memory.
 void XC::PartitionedDomain::alloc(void)
   {
@@ -126,6 +141,7 @@ void XC::PartitionedDomain::alloc(void)
 //! @param oh: to DEPRECATE.
 XC::PartitionedDomain::PartitionedDomain(CommandEntity *owr,DataOutputHandler::map_output_handlers *oh)
   :Domain(owr,oh), theSubdomains(nullptr),theDomainPartitioner(nullptr),
+   defaultGraphPartitioner(nullptr), defaultDomainPartitioner(nullptr),
    theSubdomainIter(nullptr), mySubdomainGraph()
   { alloc(); }
 
@@ -141,6 +157,7 @@ XC::PartitionedDomain::PartitionedDomain(CommandEntity *owr,DataOutputHandler::m
 //! @param oh: to DEPRECATE.
 XC::PartitionedDomain::PartitionedDomain(CommandEntity *owr,DomainPartitioner &thePartitioner,DataOutputHandler::map_output_handlers *oh)
   :Domain(owr,oh), theSubdomains(nullptr),theDomainPartitioner(&thePartitioner),
+   defaultGraphPartitioner(nullptr), defaultDomainPartitioner(nullptr),
  theSubdomainIter(nullptr), mySubdomainGraph()
   { alloc(); }
 
@@ -162,7 +179,8 @@ XC::PartitionedDomain::PartitionedDomain(CommandEntity *owr,int numNodes, int nu
                                      DomainPartitioner &thePartitioner,DataOutputHandler::map_output_handlers *oh)
 
   : Domain(owr,numNodes,0,numSPs,numMPs,numLoadPatterns,numNodeLockers,oh),
-    theSubdomains(nullptr),theDomainPartitioner(&thePartitioner),theSubdomainIter(nullptr),
+    theSubdomains(nullptr),theDomainPartitioner(&thePartitioner),
+   defaultGraphPartitioner(nullptr), defaultDomainPartitioner(nullptr),theSubdomainIter(nullptr),
     mySubdomainGraph()
   { alloc(); }
 
@@ -171,6 +189,7 @@ XC::PartitionedDomain::~PartitionedDomain(void)
   {
     this->clearAll();
     free_mem();
+    free_default_partitioner();
   }
 
 void XC::PartitionedDomain::clearAll(void)
@@ -914,6 +933,144 @@ void XC::PartitionedDomain::setLoadConstant(void)
 }
 
 
+//! @brief Updates the state of the domain using the threads of the
+//! pool. The thread safe subdomains (see Subdomain::isThreadSafe)
+//! compute their internal response and update their state concurrently,
+//! each one of them in a thread; the remaining ones are processed
+//! serially.
+int XC::PartitionedDomain::update(ThreadPool &pool)
+  {
+    const int res= this->XC::Domain::update(pool);
+    if(res != 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; domain failed in update\n";
+
+    int result= 0;
+    if(theSubdomains != 0)
+      {
+        std::vector<Subdomain *> threadSafeSubs;
+        ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
+        TaggedObject *theObject;
+        while((theObject= theSubsIter()) != 0)
+          {
+            Subdomain *theSub= dynamic_cast<Subdomain *>(theObject);
+            if(theSub->isThreadSafe())
+              {
+                theSub->setPrivateStorage();
+                threadSafeSubs.push_back(theSub);
+              }
+            else
+              {
+                if(theSub->hasAnalysis())
+                  theSub->computeNodalResponse();
+                theSub->update();
+              }
+          }
+        // Domain::update sets the active domain, so we update
+        // the meshes of the subdomains directly.
+        FEProblem::theActiveDomain= this;
+        std::atomic<int> err(0);
+        pool.parallel_for(threadSafeSubs.size(),[&](const size_t &i,const size_t &)
+          {
+            Subdomain *theSub= threadSafeSubs[i];
+            if(theSub->hasAnalysis())
+              theSub->computeNodalResponse();
+            const int subRes= theSub->getMesh().update();
+            if(subRes != 0)
+              err+= subRes;
+          },1);
+        result= err;
+        if(result != 0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+		    << "; subdomains failed in update\n";
+      }
+#ifdef _PARALLEL_PROCESSING
+    return this->barrierCheck(res);
+#endif
+    return result;
+  }
+
+//! @brief Updates the state of the domain using \p numThreads threads
+//! (see update(ThreadPool &)). If \p numThreads is less than two the
+//! update is serial.
+int XC::PartitionedDomain::threadedUpdate(int numThreads)
+  {
+    if(numThreads<2)
+      return update();
+    ThreadPool pool(numThreads);
+    return update(pool);
+  }
+
+//! @brief Computes the condensed tangent stiffness of the subdomains
+//! that have an analysis (see Subdomain::computeTang) using the
+//! threads of the pool. The thread safe subdomains are condensed
+//! concurrently; the remaining ones serially.
+int XC::PartitionedDomain::condense(ThreadPool &pool)
+  {
+    int result= 0;
+    if(theSubdomains != 0)
+      {
+        std::vector<Subdomain *> threadSafeSubs;
+        ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
+        TaggedObject *theObject;
+        while((theObject= theSubsIter()) != 0)
+          {
+            Subdomain *theSub= dynamic_cast<Subdomain *>(theObject);
+            if(theSub->hasAnalysis())
+              {
+                if(theSub->isThreadSafe())
+                  {
+                    theSub->setPrivateStorage();
+                    threadSafeSubs.push_back(theSub);
+                  }
+                else if(theSub->computeTang() < 0)
+                  result--;
+              }
+          }
+        std::atomic<int> err(0);
+        pool.parallel_for(threadSafeSubs.size(),[&](const size_t &i,const size_t &)
+          {
+            if(threadSafeSubs[i]->computeTang() < 0)
+              err--;
+          },1);
+        result+= err;
+        if(result != 0)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+		    << "; " << -result << " subdomains failed to condense"
+		    << " their tangent.\n";
+      }
+    return result;
+  }
+
+//! @brief Computes the condensed tangent stiffness of the subdomains
+//! using \p numThreads threads (see condense(ThreadPool &)). If
+//! \p numThreads is less than two the subdomains are condensed
+//! serially.
+int XC::PartitionedDomain::threadedCondense(int numThreads)
+  {
+    int result= 0;
+    if(numThreads<2)
+      {
+        if(theSubdomains != 0)
+          {
+            ArrayOfTaggedObjectsIter theSubsIter(*theSubdomains);
+            TaggedObject *theObject;
+            while((theObject= theSubsIter()) != 0)
+              {
+                Subdomain *theSub= dynamic_cast<Subdomain *>(theObject);
+                if(theSub->hasAnalysis() && (theSub->computeTang() < 0))
+                  result--;
+              }
+          }
+      }
+    else
+      {
+        ThreadPool pool(numThreads);
+        result= condense(pool);
+      }
+    return result;
+  }
+
 int XC::PartitionedDomain::update(void)
   {
     const int res= this->XC::Domain::update();
@@ -929,7 +1086,8 @@ int XC::PartitionedDomain::update(void)
         while((theObject= theSubsIter()) != 0)
           {
             Subdomain *theSub= dynamic_cast<Subdomain *>(theObject);
-            theSub->computeNodalResponse();
+            if(theSub->hasAnalysis())
+              theSub->computeNodalResponse();
             theSub->update();
           }
       }
@@ -1204,8 +1362,10 @@ int XC::PartitionedDomain::setPartitioner(DomainPartitioner *thePartitioner)
 
 //! @brief Triggers the partition of the domain.
 //! 
-//! Method which first checks that subdomains with tags 1 through \p
-//! numPartitions exist in the PartitionedDomain. Then it invokes
+//! Method which first creates the subdomains with tags 1 through \p
+//! numPartitions that don't exist in the PartitionedDomain yet. If no
+//! partitioner has been set, a DomainPartitioner using a
+//! Metis graph partitioner is used. Then it invokes
 //! {\em setPartitionedDomain(*this)} on the DomainPartitioner
 //! and finally it returns the result of invoking {\em partition(numPartitions}
 //! on the DomainPartitioner, which will return 0 if succesfull, a negative
@@ -1218,8 +1378,22 @@ int XC::PartitionedDomain::partition(int numPartitions, bool usingMain, int main
     //const Graph &theEleGraph= getElementGraph();
     getElementGraph(); //But this is Ok, isn't it?
 
+    // create the subdomains that don't exist yet.
+    result= create_subdomains(numPartitions,(usingMain ? mainPartitionID : 0));
+    if(result != 0)
+      return result;
+
     // now we call partition on the domainPartitioner which does the partitioning
     DomainPartitioner *thePartitioner= this->getPartitioner();
+    if(!thePartitioner) // no partitioner set, use METIS.
+      {
+        if(!defaultDomainPartitioner)
+          {
+            defaultGraphPartitioner= new Metis();
+            defaultDomainPartitioner= new DomainPartitioner(*defaultGraphPartitioner);
+          }
+        thePartitioner= defaultDomainPartitioner;
+      }
     if(thePartitioner != 0)
       {
         thePartitioner->setPartitionedDomain(*this);
@@ -1261,6 +1435,25 @@ int XC::PartitionedDomain::partition(int numPartitions, bool usingMain, int main
     return result;
   }
 
+//! @brief Creates the subdomains with tags 1 through \p numPartitions
+//! (except the main partition) that don't exist yet.
+int XC::PartitionedDomain::create_subdomains(int numPartitions, int mainPartitionID)
+  {
+    for(int i=1; i<=numPartitions; i++)
+      if((i != mainPartitionID) && !getSubdomainPtr(i))
+        {
+          Subdomain *theSub= new Subdomain(i,getOutputHandlers(),this);
+          if(!addSubdomain(theSub))
+            {
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; can't add subdomain: " << i << std::endl;
+              delete theSub;
+              return -1;
+            }
+        }
+    return 0;
+  }
+
 //! @brief Adds the subdomain pointed to by theSubdomainPtr to the domain.
 //!
 //! Adds the subdomain pointed to by theSubdomainPtr to the domain. The domain
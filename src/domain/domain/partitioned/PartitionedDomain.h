@@ -77,6 +77,7 @@ class ArrayOfTaggedObjects;
 class PartitionedDomainSubIter;
 class PartitionedDomainEleIter;
 class SingleDomEleIter;
+class GraphPartitioner;
 
 //! @brief Partitioned domain (aggregation of subdomains).
 //! 
@@ -93,6 +94,8 @@ class PartitionedDomain: public Domain
     TaggedObjectStorage  *elements;    
     ArrayOfTaggedObjects *theSubdomains;
     DomainPartitioner    *theDomainPartitioner;
+    GraphPartitioner    *defaultGraphPartitioner; //!< graph partitioner used when no partitioner has been set.
+    DomainPartitioner    *defaultDomainPartitioner; //!< domain partitioner used when no partitioner has been set.
 
     SingleDomEleIter	       *mainEleIter;  // for ele that belong to elements
     PartitionedDomainSubIter   *theSubdomainIter;
@@ -101,6 +104,8 @@ class PartitionedDomain: public Domain
     Graph mySubdomainGraph; //! Grafo de conectividad de subdomains.
     void alloc(void);
     void free_mem(void);
+    void free_default_partitioner(void);
+    int create_subdomains(int numPartitions, int mainPartitionID);
   protected:
     int barrierCheck(int result);
     DomainPartitioner *getPartitioner(void) const;
@@ -153,6 +158,10 @@ class PartitionedDomain: public Domain
     virtual  int revertToLastCommit(void);        
     virtual  int revertToStart(void);    
     virtual  int update(void);        
+    virtual  int update(ThreadPool &);
+    int threadedUpdate(int numThreads);
+    int condense(ThreadPool &);
+    int threadedCondense(int numThreads);
     virtual  int update(double newTime, double dT);
     virtual  int newStep(double dT);
 
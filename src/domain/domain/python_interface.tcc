@@ -29,6 +29,15 @@ class_<XC::PseudoTimeTracker, bases<XC::MovableObject>, boost::noncopyable >("Ps
   
   ;
 
+class_<XC::DomainSnapshots, bases<XC::MemoryDatastore>, boost::noncopyable >("DomainSnapshots", no_init)
+  .def("take",&XC::DomainSnapshots::take,"take(tag): store the current state of the domain in the snapshot identified by tag.")
+  .def("restore",&XC::DomainSnapshots::restore,"restore(tag): restore the state of the domain stored in the snapshot identified by tag.")
+  .def("exists",&XC::DomainSnapshots::exists,"exists(tag): return true if the snapshot exists.")
+  .def("remove",&XC::DomainSnapshots::remove,"remove(tag): remove the snapshot identified by tag.")
+  .def("clearAll",&XC::DomainSnapshots::clearAll,"Remove all the snapshots.")
+  .add_property("numSnapshots",&XC::DomainSnapshots::getNumSnapshots,"Return the number of stored snapshots.")
+  ;
+
 XC::Mesh &(XC::Domain::*getMeshRef)(void)= &XC::Domain::getMesh;
 XC::Preprocessor *(XC::Domain::*getPreprocessor)(void)= &XC::Domain::getPreprocessor;
 XC::ConstrContainer &(XC::Domain::*getConstraintsRef)(void)= &XC::Domain::getConstraints;
@@ -43,7 +52,30 @@ class_<XC::Domain, bases<XC::ObjWithRecorders>, boost::noncopyable >("Domain", n
   .def("revertToStart",&XC::Domain::revertToStart)  
   .def("setLoadConstant",&XC::Domain::setLoadConstant,"sets currents load patterns as constant in time.")  
   .def("setTime",&XC::Domain::setTime,"sets the time on the time tracker.")  
+  .add_property("getSnapshots", make_function( &XC::Domain::getSnapshots, return_internal_reference<>() ),"returns the in-memory snapshots of the domain state.")
+  .def("takeSnapshot",&XC::Domain::takeSnapshot,"takeSnapshot(tag): store the current state of the domain (nodes, elements, load pattern factors and pseudo-time) in memory.")
+  .def("restoreSnapshot",&XC::Domain::restoreSnapshot,"restoreSnapshot(tag): restore the state of the domain stored by takeSnapshot.")
   .def("setRayleighDampingFactors",&XC::Domain::setRayleighDampingFactors,"sets the Rayleigh damping factors.")  
   .def("calculateNodalReactions",&XC::Domain::calculateNodalReactions,"triggers nodal reaction calculation.")  
   .def("checkNodalReactions",&XC::Domain::checkNodalReactions,"checkNodalReactions(tolerande): check that reactions at nodes correspond to constrained degrees of freedom.")  
   ;
+
+XC::Node *(XC::Subdomain::*getSubdomainNode)(int)= &XC::Subdomain::getNode;
+class_<XC::Subdomain, bases<XC::Domain>, boost::noncopyable >("Subdomain", no_init)
+  .def("getNode", make_function(getSubdomainNode, return_internal_reference<>() ),"getNode(tag): return the internal or external node with the given identifier.")
+  .add_property("numExternalNodes", &XC::Subdomain::getNumExternalNodes,"Return the number of nodes shared with other subdomains.")
+  .add_property("hasAnalysis", &XC::Subdomain::hasAnalysis,"Return true if the subdomain has its own analysis.")
+  .def("isThreadSafe", &XC::Subdomain::isThreadSafe,"Return true if the subdomain can be updated concurrently with the other ones.")
+  .def("getExternalNodes", make_function(&XC::Subdomain::getExternalNodes, return_internal_reference<>() ),"Return the identifiers of the nodes shared with other subdomains.")
+  .add_property("numDOF", &XC::Subdomain::getNumDOF,"Return the number of degrees of freedom of the external nodes (zero if the subdomain has no analysis).")
+  .def("newStaticCondensationAnalysis", &XC::Subdomain::newStaticCondensationAnalysis,"Create an analysis that condenses the stiffness of the subdomain on its external nodes.")
+  .def("getTang", make_function(&XC::Subdomain::getTang, return_internal_reference<>() ),"Return the tangent stiffness condensed on the degrees of freedom of the external nodes.")
+  ;
+
+class_<XC::PartitionedDomain, bases<XC::Domain>, boost::noncopyable >("PartitionedDomain", no_init)
+  .def("partition", &XC::PartitionedDomain::partition,"partition(numPartitions, usingMain, mainPartitionID): split the elements of the domain in subdomains with tags 1 through numPartitions.")
+  .add_property("numSubdomains", &XC::PartitionedDomain::getNumSubdomains,"Return the number of subdomains.")
+  .def("getSubdomain", make_function(&XC::PartitionedDomain::getSubdomainPtr, return_internal_reference<>() ),"getSubdomain(tag): return the subdomain with the given identifier.")
+  .def("update", &XC::PartitionedDomain::threadedUpdate,"update(numThreads): update the state of the domain, the thread safe subdomains are updated concurrently.")
+  .def("condense", &XC::PartitionedDomain::threadedCondense,"condense(numThreads): compute the condensed tangent stiffness of the subdomains that have an analysis, the thread safe ones concurrently.")
+  ;
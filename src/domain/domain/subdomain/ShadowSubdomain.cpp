@@ -836,6 +836,10 @@ void XC::ShadowSubdomain::setLoadConstant(void)
   }
 
 
+//! @brief The update is done in the remote process.
+int XC::ShadowSubdomain::update(ThreadPool &)
+  { return update(); }
+
 int XC::ShadowSubdomain::update(void)
   {
   DomainDecompositionAnalysis *theDDA = this->getDDAnalysis();
@@ -1194,6 +1198,11 @@ int XC::ShadowSubdomain::newStep(double dT)
   }
 
 
+//! @brief The communication with the remote process through the
+//! channel can't be shared between threads.
+bool XC::ShadowSubdomain::isThreadSafe(void) const
+  { return false; }
+
 double XC::ShadowSubdomain::getCost(void)
   {
   /*
@@ -177,6 +177,7 @@ class ShadowSubdomain: public Shadow, public Subdomain
     virtual  void setLoadConstant(void);    
 
     virtual  int update(void);    
+    virtual  int update(ThreadPool &);
     virtual  int update(double newTime, double dT);    
     virtual  int commit(void);
     virtual  int revertToLastCommit(void);    
@@ -204,6 +205,7 @@ class ShadowSubdomain: public Shadow, public Subdomain
 
     virtual const Matrix &getTang(void);    
     virtual const Vector &getResistingForce(void) const;    
+    virtual bool isThreadSafe(void) const;
 
     virtual int  computeTang(void);
     virtual int  computeResidual(void);
@@ -64,12 +64,17 @@
 
 #include <domain/component/DomainComponent.h>
 #include <domain/mesh/element/Element.h>
+#include "domain/mesh/element/ElementIter.h"
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
 #include <domain/mesh/node/Node.h>
 #include <domain/constraints/SFreedom_Constraint.h>
 #include <domain/constraints/MFreedom_Constraint.h>
 #include <utility/tagged/storage/ArrayOfTaggedObjects.h>
-#include <solution/analysis/analysis/DomainDecompositionAnalysis.h>
+#include <solution/analysis/analysis/SubstructuringAnalysis.h>
+#include "solution/analysis/ModelWrapper.h"
+#include "solution/AnalysisAggregation.h"
+#include <solution/analysis/numberer/DOF_Numberer.h>
+#include <solution/system_of_eqn/linearSOE/DomainSolver.h>
 #include <solution/analysis/model/fe_ele/FE_Element.h>
 #include <domain/domain/single/SingleDomNodIter.h>
 #include "classTags.h"
@@ -79,6 +84,7 @@
 #include <solution/analysis/algorithm/equiSolnAlgo/EquiSolnAlgo.h>
 #include <solution/analysis/integrator/IncrementalIntegrator.h>
 #include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <solution/analysis/model/AnalysisModel.h>
 
 #include <solution/analysis/model/fe_ele/FE_Element.h>
 #include "utility/matrix/Matrix.h"
@@ -104,7 +110,8 @@ XC::Subdomain::Subdomain(int tag,DataOutputHandler::map_output_handlers *oh,Comm
  :Element(tag,ELE_TAG_Subdomain),
   Domain(owr,oh),
   realCost(0.0),cpuCost(0.0),pageCost(0),
-  theAnalysis(nullptr), extNodes(nullptr), theFEele(nullptr),
+  theAnalysis(nullptr), theModelWrapper(nullptr),
+  theAnalysisAggregation(nullptr), extNodes(nullptr), theFEele(nullptr),
   thePartitionedModelBuilder(nullptr),
   mapBuilt(false),map(0),mappedVect(0),mappedMatrix(0)
   {
@@ -129,9 +136,20 @@ XC::Subdomain::Subdomain(int tag,DataOutputHandler::map_output_handlers *oh,Comm
       }
   }
 
+//! @brief Virtual constructor. A subdomain owns its nodes, elements
+//! and analysis so it can't be copied; it prints an error message and
+//! returns a null pointer.
+XC::Element *XC::Subdomain::getCopy(void) const
+  {
+    std::cerr << Domain::getClassName() << "::" << __FUNCTION__
+              << "; subdomains can't be copied.\n";
+    return nullptr;
+  }
+
 //! @brief Destructor.
 XC::Subdomain::~Subdomain(void)
   {
+    wipeAnalysis();
     if(internalNodes) delete internalNodes;
     if(externalNodes) delete externalNodes;
     if(internalNodeIter) delete internalNodeIter;
@@ -421,13 +439,71 @@ XC::NodeIter &XC::Subdomain::getExternalNodeIter(void) const
 
 
 
+//! @brief Deletes the analysis of the subdomain (and its solution
+//! method if it was created by newStaticCondensationAnalysis).
 void XC::Subdomain::wipeAnalysis(void)
   {
     if(theAnalysis)
       {
-        theAnalysis->clearAll();
         delete theAnalysis;
+        theAnalysis= nullptr;
+      }
+    if(theAnalysisAggregation)
+      {
+        delete theAnalysisAggregation;
+        theAnalysisAggregation= nullptr;
+      }
+    if(theModelWrapper)
+      {
+        delete theModelWrapper;
+        theModelWrapper= nullptr;
+      }
+    mapBuilt= false;
+  }
+
+//! @brief Creates an analysis that condenses the stiffness of the
+//! subdomain on the degrees of freedom of its external nodes
+//! (substructuring solver on a profile SOE). The subdomain owns
+//! the analysis and its solution method. Returns 0 if successful.
+int XC::Subdomain::newStaticCondensationAnalysis(void)
+  {
+    wipeAnalysis();
+    theModelWrapper= new ModelWrapper();
+    theModelWrapper->newConstraintHandler("plain_handler");
+    theModelWrapper->newNumberer("default_numberer").useAlgorithm("rcm");
+    theAnalysisAggregation= new AnalysisAggregation(nullptr,theModelWrapper);
+    theAnalysisAggregation->newSolutionAlgorithm("domain_decomp_algo");
+    theAnalysisAggregation->newIntegrator("load_control_integrator",Vector());
+    LinearSOE *theSOE= dynamic_cast<LinearSOE *>(&theAnalysisAggregation->newSystemOfEqn("profile_spd_lin_soe"));
+    DomainSolver *theSolver= nullptr;
+    if(theSOE)
+      theSolver= dynamic_cast<DomainSolver *>(&theSOE->newSolver("profile_spd_lin_substr_solver"));
+    if(!theSolver)
+      {
+        std::cerr << Domain::getClassName() << "::" << __FUNCTION__
+		  << "; can't create the substructuring solver.\n";
+        wipeAnalysis();
+        return -1;
       }
+    // the constructor calls setDomainDecompAnalysis.
+    SubstructuringAnalysis *tmp= new SubstructuringAnalysis(*this,*theSolver,theAnalysisAggregation);
+    theAnalysisAggregation->set_owner(tmp);
+    this->domainChange(); // number the DOFs on first use.
+    return 0;
+  }
+
+//! @brief Updates the analysis if the subdomain has changed since
+//! the last call. Returns true in that case.
+bool XC::Subdomain::update_analysis(void) const
+  {
+    bool retval= false;
+    if(theAnalysis)
+      {
+        retval= theAnalysis->checkDomainChange();
+        if(retval)
+          mapBuilt= false;
+      }
+    return retval;
   }
 
 //! @brief Sets the corresponding DomainDecompositionAnalysis object to be {\em
@@ -541,7 +617,10 @@ const XC::ID &XC::Subdomain::getExternalNodes(void) const
 int XC::Subdomain::getNumDOF(void) const
   {
     if(theAnalysis)
-      return theAnalysis->getNumExternalEqn();
+      {
+        update_analysis();
+        return theAnalysis->getNumExternalEqn();
+      }
     else
       {
         //   std::cerr << Domain::getClassName() << "::" << __FUNCTION__
@@ -554,7 +633,7 @@ int XC::Subdomain::getNumDOF(void) const
 int XC::Subdomain::commitState(void)
   { return this->commit(); }
 
-const XC::Matrix &XC::Subdomain::getTangentStiff(void)
+const XC::Matrix &XC::Subdomain::getTangentStiff(void) const
   {
     std::cerr << Domain::getClassName() << "::" << __FUNCTION__
 	      << "; DOES NOT DO ANYTHING";
@@ -564,7 +643,7 @@ const XC::Matrix &XC::Subdomain::getTangentStiff(void)
 //! @brief For this class does nothing but print an error message. Subtypes may
 //! provide a condensed stiffness matrix, \f$T^tKT\f$ corresponding to
 //! external nodes. Returns a zero matrix of dimensions (1x1).
-const XC::Matrix &XC::Subdomain::getInitialStiff(void)
+const XC::Matrix &XC::Subdomain::getInitialStiff(void) const
   {
     std::cerr << Domain::getClassName() << "::" << __FUNCTION__
 	      << "; DOES NOT DO ANYTHING."
@@ -576,7 +655,7 @@ const XC::Matrix &XC::Subdomain::getInitialStiff(void)
 //! provide a condensed damping matrix, \f$T^tDT\f$ or a damping matrix
 //! corresponding to some comination of the condensed stifffness and mass
 //! matrices. Returns a zero matrix of dimensions (1x1).
-const XC::Matrix &XC::Subdomain::getDamp(void)
+const XC::Matrix &XC::Subdomain::getDamp(void) const
   {
     std::cerr << Domain::getClassName() << "::" << __FUNCTION__
 	      << "; DOES NOT DO ANYTHING"
@@ -587,7 +666,7 @@ const XC::Matrix &XC::Subdomain::getDamp(void)
 //! For this class does nothing but print an error message. Subtypes may
 //! provide a condensed mass matrix, \f$T^tMT\f$ or a mass matrix with zero
 //! diag elements. Returns a zero matrix of dimensions (1x1).
-const XC::Matrix &XC::Subdomain::getMass(void)
+const XC::Matrix &XC::Subdomain::getMass(void) const
   {
     std::cerr << Domain::getClassName() << "::" << __FUNCTION__
 	      << "; DOES NOT DO ANYTHING"
@@ -627,6 +706,7 @@ const XC::Vector &XC::Subdomain::getResistingForce(void) const
         exit(-1);
       }
 
+    update_analysis();
     if(!mapBuilt)
       this->buildMap();
 
@@ -660,6 +740,44 @@ const XC::Vector &XC::Subdomain::getResistingForceIncInertia(void) const
 bool XC::Subdomain::isSubdomain(void)
   { return true; }
 
+//! @brief Return true if the subdomain can be analyzed (condensation
+//! of the tangent and the residual, state update and computation of the
+//! internal response) concurrently with the other subdomains. That is
+//! the case if all its elements are thread safe (see
+//! Element::isThreadSafe); its analysis, if any, uses its own storage
+//! (see setPrivateStorage). A subdomain without analysis only updates
+//! the state of its elements.
+bool XC::Subdomain::isThreadSafe(void) const
+  {
+    bool retval= true;
+    ElementIter &theEles= const_cast<Subdomain *>(this)->getElements();
+    Element *theEle= nullptr;
+    while((theEle= theEles()) != nullptr)
+      if(!theEle->isThreadSafe())
+        {
+          retval= false;
+          break;
+        }
+    return retval;
+  }
+
+//! @brief Makes the FE_Elements and DOF_Groups of the subdomain
+//! analysis use their own tangent and residual storage, so the
+//! analysis can run concurrently with those of other subdomains
+//! (see AnalysisModel::setPrivateStorage). If the subdomain has
+//! changed the analysis is updated here, because creating
+//! FE_Elements and DOF_Groups is not thread safe.
+void XC::Subdomain::setPrivateStorage(void)
+  {
+    if(theAnalysis)
+      {
+        AnalysisModel *theModel= theAnalysis->getAnalysisModelPtr();
+        if(theModel)
+          theModel->setPrivateStorage();
+        update_analysis();
+      }
+  }
+
 
 int XC::Subdomain::setRayleighDampingFactors(const RayleighDampingFactors &rF)
   { return Domain::setRayleighDampingFactors(rF); }
@@ -673,9 +791,16 @@ int XC::Subdomain::computeTang(void)
     if(theAnalysis)
       {
         theTimer.start();
+        update_analysis();
 
         int res =0;
         res = theAnalysis->formTangent();
+
+        theTimer.pause();
+        realCost += theTimer.getReal();
+        cpuCost += theTimer.getCPU();
+        pageCost += theTimer.getNumPageFaults();
+
         return res;
       }
     else
@@ -695,6 +820,7 @@ int XC::Subdomain::computeResidual(void)
     if(theAnalysis)
       {
         theTimer.start();
+        update_analysis();
 
         int res =0;
         res = theAnalysis->formResidual();
@@ -725,6 +851,7 @@ const XC::Matrix &XC::Subdomain::getTang(void)
         exit(-1);
       }
 
+    update_analysis();
     if(mapBuilt == false)
         this->buildMap();
 
@@ -768,6 +895,7 @@ const XC::Vector &XC::Subdomain::getLastExternalSysResponse(void)
     // get the response from the FE_ele for the nodal
     // quantities - WARNING this is expressed in global dof
 
+    update_analysis();
     if(mapBuilt == false)
       this->buildMap();
 
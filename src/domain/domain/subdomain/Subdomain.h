@@ -80,6 +80,8 @@ class IncrementalIntegrator;
 class LinearSOE;
 class ConvergenceTest;
 class FE_Element;
+class ModelWrapper;
+class AnalysisAggregation;
 
 //! @ingroup Dom
 //!
@@ -106,6 +108,8 @@ class Subdomain: public Element, public Domain
     int pageCost;
     Timer theTimer;
     DomainDecompositionAnalysis *theAnalysis;
+    ModelWrapper *theModelWrapper; //!< model of the condensation analysis (if owned).
+    AnalysisAggregation *theAnalysisAggregation; //!< solution method of the condensation analysis (if owned).
     mutable ID *extNodes;
     FE_Element *theFEele;
 
@@ -115,6 +119,7 @@ class Subdomain: public Element, public Domain
 
     PartitionedModelBuilder *thePartitionedModelBuilder;
     static Matrix badResult;
+    bool update_analysis(void) const;
   protected:
     virtual int buildMap(void) const;
     mutable bool mapBuilt;
@@ -130,6 +135,7 @@ class Subdomain: public Element, public Domain
     DomainDecompositionAnalysis *getDDAnalysis(void);
   public:
     Subdomain(int tag,DataOutputHandler::map_output_handlers *oh,CommandEntity *owr);
+    Element *getCopy(void) const;
 
     virtual ~Subdomain(void);
 
@@ -169,6 +175,7 @@ class Subdomain: public Element, public Domain
     virtual bool addExternalNode(Node *);
 
     virtual void wipeAnalysis(void);
+    int newStaticCondensationAnalysis(void);
     virtual void setDomainDecompAnalysis(DomainDecompositionAnalysis &theAnalysis);
     virtual int setAnalysisAlgorithm(EquiSolnAlgo &theAlgorithm);
     virtual int setAnalysisIntegrator(IncrementalIntegrator &theIntegrator);
@@ -183,10 +190,10 @@ class Subdomain: public Element, public Domain
 
     virtual int commitState(void);
 
-    virtual const Matrix &getTangentStiff(void);
-    virtual const Matrix &getInitialStiff(void);
-    virtual const Matrix &getDamp(void);
-    virtual const Matrix &getMass(void);
+    virtual const Matrix &getTangentStiff(void) const;
+    virtual const Matrix &getInitialStiff(void) const;
+    virtual const Matrix &getDamp(void) const;
+    virtual const Matrix &getMass(void) const;
 
     virtual void  zeroLoad(void);
     virtual int addLoad(ElementalLoad *theLoad, double loadFactor);
@@ -195,6 +202,11 @@ class Subdomain: public Element, public Domain
     virtual const Vector &getResistingForce(void) const;
     virtual const Vector &getResistingForceIncInertia(void) const;
     virtual bool isSubdomain(void);
+    virtual bool isThreadSafe(void) const;
+    //! @brief Return true if the subdomain has its own analysis.
+    inline bool hasAnalysis(void) const
+      { return (theAnalysis!=nullptr); }
+    void setPrivateStorage(void);
     virtual int setRayleighDampingFactors(const RayleighDampingFactors &rF);
 
     // Element type methods unique to a subdomain
@@ -294,6 +294,7 @@ bool XC::LoadPattern::addSFreedom_Constraint(SFreedom_Constraint *theSp)
 void XC::LoadPattern::clearLoads(void)
   {
     theLoads.clearAll();
+    currentGeoTag++;
   }
 
 //! @brief Deletes all loads, constraints AND pointer to time series.
@@ -348,6 +349,11 @@ void XC::LoadPattern::setLoadConstant(void)
 const double &XC::LoadPattern::getLoadFactor(void) const
   { return loadFactor; }
 
+//! @brief Sets the weighting factor obtained from the TimeSeries object
+//! (used when restoring a snapshot of the domain state).
+void XC::LoadPattern::setLoadFactor(const double &f)
+  { loadFactor= f; }
+
 //! @brief Returns the weighting factor set by the load combination.
 const double &XC::LoadPattern::GammaF(void) const
   { return gamma_f; }
@@ -171,6 +171,7 @@ class LoadPattern: public NodeLocker
     inline void setDescription(const std::string &d)
       { description= d; }
     virtual const double &getLoadFactor(void) const;
+    void setLoadFactor(const double &);
     const double &GammaF(void) const;
     double &GammaF(void);
     void setGammaF(const double &);
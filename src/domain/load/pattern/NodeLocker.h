@@ -79,6 +79,10 @@ class NodeLocker: public ForceReprComponent
 
     virtual SFreedom_ConstraintIter &getSPs(void);
     int getNumSPs(void) const;
+    //! @brief Return the counter of changes in the loads or
+    //! constraints of the object.
+    inline int getCurrentGeoTag(void) const
+      { return currentGeoTag; }
 
     // methods to remove loads
     virtual void clearAll(void);
@@ -52,6 +52,10 @@
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
 
 #include "utility/actor/actor/MovableVector.h"
+#include "utility/ThreadPool.h"
+#include "domain/mesh/ResultTables.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
 
 //! @brief Frees memory occupied by mesh components.
 //! this calls delete on all components of the model,
@@ -113,7 +117,7 @@ void XC::Mesh::init_bounds(void)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr)
   :MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-   theBounds(6), lockers(this)
+   theBounds(6), lockers(this), contiguousNodalState(false)
   {
     alloc_containers();
     alloc_iters();
@@ -125,7 +129,8 @@ XC::Mesh::Mesh(CommandEntity *owr)
 //! @brief Constructor.
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObjectStorage &theElementsStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh), eleGraphBuiltFlag(false),
-    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this)
+    nodeGraphBuiltFlag(false), theNodes(&theNodesStorage), theElements(&theElementsStorage), theBounds(6), lockers(this),
+    contiguousNodalState(false)
   {
     // init the iters
     alloc_iters();
@@ -144,7 +149,7 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theNodesStorage,TaggedObj
 XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
   : MeshComponentContainer(owr,DOMAIN_TAG_Mesh),
     eleGraphBuiltFlag(false), nodeGraphBuiltFlag(false),
-    theBounds(6), lockers(this)
+    theBounds(6), lockers(this), contiguousNodalState(false)
   {
     // init the arrays for storing the mesh components
     theStorage.clearAll(); // clear the storage just in case populated
@@ -166,6 +171,7 @@ XC::Mesh::Mesh(CommandEntity *owr,TaggedObjectStorage &theStorage)
 //!  casting a XC::MeshComponent from theElements to an XC::Element is o.k.
 void XC::Mesh::clearAll(void)
   {
+    nodalState.release();
     // clean out the containers
     if(theElements) theElements->clearAll();
     if(theNodes) theNodes->clearAll();
@@ -321,6 +327,7 @@ void XC::Mesh::add_nodes_to_domain(void)
 //! node was added, otherwise an error is printed and false is returned.
 bool XC::Mesh::addNode(Node * node)
   {
+    nodalState.release(); // Will be packed again on next commit.
     int nodTag = node->getTag();
 
     TaggedObject *other = theNodes->getComponentPtr(nodTag);
@@ -379,23 +386,40 @@ bool XC::Mesh::removeElement(int tag)
 //! domainChange()} on itself before a pointer to the Node is returned. 
 bool XC::Mesh::removeNode(int tag)
   {
+    nodalState.release(); // Will be packed again on next commit.
+
+    // remove the node from the kd-tree before the container
+    // deletes it.
+    Node *nod= dynamic_cast<Node *>(theNodes->getComponentPtr(tag));
+    if(nod) kdtreeNodes.erase(*nod);
 
     // remove the object from the container
     bool res= theNodes->removeComponent(tag);
 
     if(res)
       {
-        Domain *dom= getDomain();
-
-        Node *nod= dom->getNode(tag);
-        if(nod) kdtreeNodes.erase(*nod);
-
         // mark the domain has having changed
-        dom->domainChange();
+        getDomain()->domainChange();
       }
     return res;
   }
 
+//! @brief Sets the storage of the nodal state (coordinates, displacements,
+//! velocities, accelerations and unbalanced loads).
+//!
+//! If true the state of all the nodes is stored in a few contiguous
+//! arrays (see NodalStateArrays) that are populated on the next commit
+//! (and again after nodes are added or removed); otherwise each node
+//! owns its vectors.
+void XC::Mesh::setContiguousNodalState(const bool &b)
+  {
+    contiguousNodalState= b;
+    if(contiguousNodalState)
+      nodalState.pack(*this);
+    else
+      nodalState.release();
+  }
+
 //! @brief Clears the pointers to node DOF groups.
 void XC::Mesh::clearDOF_GroupPtr(void)
   {
@@ -771,10 +795,19 @@ int XC::Mesh::setRayleighDampingFactors(const RayleighDampingFactors &rF)
 int XC::Mesh::commit(void)
   {
     // invoke commit on all nodes and elements in the mesh
-    Node *nodePtr= nullptr;
-    NodeIter &theNodeIter = this->getNodes();
-    while((nodePtr = theNodeIter()) != 0)
-      { nodePtr->commitState(); }
+    if(contiguousNodalState)
+      {
+        if(!nodalState.isPacked())
+          nodalState.pack(*this);
+        nodalState.commit(); // sweep the nodal state arrays.
+      }
+    else
+      {
+        Node *nodePtr= nullptr;
+        NodeIter &theNodeIter = this->getNodes();
+        while((nodePtr = theNodeIter()) != 0)
+          { nodePtr->commitState(); }
+      }
 
     Element *elePtr= nullptr;
     ElementIter &theElemIter = this->getElements();
@@ -845,6 +878,39 @@ int XC::Mesh::update(void)
     return ok;
   }
 
+//! @brief Updates the state of the elements. The thread safe
+//! ones (see Element::isThreadSafe) are updated concurrently
+//! using the threads of the pool.
+int XC::Mesh::update(ThreadPool &pool)
+  {
+    int ok = 0;
+
+    std::vector<Element *> threadSafeEles;
+    ElementIter &theEles = this->getElements();
+    Element *theEle;
+    while((theEle = theEles()) != 0)
+      {
+        if(theEle->isThreadSafe())
+          threadSafeEles.push_back(theEle);
+        else
+          ok += theEle->update();
+      }
+
+    std::atomic<int> err(0);
+    pool.parallel_for(threadSafeEles.size(),[&](const size_t &i,const size_t &)
+      {
+        const int res= threadSafeEles[i]->update();
+        if(res != 0)
+          err+= res;
+      });
+    ok+= err;
+
+    if(ok != 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; mesh failed in update.\n";
+    return ok;
+  }
+
 
 
 //! @brief Returns true if the modelo ha cambiado.
@@ -1190,4 +1256,61 @@ int XC::Mesh::calculateNodalReactions(bool inclInertia, const double &tol)
     return 0;
   }
 
+//! @brief Return the pointers to the nodes of the mesh.
+std::vector<const XC::Node *> XC::Mesh::get_node_ptrs(void)
+  {
+    std::vector<const Node *> retval;
+    retval.reserve(getNumNodes());
+    Node *theNode= nullptr;
+    NodeIter &theNodes= this->getNodes();
+    while((theNode = theNodes()) != nullptr)
+      retval.push_back(theNode);
+    return retval;
+  }
+
+//! @brief Return the pointers to the elements of the mesh.
+std::vector<const XC::Element *> XC::Mesh::get_element_ptrs(void)
+  {
+    std::vector<const Element *> retval;
+    retval.reserve(getNumElements());
+    Element *theElement= nullptr;
+    ElementIter &theElements= this->getElements();
+    while((theElement = theElements()) != nullptr)
+      retval.push_back(theElement);
+    return retval;
+  }
+
+//! @brief Return the tags of the nodes (in the order of the rows
+//! of the node tables).
+XC::ID XC::Mesh::getNodeTagsTable(void)
+  { return node_tags_table(get_node_ptrs()); }
+
+//! @brief Return a matrix whose rows are the coordinates of the nodes.
+XC::Matrix XC::Mesh::getNodeCoordinatesTable(void)
+  { return node_coordinates_table(get_node_ptrs()); }
+
+//! @brief Return a matrix whose rows are the displacements of the nodes.
+XC::Matrix XC::Mesh::getNodeDisplacementsTable(void)
+  { return node_disp_table(get_node_ptrs()); }
+
+//! @brief Return a matrix whose rows are the reactions of the nodes
+//! (see calculateNodalReactions).
+XC::Matrix XC::Mesh::getNodeReactionsTable(void)
+  { return node_reaction_table(get_node_ptrs()); }
+
+//! @brief Return the tags of the elements (in the order of the rows
+//! of the element tables).
+XC::ID XC::Mesh::getElementTagsTable(void)
+  { return element_tags_table(get_element_ptrs()); }
+
+//! @brief Return a matrix whose rows are the resisting forces
+//! of the elements.
+XC::Matrix XC::Mesh::getElementResistingForcesTable(void)
+  { return element_resisting_force_table(get_element_ptrs()); }
+
+//! @brief Return a matrix with the generalized stresses on each
+//! integration point of the elements (see element_generalized_stress_table).
+XC::Matrix XC::Mesh::getElementGeneralizedStressesTable(void)
+  { return element_generalized_stress_table(get_element_ptrs()); }
+
 
@@ -34,6 +34,7 @@
 #include "NodeLockers.h"
 #include "solution/graph/graph/Graph.h"
 #include "node/KDTreeNodes.h"
+#include "node/NodalStateArrays.h"
 #include "element/utils/KDTreeElements.h"
 
 class Pos3d;
@@ -53,6 +54,9 @@ class ElementGraph;
 class FEM_ObjectBroker;
 class TaggedObjectStorage;
 class RayleighDampingFactors;
+class ThreadPool;
+class ID;
+class Matrix;
 
 //! @ingroup Dom
 //
@@ -84,6 +88,8 @@ class Mesh: public MeshComponentContainer
     int tagNodeCheckReactionException;//!< Exception for checking reactions (see Domain::checkNodalReactions).
 
     NodeLockers lockers; //!< To block deactivated (dead) nodes.
+    bool contiguousNodalState; //!< if true, store the nodal state in contiguous arrays.
+    NodalStateArrays nodalState; //!< Contiguous storage of the nodal state (if contiguousNodalState).
 
     void alloc_containers(void);
     void alloc_iters(void);
@@ -94,6 +100,8 @@ class Mesh: public MeshComponentContainer
     void add_element_to_domain(Element *);
     void add_nodes_to_domain(void);
     void add_elements_to_domain(void);
+    std::vector<const Node *> get_node_ptrs(void);
+    std::vector<const Element *> get_element_ptrs(void);
 
     Mesh(const Mesh &otra);
     Mesh &operator=(const Mesh &otra);
@@ -123,6 +131,11 @@ class Mesh: public MeshComponentContainer
     void clearDOF_GroupPtr(void);
 
     void setGraphBuiltFlags(const bool &f);
+    void setContiguousNodalState(const bool &);
+    inline bool getContiguousNodalState(void) const
+      { return contiguousNodalState; }
+    inline const NodalStateArrays &getNodalStateArrays(void) const
+      { return nodalState; }
 
     int initialize(void);
     virtual int setRayleighDampingFactors(const RayleighDampingFactors &rF);
@@ -181,6 +194,7 @@ class Mesh: public MeshComponentContainer
     virtual int revertToLastCommit(void);
     virtual int revertToStart(void);
     int update(void);
+    int update(ThreadPool &);
 
     void freeze_dead_nodes(const std::string &nmbLocker);
     void melt_alive_nodes(const std::string &nmbLocker);
@@ -202,6 +216,15 @@ class Mesh: public MeshComponentContainer
 
     virtual int calculateNodalReactions(bool inclInertia, const double &);
 
+    // result tables (one row for each node or element)
+    ID getNodeTagsTable(void);
+    Matrix getNodeCoordinatesTable(void);
+    Matrix getNodeDisplacementsTable(void);
+    Matrix getNodeReactionsTable(void);
+    ID getElementTagsTable(void);
+    Matrix getElementResistingForcesTable(void);
+    Matrix getElementGeneralizedStressesTable(void);
+
     static void setDeadSRF(const double &);
   };
 
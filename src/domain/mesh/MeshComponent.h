@@ -42,14 +42,10 @@ class Matrix;
 //! @brief Base class for nodes and elements (mesh components).
 class MeshComponent: public ContinuaReprComponent
   {
-  private:
-    void check_matrices(const std::deque<Matrix> &,const int &) const;
-    void new_matrix(std::deque<Matrix> &,const int &) const;
   protected:
     mutable int index; //!< Index for VTK arrays.
     LabelContainer labels; //!< Label container.
 
-    void setup_matrices(std::deque<Matrix> &,const int &) const;
     int sendIdsEtiquetas(int posDbTag,CommParameters &);
     int recvIdsEtiquetas(int posDbTag,const CommParameters &);
     int sendData(CommParameters &);
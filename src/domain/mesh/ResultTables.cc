@@ -0,0 +1,146 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultTables.cc
+
+#include "ResultTables.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/Element.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include <algorithm>
+
+namespace {
+
+//! @brief Writes the vector in the row of the matrix.
+inline void put_row(XC::Matrix &m,const int &row,const XC::Vector &v)
+  {
+    const int sz= std::min(v.Size(),m.noCols());
+    for(int j= 0;j<sz;j++)
+      m(row,j)= v(j);
+  }
+
+//! @brief Returns a matrix with one row for each node; each
+//! row contains the vector returned by the member function
+//! (padded with zeros if the nodes have different number of DOFs).
+template <class FUNC>
+XC::Matrix node_vector_table(const std::vector<const XC::Node *> &nodes,FUNC f)
+  {
+    const int numNodes= nodes.size();
+    int numCols= 0;
+    for(int i= 0;i<numNodes;i++)
+      numCols= std::max(numCols,f(*nodes[i]).Size());
+    XC::Matrix retval(numNodes,numCols);
+    for(int i= 0;i<numNodes;i++)
+      put_row(retval,i,f(*nodes[i]));
+    return retval;
+  }
+
+} // end of anonymous namespace
+
+//! @brief Returns the tags of the nodes.
+XC::ID XC::node_tags_table(const std::vector<const Node *> &nodes)
+  {
+    const int numNodes= nodes.size();
+    ID retval(numNodes);
+    for(int i= 0;i<numNodes;i++)
+      retval[i]= nodes[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns a matrix whose rows are the coordinates
+//! of the nodes.
+XC::Matrix XC::node_coordinates_table(const std::vector<const Node *> &nodes)
+  { return node_vector_table(nodes,[](const Node &n) -> const Vector & { return n.getCrds(); }); }
+
+//! @brief Returns a matrix whose rows are the trial displacements
+//! of the nodes.
+XC::Matrix XC::node_disp_table(const std::vector<const Node *> &nodes)
+  { return node_vector_table(nodes,[](const Node &n) -> const Vector & { return n.getTrialDisp(); }); }
+
+//! @brief Returns a matrix whose rows are the reactions
+//! of the nodes (see Mesh::calculateNodalReactions).
+XC::Matrix XC::node_reaction_table(const std::vector<const Node *> &nodes)
+  { return node_vector_table(nodes,[](const Node &n) -> const Vector & { return n.getReaction(); }); }
+
+//! @brief Returns the tags of the elements.
+XC::ID XC::element_tags_table(const std::vector<const Element *> &elements)
+  {
+    const int numElements= elements.size();
+    ID retval(numElements);
+    for(int i= 0;i<numElements;i++)
+      retval[i]= elements[i]->getTag();
+    return retval;
+  }
+
+//! @brief Returns a matrix whose rows are the resisting forces
+//! of the elements expressed in global coordinates (padded with
+//! zeros if the elements have different number of DOFs).
+XC::Matrix XC::element_resisting_force_table(const std::vector<const Element *> &elements)
+  {
+    const int numElements= elements.size();
+    int numCols= 0;
+    for(int i= 0;i<numElements;i++)
+      numCols= std::max(numCols,elements[i]->getNumDOF());
+    Matrix retval(numElements,numCols);
+    for(int i= 0;i<numElements;i++)
+      put_row(retval,i,elements[i]->getResistingForce());
+    return retval;
+  }
+
+//! @brief Returns a matrix with a row for each integration point
+//! (material or section) of the elements. The first column contains
+//! the element tag, the second one the index of the integration
+//! point and the rest the generalized stresses (internal forces
+//! for sections) on it (see Element::getGeneralizedStresses).
+XC::Matrix XC::element_generalized_stress_table(const std::vector<const Element *> &elements)
+  {
+    const int numElements= elements.size();
+    std::vector<Matrix> stresses(numElements);
+    int numRows= 0, numCols= 0;
+    for(int i= 0;i<numElements;i++)
+      {
+        stresses[i]= elements[i]->getGeneralizedStresses();
+        numRows+= stresses[i].noRows();
+        numCols= std::max(numCols,stresses[i].noCols());
+      }
+    Matrix retval(numRows,numCols+2);
+    int row= 0;
+    for(int i= 0;i<numElements;i++)
+      {
+        const Matrix &s= stresses[i];
+        const int tag= elements[i]->getTag();
+        for(int j= 0;j<s.noRows();j++,row++)
+          {
+            retval(row,0)= tag;
+            retval(row,1)= j;
+            for(int k= 0;k<s.noCols();k++)
+              retval(row,k+2)= s(j,k);
+          }
+      }
+    return retval;
+  }
@@ -0,0 +1,57 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultTables.h
+                                                                        
+#ifndef ResultTables_h
+#define ResultTables_h
+
+#include <vector>
+
+namespace XC {
+class Node;
+class Element;
+class ID;
+class Matrix;
+
+//! @ingroup Mesh
+//!
+//! @brief Functions that gather the results of a list of nodes
+//! or elements in a single matrix (one row for each node or element)
+//! so they can be retrieved from Python with only one call.
+
+ID node_tags_table(const std::vector<const Node *> &);
+Matrix node_coordinates_table(const std::vector<const Node *> &);
+Matrix node_disp_table(const std::vector<const Node *> &);
+Matrix node_reaction_table(const std::vector<const Node *> &);
+
+ID element_tags_table(const std::vector<const Element *> &);
+Matrix element_resisting_force_table(const std::vector<const Element *> &);
+Matrix element_generalized_stress_table(const std::vector<const Element *> &);
+
+} // end of XC namespace
+
+#endif
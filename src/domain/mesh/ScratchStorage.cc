@@ -0,0 +1,55 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ScratchStorage.cc
+
+#include "ScratchStorage.h"
+
+//! @brief Return a (n x n) scratch matrix.
+XC::Matrix &XC::ScratchStorage::getMatrix(const int &n)
+  {
+    map_matrices::iterator i= matrices.find(n);
+    if(i==matrices.end())
+      i= matrices.insert(map_matrices::value_type(n,Matrix(n,n))).first;
+    return i->second;
+  }
+
+//! @brief Return the i-th (0 or 1) scratch vector of dimension n.
+XC::Vector &XC::ScratchStorage::getVector(const int &n,const size_t &i)
+  {
+    map_vectors &v= vectors[i];
+    map_vectors::iterator j= v.find(n);
+    if(j==v.end())
+      j= v.insert(map_vectors::value_type(n,Vector(n))).first;
+    return j->second;
+  }
+
+//! @brief Return the scratch storage of the calling thread.
+XC::ScratchStorage &XC::ScratchStorage::get(void)
+  {
+    thread_local ScratchStorage retval;
+    return retval;
+  }
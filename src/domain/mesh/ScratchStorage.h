@@ -0,0 +1,63 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ScratchStorage.h
+                                                                        
+#ifndef ScratchStorage_h
+#define ScratchStorage_h
+
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/Vector.h"
+#include <map>
+
+namespace XC {
+
+//! @ingroup Mesh
+//! 
+//! @brief Per thread scratch matrices and vectors.
+//!
+//! Nodes and elements return by reference some results (damping
+//! matrix, resisting force including inertia,...) that are computed
+//! in temporary storage shared by all the objects with the same number
+//! of degrees of freedom. Each thread has its own instance of this
+//! storage (see get()) so the computations of different mesh components
+//! can run concurrently. The returned references remain valid until the
+//! same thread asks for another result of the same size.
+class ScratchStorage
+  {
+  private:
+    typedef std::map<int,Matrix> map_matrices;
+    typedef std::map<int,Vector> map_vectors;
+    map_matrices matrices; //!< Square matrices indexed by its size.
+    map_vectors vectors[2]; //!< Vectors indexed by its size.
+  public:
+    Matrix &getMatrix(const int &);
+    Vector &getVector(const int &,const size_t &i= 0);
+    static ScratchStorage &get(void);
+  };
+} // end of XC namespace
+
+#endif
@@ -63,6 +63,7 @@ class ElemWithMaterial : public ElementBase<NNODOS>
     void setPhysicalProperties(const PhysProp &);
     inline virtual std::set<std::string> getMaterialNames(void) const
       { return physicalProperties.getMaterialNames(); }
+    virtual Matrix getGeneralizedStresses(void) const;
   };
 
 template <int NNODOS,class PhysProp>
@@ -108,6 +109,12 @@ void ElemWithMaterial<NNODOS, PhysProp>::zeroInitialGeneralizedStrains(void)
     physicalProperties.getMaterialsVector().zeroInitialGeneralizedStrains();
   }
 
+//! @brief Return the generalized stresses on each integration point
+//! of the element (one row for each material).
+template <int NNODOS,class PhysProp>
+Matrix ElemWithMaterial<NNODOS, PhysProp>::getGeneralizedStresses(void) const
+  { return Element::generalized_stresses(physicalProperties.getMaterialsVector()); }
+
 template <int NNODOS,class PhysProp>
 void ElemWithMaterial<NNODOS, PhysProp>::setPhysicalProperties(const PhysProp &physProp)
   { physicalProperties= physProp; }
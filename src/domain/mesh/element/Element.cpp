@@ -86,10 +86,8 @@
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 #include "utility/actor/actor/CommMetaData.h"
 #include "vtkCellType.h"
+#include "domain/mesh/ScratchStorage.h"
 
-std::deque<XC::Matrix> XC::Element::theMatrices;
-std::deque<XC::Vector> XC::Element::theVectors1;
-std::deque<XC::Vector> XC::Element::theVectors2;
 double XC::Element::dead_srf= 1e-6;//Stiffness reduction factor for dead (non active) elements.
 XC::DefaultTag XC::Element::defaultTag;
 
@@ -99,7 +97,7 @@ XC::DefaultTag XC::Element::defaultTag;
 //! @param tag: element identifier.
 //! @param cTag: element class identifier.
 XC::Element::Element(int tag, int cTag)
-  :MeshComponent(tag, cTag), nodeIndex(-1), rayFactors() 
+  :MeshComponent(tag, cTag), rayFactors() 
   { defaultTag= tag+1; }
 
 //! @brief Returns next element's tag value by default.
@@ -145,21 +143,6 @@ int XC::Element::setRayleighDampingFactors(const RayleighDampingFactors &rF) con
   {
     rayFactors= rF;
 
-    // check that memory has been allocated to store compute/return
-    // damping matrix & residual force calculations
-    if(index == -1)
-      {
-        int numDOF = this->getNumDOF();
-
-        setup_matrices(theMatrices,numDOF);
-        if(theVectors1.size()<theMatrices.size())
-          {
-            Vector theVector1(numDOF);
-            Vector theVector2(numDOF);
-            theVectors1.push_back(theVector1);
-            theVectors2.push_back(theVector2);
-         }
-      }
     // if need storage for Kc go get it
     if(rayFactors.getBetaKc() != 0.0)
       Kc= Matrix(this->getTangentStiff());
@@ -230,11 +213,8 @@ void XC::Element::compute_damping_matrix(Matrix &theMatrix) const
 //! \f]
 const XC::Matrix &XC::Element::getDamp(void) const
   {
-    if(index == -1)
-      setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
-
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= ScratchStorage::get().getMatrix(getNumDOF());
     compute_damping_matrix(theMatrix);
     // return the computed matrix
     return theMatrix;
@@ -251,11 +231,8 @@ const XC::Matrix &XC::Element::getDamp(void) const
 //! \f]
 const XC::Matrix &XC::Element::getMass(void) const
   {
-    if(index  == -1)
-      setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
-
     // zero the matrix & return it
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= ScratchStorage::get().getMatrix(getNumDOF());
     theMatrix.Zero();
     return theMatrix;
   }
@@ -264,12 +241,11 @@ const XC::Matrix &XC::Element::getMass(void) const
 //! Computes damping matrix.
 const XC::Vector &XC::Element::getResistingForceIncInertia(void) const
   {
-    if(index == -1)
-      setRayleighDampingFactors(RayleighDampingFactors()); //Zeroes dumping factors.
-
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    const int numDOF= getNumDOF();
+    ScratchStorage &scratch= ScratchStorage::get();
+    Matrix &theMatrix= scratch.getMatrix(numDOF);
+    Vector &theVector= scratch.getVector(numDOF,1);
+    Vector &theVector2= scratch.getVector(numDOF,0);
 
     //
     // perform: R = P(U) - Pext(t);
@@ -387,13 +363,11 @@ XC::Matrix XC::Element::getEquivalentStaticNodalLoads(int mode,const double &acc
 //! @brief Returns element Rayleigh damping forces.
 const XC::Vector &XC::Element::getRayleighDampingForces(void) const
   {
-
-    if(index == -1)
-      setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
-
-    Matrix &theMatrix= theMatrices[index];
-    Vector &theVector= theVectors2[index];
-    Vector &theVector2= theVectors1[index];
+    const int numDOF= getNumDOF();
+    ScratchStorage &scratch= ScratchStorage::get();
+    Matrix &theMatrix= scratch.getMatrix(numDOF);
+    Vector &theVector= scratch.getVector(numDOF,1);
+    Vector &theVector2= scratch.getVector(numDOF,0);
 
     //
     // perform: R = (rayFactors.getAlphaM() * M + rayFactors.getBetaK0() * K0 + rayFactors.getBetaK() * K) * v
@@ -424,6 +398,37 @@ const XC::Vector &XC::Element::getRayleighDampingForces(void) const
 bool XC::Element::isSubdomain(void)
   { return false; }
 
+//! @brief Returns true if the state, tangent and resisting force
+//! of the element can be computed concurrently with those
+//! of other elements (the element doesn't use shared scratch storage).
+bool XC::Element::isThreadSafe(void) const
+  { return false; }
+
+//! @brief Returns true if the tangent stiffness of the element
+//! doesn't depend on its state (linear elastic material and small
+//! displacements), so it needs to be formed only once while the model
+//! doesn't change (see Linear::setReuseTangent).
+bool XC::Element::isTangentConstant(void) const
+  { return false; }
+
+//! @brief Write the tangent stiffness matrix of the element
+//! into the matrix being passed as parameter (the caller owns
+//! the storage so the result survives the next call to
+//! getTangentStiff from the same thread).
+int XC::Element::getTangentInto(Matrix &K) const
+  {
+    K= getTangentStiff();
+    return 0;
+  }
+
+//! @brief Write the resisting force vector of the element
+//! into the vector being passed as parameter (see getTangentInto).
+int XC::Element::getResistingForceInto(Vector &R) const
+  {
+    R= getResistingForce();
+    return 0;
+  }
+
 //! setResponse() is a method invoked to determine if the element
 //! will respond to a request for a certain of information. The
 //! information requested of the element is passed in the array of char
@@ -504,11 +509,8 @@ int XC::Element::addInertiaLoadSensitivityToUnbalance(const XC::Vector &accel, b
 
 const XC::Matrix &XC::Element::getDampSensitivity(int gradNumber)
   {
-    if(index  == -1)
-      setRayleighDampingFactors(RayleighDampingFactors()); //Anula los factores de amortiguamiento.
-
     // now compute the damping matrix
-    Matrix &theMatrix= theMatrices[index];
+    Matrix &theMatrix= ScratchStorage::get().getMatrix(getNumDOF());
     theMatrix.Zero();
     if(rayFactors.getAlphaM() != 0.0)
       theMatrix.addMatrix(0.0, this->getMassSensitivity(gradNumber), rayFactors.getAlphaM());
@@ -543,47 +545,6 @@ int XC::Element::addResistingForceToNodalReaction(bool inclInertia)
     int numNodes = this->getNumExternalNodes();
     NodePtrs &theNodes= getNodePtrs();
 
-    //
-    // first we create the nodes in static arrays as presume
-    // we are going to do this many times & save new/delete
-    //
-    if(nodeIndex == -1)
-      {
-        int numLastDOF = -1;
-        const size_t numMatrices= theMatrices.size();
-        for(int i=0; i<numNodes; i++)
-          {
-            const int numNodalDOF = theNodes[i]->getNumberDOF();
-
-            if(numNodalDOF != 0 && numNodalDOF != numLastDOF)
-              {
-                // see if an existing vector will do
-                size_t j;
-                for(j=0; j<numMatrices; j++)
-                  {
-                    if(theVectors1[j].Size() == numNodalDOF)
-                    nodeIndex = j;
-                    j = numMatrices+2;
-                  }
-
-                // if not we need to enlarge the bool of temp vectors, matrices
-                if(j != (numMatrices+2))
-                  {
-                    Matrix theMatrix(numNodalDOF, numNodalDOF);
-                    theMatrices.push_back(theMatrix);
-
-                    Vector theVector1(numNodalDOF);
-                    Vector theVector2(numNodalDOF);
-                    theVectors1.push_back(theVector1);
-                    theVectors2.push_back(theVector2);
-
-                    nodeIndex= numMatrices;
-                  }
-              }
-            numLastDOF = numNodalDOF;
-          }
-      }
-
     //
     // now determine the resisting force
     //
@@ -594,35 +555,19 @@ int XC::Element::addResistingForceToNodalReaction(bool inclInertia)
     else
       theResistingForce= &(getResistingForceIncInertia());
 
-    if(nodeIndex == -1)
-      {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-	          << "; HUH!\n";
-        return -1;
-      }
-
     //
     // iterate over the elements nodes; determine nodes contribution & add it
     //
 
     int nodalDOFCount = 0;
 
-    const size_t numMatrices= theMatrices.size();
+    ScratchStorage &scratch= ScratchStorage::get();
     for(int i=0; i<numNodes; i++)
       {
         Node *theNode= theNodes[i];
 
         int numNodalDOF= theNode->getNumberDOF();
-        Vector &theVector= theVectors1[nodeIndex];
-        if(theVector.Size() != numNodalDOF)
-          {
-            for(size_t j=0; j<numMatrices; j++)
-            if(theVectors1[j].Size() == numNodalDOF)
-              {
-                j = numMatrices;
-                theVector= theVectors1[j];
-              }
-          }
+        Vector &theVector= scratch.getVector(numNodalDOF,0);
         for(int j=0; j<numNodalDOF; j++)
           {
             theVector(j) = (*theResistingForce)(nodalDOFCount);
@@ -1073,11 +1018,17 @@ boost::python::list XC::Element::getMaterialNamesPy(void) const
     return retval;
   }
 
+//! @brief Return the generalized stresses (internal forces for
+//! sections) on each integration point of the element (one row
+//! for each material or section). The element has no materials
+//! so the matrix is empty.
+XC::Matrix XC::Element::getGeneralizedStresses(void) const
+  { return Matrix(); }
+
 //! @brief Sends object members through the channel being passed as parameter.
 int XC::Element::sendData(CommParameters &cp)
   {
     int res= MeshComponent::sendData(cp);
-    setDbTagDataPos(4,nodeIndex);
     res+= cp.sendVector(load,getDbTagData(),CommMetaData(5));
     return res;
   }
@@ -1086,7 +1037,6 @@ int XC::Element::sendData(CommParameters &cp)
 int XC::Element::recvData(const CommParameters &cp)
   {
     int res= MeshComponent::recvData(cp);
-    nodeIndex= getDbTagDataPos(4);
     res+= cp.receiveVector(load,getDbTagData(),CommMetaData(5));
     return res;
   }
@@ -68,6 +68,7 @@
 #include "domain/mesh/element/utils/RayleighDampingFactors.h"
 #include "utility/matrix/Matrix.h"
 #include "domain/mesh/node/NodeTopology.h"
+#include <algorithm>
 
 class Pos3dArray3d;
 class Pos2d;
@@ -115,11 +116,6 @@ class Element: public MeshComponent
     inline static void setDeadSRF(const double &d)
       { dead_srf= d; }
   private:
-    int nodeIndex;
-
-    static std::deque<Matrix> theMatrices;
-    static std::deque<Vector> theVectors1;
-    static std::deque<Vector> theVectors2;
 
     void compute_damping_matrix(Matrix &) const;
     static DefaultTag defaultTag; //<! default tag for next new element.
@@ -139,6 +135,9 @@ class Element: public MeshComponent
     int sendData(CommParameters &cp);
     int recvData(const CommParameters &cp);
 
+    template <class MaterialPtrs>
+    static Matrix generalized_stresses(const MaterialPtrs &);
+
   public:
     Element(int tag, int classTag);
     virtual Element *getCopy(void) const= 0;
@@ -174,6 +173,8 @@ class Element: public MeshComponent
     virtual int revertToStart(void);
     virtual int update(void);
     virtual bool isSubdomain(void);
+    virtual bool isThreadSafe(void) const;
+    virtual bool isTangentConstant(void) const;
 
     // methods to return the current linearized stiffness,
     // damping and mass matrices
@@ -185,6 +186,7 @@ class Element: public MeshComponent
     //! current trial displacement at the nodes.
     //! \f[ K_e = {\frac{\partial f_{R_i}}{\partial U} \vert}_{U_{trial}} \f]
     virtual const Matrix &getTangentStiff(void) const= 0;
+    virtual int getTangentInto(Matrix &) const;
     virtual const Matrix &getInitialStiff(void) const= 0;
     virtual const Matrix &getDamp(void) const;
     virtual const Matrix &getMass(void) const;
@@ -204,6 +206,7 @@ class Element: public MeshComponent
     //! displacement, i.e. 
     //! \f[ R_e= P_{e} - {R_e}(U_{trial}) \f]
     virtual const Vector &getResistingForce(void) const= 0;
+    virtual int getResistingForceInto(Vector &) const;
     
     //! @brief Returns the resisting force vector including inertia forces.
     //!
@@ -293,6 +296,7 @@ class Element: public MeshComponent
     
     virtual std::set<std::string> getMaterialNames(void) const;
     boost::python::list getMaterialNamesPy(void) const;
+    virtual Matrix getGeneralizedStresses(void) const;
 
     
 
@@ -300,6 +304,28 @@ class Element: public MeshComponent
     void add_to_sets(std::set<SetBase *> &);
 
   };
+
+//! @brief Return a matrix whose rows are the generalized stresses
+//! of the materials (or sections) being passed as parameter
+//! (padded with zeros if their sizes are different).
+template <class MaterialPtrs>
+Matrix Element::generalized_stresses(const MaterialPtrs &materials)
+  {
+    const int nMat= materials.size();
+    int nCols= 0;
+    for(int i= 0;i<nMat;i++)
+      if(materials[i])
+        nCols= std::max(nCols,materials[i]->getGeneralizedStress().Size());
+    Matrix retval(nMat,nCols);
+    for(int i= 0;i<nMat;i++)
+      if(materials[i])
+        {
+          const Vector &s= materials[i]->getGeneralizedStress();
+          for(int j= 0;j<s.Size();j++)
+            retval(i,j)= s(j);
+        }
+    return retval;
+  }
 } // end of XC namespace
 
 #endif
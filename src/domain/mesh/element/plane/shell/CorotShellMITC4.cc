@@ -29,7 +29,7 @@
 #include "CorotShellMITC4.h"
 #include "ShellCorotCrdTransf3d.h"
 
-XC::ShellCorotCrdTransf3d XC::CorotShellMITC4::corot_trf;
+const XC::ShellCorotCrdTransf3d XC::CorotShellMITC4::corot_trf;
 
 //! @brief Constructor
 XC::CorotShellMITC4::CorotShellMITC4(void)
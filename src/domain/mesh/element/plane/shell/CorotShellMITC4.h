@@ -40,7 +40,7 @@ class ShellCorotCrdTransf3d;
 //! @brief MIT C4 shell element.
 class CorotShellMITC4 : public ShellMITC4Base
   {
-    static ShellCorotCrdTransf3d corot_trf;
+    static const ShellCorotCrdTransf3d corot_trf; //!< Prototype (each element owns a copy).
   protected:
     DbTagData &getDbTagData(void) const;
 
@@ -134,7 +134,7 @@ void XC::ShellBData::DivideBHat(const double &vol)
 //! @brief compute standard Bshear matrix
 const XC::Matrix &XC::ShellBData::computeBshear(const size_t &node, const double shp[3][4] ) const
   {
-    static Matrix Bshear(2,3);
+    thread_local Matrix Bshear(2,3);
 
 //---Bshear XC::Matrix in standard {1,2,3} mechanics notation------
 //
@@ -159,16 +159,16 @@ const XC::Matrix &XC::ShellBData::computeBshear(const size_t &node, const double
 //! @brief compute Bbar shear matrix
 const XC::Matrix &XC::ShellBData::computeBbarShear(const size_t &node,const double &L1,const double &L2,const Matrix &Jinv) const
   {
-      static Matrix Bshear(2,3);
-      static Matrix BshearNat(2,3);
+      thread_local Matrix Bshear(2,3);
+      thread_local Matrix BshearNat(2,3);
 
-      static Matrix JinvTran(2,2);  // J-inverse-transpose
+      thread_local Matrix JinvTran(2,2);  // J-inverse-transpose
 
-      static Matrix Gamma1(1,3);
-      static Matrix Gamma2(1,3);
+      thread_local Matrix Gamma1(1,3);
+      thread_local Matrix Gamma2(1,3);
 
-      static Matrix temp1(1,3);
-      static Matrix temp2(1,3);
+      thread_local Matrix temp1(1,3);
+      thread_local Matrix temp2(1,3);
 
 
       //JinvTran= transpose( 2, 2, Jinv );
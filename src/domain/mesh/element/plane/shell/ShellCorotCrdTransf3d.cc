@@ -55,6 +55,10 @@ XC::ShellCorotCrdTransf3d::ShellCorotCrdTransf3d(const NodePtrs &theNodes)
 XC::ShellCrdTransf3dBase *XC::ShellCorotCrdTransf3d::getCopy(void) const
   { return new ShellCorotCrdTransf3d(*this); }
 
+//! @brief The scratch storage of the transformation is thread local.
+bool XC::ShellCorotCrdTransf3d::isThreadSafe(void) const
+  { return true; }
+
 //! @brief Sets the transformations from node positions.
 int XC::ShellCorotCrdTransf3d::initialize(const NodePtrs &ptrs)
   {
@@ -187,7 +191,7 @@ XC::Vector XC::ShellCorotCrdTransf3d::global_to_local_accel_nod(const int &i) co
 const XC::Vector &XC::ShellCorotCrdTransf3d::local_to_global_resisting_force(const Vector &pl) const
   {
     // transform resisting forces  from local to global coordinates
-    static Vector pg(24);
+    thread_local Vector pg(24);
     const Matrix R= getR();
     const Matrix Rd= R*getR0T();
     pg= local_to_global(R,Rd,pl);
@@ -283,7 +287,7 @@ XC::Vector XC::ShellCorotCrdTransf3d::local_to_global(const Matrix &R,const Matr
 //! @param kl: matrix expressed in local coordinates.
 XC::Matrix XC::ShellCorotCrdTransf3d::local_to_global(const Matrix &R,const Matrix &Rd,const Matrix &kl) const
   {
-    static Matrix tmp(24,24);
+    thread_local Matrix tmp(24,24);
 
     // Transform local matrix to global system
     // First compute kl*T_{lg}
@@ -62,6 +62,7 @@ class ShellCorotCrdTransf3d: public ShellCrdTransf3dBase
     ShellCorotCrdTransf3d(const Vector &,const Vector &,const Vector &);
     ShellCorotCrdTransf3d(const NodePtrs &t);
     virtual ShellCrdTransf3dBase *getCopy(void) const;
+    virtual bool isThreadSafe(void) const;
 
     //! @brief Returns the local axis 1 (lies in the plane of the element)
     inline const Vector &G1trial(void) const
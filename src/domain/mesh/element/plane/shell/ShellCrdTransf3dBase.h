@@ -91,6 +91,8 @@ class ShellCrdTransf3dBase: public CommandEntity, public MovableObject
     virtual int commitState(void) = 0;
     virtual int revertToLastCommit(void) = 0;
     virtual int revertToStart(void) = 0;
+    virtual bool isTangentConstant(void) const;
+    virtual bool isThreadSafe(void) const;
     
     virtual Vector getBasicTrialDisp(const int &) const= 0;
     virtual Vector getBasicTrialVel(const int &) const= 0;
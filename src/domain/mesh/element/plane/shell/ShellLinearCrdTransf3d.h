@@ -55,6 +55,8 @@ class ShellLinearCrdTransf3d: public ShellCrdTransf3dBase
     virtual int commitState(void);
     virtual int revertToLastCommit(void);        
     virtual int revertToStart(void);
+    virtual bool isTangentConstant(void) const;
+    virtual bool isThreadSafe(void) const;
     
     virtual Vector getBasicTrialDisp(const int &) const;
     virtual Vector getBasicTrialVel(const int &) const;
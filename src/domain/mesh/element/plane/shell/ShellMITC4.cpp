@@ -79,7 +79,7 @@
 #include "utility/actor/actor/MatrixCommMetaData.h"
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 
-XC::ShellLinearCrdTransf3d XC::ShellMITC4::linear_trf;
+const XC::ShellLinearCrdTransf3d XC::ShellMITC4::linear_trf;
 
 //! @brief Constructor
 XC::ShellMITC4::ShellMITC4(void)
@@ -66,7 +66,7 @@ class ShellLinearCrdTransf3d;
 //! @brief MIT C4 shell elements.
 class ShellMITC4 : public ShellMITC4Base
   {
-    static ShellLinearCrdTransf3d linear_trf;
+    static const ShellLinearCrdTransf3d linear_trf; //!< Prototype (each element owns a copy).
   protected:
     DbTagData &getDbTagData(void) const;
 
@@ -74,12 +74,12 @@
 #include "domain/mesh/element/utils/gauss_models/GaussModel.h"
 
 
-//static data
-XC::Matrix XC::ShellMITC4Base::stiff(24,24);
-XC::Vector XC::ShellMITC4Base::resid(24);
-XC::Matrix XC::ShellMITC4Base::mass(24,24);
+//static data (a copy for each thread).
+thread_local XC::Matrix XC::ShellMITC4Base::stiff(24,24);
+thread_local XC::Vector XC::ShellMITC4Base::resid(24);
+thread_local XC::Matrix XC::ShellMITC4Base::mass(24,24);
 
-XC::ShellBData XC::ShellMITC4Base::BData;
+thread_local XC::ShellBData XC::ShellMITC4Base::BData;
 
 void XC::ShellMITC4Base::free_mem(void)
   {
@@ -147,7 +147,7 @@ const XC::ShellUniformLoad *XC::ShellMITC4Base::vector3dUniformLoadLocal(const V
     if(preprocessor)
       {
         MapLoadPatterns &casos= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= casos.getCurrentElementLoadTag(); //Load identifier.
 
@@ -199,7 +199,7 @@ void XC::ShellMITC4Base::strainLoad(const Matrix &strains)
     if(preprocessor)
       {
         MapLoadPatterns &casos= preprocessor->getLoadHandler().getLoadPatterns();
-        static ID eTags(1);
+        thread_local ID eTags(1);
         eTags[0]= getTag(); //Load for this element.
         const int &loadTag= casos.getCurrentElementLoadTag(); //Load identifier.
         LoadPattern *lp= casos.getCurrentLoadPatternPtr();
@@ -230,8 +230,8 @@ void XC::ShellMITC4Base::setDomain(Domain *theDomain)
   {
     QuadBase4N<SectionFDPhysicalProperties>::setDomain(theDomain);
 
-    static Vector eig(3);
-    static Matrix ddMembrane(3,3);
+    thread_local Vector eig(3);
+    thread_local Matrix ddMembrane(3,3);
 
     //compute drilling stiffness penalty parameter
     const Matrix &dd= physicalProperties[0]->getInitialTangent();
@@ -347,15 +347,50 @@ int XC::ShellMITC4Base::update(void)
     return QuadBase4N<SectionFDPhysicalProperties>::update();
   }
 
-//! @brief return stiffness matrix
-const XC::Matrix &XC::ShellMITC4Base::getTangentStiff(void) const
+//! @brief The tangent is constant if the coordinate transformation
+//! is linear and the sections are elastic.
+bool XC::ShellMITC4Base::isTangentConstant(void) const
   {
-    theCoordTransf->update();
+    return (theCoordTransf && theCoordTransf->isTangentConstant() &&
+            physicalProperties.getMaterialsVector().isTangentConstant());
+  }
+
+//! @brief The element scratch storage is thread local so it's thread
+//! safe if its coordinate transformation and its sections are.
+bool XC::ShellMITC4Base::isThreadSafe(void) const
+  {
+    bool retval= (theCoordTransf && theCoordTransf->isThreadSafe());
+    if(retval)
+      {
+        const SectionFDPhysicalProperties::material_vector &sections= physicalProperties.getMaterialsVector();
+        for(size_t i= 0;i<sections.size();i++)
+          if(!sections[i] || !sections[i]->isThreadSafe())
+            {
+              retval= false;
+              break;
+            }
+      }
+    return retval;
+  }
 
+//! @brief Computes the stiffness matrix into the matrix being passed
+//! as parameter.
+int XC::ShellMITC4Base::getTangentInto(Matrix &K) const
+  {
+    theCoordTransf->update();
+    if((K.noRows()!=24) || (K.noCols()!=24))
+      K.resize(24,24);
     const int tang_flag= 1; //get the tangent
-    formResidAndTangent(tang_flag); //do tangent and residual here
+    formResidAndTangent(tang_flag,resid,K); //do tangent and residual here
     if(isDead())
-      stiff*=dead_srf;
+      K*=dead_srf;
+    return 0;
+  }
+
+//! @brief return stiffness matrix
+const XC::Matrix &XC::ShellMITC4Base::getTangentStiff(void) const
+  {
+    getTangentInto(stiff);
     return stiff;
   }
 
@@ -420,31 +455,31 @@ const XC::Matrix &XC::ShellMITC4Base::getInitialStiff(void) const
 
     double volume= 0.0;
 
-    static double xsj;  // determinant of the jacobian matrix 
-    static double dvol[ngauss]; //volume element
-    static double shp[3][numnodes];  //shape functions at a gauss point
+    thread_local double xsj;  // determinant of the jacobian matrix 
+    thread_local double dvol[ngauss]; //volume element
+    thread_local double shp[3][numnodes];  //shape functions at a gauss point
 
     //  static double Shape[3][numnodes][ngauss]; //all the shape functions
 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
+    thread_local Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
+    thread_local Matrix dd(nstress,nstress);  //material tangent
+    thread_local Matrix J0(2,2);  //Jacobian at center
+    thread_local Matrix J0inv(2,2); //inverse of Jacobian at center
 
     //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
+    thread_local Matrix BJ(nstress,ndf);      // B matrix node J
+    thread_local Matrix BJtran(ndf,nstress);
+    thread_local Matrix BK(nstress,ndf);      // B matrix node k
+    thread_local Matrix BJtranD(ndf,nstress);
+    thread_local Matrix Bbend(3,3);  // bending B matrix
+    thread_local Matrix Bshear(2,3); // shear B matrix
+    thread_local Matrix Bmembrane(3,2); // membrane B matrix
+    thread_local double BdrillJ[ndf]; //drill B matrix
+    thread_local double BdrillK[ndf];  
 
     double *drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    thread_local double saveB[nstress][ndf][numnodes];
 
     //-------------------------------------------------------
 
@@ -699,27 +734,36 @@ int XC::ShellMITC4Base::addInertiaLoadToUnbalance(const Vector &accel)
     return 0;
   }
 
-//! @brief get residual
-const XC::Vector &XC::ShellMITC4Base::getResistingForce(void) const
+//! @brief Computes the residual into the vector being passed
+//! as parameter.
+int XC::ShellMITC4Base::getResistingForceInto(Vector &R) const
   {
     theCoordTransf->update();
-
+    if(R.Size()!=24)
+      R.resize(24);
     const int tang_flag= 0; //don't get the tangent
-    formResidAndTangent(tang_flag);
+    formResidAndTangent(tang_flag,R,stiff);
     // subtract external loads
     if(!load.isEmpty())
-      resid-= load;
-    resid+= theCoordTransf->getGlobalResistingForce(p0.getVector());
+      R-= load;
+    R+= theCoordTransf->getGlobalResistingForce(p0.getVector());
 
     if(isDead())
-      resid*=dead_srf;
+      R*=dead_srf;
+    return 0;
+  }
+
+//! @brief get residual
+const XC::Vector &XC::ShellMITC4Base::getResistingForce(void) const
+  {
+    getResistingForceInto(resid);
     return resid;
   }
 
 //! @brief get residual with inertia terms
 const XC::Vector &XC::ShellMITC4Base::getResistingForceIncInertia(void) const
   {
-    static Vector res(24);
+    thread_local Vector res(24);
     res= getResistingForce();
 
     formInertiaTerms(0);
@@ -770,7 +814,7 @@ XC::Vector XC::ShellMITC4Base::getInterpolationFactors(const ParticlePos3d &pos)
     static const int massIndex= nShape - 1;
 
     double xsj;  // determinant of the jacobian matrix
-    static double shp[nShape][numberNodes];  //shape functions at a gauss point
+    thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
     Vector retval(numberNodes);
 
 
@@ -855,8 +899,8 @@ void XC::ShellMITC4Base::formInertiaTerms( int tangFlag ) const
 
     double xsj;  // determinant of the jacobian matrix
     double dvol; //volume element
-    static double shp[nShape][numberNodes];  //shape functions at a gauss point
-    static Vector momentum(ndf);
+    thread_local double shp[nShape][numberNodes];  //shape functions at a gauss point
+    thread_local Vector momentum(ndf);
 
 
     double temp, rhoH, massJK;
@@ -924,7 +968,11 @@ void XC::ShellMITC4Base::formInertiaTerms( int tangFlag ) const
   }
 
 //! @brief form residual and tangent
-void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
+//!
+//! @param tang_flag: if not zero compute the tangent too.
+//! @param resid: vector to store the residual (size 24).
+//! @param stiff: matrix to store the tangent (size 24x24).
+void XC::ShellMITC4Base::formResidAndTangent(int tang_flag,Vector &resid,Matrix &stiff) const
   {
     //
     //  six(6) nodal dof's ordered :
@@ -977,36 +1025,36 @@ void XC::ShellMITC4Base::formResidAndTangent(int tang_flag) const
     
     double volume= 0.0;
 
-    static double xsj;  // determinant jacaobian matrix 
-    static double dvol[ngauss]; //volume element
-    static Vector strain(nstress);  //strain
-    static double shp[3][numnodes];  //shape functions at a gauss point
+    thread_local double xsj;  // determinant jacaobian matrix 
+    thread_local double dvol[ngauss]; //volume element
+    thread_local Vector strain(nstress);  //strain
+    thread_local double shp[3][numnodes];  //shape functions at a gauss point
 
     //  static double Shape[3][numnodes][ngauss]; //all the shape functions
-    static Vector residJ(ndf); //nodeJ residual 
-    static Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
-    static Vector stress(nstress);  //stress resultants
-    static Matrix dd(nstress,nstress);  //material tangent
-    static Matrix J0(2,2);  //Jacobian at center
-    static Matrix J0inv(2,2); //inverse of Jacobian at center
+    thread_local Vector residJ(ndf); //nodeJ residual 
+    thread_local Matrix stiffJK(ndf,ndf); //nodeJK stiffness 
+    thread_local Vector stress(nstress);  //stress resultants
+    thread_local Matrix dd(nstress,nstress);  //material tangent
+    thread_local Matrix J0(2,2);  //Jacobian at center
+    thread_local Matrix J0inv(2,2); //inverse of Jacobian at center
 
     double epsDrill= 0.0;  //drilling "strain"
     double tauDrill= 0.0; //drilling "stress"
 
     //---------B-matrices------------------------------------
-    static Matrix BJ(nstress,ndf);      // B matrix node J
-    static Matrix BJtran(ndf,nstress);
-    static Matrix BK(nstress,ndf);      // B matrix node k
-    static Matrix BJtranD(ndf,nstress);
-    static Matrix Bbend(3,3);  // bending B matrix
-    static Matrix Bshear(2,3); // shear B matrix
-    static Matrix Bmembrane(3,2); // membrane B matrix
-    static double BdrillJ[ndf]; //drill B matrix
-    static double BdrillK[ndf];  
+    thread_local Matrix BJ(nstress,ndf);      // B matrix node J
+    thread_local Matrix BJtran(ndf,nstress);
+    thread_local Matrix BK(nstress,ndf);      // B matrix node k
+    thread_local Matrix BJtranD(ndf,nstress);
+    thread_local Matrix Bbend(3,3);  // bending B matrix
+    thread_local Matrix Bshear(2,3); // shear B matrix
+    thread_local Matrix Bmembrane(3,2); // membrane B matrix
+    thread_local double BdrillJ[ndf]; //drill B matrix
+    thread_local double BdrillK[ndf];  
 
     double *drillPointer;
 
-    static double saveB[nstress][ndf][numnodes];
+    thread_local double saveB[nstress][ndf][numnodes];
 
     //------------------------------------------------------- 
 
@@ -1239,11 +1287,11 @@ double *XC::ShellMITC4Base::computeBdrill( int node, const double shp[3][4]) con
   {
 
     //static Matrix Bdrill(1,6);
-    static double Bdrill[6];
+    thread_local double Bdrill[6];
 
-    static double B1;
-    static double B2;
-    static double B6;
+    thread_local double B1;
+    thread_local double B2;
+    thread_local double B6;
 
 
 //---Bdrill Matrix in standard {1,2,3} mechanics notation---------
@@ -1286,7 +1334,7 @@ double *XC::ShellMITC4Base::computeBdrill( int node, const double shp[3][4]) con
 const XC::Matrix &XC::ShellMITC4Base::computeBmembrane( int node, const double shp[3][4] ) const
   {
 
-    static Matrix Bmembrane(3,2);
+    thread_local Matrix Bmembrane(3,2);
 
 //---Bmembrane matrix in standard {1,2,3} mechanics notation---------
 //
@@ -1316,12 +1364,12 @@ const XC::Matrix &XC::ShellMITC4Base::computeBmembrane( int node, const double s
 const XC::Matrix &XC::ShellMITC4Base::assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const
   {
 
-    static Matrix B(8,6);
-    static Matrix BmembraneShell(3,3);
-    static Matrix BbendShell(3,3);
-    static Matrix BshearShell(2,6);
-    static Matrix Gmem(2,3);
-    static Matrix Gshear(3,6);
+    thread_local Matrix B(8,6);
+    thread_local Matrix BmembraneShell(3,3);
+    thread_local Matrix BbendShell(3,3);
+    thread_local Matrix BshearShell(2,6);
+    thread_local Matrix Gmem(2,3);
+    thread_local Matrix Gshear(3,6);
 
 //
 // For Shell :
@@ -1420,7 +1468,7 @@ const XC::Matrix &XC::ShellMITC4Base::assembleB(const Matrix &Bmembrane, const M
 const XC::Matrix &XC::ShellMITC4Base::computeBbend( int node, const double shp[3][4] ) const
   {
 
-      static XC::Matrix Bbend(3,2);
+      thread_local XC::Matrix Bbend(3,2);
 
 //---Bbend matrix in standard {1,2,3} mechanics notation---------
 //
@@ -1455,8 +1503,8 @@ void XC::ShellMITC4Base::shape2d(const double &ss, const double &tt,const double
     static const double s[]= { -0.5,  0.5, 0.5, -0.5 };
     static const double t[]= { -0.5, -0.5, 0.5,  0.5 };
 
-    static double xs[2][2];
-    static double sx[2][2];
+    thread_local double xs[2][2];
+    thread_local double sx[2][2];
 
     for(int i= 0; i < 4; i++ )
       {
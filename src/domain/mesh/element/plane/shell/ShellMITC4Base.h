@@ -60,13 +60,12 @@ class ShellMITC4Base : public QuadBase4N<SectionFDPhysicalProperties>
 
     std::vector<Vector> inicDisp; //!< Initial displacements.
 
-    //static data
-    static Matrix stiff;
-    static Vector resid;
-    static Matrix mass;
-    static Matrix damping;
+    //static data (a copy for each thread).
+    static thread_local Matrix stiff;
+    static thread_local Vector resid;
+    static thread_local Matrix mass;
 
-    static ShellBData BData; //!< B-bar data
+    static thread_local ShellBData BData; //!< B-bar data
 
     void free_mem(void);
     void alloc(const ShellCrdTransf3dBase *);
@@ -76,7 +75,7 @@ class ShellMITC4Base : public QuadBase4N<SectionFDPhysicalProperties>
     void zeroInicDisp(void);
 
     void formInertiaTerms(int tangFlag) const;
-    void formResidAndTangent(int tang_flag) const;
+    void formResidAndTangent(int tang_flag,Vector &,Matrix &) const;
     const Matrix calculateG(void) const;
     double *computeBdrill(int node, const double shp[3][4]) const;
     const Matrix& assembleB(const Matrix &Bmembrane, const Matrix &Bbend, const Matrix &Bshear) const;
@@ -105,9 +104,12 @@ class ShellMITC4Base : public QuadBase4N<SectionFDPhysicalProperties>
     int getNumDOF(void) const;
 	
     int update(void);
+    bool isTangentConstant(void) const;
+    bool isThreadSafe(void) const;
 
     //return stiffness matrix 
     const Matrix &getTangentStiff(void) const;
+    int getTangentInto(Matrix &) const;
     const Matrix &getInitialStiff(void) const;
     const Matrix &getMass(void) const;
 
@@ -134,6 +136,7 @@ class ShellMITC4Base : public QuadBase4N<SectionFDPhysicalProperties>
     void alive(void);
 
     const Vector &getResistingForce(void) const;
+    int getResistingForceInto(Vector &) const;
     const Vector &getResistingForceIncInertia(void) const;
     double getMeanInternalForce(const std::string &) const;
     double getMeanInternalDeformation(const std::string &) const;
@@ -46,6 +46,9 @@ class_<XC::Element, XC::Element *,bases<XC::MeshComponent>, boost::noncopyable >
   .def("getResistingForce",make_function(getResistingForceRef, return_internal_reference<>() ),"Calculates element's resisting force.")
   .def("getTangentStiff",make_function(getTangentStiffRef, return_internal_reference<>() ),"Return tangent stiffness matrix.")
   .def("getInitialStiff",make_function(getInitialStiffRef, return_internal_reference<>() ),"Return initial stiffness matrix.")
+  .add_property("isThreadSafe",&XC::Element::isThreadSafe,"True if the element state, tangent and resisting force can be computed concurrently with those of other elements.")
+  .def("getGeneralizedStresses",&XC::Element::getGeneralizedStresses,"Return a matrix whose rows are the generalized stresses (internal forces for sections) on each integration point.")
+  .add_property("isTangentConstant",&XC::Element::isTangentConstant,"True if the tangent stiffness doesn't depend on the element state (linear elastic element).")
   .def("setDeadSRF",XC::Element::setDeadSRF,"Assigns Stress Reduction Factor for element deactivation.")
   .add_property("getVtkCellType",&XC::Element::getVtkCellType,"Return cell type for Vtk graphics.")
   .def("getPosCentroid",&XC::Element::getCenterOfMassPosition,"Return centroid's position.")
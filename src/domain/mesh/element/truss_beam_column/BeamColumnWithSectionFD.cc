@@ -52,6 +52,11 @@ XC::BeamColumnWithSectionFD::BeamColumnWithSectionFD(int tag, int classTag,const
   {}
 
 //! @brief Zeroes loads on element.
+//! @brief Return the internal forces on each section of the element
+//! (one row for each section).
+XC::Matrix XC::BeamColumnWithSectionFD::getGeneralizedStresses(void) const
+  { return generalized_stresses(theSections); }
+
 void XC::BeamColumnWithSectionFD::zeroLoad(void)
   {
     Element1D::zeroLoad();
@@ -65,6 +65,7 @@ class BeamColumnWithSectionFD : public Element1D
       { return theSections.size(); }
     inline PrismaticBarCrossSectionsVector &getSections(void)
       { return theSections; }
+    Matrix getGeneralizedStresses(void) const;
  
     Response *setSectionResponse(PrismaticBarCrossSection *,const std::vector<std::string> &,const size_t &,Information &);
     int setSectionParameter(PrismaticBarCrossSection *,const std::vector<std::string> &,const size_t &, Parameter &);
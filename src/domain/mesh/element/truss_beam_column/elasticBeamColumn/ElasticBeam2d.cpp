@@ -76,9 +76,9 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::Matrix XC::ElasticBeam2d::K(6,6);
-XC::Vector XC::ElasticBeam2d::P(6);
-XC::Matrix XC::ElasticBeam2d::kb(3,3);
+thread_local XC::Matrix XC::ElasticBeam2d::K(6,6);
+thread_local XC::Vector XC::ElasticBeam2d::P(6);
+thread_local XC::Matrix XC::ElasticBeam2d::kb(3,3);
 
 void XC::ElasticBeam2d::set_transf(const CrdTransf *trf)
   {
@@ -257,7 +257,7 @@ int XC::ElasticBeam2d::setInitialSectionDeformation(const Vector &def)
 
 const XC::Vector &XC::ElasticBeam2d::getSectionDeformation(void) const
   {
-    static Vector retval(3);
+    thread_local Vector retval(3);
     theCoordTransf->update();
     const double L = theCoordTransf->getInitialLength();
     // retval(0)= (dx2-dx1)/L: Element elongation/L.
@@ -289,6 +289,16 @@ int XC::ElasticBeam2d::revertToStart()
 int XC::ElasticBeam2d::update(void)
   { return theCoordTransf->update(); }
 
+//! @brief The element scratch storage is thread local so it's thread
+//! safe if its coordinate transformation is.
+bool XC::ElasticBeam2d::isThreadSafe(void) const
+  { return (theCoordTransf && theCoordTransf->isThreadSafe()); }
+
+//! @brief The tangent is constant if the coordinate transformation
+//! is linear.
+bool XC::ElasticBeam2d::isTangentConstant(void) const
+  { return (theCoordTransf && theCoordTransf->isTangentConstant()); }
+
 //! @brief Returns the direction vector of element strong axis
 //! expressed in the global coordinate system.
 const XC::Vector &XC::ElasticBeam2d::getVDirStrongAxisGlobalCoord(bool initialGeometry) const
@@ -355,7 +365,7 @@ const XC::Matrix &XC::ElasticBeam2d::getTangentStiff(void) const
     kb(2,1)= kb(1,2)= EI2/L;
 
     
-    static Matrix retval;
+    thread_local Matrix retval;
     retval= theCoordTransf->getGlobalStiffMatrix(kb,q);
     if(isDead())
       retval*=dead_srf;
@@ -375,7 +385,7 @@ const XC::Matrix &XC::ElasticBeam2d::getInitialStiff(void) const
     kb(1,1) = kb(2,2) = EIoverL4;
     kb(2,1) = kb(1,2) = EIoverL2;
 
-    static Matrix retval;
+    thread_local Matrix retval;
     retval= theCoordTransf->getInitialGlobalStiffMatrix(kb);
     if(isDead())
       retval*=dead_srf;
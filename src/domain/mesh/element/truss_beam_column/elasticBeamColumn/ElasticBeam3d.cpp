@@ -74,9 +74,9 @@
 #include "material/section/ResponseId.h"
 #include "utility/actor/actor/MovableVector.h"
 
-XC::Matrix XC::ElasticBeam3d::K(12,12);
-XC::Vector XC::ElasticBeam3d::P(12);
-XC::Matrix XC::ElasticBeam3d::kb(6,6);
+thread_local XC::Matrix XC::ElasticBeam3d::K(12,12);
+thread_local XC::Vector XC::ElasticBeam3d::P(12);
+thread_local XC::Matrix XC::ElasticBeam3d::kb(6,6);
 
 void XC::ElasticBeam3d::set_transf(const CrdTransf *trf)
   {
@@ -265,7 +265,7 @@ int XC::ElasticBeam3d::setInitialSectionDeformation(const Vector &def)
 //! @brief Return the section generalized strain.
 const XC::Vector &XC::ElasticBeam3d::getSectionDeformation(void) const
   {
-    static Vector retval(5);
+    thread_local Vector retval(5);
     theCoordTransf->update();
     const double L = theCoordTransf->getInitialLength();
     // retval(0)= dx2-dx1: Element elongation/L.
@@ -303,6 +303,16 @@ int XC::ElasticBeam3d::revertToStart()
 int XC::ElasticBeam3d::update(void)
   { return theCoordTransf->update(); }
 
+//! @brief The element scratch storage is thread local so it's thread
+//! safe if its coordinate transformation is.
+bool XC::ElasticBeam3d::isThreadSafe(void) const
+  { return (theCoordTransf && theCoordTransf->isThreadSafe()); }
+
+//! @brief The tangent is constant if the coordinate transformation
+//! is linear.
+bool XC::ElasticBeam3d::isTangentConstant(void) const
+  { return (theCoordTransf && theCoordTransf->isTangentConstant()); }
+
 //! @brief Return the tangent stiffness matrix expresada en coordenadas globales.
 const XC::Matrix &XC::ElasticBeam3d::getTangentStiff(void) const
   {
@@ -348,7 +358,7 @@ const XC::Matrix &XC::ElasticBeam3d::getTangentStiff(void) const
     kb(4,3) = kb(3,4)= EIy2/L;
     kb(5,5) = GJ/L;
 
-    static Matrix retval;
+    thread_local Matrix retval;
     retval= theCoordTransf->getGlobalStiffMatrix(kb,q);
     if(isDead())
       retval*=dead_srf;
@@ -387,7 +397,7 @@ const XC::Matrix &XC::ElasticBeam3d::getInitialStiff(void) const
     kb(4,3) = kb(3,4) = EIyoverL2;
     kb(5,5) = GJoverL;
 
-    static Matrix retval;
+    thread_local Matrix retval;
     retval= theCoordTransf->getInitialGlobalStiffMatrix(kb);
     if(isDead())
       retval*=dead_srf;
@@ -289,17 +289,17 @@ const XC::Matrix &XC::ForceBeamColumn3d::getInitialStiff(void) const
     // check for quick return
     if(Ki.isEmpty())
       {
-        static Matrix f(NEBD,NEBD);   // element flexibility matrix
+        thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
         this->getInitialFlexibility(f);
 
-        static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+        thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
         I.Zero();
         for(size_t i=0; i<NEBD; i++)
           I(i,i) = 1.0;
 
         // calculate element stiffness matrix
         // invert3by3Matrix(f, kv);
-        static Matrix kvInit(NEBD, NEBD);
+        thread_local Matrix kvInit(NEBD, NEBD);
         if(f.Solve(I, kvInit) < 0)
           std::cerr << "%s -- could not invert flexibility, ForceBeamColumn3d::getInitialStiff()\n";
         Ki= Matrix(theCoordTransf->getInitialGlobalStiffMatrix(kvInit));
@@ -307,6 +307,17 @@ const XC::Matrix &XC::ForceBeamColumn3d::getInitialStiff(void) const
     return Ki;
   }
 
+//! @brief The element scratch storage is thread local so it's thread
+//! safe if its coordinate transformation and its sections are.
+bool XC::ForceBeamColumn3d::isThreadSafe(void) const
+  {
+    bool retval= (theCoordTransf && theCoordTransf->isThreadSafe());
+    const size_t numSections= getNumSections();
+    for(size_t i= 0;(i<numSections) && retval;i++)
+      retval= (theSections[i] && theSections[i]->isThreadSafe());
+    return retval;
+  }
+
 // NEWTON , SUBDIVIDE AND INITIAL ITERATIONS
 int XC::ForceBeamColumn3d::update(void)
   {
@@ -321,13 +332,13 @@ int XC::ForceBeamColumn3d::update(void)
     // get basic displacements and increments
     const Vector &v = theCoordTransf->getBasicTrialDisp();
 
-    static Vector dv(NEBD);
+    thread_local Vector dv(NEBD);
     dv = theCoordTransf->getBasicIncrDeltaDisp();
 
     if(initialFlag != 0 && dv.Norm() <= DBL_EPSILON && sp.isEmpty())
       return 0;
 
-    static Vector vin(NEBD);
+    thread_local Vector vin(NEBD);
     vin = v;
     vin -= dv;
     const double L= theCoordTransf->getInitialLength();
@@ -340,10 +351,10 @@ int XC::ForceBeamColumn3d::update(void)
     double wt[SectionMatrices::maxNumSections];
     beamIntegr->getSectionWeights(numSections, L, wt);
 
-    static Vector vr(NEBD);       // element residual displacements
-    static Matrix f(NEBD,NEBD);   // element flexibility matrix
+    thread_local Vector vr(NEBD);       // element residual displacements
+    thread_local Matrix f(NEBD,NEBD);   // element flexibility matrix
 
-    static Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
+    thread_local Matrix I(NEBD,NEBD);   // an identity matrix for matrix inverse
     double dW= 0.0;                    // section strain energy (work) norm
 
     I.Zero();
@@ -352,16 +363,16 @@ int XC::ForceBeamColumn3d::update(void)
 
     int numSubdivide = 1;
     bool converged = false;
-    static Vector dSe(NEBD);
-    static Vector dvToDo(NEBD);
-    static Vector dvTrial(NEBD);
-    static EsfBeamColumn3d SeTrial;
-    static Matrix kvTrial(NEBD, NEBD);
+    thread_local Vector dSe(NEBD);
+    thread_local Vector dvToDo(NEBD);
+    thread_local Vector dvTrial(NEBD);
+    thread_local EsfBeamColumn3d SeTrial;
+    thread_local Matrix kvTrial(NEBD, NEBD);
 
     dvToDo = dv;
     dvTrial = dvToDo;
 
-    static double factor = 10;
+    const double factor= 10;
     double dW0 = 0.0;
 
     maxSubdivisions= 10;
@@ -433,10 +444,10 @@ int XC::ForceBeamColumn3d::update(void)
                        const int order= theSections[i]->getOrder();
                        const ID &code = theSections[i]->getType();
 
-                       static Vector Ss;
-                       static Vector dSs;
-                       static Vector dvs;
-                       static Matrix fb;
+                       thread_local Vector Ss;
+                       thread_local Vector dSs;
+                       thread_local Vector dvs;
+                       thread_local Matrix fb;
 
                         Ss.setData(workArea, order);
                         dSs.setData(&workArea[order], order);
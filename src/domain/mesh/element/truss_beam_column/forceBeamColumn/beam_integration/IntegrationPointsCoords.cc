@@ -96,7 +96,7 @@ MapValores XC::IntegrationPointsCoords::getMapValores(const size_t &i,const std:
 const XC::Vector &XC::IntegrationPointsCoords::eval(const ExprAlgebra &expr) const
   {
     const size_t nIP= rst.noRows();
-    static Vector retval;
+    thread_local Vector retval;
     retval.resize(nIP);
     retval.Zero();
     std::vector<std::string> nombres= expr.getNombresVariables();
@@ -127,12 +127,12 @@ int XC::UserDefinedHingeIntegration3d::addElasticFlexibility(double L, Matrix &f
    double Lover6EI= 0.5*Lover3EI;
   
     // Elastic flexibility of element interior
-    static Matrix fe(2,2);
+    thread_local Matrix fe(2,2);
     fe(0,0)= fe(1,1)=  Lover3EI;
     fe(0,1)= fe(1,0)= -Lover6EI;
   
     // Equilibrium transformation matrix
-    static XC::Matrix B(2,2);
+    thread_local XC::Matrix B(2,2);
     B(0,0)= 1.0 - betaI;
     B(1,1)= 1.0 - betaJ;
     B(0,1)= -betaI;
@@ -140,7 +140,7 @@ int XC::UserDefinedHingeIntegration3d::addElasticFlexibility(double L, Matrix &f
   
     // Transform the elastic flexibility of the element
     // interior to the basic system
-    static Matrix ftmp(2,2);
+    thread_local Matrix ftmp(2,2);
     ftmp.addMatrixTripleProduct(0.0, B, fe, 1.0);
 
     fElastic(1,1)+= ftmp(0,0);
@@ -308,6 +308,11 @@ int XC::Truss::update(void)
     return theMaterial->setTrialStrain(strain, rate);
   }
 
+//! @brief The element uses the initial geometry so its tangent
+//! is constant if the tangent of the material is.
+bool XC::Truss::isTangentConstant(void) const
+  { return (theMaterial && theMaterial->isTangentConstant()); }
+
 //! @brief Returns the tangent stiffness matrix.
 const XC::Matrix &XC::Truss::getTangentStiff(void) const
   {
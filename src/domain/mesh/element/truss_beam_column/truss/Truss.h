@@ -118,6 +118,7 @@ class Truss : public TrussBase
     int revertToLastCommit(void);        
     int revertToStart(void);        
     int update(void);
+    bool isTangentConstant(void) const;
     
     const Material *getMaterial(void) const;
     Material *getMaterial(void);
@@ -108,6 +108,17 @@ std::string XC::CrdTransf::getName(void) const
     return cthandler->getName(getTag());
   }
 
+//! @brief Return true if the transformation can be used concurrently
+//! by different threads (i.e. it doesn't use shared scratch storage).
+bool XC::CrdTransf::isThreadSafe(void) const
+  { return false; }
+
+//! @brief Return true if the transformation doesn't depend on the
+//! displacements of the nodes (so the element tangent doesn't
+//! change due to geometric effects).
+bool XC::CrdTransf::isTangentConstant(void) const
+  { return false; }
+
 
 //! @brief Asigna los pointers to node dorsal y frontal.
 int XC::CrdTransf::set_node_ptrs(Node *nodeIPointer, Node *nodeJPointer)
@@ -135,7 +146,7 @@ double XC::CrdTransf::getLength(bool initialGeometry) const
 
 const XC::Matrix &XC::CrdTransf::getPointsGlobalCoordFromLocal(const Matrix &localCoords) const
   {
-    static Matrix retval;
+    thread_local Matrix retval;
     const size_t numPts= localCoords.noRows(); //Number of points to transform.
     const size_t dim= localCoords.noCols(); //Space dimension.
     retval.resize(numPts,dim);
@@ -163,7 +174,7 @@ const XC::Vector &XC::CrdTransf::getBasicDisplSensitivity(int gradNumber)
     std::cerr << "WARNING XC::CrdTransf::getBasicDisplSensitivity() - this method "
         << " should not be called." << std::endl;
 
-    static XC::Vector dummy(1);
+    thread_local XC::Vector dummy(1);
     return dummy;
   }
 
@@ -172,7 +183,7 @@ const XC::Vector &XC::CrdTransf::getGlobalResistingForceShapeSensitivity(const X
     std::cerr << "ERROR XC::CrdTransf::getGlobalResistingForceSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << std::endl;
 
-    static XC::Vector dummy(1);
+    thread_local XC::Vector dummy(1);
     return dummy;
   }
 
@@ -181,7 +192,7 @@ const XC::Vector &XC::CrdTransf::getBasicTrialDispShapeSensitivity(void)
     std::cerr << "ERROR CrdTransf::getBasicTrialDispShapeSensitivity() - has not been"
         << " implemented yet for the chosen transformation." << std::endl;
 
-    static Vector dummy(1);
+    thread_local Vector dummy(1);
     return dummy;
   }
 
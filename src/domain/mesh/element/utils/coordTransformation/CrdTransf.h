@@ -108,6 +108,8 @@ class CrdTransf: public TaggedObject, public MovableObject
     const TransfCooHandler *GetTransfCooHandler(void) const;
     TransfCooHandler *GetTransfCooHandler(void);
     std::string getName(void) const;
+    virtual bool isThreadSafe(void) const;
+    virtual bool isTangentConstant(void) const;
 
     virtual int initialize(Node *node1Pointer, Node *node2Pointer) = 0;
     virtual int update(void) = 0;
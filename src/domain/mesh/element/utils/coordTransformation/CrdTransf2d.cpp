@@ -182,7 +182,7 @@ int XC::CrdTransf2d::initialize(Node *nodeIPointer, Node *nodeJPointer)
 int XC::CrdTransf2d::computeElemtLengthAndOrient(void) const
   {
     // element projection
-    static Vector dx(2);
+    thread_local Vector dx(2);
     if(nodeIPtr && nodeJPtr)
       {
         const Vector &ndICoords= nodeIPtr->getCrds();
@@ -244,7 +244,7 @@ const XC::Vector &XC::CrdTransf2d::getBasicTrialDisp(void) const
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
     
-    static double ug[6];
+    thread_local double ug[6];
     for(register int i= 0;i<3;i++)
       {
         ug[i]   = disp1(i);
@@ -263,7 +263,7 @@ const XC::Vector &XC::CrdTransf2d::getBasicTrialDisp(void) const
           ug[j+3]-= nodeJInitialDisp[j];
       }
     
-    static Vector ub(3);
+    thread_local Vector ub(3);
     // ub(0)= dx2-dx1: Element elongation.
     // ub(1)= (dy1-dy2)/L+gz1: Rotation about z axis.
     // ub(2)= (dy1-dy2)/L+gz2: Rotation about z axis.
@@ -297,14 +297,14 @@ const XC::Vector &XC::CrdTransf2d::getBasicIncrDisp(void) const
     const Vector &disp1 = nodeIPtr->getIncrDisp();
     const Vector &disp2 = nodeJPtr->getIncrDisp();
     
-    static double dug[6];
+    thread_local double dug[6];
     for(register int i= 0;i<3;i++)
       {
         dug[i]   = disp1(i);
         dug[i+3] = disp2(i);
       }
     
-    static XC::Vector dub(3);
+    thread_local XC::Vector dub(3);
     
     const double oneOverL = 1.0/L;
     const double sl = sinTheta*oneOverL;
@@ -334,14 +334,14 @@ const XC::Vector &XC::CrdTransf2d::getBasicIncrDeltaDisp(void) const
     const Vector &disp1 = nodeIPtr->getIncrDeltaDisp();
     const Vector &disp2 = nodeJPtr->getIncrDeltaDisp();
     
-    static double Dug[6];
+    thread_local double Dug[6];
     for(register int i = 0; i < 3; i++)
       {
         Dug[i]   = disp1(i);
         Dug[i+3] = disp2(i);
       }
     
-    static XC::Vector Dub(3);
+    thread_local XC::Vector Dub(3);
     
     const double oneOverL = 1.0/L;
     const double sl = sinTheta*oneOverL;
@@ -371,14 +371,14 @@ const XC::Vector &XC::CrdTransf2d::getBasicTrialVel(void) const
     const XC::Vector &vel1 = nodeIPtr->getTrialVel();
     const XC::Vector &vel2 = nodeJPtr->getTrialVel();
 	
-    static double vg[6];
+    thread_local double vg[6];
     for(int i = 0; i < 3; i++)
       {
 	vg[i]   = vel1(i);
 	vg[i+3] = vel2(i);
       }
 	
-    static XC::Vector vb(3);
+    thread_local XC::Vector vb(3);
 	
     const double oneOverL = 1.0/L;
     const double sl = sinTheta*oneOverL;
@@ -409,14 +409,14 @@ const XC::Vector &XC::CrdTransf2d::getBasicTrialAccel(void) const
     const XC::Vector &accel1 = nodeIPtr->getTrialAccel();
     const XC::Vector &accel2 = nodeJPtr->getTrialAccel();
     
-    static double ag[6];
+    thread_local double ag[6];
     for(int i = 0; i < 3; i++)
       {
         ag[i]   = accel1(i);
         ag[i+3] = accel2(i);
       }
     
-    static Vector ab(3);
+    thread_local Vector ab(3);
     
     const double oneOverL = 1.0/L;
     const double sl = sinTheta*oneOverL;
@@ -445,7 +445,7 @@ const XC::Vector &XC::CrdTransf2d::getBasicTrialAccel(void) const
 const XC::Vector &XC::CrdTransf2d::getInitialI(void) const
   {
     computeElemtLengthAndOrient();
-    static Vector vectorI(2);
+    thread_local Vector vectorI(2);
     vectorI(0)= cosTheta;
     vectorI(1)= sinTheta;
     return vectorI;
@@ -462,7 +462,7 @@ const XC::Vector &XC::CrdTransf2d::getI(void) const
 const XC::Vector &XC::CrdTransf2d::getInitialJ(void) const
   {
     computeElemtLengthAndOrient();
-    static Vector vectorJ(2);
+    thread_local Vector vectorJ(2);
     vectorJ(0)= -sinTheta;
     vectorJ(1)= cosTheta;
     return vectorJ;
@@ -506,7 +506,7 @@ XC::Matrix XC::CrdTransf2d::getLocalAxes(bool initialGeometry) const
 //! @brief Return the global coordinates of the point.
 const XC::Vector &XC::CrdTransf2d::getPointGlobalCoordFromBasic(const double &xi) const
   {
-    static Vector local_coord(2),global_coord(2);
+    thread_local Vector local_coord(2),global_coord(2);
     local_coord.Zero();
     local_coord[0]= xi*getDeformedLength();
     global_coord= getPointGlobalCoordFromLocal(local_coord);
@@ -553,7 +553,7 @@ XC::Vector XC::CrdTransf2d::getPointLocalCoordFromGlobal(const Vector &xg) const
 //! @brief Return the global coordinates of the points.
 const XC::Matrix &XC::CrdTransf2d::getPointsGlobalCoordFromBasic(const Vector &basicCoords) const
   {
-    static Matrix retval;
+    thread_local Matrix retval;
     const size_t numPts= basicCoords.Size(); //Number of points to transform.
     retval.resize(numPts,2);
     Vector xg(2);
@@ -569,7 +569,7 @@ const XC::Matrix &XC::CrdTransf2d::getPointsGlobalCoordFromBasic(const Vector &b
 //! @brief Return the vector expressed in global coordinates.
 const XC::Vector &XC::CrdTransf2d::getVectorGlobalCoordFromLocal(const Vector &localCoords) const
   {
-    static XC::Vector retval(2);
+    thread_local XC::Vector retval(2);
     // retval = Rlj'*localCoords (Multiplica el vector por R traspuesta).
     retval(0)= cosTheta*localCoords(0) - sinTheta*localCoords(1);
     retval(1)= sinTheta*localCoords(0) + cosTheta*localCoords(1);
@@ -579,7 +579,7 @@ const XC::Vector &XC::CrdTransf2d::getVectorGlobalCoordFromLocal(const Vector &l
 //! @brief Return the vectors expressed in global coordinates.
 const XC::Matrix &XC::CrdTransf2d::getVectorGlobalCoordFromLocal(const Matrix &localCoords) const
   {
-    static Matrix retval;
+    thread_local Matrix retval;
     const size_t numPts= localCoords.noRows(); //Number of vectors to transform.
     retval.resize(numPts,2);
     for(size_t i= 0;i<numPts;i++)
@@ -594,7 +594,7 @@ const XC::Matrix &XC::CrdTransf2d::getVectorGlobalCoordFromLocal(const Matrix &l
 //! @brief Return the vector expressed in local coordinates.
 const XC::Vector &XC::CrdTransf2d::getVectorLocalCoordFromGlobal(const Vector &globalCoords) const
   {
-    static XC::Vector retval(2);
+    thread_local XC::Vector retval(2);
     retval(0)=  cosTheta*globalCoords(0) + sinTheta*globalCoords(1);
     retval(1)= -sinTheta*globalCoords(0) + cosTheta*globalCoords(1);
     return retval;
@@ -603,7 +603,7 @@ const XC::Vector &XC::CrdTransf2d::getVectorLocalCoordFromGlobal(const Vector &g
 //! @brief Return the coordinates of the nodes as rows of the returned matrix.
 const XC::Matrix &XC::CrdTransf2d::getCooNodes(void) const
   {
-    static Matrix retval;
+    thread_local Matrix retval;
     retval= Matrix(2,2);
 
     retval(0,0)= nodeIPtr->getCrds()[0];
@@ -621,7 +621,7 @@ const XC::Matrix &XC::CrdTransf2d::getCooPoints(const size_t &ndiv) const
     const Pos3d p0= nodeIPtr->getInitialPosition3d();
     const Pos3d p1= nodeJPtr->getInitialPosition3d();
     Pos3dArray linea(p0,p1,ndiv);
-    static Matrix retval;
+    thread_local Matrix retval;
     retval= Matrix(ndiv+1,2);
     Pos3d tmp;
     for(size_t i= 0;i<ndiv+1;i++)
@@ -639,7 +639,7 @@ const XC::Vector &XC::CrdTransf2d::getCooPoint(const double &xrel) const
     const Pos3d p0= nodeIPtr->getInitialPosition3d();
     const Pos3d p1= nodeJPtr->getInitialPosition3d();
     const Vector3d v= p1-p0;
-    static Vector retval(2);
+    thread_local Vector retval(2);
     const Pos3d tmp= p0+xrel*v;
     retval(0)= tmp.x();
     retval(1)= tmp.y();
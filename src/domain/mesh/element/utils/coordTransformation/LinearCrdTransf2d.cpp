@@ -103,6 +103,10 @@ int XC::LinearCrdTransf2d::revertToLastCommit(void)
 int XC::LinearCrdTransf2d::revertToStart(void)
   { return 0; }
 
+//! @brief The transformation is computed from the initial geometry.
+bool XC::LinearCrdTransf2d::isTangentConstant(void) const
+  { return true; }
+
 
 int XC::LinearCrdTransf2d::update(void)
   { return 0; }
@@ -116,7 +120,7 @@ const XC::Vector &XC::LinearCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-    static double ug[6];
+    thread_local double ug[6];
     for(int i = 0; i < 3; i++)
       {
         ug[i]   = disp1(i);
@@ -135,10 +139,10 @@ const XC::Vector &XC::LinearCrdTransf2d::getBasicTrialDispShapeSensitivity(void)
           ug[j+3] -= nodeJInitialDisp[j];
       }
 
-    static Vector ub(3);
+    thread_local Vector ub(3);
     ub.Zero();
 
-    static ID nodeParameterID(2);
+    thread_local ID nodeParameterID(2);
     nodeParameterID(0)= nodeIPtr->getCrdsSensitivity();
     nodeParameterID(1)= nodeJPtr->getCrdsSensitivity();
 
@@ -207,7 +211,7 @@ const XC::Vector &XC::LinearCrdTransf2d::getGlobalResistingForce(const XC::Vecto
 const XC::Vector &XC::LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity(const XC::Vector &pb, const XC::Vector &p0)
   {
     // transform resisting forces from the basic system to local coordinates
-    static double pl[6];
+    thread_local double pl[6];
 
     double q0 = pb(0);
     double q1 = pb(1);
@@ -229,10 +233,10 @@ const XC::Vector &XC::LinearCrdTransf2d::getGlobalResistingForceShapeSensitivity
     //    pl[4] += p0(2);
 
     // transform resisting forces  from local to global coordinates
-    static Vector pg(6);
+    thread_local Vector pg(6);
     pg.Zero();
 
-    static ID nodeParameterID(2);
+    thread_local ID nodeParameterID(2);
     nodeParameterID(0) = nodeIPtr->getCrdsSensitivity();
     nodeParameterID(1) = nodeJPtr->getCrdsSensitivity();
 
@@ -309,7 +313,7 @@ const XC::Matrix &XC::LinearCrdTransf2d::getGlobalStiffMatrix(const XC::Matrix &
     const bool nodeIOffsetNotZero= (nodeIOffset.Norm2()>0.0);
     const bool nodeJOffsetNotZero= (nodeJOffset.Norm2()>0.0);
 
-    static Matrix tmp(6,6);
+    thread_local Matrix tmp(6,6);
     tmp(0,0) = -cosTheta*kb(0,0) - sl*(kb(0,1)+kb(0,2));
     tmp(0,1) = -sinTheta*kb(0,0) + cl*(kb(0,1)+kb(0,2));
     tmp(0,2) = (nodeIOffsetNotZero) ? t02*kb(0,0) + t12*kb(0,1) + t22*kb(0,2) : kb(0,1);
@@ -331,7 +335,7 @@ const XC::Matrix &XC::LinearCrdTransf2d::getGlobalStiffMatrix(const XC::Matrix &
     tmp(2,4) = -tmp(2,1);
     tmp(2,5) = (nodeJOffsetNotZero) ? t05*kb(2,0) + t15*kb(2,1) + t25*kb(2,2) : kb(2,2);
 
-    static Matrix kg(6,6);
+    thread_local Matrix kg(6,6);
     kg(0,0) = -cosTheta*tmp(0,0) - sl*(tmp(1,0)+tmp(2,0));
     kg(0,1) = -cosTheta*tmp(0,1) - sl*(tmp(1,1)+tmp(2,1));
     kg(0,2) = -cosTheta*tmp(0,2) - sl*(tmp(1,2)+tmp(2,2));
@@ -420,7 +424,7 @@ const XC::Matrix &XC::LinearCrdTransf2d::getInitialGlobalStiffMatrix(const XC::M
     const bool nodeIOffsetNotZero= (nodeIOffset.Norm2()>0.0);
     const bool nodeJOffsetNotZero= (nodeJOffset.Norm2()>0.0);
 
-    static Matrix tmp(6,6);
+    thread_local Matrix tmp(6,6);
     tmp(0,0)= -cosTheta*kb(0,0) - sl*(kb(0,1)+kb(0,2));
     tmp(0,1)= -sinTheta*kb(0,0) + cl*(kb(0,1)+kb(0,2));
     tmp(0,2)= (nodeIOffsetNotZero) ? t02*kb(0,0) + t12*kb(0,1) + t22*kb(0,2) : kb(0,1);
@@ -442,7 +446,7 @@ const XC::Matrix &XC::LinearCrdTransf2d::getInitialGlobalStiffMatrix(const XC::M
     tmp(2,4)= -tmp(2,1);
     tmp(2,5)= (nodeJOffsetNotZero) ? t05*kb(2,0) + t15*kb(2,1) + t25*kb(2,2) : kb(2,2);
 
-    static Matrix kg(6,6);
+    thread_local Matrix kg(6,6);
     kg(0,0)= -cosTheta*tmp(0,0) - sl*(tmp(1,0)+tmp(2,0));
     kg(0,1)= -cosTheta*tmp(0,1) - sl*(tmp(1,1)+tmp(2,1));
     kg(0,2)= -cosTheta*tmp(0,2) - sl*(tmp(1,2)+tmp(2,2));
@@ -533,13 +537,13 @@ const XC::Vector &XC::LinearCrdTransf2d::getBasicDisplSensitivity(int gradNumber
     // up the nodal displacements we just pick up
     // the nodal displacement sensitivities.
 
-    static double ug[6];
+    thread_local double ug[6];
     for (int i = 0; i < 3; i++) {
         ug[i]   = nodeIPtr->getDispSensitivity((i+1),gradNumber);
         ug[i+3] = nodeJPtr->getDispSensitivity((i+1),gradNumber);
     }
 
-    static Vector ub(3);
+    thread_local Vector ub(3);
 
     const double oneOverL= 1.0/L;
     const double sl= sinTheta*oneOverL;
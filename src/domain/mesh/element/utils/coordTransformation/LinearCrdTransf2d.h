@@ -83,6 +83,7 @@ class LinearCrdTransf2d: public SmallDispCrdTransf2d
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isTangentConstant(void) const;
     
     // AddingSensitivity:BEGIN //////////////////////////////////
     const Vector &getBasicDisplSensitivity(int gradNumber);
@@ -106,6 +106,10 @@ int XC::LinearCrdTransf3d::revertToLastCommit(void)
 int XC::LinearCrdTransf3d::revertToStart(void)
   { return 0; }
 
+//! @brief The transformation is computed from the initial geometry.
+bool XC::LinearCrdTransf3d::isTangentConstant(void) const
+  { return true; }
+
 
 
 
@@ -135,7 +139,7 @@ XC::CrdTransf3d *XC::LinearCrdTransf3d::getCopy(void) const
 
 const XC::Vector &XC::LinearCrdTransf3d::getPointGlobalCoordFromLocal(const Vector &xl) const
   {
-    static Vector xg(3);
+    thread_local Vector xg(3);
 
     //xg = nodeIPtr->getCrds() + nodeIOffset;
     xg = nodeIPtr->getCrds();
@@ -166,13 +170,13 @@ const XC::Vector &XC::LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi,
     const Vector &disp1 = nodeIPtr->getTrialDisp();
     const Vector &disp2 = nodeJPtr->getTrialDisp();
 
-    static double ug[12];
+    thread_local double ug[12];
     inic_ug(disp1,disp2,ug);
     modif_ug_init_disp(ug);
 
     // transform global end displacements to local coordinates
     //ul.addMatrixVector(0.0, Tlg,  ug, 1.0);       //  ul = Tlg *  ug;
-    static double ul[12];
+    thread_local double ul[12];
 
     ul[0]  = R(0,0)*ug[0] + R(0,1)*ug[1] + R(0,2)*ug[2];
     ul[1]  = R(1,0)*ug[0] + R(1,1)*ug[1] + R(1,2)*ug[2];
@@ -181,12 +185,12 @@ const XC::Vector &XC::LinearCrdTransf3d::getPointGlobalDisplFromBasic(double xi,
     ul[7]  = R(1,0)*ug[6] + R(1,1)*ug[7] + R(1,2)*ug[8];
     ul[8]  = R(2,0)*ug[6] + R(2,1)*ug[7] + R(2,2)*ug[8];
 
-    static double Wu[3];
+    thread_local double Wu[3];
     calc_Wu(ug,ul,Wu);
 
     // compute displacements at point xi, in local coordinates
-    static double uxl[3];
-    static Vector uxg(3);
+    thread_local double uxl[3];
+    thread_local Vector uxg(3);
 
     uxl[0] = uxb(0) +        ul[0];
     uxl[1] = uxb(1) + (1-xi)*ul[1] + xi*ul[7];
@@ -85,6 +85,7 @@ class LinearCrdTransf3d: public SmallDispCrdTransf3d
     int commitState(void);
     int revertToLastCommit(void);        
     int revertToStart(void);
+    bool isTangentConstant(void) const;
     
     const Vector &getGlobalResistingForce(const Vector &basicForce, const Vector &p0) const;
     const Matrix &getGlobalStiffMatrix(const Matrix &basicStiff, const Vector &basicForce) const;
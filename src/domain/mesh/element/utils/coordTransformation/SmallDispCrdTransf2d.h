@@ -44,6 +44,8 @@ class SmallDispCrdTransf2d: public CrdTransf2d
     DbTagData &getDbTagData(void) const;
   public:
     SmallDispCrdTransf2d(int tag, int classTag);
+
+    virtual bool isThreadSafe(void) const;
     const Vector &getPointGlobalCoordFromLocal(const Vector &) const;
     const Vector &getPointGlobalDisplFromBasic(double xi, const Vector &) const;
 
@@ -51,6 +51,8 @@ class SmallDispCrdTransf3d: public CrdTransf3d
     SmallDispCrdTransf3d(int tag, int classTag);
     SmallDispCrdTransf3d(int tag, int classTag, const Vector &vecInLocXZPlane);
 
+    virtual bool isThreadSafe(void) const;
+
     double getInitialLength(void) const;
     double getDeformedLength(void) const;
 
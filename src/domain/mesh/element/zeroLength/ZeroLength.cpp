@@ -381,6 +381,10 @@ int XC::ZeroLength::revertToLastCommit(void)
 int XC::ZeroLength::revertToStart(void)
   { return theMaterial1d.revertToStart(); }
 
+//! @brief The tangent is constant if the tangents of all
+//! the materials are.
+bool XC::ZeroLength::isTangentConstant(void) const
+  { return theMaterial1d.isTangentConstant(); }
 
 int XC::ZeroLength::update(void)
   {
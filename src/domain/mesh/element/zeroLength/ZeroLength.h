@@ -155,6 +155,7 @@ class ZeroLength: public Element0D
     int revertToLastCommit(void);        
     int revertToStart(void);        
     int update(void);
+    bool isTangentConstant(void) const;
 
     // public methods to obtain stiffness, mass, damping and residual information    
     std::string getElementType(void) const;
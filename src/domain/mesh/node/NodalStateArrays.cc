@@ -0,0 +1,113 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodalStateArrays.cc
+
+#include "domain/mesh/node/NodalStateArrays.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/node/NodeIter.h"
+#include "domain/mesh/Mesh.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::NodalStateArrays::NodalStateArrays(void)
+  {}
+
+//! @brief Destructor.
+XC::NodalStateArrays::~NodalStateArrays(void)
+  { release(); }
+
+//! @brief Return the number of values stored in the arrays.
+size_t XC::NodalStateArrays::getNumValues(void) const
+  { return crd.size()+disp.size()+vel.size()+accel.size()+unbalance.size(); }
+
+//! @brief Moves the state of the mesh nodes to the arrays.
+void XC::NodalStateArrays::pack(Mesh &mesh)
+  {
+    release();
+    const size_t numNodes= mesh.getNumNodes();
+    nodes.reserve(numNodes);
+    numDOFs.reserve(numNodes);
+    size_t szCrd= 0, szDOF= 0;
+    Node *nodePtr= nullptr;
+    NodeIter &theNodeIter= mesh.getNodes();
+    while((nodePtr = theNodeIter()) != nullptr)
+      {
+        const size_t nDOF= nodePtr->getNumberDOF();
+        nodes.push_back(nodePtr);
+        numDOFs.push_back(nDOF);
+        szCrd+= nodePtr->getCrds().Size();
+        szDOF+= nDOF;
+      }
+    crd.resize(szCrd);
+    disp.resize(4*szDOF);
+    vel.resize(2*szDOF);
+    accel.resize(2*szDOF);
+    unbalance.resize(szDOF);
+    size_t iCrd= 0, iDOF= 0;
+    for(size_t i= 0;i<nodes.size();i++)
+      {
+        Node *n= nodes[i];
+        const size_t nDOF= numDOFs[i];
+        n->setStateStorage(&crd[iCrd],&disp[4*iDOF],&vel[2*iDOF],&accel[2*iDOF],&unbalance[iDOF]);
+        iCrd+= n->getCrds().Size();
+        iDOF+= nDOF;
+      }
+  }
+
+//! @brief Returns the nodes the ownership of its state.
+void XC::NodalStateArrays::release(void)
+  {
+    for(std::vector<Node *>::iterator i= nodes.begin();i!=nodes.end();i++)
+      (*i)->releaseStateStorage();
+    nodes.clear();
+    numDOFs.clear();
+    crd.clear(); crd.shrink_to_fit();
+    disp.clear(); disp.shrink_to_fit();
+    vel.clear(); vel.shrink_to_fit();
+    accel.clear(); accel.shrink_to_fit();
+    unbalance.clear(); unbalance.shrink_to_fit();
+  }
+
+//! @brief Commits the state of all the nodes: for each node
+//! committed= trial for displacement, velocity and acceleration
+//! and the displacement increments are set to zero
+//! (see Node::commitState).
+void XC::NodalStateArrays::commit(void)
+  {
+    double *d= disp.data();
+    double *v= vel.data();
+    double *a= accel.data();
+    for(std::vector<size_t>::const_iterator i= numDOFs.begin();i!=numDOFs.end();i++)
+      {
+        const size_t n= *i;
+        std::copy(d,d+n,d+n);
+        std::fill(d+2*n,d+4*n,0.0);
+        std::copy(v,v+n,v+n);
+        std::copy(a,a+n,a+n);
+        d+= 4*n; v+= 2*n; a+= 2*n;
+      }
+  }
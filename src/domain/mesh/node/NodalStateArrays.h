@@ -0,0 +1,80 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//NodalStateArrays.h
+                                                                        
+#ifndef NodalStateArrays_h
+#define NodalStateArrays_h
+
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class Node;
+class Mesh;
+
+//! @ingroup Nod
+//
+//! @brief Contiguous arrays storing the state of all the nodes
+//! of a mesh (coordinates, displacements, velocities, accelerations
+//! and unbalanced loads).
+//!
+//! Once the arrays are populated (see pack) the node vectors are
+//! views on them, so the node accessors read and write through
+//! the arrays and the domain-wide operations (i.e. commit) can
+//! sweep them sequentially.
+class NodalStateArrays
+  {
+  private:
+    std::vector<Node *> nodes; //!< Nodes whose state is stored.
+    std::vector<size_t> numDOFs; //!< Number of DOFs of each node.
+    std::vector<double> crd; //!< Node coordinates.
+    std::vector<double> disp; //!< Trial, committed and incremental displacements.
+    std::vector<double> vel; //!< Trial and committed velocities.
+    std::vector<double> accel; //!< Trial and committed accelerations.
+    std::vector<double> unbalance; //!< Unbalanced loads.
+
+    NodalStateArrays(const NodalStateArrays &);
+    NodalStateArrays &operator=(const NodalStateArrays &);
+  public:
+    NodalStateArrays(void);
+    ~NodalStateArrays(void);
+
+    inline bool isPacked(void) const
+      { return !nodes.empty(); }
+    inline size_t getNumNodes(void) const
+      { return nodes.size(); }
+    size_t getNumValues(void) const;
+
+    void pack(Mesh &);
+    void release(void);
+
+    void commit(void);
+  };
+
+} // end of XC namespace
+
+#endif
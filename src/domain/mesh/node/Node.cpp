@@ -86,6 +86,7 @@
 
 #include <domain/domain/Domain.h>
 #include "domain/mesh/MeshEdge.h"
+#include "domain/mesh/ScratchStorage.h"
 #include "domain/mesh/element/Element.h"
 #include "domain/mesh/element/ElementIter.h"
 
@@ -95,7 +96,6 @@
 
 #include "utility/tagged/DefaultTag.h"
 
-std::deque<XC::Matrix> XC::Node::theMatrices;
 XC::DefaultTag XC::Node::defaultTag;
 
 //! @brief Default constructor.
@@ -164,8 +164,6 @@ XC::Node::Node(int tag, int ndof, double Crd1)
 
     Crd(0) = Crd1;
 
-    index = -1;
-    setup_matrices(theMatrices,ndof);
   }
 
 
@@ -197,8 +195,6 @@ XC::Node::Node(int tag, int ndof, double Crd1, double Crd2)
     Crd(0)= Crd1;
     Crd(1)= Crd2;
 
-    index = -1;
-    setup_matrices(theMatrices,ndof);
   }
 
 
@@ -232,8 +228,6 @@ XC::Node::Node(int tag, int ndof, double Crd1, double Crd2, double Crd3)
     Crd(1) = Crd2;
     Crd(2) = Crd3;
 
-    index= -1;
-    setup_matrices(theMatrices,ndof);
   }
 
 //! @brief Constructor.
@@ -252,13 +246,13 @@ XC::Node::Node(int tag, int ndof, const Vector &crds)
     parameterID = 0;
     // AddingSensitivity:END ///////////////////////////////////////////
 
-    index= -1;
-    setup_matrices(theMatrices,ndof);
   }
 
 //! @brief  used for domain decomposition & external nodes
 //!  copy everything but the mass
 //!  we should really set the mass to 0.0
+//!  The copy is not connected to the elements of the original
+//!  node; they connect to it when added to its domain.
 XC::Node::Node(const Node &otherNode, bool copyMass)
   :MeshComponent(otherNode), numberDOF(otherNode.numberDOF),
    theDOF_GroupPtr(nullptr), Crd(otherNode.Crd),
@@ -267,7 +261,7 @@ XC::Node::Node(const Node &otherNode, bool copyMass)
    unbalLoadWithInertia(otherNode.unbalLoadWithInertia),
    reaction(otherNode.reaction), alphaM(otherNode.alphaM),
    tributary(otherNode.tributary), theEigenvectors(otherNode.theEigenvectors),
-   connected(otherNode.connected),
+   connected(),
    freeze_constraints(otherNode.freeze_constraints)
   {
     // AddingSensitivity:BEGIN /////////////////////////////////////////
@@ -279,8 +273,6 @@ XC::Node::Node(const Node &otherNode, bool copyMass)
     if(copyMass == true)
       mass= otherNode.mass;
 
-    index = -1;
-    setup_matrices(theMatrices,numberDOF);
   }
 
 //! @brief Inserts a component (element, constraint,...) to the connected component list.
@@ -1147,6 +1139,99 @@ int XC::Node::revertToStart(void)
     return 0;
   }
 
+//! @brief Return the number of values that define the state of the node
+//! (trial and committed displacements, velocities and accelerations).
+size_t XC::Node::getStateSize(void) const
+  { return disp.getStateSize()+vel.getStateSize()+accel.getStateSize(); }
+
+//! @brief Copy the trial and committed displacements, velocities and
+//! accelerations of the node to the buffer being passed as parameter
+//! (it must have room for getStateSize() values).
+//!
+//! @return pointer to the position that follows the copied values.
+double *XC::Node::copyStateTo(double *buffer) const
+  {
+    double *retval= disp.copyStateTo(buffer);
+    retval= vel.copyStateTo(retval);
+    retval= accel.copyStateTo(retval);
+    return retval;
+  }
+
+//! @brief Set the trial and committed displacements, velocities and
+//! accelerations of the node from the buffer being passed as parameter
+//! (see copyStateTo).
+//!
+//! @return pointer to the position that follows the read values.
+const double *XC::Node::setStateFrom(const double *buffer)
+  {
+    const double *retval= disp.setStateFrom(buffer);
+    retval= vel.setStateFrom(retval);
+    retval= accel.setStateFrom(retval);
+    return retval;
+  }
+
+//! @brief Copy the vector values to the array and make the
+//! vector read and write through it.
+static void bind_vector(XC::Vector &v, double *ptr)
+  {
+    const int sz= v.Size();
+    for(int i= 0;i<sz;i++)
+      ptr[i]= v[i];
+    v.setData(ptr,sz);
+  }
+
+//! @brief Make the vector own its data again.
+static void own_vector(XC::Vector &v)
+  {
+    const XC::Vector tmp(v);
+    v= XC::Vector();
+    v= tmp;
+  }
+
+//! @brief Creates (if not already created) the displacement, velocity
+//! and acceleration vectors.
+void XC::Node::createStateVectors(void)
+  {
+    getTrialDisp();
+    getTrialVel();
+    getTrialAccel();
+  }
+
+//! @brief Moves the node state to the arrays being passed as parameters
+//! (normally owned by the mesh, see NodalStateArrays). The node accessors
+//! read and write through those arrays until releaseStateStorage is called.
+//!
+//! @param crdPtr: room for getCrds().Size() values (coordinates).
+//! @param dispPtr: room for 4*getNumberDOF() values (trial, committed and incremental displacements).
+//! @param velPtr: room for 2*getNumberDOF() values (trial and committed velocities).
+//! @param accelPtr: room for 2*getNumberDOF() values (trial and committed accelerations).
+//! @param unbalPtr: room for getNumberDOF() values (unbalanced load).
+void XC::Node::setStateStorage(double *crdPtr,double *dispPtr,double *velPtr,double *accelPtr,double *unbalPtr)
+  {
+    if(hasExternalStateStorage())
+      releaseStateStorage();
+    createStateVectors();
+    bind_vector(Crd,crdPtr);
+    disp.setStorage(dispPtr);
+    vel.setStorage(velPtr);
+    accel.setStorage(accelPtr);
+    bind_vector(unbalLoad,unbalPtr);
+  }
+
+//! @brief Copy back the node state from the external arrays so the
+//! node owns its data again.
+void XC::Node::releaseStateStorage(void)
+  {
+    if(hasExternalStateStorage())
+      {
+        own_vector(Crd);
+        disp.releaseStorage();
+        vel.releaseStorage();
+        accel.releaseStorage();
+        own_vector(unbalLoad);
+      }
+  }
+
 //! @brief Return the mass matrix of the node.
 //!
 //! Returns the mass matrix set for the node, which is a matrix of size
@@ -1169,15 +1254,14 @@ int XC::Node::setRayleighDampingFactor(double alpham)
 //! @brief Return the damping matrix of the node.
 const XC::Matrix &XC::Node::getDamp(void)
   {
-    // make sure it was created before we return it
+    Matrix &result= ScratchStorage::get().getMatrix(numberDOF);
     if(alphaM == 0.0)
       {
-        theMatrices[index].Zero();
-        return theMatrices[index];
+        result.Zero();
+        return result;
       }
     else
       {
-        Matrix &result= theMatrices[index];
         result= mass;
         result*= alphaM;
         return result;
@@ -1199,15 +1283,14 @@ const double &XC::Node::getTributary(void) const
 
 const XC::Matrix &XC::Node::getDampSensitivity(void)
   {
-    // make sure it was created before we return it
+    Matrix &result= ScratchStorage::get().getMatrix(numberDOF);
     if(alphaM == 0.0)
       {
-        theMatrices[index].Zero();
-        return theMatrices[index];
+        result.Zero();
+        return result;
       }
     else
       {
-        Matrix &result= theMatrices[index];
         result.Zero();
         //result = *mass;
         //result *= alphaM;
@@ -1668,14 +1751,12 @@ int XC::Node::recvData(const CommParameters &cp)
     res+= cp.receiveMatrix(R,getDbTagData(),CommMetaData(10));
     res+= cp.receiveDoubles(alphaM,tributary,getDbTagData(),CommMetaData(11));
     res+= cp.receiveMatrix(theEigenvectors,getDbTagData(),CommMetaData(12));
-    index= -1;
     res+= cp.receiveMovable(disp,getDbTagData(),CommMetaData(13));
     res+= cp.receiveMovable(vel,getDbTagData(),CommMetaData(14));
     res+= cp.receiveMovable(accel,getDbTagData(),CommMetaData(15));
     ID tmp;
     res+= cp.receiveID(tmp,getDbTagData(),CommMetaData(16));
     set_id_constraints(tmp);
-    setup_matrices(theMatrices,numberDOF);
     return res;
   }
 
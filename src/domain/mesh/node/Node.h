@@ -136,7 +136,6 @@ class Node: public MeshComponent
     int parameterID;
     // AddingSensitivity:END ///////////////////////////////////////////
 
-    static std::deque<Matrix> theMatrices;
 
     mutable std::set<ContinuaReprComponent *> connected; //!< Components (elements, contraints,...) that are connected with this node.
 
@@ -258,6 +257,18 @@ class Node: public MeshComponent
     virtual int revertToLastCommit();    
     virtual int revertToStart();        
 
+    // public methods to copy the state of the node
+    size_t getStateSize(void) const;
+    double *copyStateTo(double *) const;
+    const double *setStateFrom(const double *);
+
+    // public methods to store the node state in arrays owned by the mesh
+    void createStateVectors(void);
+    void setStateStorage(double *,double *,double *,double *,double *);
+    void releaseStateStorage(void);
+    inline bool hasExternalStateStorage(void) const
+      { return disp.hasExternalStorage(); }
+
     // public methods for dynamic analysis
     virtual const Matrix &getMass(void);
     virtual int setMass(const Matrix &theMass);
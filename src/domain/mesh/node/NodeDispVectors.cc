@@ -62,6 +62,21 @@ XC::NodeDispVectors &XC::NodeDispVectors::operator=(const NodeDispVectors &other
 XC::NodeDispVectors::~NodeDispVectors(void)
   { free_mem(); }
 
+//! @brief Points the trial, committed and increment vectors
+//! to its place in the values array.
+void XC::NodeDispVectors::bind_views(const size_t &nDOF)
+  {
+    NodeVectors::bind_views(nDOF);
+    if(incrDisp)
+      incrDisp->setData(&values[2*nDOF], nDOF);
+    else
+      incrDisp= new Vector(&values[2*nDOF], nDOF);
+    if(incrDeltaDisp)
+      incrDeltaDisp->setData(&values[3*nDOF], nDOF);
+    else
+      incrDeltaDisp= new Vector(&values[3*nDOF], nDOF);
+  }
+
 //! @brief Returns displacement increment.
 //! @param nDOF: number of degrees of freedom
 const XC::Vector &XC::NodeDispVectors::getIncrDisp(const size_t &nDOF) const
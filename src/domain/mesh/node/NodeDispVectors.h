@@ -47,6 +47,7 @@ class NodeDispVectors: public NodeVectors
     Vector *incrDeltaDisp;
   protected:
     void free_mem(void);
+    virtual void bind_views(const size_t &);
   public:
     // constructors
     NodeDispVectors(void);
@@ -62,12 +62,12 @@ void XC::NodeVectors::copy(const NodeVectors &other)
 
 //! @brief Constructor.
 XC::NodeVectors::NodeVectors(const size_t &nv)
-  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values() {}
+  :CommandEntity(),MovableObject(NOD_TAG_NodeVectors), numVectors(nv), commitData(nullptr),trialData(nullptr), values(), externalStorage(false) {}
 
 
 //! @brief Copy constructor.
 XC::NodeVectors::NodeVectors(const NodeVectors &other)
-  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), commitData(nullptr), trialData(nullptr), values()
+  : CommandEntity(other),MovableObject(NOD_TAG_NodeVectors), numVectors(other.numVectors), commitData(nullptr), trialData(nullptr), values(), externalStorage(false)
   { copy(other); }
 
 XC::NodeVectors &XC::NodeVectors::operator=(const NodeVectors &other)
@@ -107,6 +107,79 @@ const XC::Vector &XC::NodeVectors::getData(const size_t &nDOF) const
     return *commitData;
   }
   
+//! @brief Points the trial and committed vectors to its
+//! place in the values array.
+void XC::NodeVectors::bind_views(const size_t &nDOF)
+  {
+    if(trialData)
+      trialData->setData(&values[0], nDOF);
+    if(commitData)
+      commitData->setData(&values[nDOF], nDOF);
+  }
+
+//! @brief Moves the values to the array being passed as parameter
+//! (that must have room for getStateSize() values). The vectors
+//! read and write through that array until releaseStorage is called.
+//!
+//! @return number of values placed in the array.
+int XC::NodeVectors::setStorage(double *ptr)
+  {
+    const int sz= values.Size();
+    if(sz>0)
+      {
+        for(int i= 0;i<sz;i++)
+          ptr[i]= values[i];
+        values.setData(ptr,sz);
+        bind_views(sz/numVectors);
+        externalStorage= true;
+      }
+    return sz;
+  }
+
+//! @brief Copy back the values from the external array so the
+//! object owns its data again.
+void XC::NodeVectors::releaseStorage(void)
+  {
+    if(externalStorage)
+      {
+        const Vector tmp(values);
+        values= Vector();
+        values= tmp;
+        bind_views(values.Size()/numVectors);
+        externalStorage= false;
+      }
+  }
+
+//! @brief Return the number of values that define the state
+//! of the vectors (trial, committed,...).
+size_t XC::NodeVectors::getStateSize(void) const
+  { return values.Size(); }
+
+//! @brief Copy the values that define the state of the vectors
+//! (trial, committed,...) to the buffer being passed as parameter.
+//!
+//! @return pointer to the position that follows the copied values.
+double *XC::NodeVectors::copyStateTo(double *buffer) const
+  {
+    const size_t sz= getStateSize();
+    for(size_t i= 0;i<sz;i++)
+      buffer[i]= values[i];
+    return buffer+sz;
+  }
+
+//! @brief Set the values that define the state of the vectors
+//! (trial, committed,...) from the buffer being passed as parameter
+//! (see copyStateTo).
+//!
+//! @return pointer to the position that follows the read values.
+const double *XC::NodeVectors::setStateFrom(const double *buffer)
+  {
+    const size_t sz= getStateSize();
+    for(size_t i= 0;i<sz;i++)
+      values[i]= buffer[i];
+    return buffer+sz;
+  }
+
 //! @brief Returns commited values.
 const XC::Vector &XC::NodeVectors::getCommitData(void) const
   {
@@ -52,7 +52,9 @@ class NodeVectors: public CommandEntity, public MovableObject
     Vector *trialData; //!< trial quantities
     
     Vector values; //!< double array holding the displacement/velocity/acceleration.
+    bool externalStorage; //!< true if values are stored in an array owned by other object.
 
+    virtual void bind_views(const size_t &);
     DbTagData &getDbTagData(void) const;
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -86,6 +88,17 @@ class NodeVectors: public CommandEntity, public MovableObject
     virtual int revertToLastCommit(const size_t &nDOF);    
     virtual int revertToStart(const size_t &nDOF);        
 
+    // public methods to store the values in an external array
+    int setStorage(double *);
+    void releaseStorage(void);
+    inline bool hasExternalStorage(void) const
+      { return externalStorage; }
+
+    // public methods to copy the whole state (trial, committed,...)
+    size_t getStateSize(void) const;
+    double *copyStateTo(double *) const;
+    const double *setStateFrom(const double *);
+
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
   };
@@ -43,10 +43,18 @@ class_<XC::Mesh, bases<XC::MeshComponentContainer>, boost::noncopyable >("Mesh",
   .def("getNumDeadNodes", &XC::Mesh::getNumDeadNodes,"Returns the number of dead nodes.")
   .def("getNumFrozenNodes", &XC::Mesh::getNumFrozenNodes,"Returns the number of frozen nodes.")
   .def("getNumFreeNodes", &XC::Mesh::getNumFreeNodes,"Returns the number of free nodes.")
+  .add_property("contiguousNodalState", &XC::Mesh::getContiguousNodalState, &XC::Mesh::setContiguousNodalState,"If true, store the state of all the nodes (coordinates, displacements, velocities, accelerations and unbalanced loads) in contiguous arrays.")
   .def("freezeDeadNodes",&XC::Mesh::freeze_dead_nodes,"Restrain movement of dead nodes. Syntax: freezeDeadNodes(lockerName)")
   .def("meltAliveNodes",&XC::Mesh::melt_alive_nodes,"Allows movement of melted nodes.")
   .def("calculateNodalReactions",&XC::Mesh::calculateNodalReactions,"triggers nodal reaction calculation.")
   .def("checkNodalReactions",&XC::Mesh::checkNodalReactions,"checkNodalReactions(tolerande): check that reactions at nodes correspond to constrained degrees of freedom.")
+  .def("getNodeTagsTable",&XC::Mesh::getNodeTagsTable,"Returns the node identifiers in the order of the rows of the node tables.")
+  .def("getNodeCoordinatesTable",&XC::Mesh::getNodeCoordinatesTable,"Returns a matrix whose rows are the node coordinates.")
+  .def("getNodeDisplacementsTable",&XC::Mesh::getNodeDisplacementsTable,"Returns a matrix whose rows are the node displacements.")
+  .def("getNodeReactionsTable",&XC::Mesh::getNodeReactionsTable,"Returns a matrix whose rows are the node reactions.")
+  .def("getElementTagsTable",&XC::Mesh::getElementTagsTable,"Returns the element identifiers in the order of the rows of the element tables.")
+  .def("getElementResistingForcesTable",&XC::Mesh::getElementResistingForcesTable,"Returns a matrix whose rows are the element resisting forces (global coordinates).")
+  .def("getElementGeneralizedStressesTable",&XC::Mesh::getElementGeneralizedStressesTable,"Returns a matrix with a row for each integration point of the elements: element tag, integration point index and generalized stresses on it.")
   .add_property("getElementIter", make_function( &XC::Mesh::getElements, return_internal_reference<>() ),"returns an iterator over the elements of the mesh.")
   .def("getElement", make_function(getElementPtr, return_internal_reference<>() ),"Returns an element from its identifier.")
   .def("getNumElements", &XC::Mesh::getNumElements,"Returns the number of elements.")
@@ -60,6 +60,7 @@
 #include <domain/partitioner/DomainPartitioner.h>
 
 #include <cstdlib>
+#include <deque>
 #include "solution/graph/partitioner/GraphPartitioner.h"
 #include <domain/domain/partitioned/PartitionedDomain.h>
 #include "domain/partitioner/loadBalancer/LoadBalancer.h"
@@ -288,7 +289,7 @@ int XC::DomainPartitioner::partition(int numParts, bool usingMain, int mainParti
                 std::cerr << getClassName() << "::" << __FUNCTION__
 			  << "(int numParts)"
 			  << "; failed to find NodeLocation in Map for Node: "
-                          << nodePtr->getTag() << " -- A BUG!!\n";
+                          << nodeTag << " -- A BUG!!\n";
                 numPartitions = 0;
                 return -1;
               }
@@ -329,7 +330,9 @@ int XC::DomainPartitioner::partition(int numParts, bool usingMain, int mainParti
           { theRetainedLocation->addPartition(*i); }
       }
 
-    // we now add the nodes,
+    // we now add the nodes, the internal ones are removed from the
+    // partitioned domain once the elements that use them have been moved.
+    std::deque<int> internalNodes;
     TaggedObjectIter &theNodeLocationIter = theNodeLocations->getComponents();
     TaggedObject *theNodeObject;
     while((theNodeObject = theNodeLocationIter()) != 0)
@@ -345,10 +348,10 @@ int XC::DomainPartitioner::partition(int numParts, bool usingMain, int mainParti
               {
                 Subdomain *theSubdomain = myDomain->getSubdomainPtr(partition);
                 Node *nodePtr = myDomain->getNode(nodeTag);
-                if(numPartitions == 1)
+                if(nodePartitions.size() == 1)
                   {
                     theSubdomain->addNode(nodePtr->getCopy());
-                    myDomain->removeNode(nodeTag);
+                    internalNodes.push_back(nodeTag);
                   }
                 else
                   theSubdomain->addExternalNode(nodePtr);
@@ -370,6 +373,8 @@ int XC::DomainPartitioner::partition(int numParts, bool usingMain, int mainParti
             myDomain->removeElement(eleTag);
           }
       }
+    for(std::deque<int>::const_iterator i= internalNodes.begin(); i!=internalNodes.end(); i++)
+      myDomain->removeNode(*i);
 
     // now we go through the load patterns and move NodalLoad
     // 1) make sure each subdomain has a copy of the partitioneddomains load patterns.
@@ -486,7 +491,9 @@ int XC::DomainPartitioner::partition(int numParts, bool usingMain, int mainParti
           }
       }
 
-    // add the single point constraints,
+    // move the single point constraints of the internal nodes, the
+    // constraints of the external ones stay in the partitioned domain.
+    std::deque<std::pair<int,int> > internalSPs; // (constraint, partition)
     SFreedom_ConstraintIter &theDomainSP = myDomain->getConstraints().getSPs();
     SFreedom_Constraint *spPtr;
     while((spPtr = theDomainSP()) != 0)
@@ -506,19 +513,24 @@ int XC::DomainPartitioner::partition(int numParts, bool usingMain, int mainParti
 
         NodeLocations *theNodeLocation = (NodeLocations *)theTaggedObject;
         const std::set<int> &nodePartitions = theNodeLocation->nodePartitions;
-        for(std::set<int>::const_iterator i= nodePartitions.begin(); i!=nodePartitions.end(); i++)
+        if(nodePartitions.size() == 1)
           {
-            int partition = *i;
+            const int partition= *nodePartitions.begin();
             if(partition != mainPartition)
-              {
-                Subdomain *theSubdomain = myDomain->getSubdomainPtr(partition);
-                if(numPartitions == 1)
-                  { myDomain->removeSFreedom_Constraint(spPtr->getTag()); }
-                int res = theSubdomain->addSFreedom_Constraint(spPtr);
-                if(res < 0)
-                  std::cerr << getClassName() << "::" << __FUNCTION__
-			    << "; failed to add SP Constraint.\n";
-              }
+              internalSPs.push_back(std::make_pair(spPtr->getTag(),partition));
+          }
+      }
+    for(std::deque<std::pair<int,int> >::const_iterator i= internalSPs.begin(); i!=internalSPs.end(); i++)
+      {
+        spPtr= myDomain->getConstraints().getSFreedom_Constraint(i->first);
+        SFreedom_Constraint *spCopy= spPtr->getCopy();
+        myDomain->removeSFreedom_Constraint(i->first);
+        Subdomain *theSubdomain = myDomain->getSubdomainPtr(i->second);
+        if(!theSubdomain->addSFreedom_Constraint(spCopy))
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; failed to add SP Constraint.\n";
+            delete spCopy;
           }
       }
 
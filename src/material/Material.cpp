@@ -124,6 +124,11 @@ int XC::Material::getResponse(int responseID, Information &info)
 void XC::Material::update(void)
    {return;}
 
+//! @brief Return true if the tangent of the material doesn't depend
+//! on its state (linear elastic materials).
+bool XC::Material::isTangentConstant(void) const
+  { return false; }
+
 //! @brief Increments generalized strain
 //! @param incS: strain increment.
 void XC::Material::addInitialGeneralizedStrain(const Vector &incS)
@@ -74,6 +74,7 @@ class MaterialVector: public std::vector<MAT *>, public CommandEntity, public Mo
     int commitState(void);
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isTangentConstant(void) const;
 
     void setInitialGeneralizedStrains(const std::vector<Vector> &);
     void addInitialGeneralizedStrains(const std::vector<Vector> &);
@@ -251,6 +252,21 @@ int MaterialVector<MAT>::revertToStart(void)
     return retVal;
   }
 
+//! @brief Return true if the tangent of all the materials
+//! is constant (see Material::isTangentConstant).
+template <class MAT>
+bool MaterialVector<MAT>::isTangentConstant(void) const
+  {
+    bool retval= !mat_vector::empty();
+    for(const_iterator i=mat_vector::begin();i!=mat_vector::end();i++)
+      if(!(*i) || !(*i)->isTangentConstant())
+        {
+          retval= false;
+          break;
+        }
+    return retval;
+  }
+
 //! @brief Returns the size of stress vector.
 template <class MAT>
 size_t MaterialVector<MAT>::getGeneralizedStressSize(void) const
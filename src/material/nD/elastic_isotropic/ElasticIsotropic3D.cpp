@@ -54,6 +54,7 @@
 #include <material/nD/elastic_isotropic/ElasticIsotropic3D.h>
 
 #include "utility/matrix/Matrix.h"
+#include "utility/matrix/nDarray/FixedTensor.h"
 #include "material/nD/NDMaterialType.h"
 
 XC::Matrix XC::ElasticIsotropic3D::D(6,6);	  // global for XC::ElasticIsotropic3D only
@@ -192,7 +193,8 @@ const XC::stresstensor &XC::ElasticIsotropic3D::getStressTensor(void) const
         Dt = BJtensor( 4, def_dim_4, 0.0 ); 
         setInitElasticStiffness();
       }
-    Stress = Dt("ijkl") * Strain("kl");
+    Tensor2<3> sigma_ij= ddot(Tensor4<3>(Dt),Tensor2<3>(Strain));
+    Stress = stresstensor(sigma_ij.getComponents());
     return Stress;
   }
 
@@ -237,24 +239,9 @@ void XC::ElasticIsotropic3D::Print(std::ostream &s, int flag)
 //================================================================================
 void XC::ElasticIsotropic3D::setInitElasticStiffness(void) const
   {    
-    BJtensor ret( 4, def_dim_4, 0.0 );
-    				       
-    // Kronecker delta XC::BJtensor
-    BJtensor I2("I", 2, def_dim_2);
-
-    BJtensor I_ijkl = I2("ij")*I2("kl");
-
-
-    //I_ijkl.null_indices();
-    BJtensor I_ikjl = I_ijkl.transpose0110();
-    BJtensor I_iljk = I_ijkl.transpose0111();
-    BJtensor I4s = (I_ikjl+I_iljk)*0.5;
-    
     // Building elasticity BJtensor
-    ret = I_ijkl*( E*v / ( (1.0+v)*(1.0 - 2.0*v) ) ) + I4s*( E / (1.0 + v) );
-    
-    //ret.print();
-    Dt= ret;
+    const Tensor4<3> ret= Tensor4<3>::isotropic(E*v / ( (1.0+v)*(1.0 - 2.0*v) ), E / (1.0 + v));
+    Dt= ret.getBJtensor();
 
     return;
   }
@@ -61,6 +61,7 @@
 #include <utility/matrix/nDarray/straint.h>
 #include <utility/matrix/nDarray/stresst.h>
 #include <utility/matrix/nDarray/Tensor.h>
+#include <utility/matrix/nDarray/FixedTensor.h>
 
 #include "material/nD/NDMaterialType.h"
 
@@ -199,7 +200,8 @@ const XC::stresstensor &XC::PressureDependentElastic3D::getStressTensor(void) co
       return Stress;
     else
       {
-        Stress = Dt("ijkl") * Strain("kl");
+        Tensor2<3> sigma_ij= ddot(Tensor4<3>(Dt),Tensor2<3>(Strain));
+        Stress = stresstensor(sigma_ij.getComponents());
         return Stress;
       }
   }
@@ -217,19 +219,6 @@ const XC::straintensor &XC::PressureDependentElastic3D::getPlasticStrainTensor(v
 int XC::PressureDependentElastic3D::commitState(void)
   {
     //Set the new Elastic constants
-    BJtensor ret( 4, def_dim_4, 0.0 );
-
-    // Kronecker delta XC::BJtensor
-    BJtensor I2("I", 2, def_dim_2);
-
-    BJtensor I_ijkl = I2("ij")*I2("kl");
-
-
-    //I_ijkl.null_indices();
-    BJtensor I_ikjl = I_ijkl.transpose0110();
-    BJtensor I_iljk = I_ijkl.transpose0111();
-    BJtensor I4s = (I_ikjl+I_iljk)*0.5;
-
     //Update E according to hydrostatic stress
     Stress = this->getStressTensor();
     //Dt("ijkl") * Strain("kl");
@@ -245,10 +234,8 @@ int XC::PressureDependentElastic3D::commitState(void)
     //std::cerr << " coef = " << Ec/E << std::endl;
 
     // Building elasticity XC::BJtensor
-    ret = I_ijkl*( Ec*v / ( (1.0+v)*(1.0 - 2.0*v) ) ) + I4s*( Ec / (1.0 + v) );
-
-    //ret.print();
-    Dt = ret;
+    const Tensor4<3> ret= Tensor4<3>::isotropic(Ec*v / ( (1.0+v)*(1.0 - 2.0*v) ), Ec / (1.0 + v));
+    Dt = ret.getBJtensor();
 
     return 0;
   }
@@ -347,14 +334,6 @@ void XC::PressureDependentElastic3D::Print(std::ostream &s, int flag)
 //================================================================================
 void XC::PressureDependentElastic3D::ComputeElasticStiffness(void) const
   {
-    BJtensor ret( 4, def_dim_4, 0.0 );
-    // Kronecker delta XC::BJtensor
-    BJtensor I2("I", 2, def_dim_2);
-    BJtensor I_ijkl = I2("ij")*I2("kl");
-    //I_ijkl.null_indices();
-    BJtensor I_ikjl = I_ijkl.transpose0110();
-    BJtensor I_iljk = I_ijkl.transpose0111();
-    BJtensor I4s = (I_ikjl+I_iljk)*0.5;
     //Initialize E according to initial pressure in the gauss point
     Stress = getStressTensor();
     //Dt("ijkl") * Strain("kl");
@@ -367,8 +346,7 @@ void XC::PressureDependentElastic3D::ComputeElasticStiffness(void) const
     //std::cerr << " E@ref = " << E << " Eo = " << Eo << std::endl;
 
     // Building elasticity XC::BJtensor
-    ret = I_ijkl*( Eo*v / ( (1.0+v)*(1.0 - 2.0*v) ) ) + I4s*( Eo / (1.0 + v) );
-    //ret.print();
-    Dt = ret;
+    const Tensor4<3> ret= Tensor4<3>::isotropic(Eo*v / ( (1.0+v)*(1.0 - 2.0*v) ), Eo / (1.0 + v));
+    Dt = ret.getBJtensor();
     return;
   }
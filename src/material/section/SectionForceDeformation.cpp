@@ -110,6 +110,12 @@ XC::SectionForceDeformation::~SectionForceDeformation(void)
     fDefault= nullptr;
   }
 
+//! @brief Return true if the trial state of the section can be updated
+//! concurrently with the state of other sections (i.e. the
+//! section doesn't use shared scratch storage).
+bool XC::SectionForceDeformation::isThreadSafe(void) const
+  { return false; }
+
 //! @brief Comma separated internal forces names to with the section contributes with stiffness.
 std::string XC::SectionForceDeformation::getTypeString(void) const
   { return getType().getString(); }
@@ -99,6 +99,7 @@ class SectionForceDeformation: public Material
 
     inline MaterialHandler *getMaterialHandler(void)
       { return material_handler; }
+    virtual bool isThreadSafe(void) const;
 
     virtual void zeroInitialSectionDeformation(void)= 0;
     virtual int setInitialSectionDeformation(const Vector &)= 0;
@@ -63,6 +63,10 @@ int XC::BaseElasticSection::revertToStart(void)
     return 0;
   }
 
+//! @brief The section stiffness doesn't depend on the deformation.
+bool XC::BaseElasticSection::isTangentConstant(void) const
+  { return true; }
+
 //! @brief Set the initial (generalized) deformation of the section.
 int XC::BaseElasticSection::setInitialSectionDeformation(const Vector &def)
   {
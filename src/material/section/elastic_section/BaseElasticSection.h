@@ -58,6 +58,7 @@ class BaseElasticSection: public PrismaticBarCrossSection
     int commitState(void);
     int revertToLastCommit (void);
     int revertToStart (void);
+    bool isTangentConstant(void) const;
 
     virtual void sectionGeometry(const std::string &)= 0;
 
@@ -43,6 +43,8 @@
 #include "material/section/interaction_diagram/InteractionDiagram2d.h"
 #include "material/section/interaction_diagram/NMPointCloud.h"
 #include "material/section/interaction_diagram/NMyMzPointCloud.h"
+#include "utility/ThreadPool.h"
+#include <algorithm>
 #include "xc_utils/src/geom/pos_vec/Vector3d.h"
 #include "xc_utils/src/geom/d2/Triang3dMesh.h"
 #include "xc_utils/src/geom/d3/ConvexHull3d.h"
@@ -169,10 +171,16 @@ int XC::FiberSectionBase::setTrialSectionDeformation(const Vector &deforms)
     return 0;
   }
 
+//! @brief The fiber state is stored in the fiber materials, so the
+//! section can be updated concurrently with other sections if all
+//! its materials can (see UniaxialMaterial::isThreadSafe).
+bool XC::FiberSectionBase::isThreadSafe(void) const
+  { return fibers.isThreadSafe(); }
+
 //! @brief Returns material's trial generalized strain.
 const XC::Vector &XC::FiberSectionBase::getSectionDeformation(void) const
   {
-    static Vector retval;
+    thread_local Vector retval;
     retval= eTrial-eInic;
     return retval;
   }
@@ -643,11 +651,9 @@ void XC::FiberSectionBase::getInteractionDiagramPointsForTheta(NMyMzPointCloud &
 
 //! @brief Returns the points that define the interaction diagram
 //! on the plane defined by the \f$\theta\f$ angle being passed as parameter.
-const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta)
+XC::NMPointCloud XC::FiberSectionBase::getInteractionDiagramPointsForPlane(const InteractionDiagramData &diag_data, const double &theta)
   {
-    static NMPointCloud retval;
-    retval.clear();
-    retval.setUmbral(diag_data.getUmbral());
+    NMPointCloud retval(diag_data.getUmbral());
     const FiberPtrDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
     if(fsC.empty())
       std::cerr << getClassName() << "::" << __FUNCTION__
@@ -662,9 +668,7 @@ const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlan
                 << ", not found." << std::endl;
     if(!fsC.empty() && !fsS.empty())
       {
-        static NMyMzPointCloud tmp;
-        tmp.clear();
-        tmp.setUmbral(diag_data.getUmbral());
+        NMyMzPointCloud tmp(diag_data.getUmbral());
         getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta);
         getInteractionDiagramPointsForTheta(tmp,diag_data,fsC,fsS,theta+M_PI); //theta+M_PI
         retval= tmp.getNM(theta);
@@ -676,12 +680,44 @@ const XC::NMPointCloud &XC::FiberSectionBase::getInteractionDiagramPointsForPlan
     return retval;
   }
 
+//! @brief Computes the points of the interaction diagram for the angles
+//! being passed as parameter using numThreads threads.
+//!
+//! Each thread works on its own copy of the section, so the state of this
+//! object is not modified. The points obtained for each angle are appended
+//! to lista_esfuerzos in the order of the angles, so the result is the
+//! same that a serial sweep would produce.
+void XC::FiberSectionBase::getInteractionDiagramPointsForThetas(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &diag_data,const std::vector<double> &thetas,const size_t &numThreads) const
+  {
+    ThreadPool pool(numThreads);
+    const size_t nt= pool.size();
+    std::vector<FiberSectionBase *> copies(nt,nullptr);
+    std::vector<const FiberPtrDeque *> fsCs(nt,nullptr);
+    std::vector<const FiberPtrDeque *> fsSs(nt,nullptr);
+    for(size_t t= 0;t<nt;t++)
+      {
+        copies[t]= dynamic_cast<FiberSectionBase *>(getCopy());
+        fsCs[t]= &(copies[t]->sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second);
+        fsSs[t]= &(copies[t]->sel_mat_tag(diag_data.getRebarSetName(),diag_data.getReinforcementTag())->second);
+      }
+    //Points are filtered (umbral) when merged.
+    std::vector<NMyMzPointCloud> partial(thetas.size(),NMyMzPointCloud(0.0));
+    pool.parallel_for(thetas.size(),[&](const size_t &i,const size_t &t)
+      { copies[t]->getInteractionDiagramPointsForTheta(partial[i],diag_data,*fsCs[t],*fsSs[t],thetas[i]); },1);
+    for(size_t i= 0;i<partial.size();i++)
+      for(NMyMzPointCloud::const_iterator j= partial[i].begin();j!=partial[i].end();j++)
+        lista_esfuerzos.append(*j);
+    for(size_t t= 0;t<nt;t++)
+      delete copies[t];
+  }
+
 //! @brief Returns the points that define the interaction diagram of the section.
-const XC::NMyMzPointCloud &XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data)
+//!
+//! If the number of threads specified in diag_data is greater than one
+//! the angles are swept concurrently (see getInteractionDiagramPointsForThetas).
+XC::NMyMzPointCloud XC::FiberSectionBase::getInteractionDiagramPoints(const InteractionDiagramData &diag_data)
   {
-    static NMyMzPointCloud lista_esfuerzos;
-    lista_esfuerzos.clear();
-    lista_esfuerzos.setUmbral(diag_data.getUmbral());
+    NMyMzPointCloud lista_esfuerzos(diag_data.getUmbral());
     const FiberPtrDeque &fsC= sel_mat_tag(diag_data.getConcreteSetName(),diag_data.getConcreteTag())->second;
     if(fsC.empty())
       std::cerr << getClassName() << "::" << __FUNCTION__
@@ -696,9 +732,21 @@ const XC::NMyMzPointCloud &XC::FiberSectionBase::getInteractionDiagramPoints(con
                 << ", not found." << std::endl;
     if(!fsC.empty() && !fsS.empty())
       {
+        std::vector<double> thetas;
         for(double theta= 0.0;theta<2*M_PI;theta+=diag_data.getIncTheta())
-          getInteractionDiagramPointsForTheta(lista_esfuerzos,diag_data,fsC,fsS,theta);
-        revertToStart();
+          thetas.push_back(theta);
+        size_t numThreads= diag_data.getNumThreads();
+        if(numThreads==0)
+          numThreads= ThreadPool::getHardwareConcurrency();
+        numThreads= std::min(numThreads,thetas.size());
+        if(numThreads>1)
+          getInteractionDiagramPointsForThetas(lista_esfuerzos,diag_data,thetas,numThreads);
+        else
+          {
+            for(std::vector<double>::const_iterator i= thetas.begin();i!=thetas.end();i++)
+              getInteractionDiagramPointsForTheta(lista_esfuerzos,diag_data,fsC,fsS,*i);
+            revertToStart();
+          }
       }
     else
       std::cerr << getClassName() << "::" << __FUNCTION__
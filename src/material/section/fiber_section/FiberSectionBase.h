@@ -81,8 +81,9 @@ class FiberSectionBase: public PrismaticBarCrossSection
     Pos3d Esf2Pos3d(void) const;
     Pos3d getNMyMz(const DeformationPlane &);
     void getInteractionDiagramPointsForTheta(NMyMzPointCloud &lista_esfuerzos,const InteractionDiagramData &,const FiberPtrDeque &,const FiberPtrDeque &,const double &);
-    const NMyMzPointCloud &getInteractionDiagramPoints(const InteractionDiagramData &);
-    const NMPointCloud &getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &);
+    void getInteractionDiagramPointsForThetas(NMyMzPointCloud &,const InteractionDiagramData &,const std::vector<double> &,const size_t &) const;
+    NMyMzPointCloud getInteractionDiagramPoints(const InteractionDiagramData &);
+    NMPointCloud getInteractionDiagramPointsForPlane(const InteractionDiagramData &, const double &);
   public:
     FiberSectionBase(int classTag,int dim,MaterialHandler *mat_ldr= nullptr); 
     FiberSectionBase(int tag, int classTag,int dim,MaterialHandler *mat_ldr= nullptr);
@@ -96,11 +97,18 @@ class FiberSectionBase: public PrismaticBarCrossSection
       { return fibers.getNumFibers(); }
     inline FiberContainer &getFibers(void)
       { return fibers; }
+    //! @brief Return true if the fibers are updated using packed arrays.
+    inline bool usePackedFibers(void) const
+      { return fibers.usePackedFibers(); }
+    //! @brief Activates/deactivates the update of the fibers using packed arrays.
+    inline void setPackedFibers(const bool &b)
+      { fibers.setPackedFibers(b); }
     virtual Fiber *addFiber(Fiber &)= 0;
     virtual Fiber *addFiber(int tag,const MaterialHandler &,const std::string &nmbMat,const double &, const Vector &position)= 0;
     Fiber *addFiber(const std::string &nmbMat,const double &area,const Vector &coo);
     int setInitialSectionDeformation(const Vector &deforms); 
     int setTrialSectionDeformation(const Vector &deforms);
+    virtual bool isThreadSafe(void) const;
     inline void zeroInitialSectionDeformation(void)
       { eInic.Zero(); }
     inline const Vector &getInitialSectionDeformation(void) const
@@ -346,6 +346,11 @@ const XC::Vector &XC::FiberSectionShear3d::getStressResultant(void) const
     return s;
   }
 
+//! @brief The section uses class-wide static storage for its
+//! stress resultant and tangent so it can't be updated concurrently.
+bool XC::FiberSectionShear3d::isThreadSafe(void) const
+  { return false; }
+
 //! @brief Virtual constructor.
 XC::SectionForceDeformation *XC::FiberSectionShear3d::getCopy(void) const
   { return new FiberSectionShear3d(*this); }
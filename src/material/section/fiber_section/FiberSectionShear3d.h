@@ -90,6 +90,7 @@ class FiberSectionShear3d : public FiberSection3d
     int revertToLastCommit(void);    
     int revertToStart(void);
  
+    virtual bool isThreadSafe(void) const;
     SectionForceDeformation *getCopy(void) const;
     const ResponseId &getType(void) const;
     int getOrder(void) const;
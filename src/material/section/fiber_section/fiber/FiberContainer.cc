@@ -70,6 +70,7 @@ void XC::FiberContainer::free_mem(void)
           (*this)[i]= nullptr;
         }
     clear();
+    packedArrays.invalidate();
   }
 
 //! @brief Default constructor.
@@ -79,12 +80,16 @@ XC::FiberContainer::FiberContainer(const size_t &num)
 //! @brief Copy constructor.
 XC::FiberContainer::FiberContainer(const FiberContainer &other)
   : FiberPtrDeque() //Don't copy pointers
-  { copy_fibers(other); }
+  {
+    packedFibers= other.packedFibers;
+    copy_fibers(other);
+  }
 
 //! @brief Assignment operator.
 XC::FiberContainer &XC::FiberContainer::operator=(const FiberContainer &other)
   {
     CommandEntity::operator=(other); //Don't copy pointers
+    packedFibers= other.packedFibers;
     copy_fibers(other); //They are copied here.
     return *this;
   }
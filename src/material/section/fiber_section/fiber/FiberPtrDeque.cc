@@ -55,12 +55,12 @@
 
 //! @brief Constructor.
 XC::FiberPtrDeque::FiberPtrDeque(const size_t &num)
-  : CommandEntity(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), yCenterOfMass(0.0), zCenterOfMass(0.0)
+  : CommandEntity(), fiber_ptrs_dq(num,static_cast<Fiber *>(nullptr)), yCenterOfMass(0.0), zCenterOfMass(0.0), packedFibers(false)
   {}
 
 //! @brief Copy constructor.
 XC::FiberPtrDeque::FiberPtrDeque(const FiberPtrDeque &other)
-  : CommandEntity(other), fiber_ptrs_dq(other), yCenterOfMass(other.yCenterOfMass), zCenterOfMass(other.zCenterOfMass)
+  : CommandEntity(other), fiber_ptrs_dq(other), yCenterOfMass(other.yCenterOfMass), zCenterOfMass(other.zCenterOfMass), packedFibers(other.packedFibers)
   {}
 
 //! @brief Assignment operator.
@@ -70,12 +70,25 @@ XC::FiberPtrDeque &XC::FiberPtrDeque::operator=(const FiberPtrDeque &other)
     fiber_ptrs_dq::operator=(other);
     yCenterOfMass= other.yCenterOfMass;
     zCenterOfMass= other.zCenterOfMass;
+    packedFibers= other.packedFibers;
+    packedArrays.invalidate();
     return *this;
   }
 
 //! @brief Adds the fiber to the container.
 void XC::FiberPtrDeque::push_back(Fiber *f)
-   { fiber_ptrs_dq::push_back(f); }
+   {
+     fiber_ptrs_dq::push_back(f);
+     packedArrays.invalidate();
+   }
+
+//! @brief Activates/deactivates the update of the fibers
+//! trial state using packed arrays (see PackedFiberArrays).
+void XC::FiberPtrDeque::setPackedFibers(const bool &b)
+  {
+    packedFibers= b;
+    packedArrays.invalidate();
+  }
 
 
 //! @brief Search for the fiber identified by the parameter.
@@ -1562,6 +1575,24 @@ int XC::FiberPtrDeque::commitState(void)
     return err;
   }
 
+//! @brief Return true if the materials of all the fibers can be
+//! updated concurrently with other materials (see
+//! UniaxialMaterial::isThreadSafe).
+bool XC::FiberPtrDeque::isThreadSafe(void) const
+  {
+    bool retval= true;
+    for(const_iterator i= begin();i!= end();i++)
+      {
+        const UniaxialMaterial *mat= (*i)->getMaterial();
+        if(!mat || !mat->isThreadSafe())
+          {
+            retval= false;
+            break;
+          }
+      }
+    return retval;
+  }
+
 //! @brief Sets initial strains values.
 int XC::FiberPtrDeque::setInitialSectionDeformation(const FiberSection2d &Section2d)
   {
@@ -1584,6 +1615,17 @@ int XC::FiberPtrDeque::setTrialSectionDeformation(const FiberSection2d &Section2
   {
     int retval= 0;
     kr2.zero();
+    if(packedFibers)
+      {
+        if(!packedArrays.isValid(size(),false)) //Zero area fibers ignored.
+          packedArrays.pack(*this,false);
+        const Vector &def= Section2d.getSectionDeformation();
+        packedArrays.computeStrains(def(0),def(1));
+        retval= packedArrays.setTrial();
+        packedArrays.sumKR2d(kr2.kData,kr2.rData);
+        kr2.kData[2]= kr2.kData[1]; //Simetría.
+        return retval;
+      }
     UniaxialMaterial *theMat;
     double y,fiberArea,strain,tangent,stress, fs0; 
     std::deque<Fiber *>::iterator i= begin();
@@ -1637,10 +1679,10 @@ int XC::FiberPtrDeque::revertToStart(FiberSection2d &Section2d,CrossSectionKR &k
 //! @brief Return the initial tangent stiffness matrix.
 const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection2d &Section2d) const
   {
-    static double kInitial[4];
+    thread_local double kInitial[4];
     kInitial[0]= 0.0; kInitial[1]= 0.0;
     kInitial[2]= 0.0; kInitial[3]= 0.0;
-    static Matrix kInitialMatrix(kInitial, 2, 2);
+    thread_local Matrix kInitialMatrix(kInitial, 2, 2);
 
     std::deque<Fiber *>::const_iterator i= begin();
     UniaxialMaterial *theMat= nullptr;
@@ -1762,6 +1804,19 @@ int XC::FiberPtrDeque::setTrialSectionDeformation(FiberSection3d &Section3d,Cros
   {
     int retval= 0;
     kr3.zero();
+    if(packedFibers)
+      {
+        if(!packedArrays.isValid(size(),true)) //All fibers are updated.
+          packedArrays.pack(*this,true);
+        const Vector &def= Section3d.getSectionDeformation();
+        packedArrays.computeStrains(def(0),def(1),def(2));
+        retval= packedArrays.setTrial();
+        packedArrays.sumKR3d(kr3.kData,kr3.rData);
+        kr3.kData[3]= kr3.kData[1]; //Stiffness matrix symmetry.
+        kr3.kData[6]= kr3.kData[2];
+        kr3.kData[7]= kr3.kData[5];
+        return retval;
+      }
     std::deque<Fiber *>::iterator i= begin();
     UniaxialMaterial *theMat;
     double y,z,fiberArea,tangent,stress, fs0; 
@@ -1819,8 +1874,8 @@ int XC::FiberPtrDeque::revertToStart(FiberSection3d &Section3d,CrossSectionKR &k
 //! @brief Return the tangent stiffness matrix inicial.
 const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSection3d &Section3d) const
   {
-    static double kInitialData[9];
-    static XC::Matrix kInitial(kInitialData, 3, 3);
+    thread_local double kInitialData[9];
+    thread_local XC::Matrix kInitial(kInitialData, 3, 3);
 
     kInitialData[0]= 0.0; kInitialData[1]= 0.0; kInitialData[2]= 0.0;
     kInitialData[3]= 0.0; kInitialData[4]= 0.0; kInitialData[5]= 0.0;
@@ -1977,14 +2032,14 @@ int XC::FiberPtrDeque::revertToStart(FiberSectionGJ &SectionGJ,CrossSectionKR &k
 //! @brief Return the initial tangent stiffness matrix.
 const XC::Matrix &XC::FiberPtrDeque::getInitialTangent(const FiberSectionGJ &SectionGJ) const
   {
-    static double kInitialData[16];
+    thread_local double kInitialData[16];
 
     kInitialData[0]= 0.0; kInitialData[1]= 0.0; kInitialData[2]= 0.0; kInitialData[3]= 0.0;
     kInitialData[4]= 0.0; kInitialData[5]= 0.0; kInitialData[6]= 0.0; kInitialData[7]= 0.0;
     kInitialData[8]= 0.0; kInitialData[9]= 0.0; kInitialData[10]= 0.0; kInitialData[11]= 0.0;
     kInitialData[12]= 0.0; kInitialData[13]= 0.0; kInitialData[14]= 0.0; kInitialData[15]= 0.0;
 
-    static XC::Matrix kInitial(kInitialData, 4, 4);
+    thread_local XC::Matrix kInitial(kInitialData, 4, 4);
     UniaxialMaterial *theMat;
     double y,z,fiberArea,tangent; 
     std::deque<Fiber *>::const_iterator i= begin();
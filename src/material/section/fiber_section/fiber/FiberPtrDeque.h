@@ -31,6 +31,7 @@
 
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include "xc_utils/src/geom/GeomObj.h"
+#include "PackedFiberArrays.h"
 #include <deque>
 
 class Ref3d3d;
@@ -77,8 +78,14 @@ class FiberPtrDeque: public CommandEntity, public std::deque<Fiber *>
     mutable std::deque<double> recubs; //! Cover for each fiber.
     mutable std::deque<double> seps; //! Spacing for each fiber.
 
+    bool packedFibers; //!< If true update the fibers using packed arrays.
+    PackedFiberArrays packedArrays; //!< Packed copy of the fiber data.
+
     inline void resize(const size_t &nf)
-      { fiber_ptrs_dq::resize(nf,nullptr); }
+      {
+        fiber_ptrs_dq::resize(nf,nullptr);
+        packedArrays.invalidate();
+      }
 
     inline reference operator[](const size_t &i)
       { return fiber_ptrs_dq::operator[](i); }
@@ -96,6 +103,12 @@ class FiberPtrDeque: public CommandEntity, public std::deque<Fiber *>
     inline size_t getNumFibers(void) const
       { return size(); }
 
+    //! @brief Return true if the trial state of the fibers is
+    //! updated using packed arrays (see PackedFiberArrays).
+    inline bool usePackedFibers(void) const
+      { return packedFibers; }
+    void setPackedFibers(const bool &);
+
     const Fiber *findFiber(const int &tag) const;
     Fiber *findFiber(const int &tag);
     bool in(const Fiber *ptr) const;
@@ -137,6 +150,7 @@ class FiberPtrDeque: public CommandEntity, public std::deque<Fiber *>
     const Vector &getCentroidFibersWithStrainGreaterThan(const double &epsRef) const;
 
     int commitState(void);
+    bool isThreadSafe(void) const;
 
     double getStrainMin(void) const;
     double getStrainMax(void) const;
@@ -0,0 +1,205 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PackedFiberArrays.cc
+
+#include "PackedFiberArrays.h"
+#include "material/section/fiber_section/fiber/Fiber.h"
+#include "material/uniaxial/UniaxialMaterial.h"
+#include <typeindex>
+#include <algorithm>
+
+//! @brief Default constructor.
+XC::PackedFiberArrays::PackedFiberArrays(void)
+  : valid(false), zeroAreaFibers(false), numFibers(0) {}
+
+//! @brief Return true if the arrays correspond to a container
+//! with nf fibers packed with the same treatment of the zero area fibers.
+bool XC::PackedFiberArrays::isValid(const size_t &nf,const bool &zeroArea) const
+  { return (valid && (nf==numFibers) && (zeroArea==zeroAreaFibers)); }
+
+//! @brief Copy the data of the fibers into the arrays, grouping them
+//! by the type of their material.
+//!
+//! @param fibers: fiber container.
+//! @param zeroArea: if false the fibers with zero area are ignored.
+void XC::PackedFiberArrays::pack(const std::deque<Fiber *> &fibers,const bool &zeroArea)
+  {
+    //Fiber indexes sorted by material type (stable, so the
+    //fibers of each group keep their order).
+    std::vector<size_t> order;
+    order.reserve(fibers.size());
+    for(size_t i= 0;i<fibers.size();i++)
+      if(zeroArea || (fibers[i]->getArea()!=0.0))
+        order.push_back(i);
+    std::vector<std::type_index> types;
+    types.reserve(fibers.size());
+    for(size_t i= 0;i<fibers.size();i++)
+      types.push_back(std::type_index(typeid(*fibers[i]->getMaterial())));
+    std::stable_sort(order.begin(),order.end(),[&types](const size_t &a,const size_t &b)
+                     { return types[a]<types[b]; });
+
+    const size_t sz= order.size();
+    materials.resize(sz);
+    yLoc.resize(sz); zLoc.resize(sz); area.resize(sz);
+    strain.assign(sz,0.0); stress.assign(sz,0.0); tangent.assign(sz,0.0);
+    groups.clear();
+    for(size_t j= 0;j<sz;j++)
+      {
+        const size_t i= order[j];
+        const Fiber *f= fibers[i];
+        if((j==0) || (types[i]!=types[order[j-1]]))
+          groups.push_back(j);
+        materials[j]= const_cast<Fiber *>(f)->getMaterial();
+        yLoc[j]= f->getLocY();
+        zLoc[j]= f->getLocZ();
+        area[j]= f->getArea();
+      }
+    groups.push_back(sz);
+    numFibers= fibers.size();
+    zeroAreaFibers= zeroArea;
+    valid= true;
+  }
+
+//! @brief Compute the fiber strains of a 2D section
+//! (strain= e0+ky*y).
+void XC::PackedFiberArrays::computeStrains(const double &e0,const double &ky)
+  {
+    const size_t sz= size();
+    const double *y= yLoc.data();
+    double *eps= strain.data();
+    for(size_t i= 0;i<sz;i++)
+      eps[i]= e0 + y[i]*ky;
+  }
+
+//! @brief Compute the fiber strains of a 3D section
+//! (strain= e0+ky*y+kz*z).
+void XC::PackedFiberArrays::computeStrains(const double &e0,const double &ky,const double &kz)
+  {
+    const size_t sz= size();
+    const double *y= yLoc.data();
+    const double *z= zLoc.data();
+    double *eps= strain.data();
+    for(size_t i= 0;i<sz;i++)
+      eps[i]= e0 + y[i]*ky + z[i]*kz;
+  }
+
+//! @brief Set the trial strain of the fiber materials, group by
+//! group, and store their stresses and tangents.
+int XC::PackedFiberArrays::setTrial(void)
+  {
+    int retval= 0;
+    const size_t ng= getNumGroups();
+    for(size_t g= 0;g<ng;g++)
+      {
+        const size_t b= groups[g];
+        const size_t n= groups[g+1]-b;
+        retval+= materials[b]->setTrialBatch(n,&materials[b],&strain[b],&stress[b],&tangent[b]);
+      }
+    return retval;
+  }
+
+//! @brief Add the contribution of the fibers to the stiffness matrix
+//! and stress resultant data of a 2D section (see CrossSectionKR::updateK2d
+//! and CrossSectionKR::updateNMz).
+void XC::PackedFiberArrays::sumKR2d(double k[],double r[]) const
+  {
+    const size_t nq= 5;
+    double acc[nq][lanes];
+    std::fill(&acc[0][0],&acc[0][0]+nq*lanes,0.0);
+    const size_t sz= size();
+    for(size_t i= 0;i<sz;i+= lanes)
+      {
+        const size_t nl= std::min(lanes,sz-i);
+        for(size_t j= 0;j<nl;j++)
+          {
+            const size_t l= i+j;
+            const double y= yLoc[l];
+            const double value= tangent[l]*area[l];
+            const double vas1= y*value;
+            const double fs0= stress[l]*area[l];
+            acc[0][j]+= value;
+            acc[1][j]+= vas1;
+            acc[2][j]+= vas1*y;
+            acc[3][j]+= fs0;
+            acc[4][j]+= fs0*y;
+          }
+      }
+    for(size_t j= 0;j<lanes;j++)
+      {
+        k[0]+= acc[0][j]; //Axial stiffness
+        k[1]+= acc[1][j];
+        k[2]+= acc[2][j];
+        r[0]+= acc[3][j]; //N.
+        r[1]+= acc[4][j]; //Mz.
+      }
+  }
+
+//! @brief Add the contribution of the fibers to the stiffness matrix
+//! and stress resultant data of a 3D section (see CrossSectionKR::updateK3d
+//! and CrossSectionKR::updateNMzMy).
+void XC::PackedFiberArrays::sumKR3d(double k[],double r[]) const
+  {
+    const size_t nq= 9;
+    double acc[nq][lanes];
+    std::fill(&acc[0][0],&acc[0][0]+nq*lanes,0.0);
+    const size_t sz= size();
+    for(size_t i= 0;i<sz;i+= lanes)
+      {
+        const size_t nl= std::min(lanes,sz-i);
+        for(size_t j= 0;j<nl;j++)
+          {
+            const size_t l= i+j;
+            const double y= yLoc[l];
+            const double z= zLoc[l];
+            const double value= tangent[l]*area[l];
+            const double vas1= y*value;
+            const double vas2= z*value;
+            const double fs0= stress[l]*area[l];
+            acc[0][j]+= value;
+            acc[1][j]+= vas1;
+            acc[2][j]+= vas2;
+            acc[3][j]+= vas1*y;
+            acc[4][j]+= vas1*z;
+            acc[5][j]+= vas2*z;
+            acc[6][j]+= fs0;
+            acc[7][j]+= fs0*y;
+            acc[8][j]+= fs0*z;
+          }
+      }
+    for(size_t j= 0;j<lanes;j++)
+      {
+        k[0]+= acc[0][j]; //Axial stiffness
+        k[1]+= acc[1][j];
+        k[2]+= acc[2][j];
+        k[4]+= acc[3][j];
+        k[5]+= acc[4][j];
+        k[8]+= acc[5][j];
+        r[0]+= acc[6][j]; //N.
+        r[1]+= acc[7][j]; //Mz.
+        r[2]+= acc[8][j]; //My.
+      }
+  }
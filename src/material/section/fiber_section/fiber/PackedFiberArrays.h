@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PackedFiberArrays.h
+
+#ifndef PackedFiberArrays_h
+#define PackedFiberArrays_h
+
+#include <deque>
+#include <vector>
+#include <cstddef>
+
+namespace XC {
+class Fiber;
+class UniaxialMaterial;
+
+//! @ingroup MATSCCFibers
+//
+//! @brief Structure of arrays copy of the fiber data used when
+//! updating the trial state of a fiber section.
+//!
+//! Positions, areas, strains, stresses and tangents are stored
+//! in contiguous arrays and the fibers are grouped by the type
+//! of their material, so the strains and the section stiffness
+//! and resultant can be computed with loops the compiler can
+//! vectorize, and the materials of each group can be updated
+//! with a single call to UniaxialMaterial::setTrialBatch.
+class PackedFiberArrays
+  {
+  public:
+    typedef std::vector<double> dbl_vector;
+    typedef std::vector<UniaxialMaterial *> material_vector;
+  private:
+    static const size_t lanes= 4; //!< Number of partial sums in reductions.
+    bool valid; //!< False if the arrays must be rebuilt.
+    bool zeroAreaFibers; //!< True if fibers with zero area are included.
+    size_t numFibers; //!< Number of fibers in the container when packed.
+    material_vector materials; //!< Fiber materials grouped by type.
+    std::vector<size_t> groups; //!< First position of each material group.
+    dbl_vector yLoc; //!< Fiber y coordinates.
+    dbl_vector zLoc; //!< Fiber z coordinates.
+    dbl_vector area; //!< Fiber areas.
+    dbl_vector strain; //!< Fiber trial strains.
+    dbl_vector stress; //!< Fiber stresses.
+    dbl_vector tangent; //!< Fiber tangents.
+  public:
+    PackedFiberArrays(void);
+
+    //! @brief Return the number of packed fibers.
+    inline size_t size(void) const
+      { return materials.size(); }
+    //! @brief Return the number of material groups.
+    inline size_t getNumGroups(void) const
+      { return (groups.empty() ? 0 : groups.size()-1); }
+    //! @brief Mark the arrays as outdated (the fiber container has changed).
+    inline void invalidate(void)
+      { valid= false; }
+    bool isValid(const size_t &,const bool &) const;
+    void pack(const std::deque<Fiber *> &,const bool &);
+
+    void computeStrains(const double &,const double &);
+    void computeStrains(const double &,const double &,const double &);
+    int setTrial(void);
+    void sumKR2d(double k[],double r[]) const;
+    void sumKR3d(double k[],double r[]) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -28,6 +28,7 @@ class_<XC::FiberSectionBase, bases<XC::PrismaticBarCrossSection>, boost::noncopy
   .def("addFiber",make_function(addFiberAdHoc,return_internal_reference<>()),"Adds a fiber to the section.")
 .def("getFibers",make_function(&XC::FiberSectionBase::getFibers,return_internal_reference<>()),"Return a fiber container with the fibers in the section.")
 .def("getFiberSets",make_function(&XC::FiberSectionBase::getFiberSets,return_internal_reference<>()),"Return the fiber sets in the fiber section.")
+.add_property("packedFibers",&XC::FiberSectionBase::usePackedFibers,&XC::FiberSectionBase::setPackedFibers,"If true the trial state of the fibers is computed using contiguous arrays with the fibers grouped by material type.")
 .def("setInitialSectionDeformation",&XC::FiberSectionBase::setInitialSectionDeformation,"Set generalized initial strains values in the section from the components of the vector passed as parameter")
   .def("setTrialSectionDeformation",&XC::FiberSectionBase::setTrialSectionDeformation,"Set generalized trial strains values in the section from the components of the vector passed as parameter")
 .def("getArea",&XC::FiberSectionBase::getArea,"Return the area of the fiber section")
@@ -34,6 +34,10 @@
 #include "xc_utils/src/geom/d3/BND3d.h"
 #include "xc_utils/src/geom/d1/Segment3d.h"
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/ThreadPool.h"
+#include <cmath>
+#include <algorithm>
 
 #include "material/section/fiber_section/FiberSectionBase.h"
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
@@ -46,12 +50,16 @@ void XC::InteractionDiagram::classify_trihedron(const Trihedron &tdro)
       if(tdro.TocaCuadrante(i+1)) quadrant_trihedrons[i].insert(&tdro);
   }
 
-//! @brier We classify the trihedrons by its quadrants.
+//! @brier We classify the trihedrons by its quadrants and build
+//! the direction-space index.
 void XC::InteractionDiagram::classify_trihedrons(void)
   {
     //Clasificamos los trihedrons por cuadrantes.
+    for(int i= 0;i<8;i++)
+      quadrant_trihedrons[i].clear();
     for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
       classify_trihedron(*i);
+    cube_map.build(trihedrons);
   }
 
 //! @brief Default constructor.
@@ -94,14 +102,18 @@ const Trihedron *XC::InteractionDiagram::findTrihedronPtr(const Pos3d &p) const
                   << std::endl;
         return retval;
       }
-    const int cuadrante= p.Cuadrante();
-    const set_ptr_trihedrons &set_trihedrons= quadrant_trihedrons[cuadrante-1];
-    for(set_ptr_trihedrons::const_iterator i= set_trihedrons.begin();i!=set_trihedrons.end();i++)
-      if((*i)->In(p,tol))
-        {
-          retval= *i;
-          break;
-        }
+    retval= cube_map.find(p,tol); //Candidates from the direction-space index.
+    if(!retval) //Not found, search on the quadrant.
+      {
+        const int cuadrante= p.Cuadrante();
+        const set_ptr_trihedrons &set_trihedrons= quadrant_trihedrons[cuadrante-1];
+        for(set_ptr_trihedrons::const_iterator i= set_trihedrons.begin();i!=set_trihedrons.end();i++)
+          if((*i)->In(p,tol))
+            {
+              retval= *i;
+              break;
+            }
+      }
     if(!retval) //Not found, so brute-force search.
       {
         for(XC::InteractionDiagram::const_iterator i= begin();i!=end();i++)
@@ -298,6 +310,65 @@ XC::Vector XC::InteractionDiagram::getCapacityFactor(const GeomObj::list_Pos3d &
     return retval;
   }
 
+//! @brief Return the capacity factor for the internal forces triplet
+//! being passed as parameter.
+//!
+//! The intersection of the ray O->(N,My,Mz) with the plane of the
+//! trihedron base is computed directly; the general algorithm
+//! (getCapacityFactor(Pos3d)) is used only when this computation fails.
+double XC::InteractionDiagram::get_capacity_factor(const double &N,const double &My,const double &Mz) const
+  {
+    const Pos3d esf_d(N,My,Mz);
+    const double d= sqrt(N*N+My*My+Mz*Mz); //Distance from the internal force triplet to origin.
+    if(d<mchne_eps_dbl || d>rMax*10.0)
+      return getCapacityFactor(esf_d);
+    const Trihedron *tr= findTrihedronPtr(esf_d);
+    if(tr)
+      {
+        const Pos3d p1= tr->Vertice(1);
+        const Pos3d p2= tr->Vertice(2);
+        const Pos3d p3= tr->Vertice(3);
+        const double a[3]= {p2.x()-p1.x(),p2.y()-p1.y(),p2.z()-p1.z()};
+        const double b[3]= {p3.x()-p1.x(),p3.y()-p1.y(),p3.z()-p1.z()};
+        const double n[3]= {a[1]*b[2]-a[2]*b[1],a[2]*b[0]-a[0]*b[2],a[0]*b[1]-a[1]*b[0]};
+        const double denom= n[0]*N+n[1]*My+n[2]*Mz;
+        const double num= n[0]*p1.x()+n[1]*p1.y()+n[2]*p1.z();
+        //Intersection C= t*esf_d so the capacity factor is d/|OC|= 1/t.
+        if(std::fabs(denom)>mchne_eps_dbl*std::fabs(num) && num/denom>0.0)
+          return denom/num;
+      }
+    return getCapacityFactor(esf_d);
+  }
+
+//! @brief Return the capacity factors for the internal forces triplets
+//! (N,My,Mz) in the rows of the matrix being passed as parameter.
+//!
+//! @param m: matrix with a triplet (N,My,Mz) in each row.
+//! @param numThreads: number of threads (0: one for each hardware thread).
+XC::Vector XC::InteractionDiagram::getCapacityFactor(const Matrix &m,const size_t &numThreads) const
+  {
+    const size_t sz= m.noRows();
+    Vector retval(sz);
+    if(m.noCols()!=3)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; matrix must have three columns (N,My,Mz)." << std::endl;
+        return retval;
+      }
+    size_t nt= (numThreads==0) ? ThreadPool::getHardwareConcurrency() : numThreads;
+    nt= std::min(nt,sz);
+    if(nt>1)
+      {
+        ThreadPool pool(nt);
+        pool.parallel_for(sz,[&](const size_t &i,const size_t &)
+          { retval[i]= get_capacity_factor(m(i,0),m(i,1),m(i,2)); },256);
+      }
+    else
+      for(size_t i= 0;i<sz;i++)
+        retval[i]= get_capacity_factor(m(i,0),m(i,1),m(i,2));
+    return retval;
+  }
+
 
 void XC::InteractionDiagram::Print(std::ostream &os) const
   {
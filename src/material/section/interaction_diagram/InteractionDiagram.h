@@ -33,12 +33,14 @@
 #include <set>
 #include <deque>
 #include "ClosedTriangleMesh.h"
+#include "TrihedronCubeMap.h"
 
 class Triang3dMesh;
 
 namespace XC {
 
 class Vector;
+class Matrix;
 class FiberSectionBase;
 class InteractionDiagramData;
 
@@ -52,11 +54,13 @@ class InteractionDiagram: public ClosedTriangleMesh
 
     
     set_ptr_trihedrons quadrant_trihedrons[8];
+    TrihedronCubeMap cube_map; //!< Direction-space index of the trihedrons.
 
     void classify_trihedron(const Trihedron &tdro);
     void classify_trihedrons(void);
     void setPositionsMatrix(const Matrix &);
     GeomObj::list_Pos3d get_intersection(const Pos3d &p) const;
+    double get_capacity_factor(const double &,const double &,const double &) const;
   public:
     InteractionDiagram(void);
     InteractionDiagram(const Pos3d &org,const Triang3dMesh &mll);
@@ -68,6 +72,7 @@ class InteractionDiagram: public ClosedTriangleMesh
     Pos3d getIntersection(const Pos3d &) const;
     double getCapacityFactor(const Pos3d &) const;
     Vector getCapacityFactor(const GeomObj::list_Pos3d &) const;
+    Vector getCapacityFactor(const Matrix &,const size_t &numThreads= 1) const;
 
     void Print(std::ostream &os) const;
   };
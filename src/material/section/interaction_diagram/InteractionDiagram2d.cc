@@ -29,6 +29,11 @@
 #include "InteractionDiagram2d.h"
 #include "xc_utils/src/geom/d1/Segment2d.h"
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/ThreadPool.h"
+#include <cmath>
+#include <vector>
+#include <algorithm>
 
 #include "material/section/fiber_section/FiberSectionBase.h"
 #include "material/section/interaction_diagram/InteractionDiagramData.h"
@@ -130,6 +135,90 @@ XC::Vector XC::InteractionDiagram2d::getCapacityFactor(const GeomObj::list_Pos2d
   }
 
 
+//! @brief Return the capacity factors for the internal forces pairs
+//! in the rows of the matrix being passed as parameter.
+//!
+//! The edges of the diagram are classified in angular sectors (as seen
+//! from the origin) so the intersection of each ray O->(N,M) is computed
+//! only with the edges of its sector. The general algorithm
+//! (getCapacityFactor(Pos2d)) is used only when this computation fails.
+//! @param m: matrix with a pair (N,M) in each row.
+//! @param numThreads: number of threads (0: one for each hardware thread).
+XC::Vector XC::InteractionDiagram2d::getCapacityFactor(const Matrix &m,const size_t &numThreads) const
+  {
+    const size_t sz= m.noRows();
+    Vector retval(sz);
+    if(m.noCols()!=2)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; matrix must have two columns (N,M)." << std::endl;
+        return retval;
+      }
+    //Edges.
+    const size_t nv= GetNumVertices();
+    std::vector<double> ex(nv), ey(nv), dx(nv), dy(nv);
+    for(size_t i= 0;i<nv;i++)
+      {
+        const Pos2d a= Vertice(i+1);
+        const Pos2d b= Vertice((i+1)%nv+1);
+        ex[i]= a.x(); ey[i]= a.y();
+        dx[i]= b.x()-a.x(); dy[i]= b.y()-a.y();
+      }
+    //Angular sectors.
+    const size_t ns= std::max(size_t(8),nv);
+    const double sectorAngle= 2.0*M_PI/ns;
+    std::vector<std::vector<size_t> > sectors(ns);
+    for(size_t i= 0;i<nv;i++)
+      {
+        double a0= atan2(ey[i],ex[i]);
+        double a1= atan2(ey[i]+dy[i],ex[i]+dx[i]);
+        if(a1<a0) std::swap(a0,a1);
+        if(a1-a0>M_PI) //The edge crosses the negative x axis.
+          { std::swap(a0,a1); a1+= 2.0*M_PI; }
+        const long s0= static_cast<long>(std::floor((a0+M_PI)/sectorAngle))-1;
+        const long s1= static_cast<long>(std::floor((a1+M_PI)/sectorAngle))+1;
+        for(long s= s0;s<=s1;s++)
+          sectors[((s%long(ns))+ns)%ns].push_back(i);
+      }
+    //Capacity factor for each pair.
+    const ThreadPool::loop_body body= [&](const size_t &k,const size_t &)
+      {
+        const double px= m(k,0), py= m(k,1);
+        const double d= sqrt(px*px+py*py);
+        double tMin= -1.0; //Intersection O+t*p with the smallest t>0.
+        if(d>=mchne_eps_dbl)
+          {
+            const long s= static_cast<long>(std::floor((atan2(py,px)+M_PI)/sectorAngle));
+            const std::vector<size_t> &candidates= sectors[std::min(size_t(s),ns-1)];
+            for(std::vector<size_t>::const_iterator j= candidates.begin();j!=candidates.end();j++)
+              {
+                const size_t i= *j;
+                const double denom= px*dy[i]-py*dx[i];
+                if(denom==0.0) continue; //Parallel.
+                const double t= (ex[i]*dy[i]-ey[i]*dx[i])/denom;
+                const double r= (ex[i]*py-ey[i]*px)/denom;
+                if(t>0.0 && r>=0.0 && r<=1.0 && (tMin<0.0 || t<tMin))
+                  tMin= t;
+              }
+          }
+        if(tMin>0.0)
+          retval[k]= 1.0/tMin;
+        else
+          retval[k]= getCapacityFactor(Pos2d(px,py));
+      };
+    size_t nt= (numThreads==0) ? ThreadPool::getHardwareConcurrency() : numThreads;
+    nt= std::min(nt,sz);
+    if(nt>1)
+      {
+        ThreadPool pool(nt);
+        pool.parallel_for(sz,body,256);
+      }
+    else
+      for(size_t k= 0;k<sz;k++)
+        body(k,0);
+    return retval;
+  }
+
 void XC::InteractionDiagram2d::Print(std::ostream &os) const
   {
     std::cerr << getClassName() << "::" << __FUNCTION__
@@ -34,6 +34,7 @@
 namespace XC {
 
 class Vector;
+class Matrix;
 class FiberSectionBase;
 class InteractionDiagramData;
 
@@ -53,6 +54,7 @@ class InteractionDiagram2d: public Polygon2d
     Pos2d getIntersection(const Pos2d &) const;
     double getCapacityFactor(const Pos2d &esf_d) const;
     Vector getCapacityFactor(const GeomObj::list_Pos2d &lp) const;
+    Vector getCapacityFactor(const Matrix &,const size_t &numThreads= 1) const;
 
     void Print(std::ostream &os) const;
   };
@@ -0,0 +1,179 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TrihedronCubeMap.cc
+
+#include "TrihedronCubeMap.h"
+#include "xc_utils/src/geom/d2/Trihedron.h"
+#include "xc_utils/src/geom/pos_vec/Pos3d.h"
+#include <cmath>
+#include <algorithm>
+
+//! @brief Default constructor.
+XC::TrihedronCubeMap::TrihedronCubeMap(void)
+  : n(0), cellBegin(), candidates()
+  { org[0]= 0.0; org[1]= 0.0; org[2]= 0.0; }
+
+//! @brief Empties the index.
+void XC::TrihedronCubeMap::clear(void)
+  {
+    n= 0;
+    cellBegin.clear();
+    candidates.clear();
+  }
+
+//! @brief Return the cube face that corresponds to the direction d
+//! (0:+x, 1:-x, 2:+y, 3:-y, 4:+z, 5:-z) and the coordinates (u,v) of
+//! its projection on that face (both in [-1,1]). Returns 6 if d is null.
+size_t XC::TrihedronCubeMap::get_face(const double d[3],double &u,double &v)
+  {
+    const double ax= std::fabs(d[0]), ay= std::fabs(d[1]), az= std::fabs(d[2]);
+    size_t a= 0;
+    if(ay>ax && ay>=az)
+      a= 1;
+    else if(az>ax && az>ay)
+      a= 2;
+    const double m= std::fabs(d[a]);
+    if(m==0.0)
+      return 6;
+    u= d[(a+1)%3]/m;
+    v= d[(a+2)%3]/m;
+    return 2*a+((d[a]<0.0) ? 1 : 0);
+  }
+
+//! @brief Return the index of the cell row (or column) that contains
+//! the coordinate u of a face.
+size_t XC::TrihedronCubeMap::get_cell(const double &u) const
+  {
+    const double t= std::floor((u+1.0)/2.0*n);
+    if(t<0.0)
+      return 0;
+    const size_t retval= static_cast<size_t>(t);
+    return std::min(retval,n-1);
+  }
+
+//! @brief Compute the cells touched by the projection of the trihedron.
+void XC::TrihedronCubeMap::get_cells(const Trihedron &t,std::vector<size_t> &cells) const
+  {
+    cells.clear();
+    double vd[3][3]; //Directions from the cusp to the vertices.
+    for(size_t k= 0;k<3;k++)
+      {
+        const Pos3d p= t.Vertice(k+1);
+        vd[k][0]= p.x()-org[0]; vd[k][1]= p.y()-org[1]; vd[k][2]= p.z()-org[2];
+      }
+    const double margin= 1e-6+0.5/n; //Conservative enlargement.
+    for(size_t face= 0;face<6;face++)
+      {
+        const size_t a= face/2;
+        const double s= (face%2) ? -1.0 : 1.0;
+        double uMin= 1.0, uMax= -1.0, vMin= 1.0, vMax= -1.0;
+        size_t numPositive= 0;
+        for(size_t k= 0;k<3;k++)
+          {
+            const double w= s*vd[k][a];
+            if(w>0.0)
+              {
+                numPositive++;
+                const double u= vd[k][(a+1)%3]/w;
+                const double v= vd[k][(a+2)%3]/w;
+                uMin= std::min(uMin,u); uMax= std::max(uMax,u);
+                vMin= std::min(vMin,v); vMax= std::max(vMax,v);
+              }
+          }
+        if(numPositive==0) //Trihedron doesn't reach this face.
+          continue;
+        if(numPositive<3) //Unbounded projection, use the whole face.
+          { uMin= -1.0; uMax= 1.0; vMin= -1.0; vMax= 1.0; }
+        uMin-= margin; uMax+= margin; vMin-= margin; vMax+= margin;
+        if(uMax<-1.0 || uMin>1.0 || vMax<-1.0 || vMin>1.0)
+          continue;
+        const size_t i0= get_cell(uMin), i1= get_cell(uMax);
+        const size_t j0= get_cell(vMin), j1= get_cell(vMax);
+        for(size_t i= i0;i<=i1;i++)
+          for(size_t j= j0;j<=j1;j++)
+            cells.push_back((face*n+i)*n+j);
+      }
+  }
+
+//! @brief Builds the index for the trihedrons being passed as parameter
+//! (all of them must have the same cusp).
+void XC::TrihedronCubeMap::build(const std::vector<Trihedron> &trihedrons)
+  {
+    clear();
+    if(trihedrons.empty())
+      return;
+    const Pos3d &c= trihedrons.front().Cuspide();
+    org[0]= c.x(); org[1]= c.y(); org[2]= c.z();
+    //About two trihedrons for each cell.
+    const double nc= std::ceil(std::sqrt(trihedrons.size()/12.0));
+    n= std::max(size_t(1),std::min(size_t(64),static_cast<size_t>(nc)));
+    const size_t numCells= 6*n*n;
+    std::vector<size_t> cells;
+    //First pass: count the candidates of each cell.
+    cellBegin.assign(numCells+1,0);
+    for(std::vector<Trihedron>::const_iterator i= trihedrons.begin();i!=trihedrons.end();i++)
+      {
+        get_cells(*i,cells);
+        for(std::vector<size_t>::const_iterator j= cells.begin();j!=cells.end();j++)
+          cellBegin[*j+1]++;
+      }
+    for(size_t k= 0;k<numCells;k++)
+      cellBegin[k+1]+= cellBegin[k];
+    //Second pass: store the candidates.
+    candidates.resize(cellBegin[numCells]);
+    std::vector<size_t> next(cellBegin.begin(),cellBegin.end()-1);
+    for(std::vector<Trihedron>::const_iterator i= trihedrons.begin();i!=trihedrons.end();i++)
+      {
+        get_cells(*i,cells);
+        for(std::vector<size_t>::const_iterator j= cells.begin();j!=cells.end();j++)
+          candidates[next[*j]++]= &(*i);
+      }
+  }
+
+//! @brief Return the first candidate trihedron that contains the point
+//! (nullptr if none of them contains it).
+const Trihedron *XC::TrihedronCubeMap::find(const Pos3d &p,const double &tol) const
+  {
+    const Trihedron *retval= nullptr;
+    if(!empty())
+      {
+        const double d[3]= {p.x()-org[0],p.y()-org[1],p.z()-org[2]};
+        double u= 0.0, v= 0.0;
+        const size_t face= get_face(d,u,v);
+        if(face<6)
+          {
+            const size_t cell= (face*n+get_cell(u))*n+get_cell(v);
+            for(size_t k= cellBegin[cell];k<cellBegin[cell+1];k++)
+              if(candidates[k]->In(p,tol))
+                {
+                  retval= candidates[k];
+                  break;
+                }
+          }
+      }
+    return retval;
+  }
@@ -0,0 +1,73 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//TrihedronCubeMap.h
+
+#ifndef TRIHEDRONCUBEMAP_H
+#define TRIHEDRONCUBEMAP_H
+
+#include <vector>
+#include <cstddef>
+
+class Pos3d;
+class Trihedron;
+
+namespace XC {
+
+//! \@ingroup MATSCCDiagInt
+//
+//! @brief Direction-space index of the trihedrons of an interaction
+//! diagram.
+//!
+//! The directions from the cusp of the trihedrons are mapped on the
+//! faces of a cube (gnomonic projection), each face is divided in
+//! n x n cells and each cell stores the trihedrons whose projection
+//! touches it. Since the gnomonic projection maps great circles on
+//! straight lines, the projection of a trihedron on a face is the
+//! triangle defined by the projection of its vertices.
+class TrihedronCubeMap
+  {
+    size_t n; //!< Number of divisions of each edge of the cube faces.
+    double org[3]; //!< Cusp of the trihedrons.
+    std::vector<size_t> cellBegin; //!< First candidate of each cell (6*n*n+1 values).
+    std::vector<const Trihedron *> candidates; //!< Trihedrons of each cell.
+
+    static size_t get_face(const double d[3],double &u,double &v);
+    size_t get_cell(const double &) const;
+    void get_cells(const Trihedron &,std::vector<size_t> &) const;
+  public:
+    TrihedronCubeMap(void);
+    void clear(void);
+    //! @brief Return true if the index is empty.
+    inline bool empty(void) const
+      { return candidates.empty(); }
+    void build(const std::vector<Trihedron> &);
+    const Trihedron *find(const Pos3d &,const double &) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -49,6 +49,7 @@ class_<XC::InteractionDiagramData, bases<CommandEntity>>("InteractionDiagramPara
   .add_property("concreteTag",make_function(&XC::InteractionDiagramData::getConcreteTag,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setConcreteTag)
   .add_property("rebarSetName",make_function(&XC::InteractionDiagramData::getRebarSetName,return_internal_reference<>()),&XC::InteractionDiagramData::setRebarSetName)
   .add_property("reinforcementTag",make_function(&XC::InteractionDiagramData::getReinforcementTag,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setReinforcementTag)
+  .add_property("numThreads",make_function(&XC::InteractionDiagramData::getNumThreads,return_value_policy<copy_const_reference>()),&XC::InteractionDiagramData::setNumThreads,"Number of threads used to compute the diagram (0: one for each hardware thread).")
   ;
 
 class_<XC::ClosedTriangleMesh, bases<GeomObj3d>, boost::noncopyable >("ClosedTriangleMesh", no_init)
@@ -65,18 +66,22 @@ class_<XC::ClosedTriangleMesh, bases<GeomObj3d>, boost::noncopyable >("ClosedTri
   ;
 
 double (XC::InteractionDiagram::*getCF)(const Pos3d &esf_d) const= &XC::InteractionDiagram::getCapacityFactor;
+XC::Vector (XC::InteractionDiagram::*getCFMatrix)(const XC::Matrix &,const size_t &) const= &XC::InteractionDiagram::getCapacityFactor;
 class_<XC::InteractionDiagram, bases<XC::ClosedTriangleMesh>, boost::noncopyable >("InteractionDiagram", no_init)
   .def("centroid",&XC::InteractionDiagram::getCenterOfMass)
   .def("getLength",&XC::InteractionDiagram::getLength)
   .def("getIntersection",&XC::InteractionDiagram::getIntersection,"Returns the intersection of the ray O->point(N,My,Mz) with the interaction diagram.")
   .def("getCapacityFactor",getCF)
+  .def("getCapacityFactor",getCFMatrix,"getCapacityFactor(m,numThreads): returns the capacity factors for the internal forces triplets (N,My,Mz) in the rows of the matrix m (numThreads= 0: one thread for each hardware thread).")
   .def("writeTo",&XC::InteractionDiagram::writeTo)
   .def("readFrom",&XC::InteractionDiagram::readFrom)
   ;
 
 double (XC::InteractionDiagram2d::*getCF2d)(const Pos2d &esf_d) const= &XC::InteractionDiagram2d::getCapacityFactor;
+XC::Vector (XC::InteractionDiagram2d::*getCF2dMatrix)(const XC::Matrix &,const size_t &) const= &XC::InteractionDiagram2d::getCapacityFactor;
 class_<XC::InteractionDiagram2d, bases<Polygon2d>, boost::noncopyable >("InteractionDiagram2d", no_init)
   .def("getIntersection",&XC::InteractionDiagram2d::getIntersection,"Returns the intersection of the ray O->point(N,My,Mz) with the interaction diagram.")
   .def("getCapacityFactor",getCF2d)
+  .def("getCapacityFactor",getCF2dMatrix,"getCapacityFactor(m,numThreads): returns the capacity factors for the internal forces pairs (N,M) in the rows of the matrix m (numThreads= 0: one thread for each hardware thread).")
   .def("simplify",&XC::InteractionDiagram2d::Simplify)
   ;
@@ -62,6 +62,15 @@ int XC::ElasticPlateBase::revertToLastCommit(void)
 int XC::ElasticPlateBase::revertToStart(void)
   { return 0; }
 
+//! @brief The section stiffness doesn't depend on the deformation.
+bool XC::ElasticPlateBase::isTangentConstant(void) const
+  { return true; }
+
+//! @brief The scratch storage of the elastic plate sections
+//! is thread local.
+bool XC::ElasticPlateBase::isThreadSafe(void) const
+  { return true; }
+
 //! @brief Send data through the channel being passed as parameter.
 int XC::ElasticPlateBase::sendData(CommParameters &cp)
   {
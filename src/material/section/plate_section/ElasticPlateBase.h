@@ -57,6 +57,8 @@ class ElasticPlateBase: public PlateBase
     int commitState(void); 
     int revertToLastCommit(void);
     int revertToStart(void);
+    bool isTangentConstant(void) const;
+    bool isThreadSafe(void) const;
 
     inline double getE(void) const
       { return E; }
@@ -46,8 +46,8 @@ class ElasticPlateProto : public ElasticPlateBase
   protected:
     Vector trialStrain;
     Vector initialStrain;
-    static Vector stress;
-    static Matrix tangent;
+    static thread_local Vector stress;
+    static thread_local Matrix tangent;
 
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -74,9 +74,9 @@ class ElasticPlateProto : public ElasticPlateBase
 
 //static vector and matrices
 template <int SZ>
-XC::Vector XC::ElasticPlateProto<SZ>::stress(SZ);
+thread_local XC::Vector XC::ElasticPlateProto<SZ>::stress(SZ);
 template <int SZ>
-XC::Matrix XC::ElasticPlateProto<SZ>::tangent(SZ,SZ);
+thread_local XC::Matrix XC::ElasticPlateProto<SZ>::tangent(SZ,SZ);
 
 
 template <int SZ>
@@ -120,7 +120,7 @@ int XC::ElasticPlateProto<SZ>::setTrialSectionDeformation(const Vector &strain)
 template <int SZ>
 const XC::Vector &XC::ElasticPlateProto<SZ>::getSectionDeformation(void) const
   {
-    static Vector retval;
+    thread_local Vector retval;
     retval= trialStrain-initialStrain;
     return retval;
   }
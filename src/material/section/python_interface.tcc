@@ -36,6 +36,7 @@ class_<XC::SectionForceDeformation, XC::SectionForceDeformation *, bases<XC::Mat
   .def("getFlexibility", make_function(&XC::SectionForceDeformation::getSectionFlexibility, return_internal_reference<>()))
   .def("getInitialFlexibility", make_function(&XC::SectionForceDeformation::getInitialFlexibility, return_internal_reference<>()))
   .def("getStrain",&XC::SectionForceDeformation::getStrain,"Returns strain at position being passed as parameter.")
+  .add_property("isThreadSafe",&XC::SectionForceDeformation::isThreadSafe,"True if the section can be updated concurrently with other sections.")
    ;
 
 class_<XC::Bidirectional, bases<XC::SectionForceDeformation>, boost::noncopyable >("Bidirectional", no_init);
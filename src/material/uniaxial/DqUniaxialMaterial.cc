@@ -205,6 +205,20 @@ int XC::DqUniaxialMaterial::revertToStart(void)
     return err;
   }
 
+//! @brief Return true if the tangent of all the materials
+//! is constant (see Material::isTangentConstant).
+bool XC::DqUniaxialMaterial::isTangentConstant(void) const
+  {
+    bool retval= !empty();
+    for(const_iterator i= begin();i!=end(); i++)
+      if(!(*i) || !(*i)->isTangentConstant())
+        {
+          retval= false;
+          break;
+        }
+    return retval;
+  }
+
 //! @brief Zeroes initial strains.
 int XC::DqUniaxialMaterial::zeroInitialStrain(void)
   {
@@ -85,6 +85,7 @@ class DqUniaxialMaterial: public CommandEntity, public MovableObject, public std
     int commitState(void);
     int revertToLastCommit(void);    
     int revertToStart(void);
+    bool isTangentConstant(void) const;
 
     int zeroInitialStrain(void);
     int setInitialStrain(const Vector &def,const size_t &offset);
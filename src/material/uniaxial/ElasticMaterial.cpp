@@ -63,6 +63,7 @@
 #include <material/uniaxial/ElasticMaterial.h>
 #include "domain/component/Parameter.h"
 #include <utility/matrix/Vector.h>
+#include <typeinfo>
 
 #include <domain/mesh/element/utils/Information.h>
 
@@ -126,6 +127,34 @@ int XC::ElasticMaterial::revertToStart(void)
     return 0;
   }
 
+//! @brief The tangent (E) doesn't depend on the strain.
+bool XC::ElasticMaterial::isTangentConstant(void) const
+  { return true; }
+
+//! @brief Sets the trial strain of the elastic materials being passed
+//! as parameter (see UniaxialMaterial::setTrialBatch). The calls are
+//! resolved at compile time, so the compiler can inline them.
+int XC::ElasticMaterial::setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const
+  {
+    if(typeid(*this)!=typeid(ElasticMaterial)) //Derived class.
+      return UniaxialMaterial::setTrialBatch(n,mats,strain,stress,tangent);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        ElasticMaterial *m= static_cast<ElasticMaterial *>(mats[i]);
+        m->trialStrain= strain[i];
+        m->trialStrainRate= 0.0;
+        stress[i]= m->ElasticMaterial::getStress();
+        tangent[i]= m->E;
+      }
+    return retval;
+  }
+
+//! @brief The stress depends only on the strain of this object, so
+//! it can be computed concurrently with other materials.
+bool XC::ElasticMaterial::isThreadSafe(void) const
+  { return true; }
+
 //! @brief Virtual constructor.
 XC::UniaxialMaterial *XC::ElasticMaterial::getCopy(void) const
   { return new ElasticMaterial(*this); }
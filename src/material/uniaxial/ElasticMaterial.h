@@ -94,9 +94,12 @@ class ElasticMaterial : public ElasticBaseMaterial
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0); 
+    int setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const;
+    bool isThreadSafe(void) const;
     double getStrainRate(void) const {return trialStrainRate;};
     double getStress(void) const;
     double getTangent(void) const {return E;}
+    bool isTangentConstant(void) const;
     double getDampTangent(void) const {return eta;}
 
     int commitState(void);
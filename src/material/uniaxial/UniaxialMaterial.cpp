@@ -92,6 +92,25 @@ int XC::UniaxialMaterial::setTrial(double strain, double &stress, double &tangen
     return res;
   }
 
+//! @brief Sets the trial strain of each of the n materials being
+//! passed as parameter and returns their stress and tangent.
+//!
+//! All the materials in mats must be of the same type as this
+//! object, so derived classes can override this method with a loop
+//! that avoids the virtual dispatch of setTrial for each material.
+//! @param n: number of materials.
+//! @param mats: materials to update.
+//! @param strain: trial strain for each material.
+//! @param stress: returned stress for each material.
+//! @param tangent: returned tangent for each material.
+int XC::UniaxialMaterial::setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const
+  {
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      retval+= mats[i]->setTrial(strain[i],stress[i],tangent[i]);
+    return retval;
+  }
+
 //! @brief Return the initial strain.
 double XC::UniaxialMaterial::getInitialStrain(void) const
   { return 0.0; }
@@ -100,6 +119,13 @@ double XC::UniaxialMaterial::getInitialStrain(void) const
 double XC::UniaxialMaterial::getStrainRate(void) const
   { return 0.0; }
 
+//! @brief Return true if the trial state of the material can be
+//! updated concurrently with the state of other materials (i.e.
+//! the material doesn't use shared scratch storage). The derived
+//! classes that are known to be safe override this.
+bool XC::UniaxialMaterial::isThreadSafe(void) const
+  { return false; }
+
 
 //! @brief Return the generalized stress.
 const XC::Vector &XC::UniaxialMaterial::getGeneralizedStress(void) const
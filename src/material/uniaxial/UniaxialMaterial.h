@@ -106,6 +106,8 @@ class UniaxialMaterial : public Material
     //!return 0 if successful, a negative number if not.
     virtual int setTrialStrain(double strain, double strainRate = 0.0)= 0;
     virtual int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
+    virtual int setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const;
+    virtual bool isThreadSafe(void) const;
 
     virtual double getInitialStrain(void) const;
     virtual double getStrain(void) const= 0;
@@ -68,6 +68,7 @@
 #include <domain/mesh/element/utils/Information.h>
 #include <cmath>
 #include <cfloat>
+#include <typeinfo>
 #include "utility/actor/actor/MatrixCommMetaData.h"
 
 //int count= 0;
@@ -237,6 +238,27 @@ int XC::Concrete01::setTrial(double strain, double &stress, double &tangent, dou
     return 0;
   }
 
+//! @brief Sets the trial strain of the Concrete01 materials being passed
+//! as parameter (see UniaxialMaterial::setTrialBatch). The calls are
+//! resolved at compile time, so the compiler can inline them.
+int XC::Concrete01::setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const
+  {
+    if(typeid(*this)!=typeid(Concrete01)) //Derived class.
+      return UniaxialMaterial::setTrialBatch(n,mats,strain,stress,tangent);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Concrete01 *m= static_cast<Concrete01 *>(mats[i]);
+        retval+= m->Concrete01::setTrial(strain[i],stress[i],tangent[i]);
+      }
+    return retval;
+  }
+
+//! @brief Return true, setTrialStrain only touches the state
+//! members of this object.
+bool XC::Concrete01::isThreadSafe(void) const
+  { return true; }
+
 //! @brief ??
 void XC::Concrete01::determineTrialState(double dStrain)
   {
@@ -109,6 +109,8 @@ class Concrete01: public ConcreteBase
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
     int setTrial(double strain, double &stress, double &tangent, double strainRate = 0.0);
+    int setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const;
+    bool isThreadSafe(void) const;
 
     //! @brief Returns initial tangent stiffness.
     inline double getInitialTangent(void) const
@@ -64,6 +64,7 @@
 
 #include <material/uniaxial/concrete/Concrete02.h>
 #include <cfloat>
+#include <typeinfo>
 
 void XC::Concrete02::setup_parameters(void)
   {
@@ -238,6 +239,29 @@ int XC::Concrete02::setTrialStrain(double trialStrain, double strainRate)
     return 0;
   }
 
+//! @brief Sets the trial strain of the Concrete02 materials being passed
+//! as parameter (see UniaxialMaterial::setTrialBatch). The calls are
+//! resolved at compile time, so the compiler can inline them.
+int XC::Concrete02::setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const
+  {
+    if(typeid(*this)!=typeid(Concrete02)) //Derived class.
+      return UniaxialMaterial::setTrialBatch(n,mats,strain,stress,tangent);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Concrete02 *m= static_cast<Concrete02 *>(mats[i]);
+        retval+= m->Concrete02::setTrialStrain(strain[i]);
+        stress[i]= m->Concrete02::getStress();
+        tangent[i]= m->Concrete02::getTangent();
+      }
+    return retval;
+  }
+
+//! @brief Return true, the trial state is computed from the members
+//! of this object only.
+bool XC::Concrete02::isThreadSafe(void) const
+  { return true; }
+
 
 
 int XC::Concrete02::commitState(void)
@@ -165,6 +165,8 @@ class Concrete02: public RawConcrete
     UniaxialMaterial *getCopy(void) const;
 
     int setTrialStrain(double strain, double strainRate = 0.0); 
+    int setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const;
+    bool isThreadSafe(void) const;
     inline double getStrain(void) const
       { return hstv.getStrain(); }
     inline double getStress(void) const
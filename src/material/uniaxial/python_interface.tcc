@@ -37,6 +37,7 @@ class_<XC::UniaxialMaterial,XC::UniaxialMaterial *, bases<XC::Material>, boost::
   .def("getSecant",&XC::UniaxialMaterial::getSecant)
   .def("getFlexibility",&XC::UniaxialMaterial::getFlexibility)
   .def("getInitialFlexibility",&XC::UniaxialMaterial::getInitialFlexibility)
+  .add_property("isThreadSafe",&XC::UniaxialMaterial::isThreadSafe,"True if the material can be updated concurrently with other materials.")
    ;
 
 class_<XC::ElasticBaseMaterial, bases<XC::UniaxialMaterial>, boost::noncopyable >("ElasticBaseMaterial", no_init)
@@ -65,6 +65,7 @@
 #include <domain/mesh/element/utils/Information.h>
 #include <cmath>
 #include <cfloat>
+#include <typeinfo>
 #include "utility/actor/actor/MovableVector.h"
 #include "utility/actor/actor/MovableMatrix.h"
 #include "utility/actor/actor/MatrixCommMetaData.h"
@@ -252,6 +253,29 @@ int XC::Steel01::sendData(CommParameters &cp)
     return res;
   }
 
+//! @brief Sets the trial strain of the Steel01 materials being passed
+//! as parameter (see UniaxialMaterial::setTrialBatch). The calls are
+//! resolved at compile time, so the compiler can inline them.
+int XC::Steel01::setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const
+  {
+    if(typeid(*this)!=typeid(Steel01)) //Derived class.
+      return UniaxialMaterial::setTrialBatch(n,mats,strain,stress,tangent);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Steel01 *m= static_cast<Steel01 *>(mats[i]);
+        retval+= m->SteelBase0103::setTrialStrain(strain[i]);
+        stress[i]= m->Tstress;
+        tangent[i]= m->Ttangent;
+      }
+    return retval;
+  }
+
+//! @brief The history variables are members of the object, so the
+//! material can be updated concurrently with other materials.
+bool XC::Steel01::isThreadSafe(void) const
+  { return true; }
+
 //! @brief Receives object members through the channel being passed as parameter.
 int XC::Steel01::recvData(const CommParameters &cp)
   {
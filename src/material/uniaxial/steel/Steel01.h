@@ -107,6 +107,8 @@ class Steel01 : public SteelBase0103
     ~Steel01(void);
 
     UniaxialMaterial *getCopy(void) const;
+    int setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const;
+    bool isThreadSafe(void) const;
 
     int revertToStart(void);
 
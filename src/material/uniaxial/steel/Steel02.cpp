@@ -64,6 +64,7 @@
 #include <material/uniaxial/steel/Steel02.h>
 #include <utility/matrix/Vector.h>
 #include <cfloat>
+#include <typeinfo>
 #include <cstdlib>
 
 #include "utility/actor/actor/MovableVector.h"
@@ -294,6 +295,29 @@ int XC::Steel02::revertToLastCommit(void)
     return 0;
   }
 
+//! @brief Sets the trial strain of the Steel02 materials being passed
+//! as parameter (see UniaxialMaterial::setTrialBatch). The calls are
+//! resolved at compile time, so the compiler can inline them.
+int XC::Steel02::setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const
+  {
+    if(typeid(*this)!=typeid(Steel02)) //Derived class.
+      return UniaxialMaterial::setTrialBatch(n,mats,strain,stress,tangent);
+    int retval= 0;
+    for(size_t i= 0;i<n;i++)
+      {
+        Steel02 *m= static_cast<Steel02 *>(mats[i]);
+        retval+= m->Steel02::setTrialStrain(strain[i]);
+        stress[i]= m->sig;
+        tangent[i]= m->e;
+      }
+    return retval;
+  }
+
+//! @brief Return true, the trial and committed state are members
+//! (the static storage is only used to send the object).
+bool XC::Steel02::isThreadSafe(void) const
+  { return true; }
+
 int XC::Steel02::revertToStart(void)
   {
     setup_parameters();
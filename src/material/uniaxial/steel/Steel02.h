@@ -125,6 +125,8 @@ class Steel02 : public SteelBase
     UniaxialMaterial *getCopy(void) const;
 
     int setTrialStrain(double strain, double strainRate = 0.0);
+    int setTrialBatch(const size_t &n,UniaxialMaterial **mats,const double *strain,double *stress,double *tangent) const;
+    bool isThreadSafe(void) const;
     double getStrain(void) const;
     double getStress(void) const;
     double getTangent(void) const;
@@ -0,0 +1,399 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CapacityFactorChecker.cc
+
+#include "CapacityFactorChecker.h"
+#include "ResultStore.h"
+#include "material/section/fiber_section/FiberSectionBase.h"
+#include "material/section/interaction_diagram/InteractionDiagramData.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/ThreadPool.h"
+
+//! @brief Constructor.
+XC::CapacityFactorChecker::ControlPoint::ControlPoint(const section_key &k,const InteractionDiagram *d3,const InteractionDiagram2d *d2)
+  : key(k), diag3d(d3), diag2d(d2)
+  { reset(); }
+
+//! @brief Reset the worst case.
+void XC::CapacityFactorChecker::ControlPoint::reset(void)
+  {
+    combIndex= -1;
+    CF= -1.0;
+    N= 0.0; My= 0.0; Mz= 0.0;
+  }
+
+//! @brief Constructor.
+XC::CapacityFactorChecker::CapacityFactorChecker(CommandEntity *owr)
+  : CommandEntity(owr), numSkippedRows(0) {}
+
+//! @brief Assign the diagram to the control point (element tag, section index).
+void XC::CapacityFactorChecker::setControlPoint(const int &elemTag,const int &sectionIndex,const InteractionDiagram *d3,const InteractionDiagram2d *d2)
+  {
+    const section_key key(elemTag,sectionIndex);
+    std::map<section_key,size_t>::const_iterator i= controlPointIndexes.find(key);
+    if(i!=controlPointIndexes.end())
+      {
+        ControlPoint &cp= controlPoints[i->second];
+        cp.diag3d= d3;
+        cp.diag2d= d2;
+        cp.reset();
+      }
+    else
+      {
+        controlPointIndexes[key]= controlPoints.size();
+        controlPoints.push_back(ControlPoint(key,d3,d2));
+      }
+  }
+
+//! @brief Assign a 3D interaction diagram to the section of the element.
+//! The diagram is not copied so it must exist while the checker is in use.
+//! @param elemTag: element identifier.
+//! @param sectionIndex: index of the section in the element (i.e. 0 for the
+//! back end of a beam or the first direction of a shell).
+//! @param diag: interaction diagram.
+void XC::CapacityFactorChecker::setInteractionDiagram(const int &elemTag,const int &sectionIndex,const InteractionDiagram &diag)
+  { setControlPoint(elemTag,sectionIndex,&diag,nullptr); }
+
+//! @brief Assign a 2D interaction diagram to the section of the element.
+//! The diagram is not copied so it must exist while the checker is in use.
+void XC::CapacityFactorChecker::setInteractionDiagram2d(const int &elemTag,const int &sectionIndex,const InteractionDiagram2d &diag)
+  { setControlPoint(elemTag,sectionIndex,nullptr,&diag); }
+
+//! @brief Assign the interaction diagram of the fiber section to the
+//! section of the element. The diagram is computed only once for each
+//! section (the section itself is not modified).
+//! @param threeDim: if true compute a N-My-Mz diagram, otherwise compute
+//! a N-My diagram.
+void XC::CapacityFactorChecker::setFiberSection(const int &elemTag,const int &sectionIndex,const FiberSectionBase &scc,const InteractionDiagramData &data,const bool &threeDim)
+  {
+    if(threeDim)
+      {
+        const InteractionDiagram *diag= nullptr;
+        std::map<const FiberSectionBase *,const InteractionDiagram *>::const_iterator i= sectionDiagrams3d.find(&scc);
+        if(i!=sectionDiagrams3d.end())
+          diag= i->second;
+        else
+          {
+            diagrams3d.push_back(calc_interaction_diagram(scc,data));
+            diag= &diagrams3d.back();
+            sectionDiagrams3d[&scc]= diag;
+          }
+        setInteractionDiagram(elemTag,sectionIndex,*diag);
+      }
+    else
+      {
+        const InteractionDiagram2d *diag= nullptr;
+        std::map<const FiberSectionBase *,const InteractionDiagram2d *>::const_iterator i= sectionDiagrams2d.find(&scc);
+        if(i!=sectionDiagrams2d.end())
+          diag= i->second;
+        else
+          {
+            FiberSectionBase *tmp= dynamic_cast<FiberSectionBase *>(scc.getCopy());
+            if(!tmp)
+              {
+                std::cerr << getClassName() << "::" << __FUNCTION__
+                          << "; can't get a copy of the section." << std::endl;
+                return;
+              }
+            diagrams2d.push_back(tmp->GetNMyInteractionDiagram(data));
+            delete tmp;
+            diag= &diagrams2d.back();
+            sectionDiagrams2d[&scc]= diag;
+          }
+        setInteractionDiagram2d(elemTag,sectionIndex,*diag);
+      }
+  }
+
+//! @brief Return the index of the combination (append it if needed).
+int XC::CapacityFactorChecker::getCombinationIndex(const std::string &combName)
+  {
+    std::map<std::string,int>::const_iterator i= combIndexes.find(combName);
+    if(i!=combIndexes.end())
+      return i->second;
+    const int retval= combNames.size();
+    combNames.push_back(combName);
+    combIndexes[combName]= retval;
+    return retval;
+  }
+
+//! @brief Append a row to the internal forces table. Return false
+//! if there is no control point for the section (the row is skipped).
+bool XC::CapacityFactorChecker::appendRow(const int &combIndex,const int &elemTag,const int &sectionIndex,const double &N,const double &My,const double &Mz)
+  {
+    std::map<section_key,size_t>::const_iterator i= controlPointIndexes.find(section_key(elemTag,sectionIndex));
+    if(i==controlPointIndexes.end())
+      {
+        numSkippedRows++;
+        return false;
+      }
+    rowComb.push_back(combIndex);
+    rowControlPoint.push_back(i->second);
+    rowN.push_back(N);
+    rowMy.push_back(My);
+    rowMz.push_back(Mz);
+    return true;
+  }
+
+//! @brief Append the internal forces obtained for the section of the
+//! element under the combination.
+//! @param combName: name of the combination.
+//! @param elemTag: element identifier.
+//! @param sectionIndex: index of the section in the element.
+//! @param f: internal forces (N, Vy, Vz, T, My, Mz).
+bool XC::CapacityFactorChecker::addInternalForces(const std::string &combName,const int &elemTag,const int &sectionIndex,const Vector &f)
+  {
+    if(f.Size()<6)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; internal forces vector must have six components"
+                  << " (N, Vy, Vz, T, My, Mz)." << std::endl;
+        return false;
+      }
+    return appendRow(getCombinationIndex(combName),elemTag,sectionIndex,f[0],f[4],f[5]);
+  }
+
+//! @brief Append the internal forces read from a ResultStore file.
+//! Returns the number of rows read (or -1 in case of error).
+int XC::CapacityFactorChecker::readResultStore(const std::string &fileName)
+  {
+    ResultStoreReader reader;
+    if(!reader.open(fileName))
+      return -1;
+    int retval= 0;
+    while(reader.next(ResultStore::ELEMENT_INTERNAL_FORCES))
+      {
+        const int combIndex= getCombinationIndex(reader.getCombinationName());
+        const size_t nRows= reader.getNumRows();
+        const double *N= reader.getColumnPtr(0);
+        const double *My= reader.getColumnPtr(4);
+        const double *Mz= reader.getColumnPtr(5);
+        for(size_t i= 0;i<nRows;i++)
+          appendRow(combIndex,reader.getTag(i),reader.getSection(i),N[i],My[i],Mz[i]);
+        retval+= nRows;
+      }
+    reader.close();
+    return retval;
+  }
+
+//! @brief Remove the internal forces table and the results.
+void XC::CapacityFactorChecker::clearInternalForces(void)
+  {
+    combNames.clear();
+    combIndexes.clear();
+    rowComb.clear();
+    rowControlPoint.clear();
+    rowN.clear();
+    rowMy.clear();
+    rowMz.clear();
+    rowCF.clear();
+    numSkippedRows= 0;
+    for(std::vector<ControlPoint>::iterator i= controlPoints.begin();i!=controlPoints.end();i++)
+      i->reset();
+  }
+
+//! @brief Remove control points, diagrams and internal forces.
+void XC::CapacityFactorChecker::clearAll(void)
+  {
+    clearInternalForces();
+    controlPoints.clear();
+    controlPointIndexes.clear();
+    sectionDiagrams3d.clear();
+    sectionDiagrams2d.clear();
+    diagrams3d.clear();
+    diagrams2d.clear();
+  }
+
+//! @brief Compute the capacity factors for all the rows of the internal
+//! forces table and keep the worst case for each control point.
+//!
+//! Rows are grouped by interaction diagram and each group is evaluated
+//! with the batch version of getCapacityFactor. When there are enough
+//! groups each thread evaluates whole groups, otherwise the threads share
+//! the rows of each group.
+//! @param numThreads: number of threads (0: one for each hardware thread).
+int XC::CapacityFactorChecker::run(const size_t &numThreads)
+  {
+    const size_t nRows= rowComb.size();
+    rowCF.assign(nRows,0.0);
+    //Group the rows by diagram.
+    std::map<const void *,size_t> groupIndexes;
+    std::vector<std::vector<size_t> > groups;
+    for(size_t i= 0;i<nRows;i++)
+      {
+        const ControlPoint &cp= controlPoints[rowControlPoint[i]];
+        const void *diag= (cp.diag3d ? static_cast<const void *>(cp.diag3d) : static_cast<const void *>(cp.diag2d));
+        std::map<const void *,size_t>::const_iterator j= groupIndexes.find(diag);
+        size_t g= 0;
+        if(j==groupIndexes.end())
+          {
+            g= groups.size();
+            groupIndexes[diag]= g;
+            groups.push_back(std::vector<size_t>());
+          }
+        else
+          g= j->second;
+        groups[g].push_back(i);
+      }
+    size_t nt= (numThreads==0) ? ThreadPool::getHardwareConcurrency() : numThreads;
+    const size_t numGroups= groups.size();
+    const bool threadPerGroup= (numGroups>=nt);
+    const size_t innerThreads= (threadPerGroup ? 1 : nt);
+    const ThreadPool::loop_body body= [&](const size_t &g,const size_t &)
+      {
+        const std::vector<size_t> &rows= groups[g];
+        const size_t sz= rows.size();
+        const ControlPoint &cp= controlPoints[rowControlPoint[rows.front()]];
+        Vector cf;
+        if(cp.diag3d)
+          {
+            Matrix m(sz,3);
+            for(size_t k= 0;k<sz;k++)
+              {
+                const size_t i= rows[k];
+                m(k,0)= rowN[i]; m(k,1)= rowMy[i]; m(k,2)= rowMz[i];
+              }
+            cf= cp.diag3d->getCapacityFactor(m,innerThreads);
+          }
+        else
+          {
+            Matrix m(sz,2);
+            for(size_t k= 0;k<sz;k++)
+              {
+                const size_t i= rows[k];
+                m(k,0)= rowN[i]; m(k,1)= rowMy[i];
+              }
+            cf= cp.diag2d->getCapacityFactor(m,innerThreads);
+          }
+        for(size_t k= 0;k<sz;k++)
+          rowCF[rows[k]]= cf[k];
+      };
+    nt= std::min(nt,numGroups);
+    if(threadPerGroup && (nt>1))
+      {
+        ThreadPool pool(nt);
+        pool.parallel_for(numGroups,body,1);
+      }
+    else
+      for(size_t g= 0;g<numGroups;g++)
+        body(g,0);
+    //Worst case for each control point.
+    for(std::vector<ControlPoint>::iterator i= controlPoints.begin();i!=controlPoints.end();i++)
+      i->reset();
+    for(size_t i= 0;i<nRows;i++)
+      {
+        ControlPoint &cp= controlPoints[rowControlPoint[i]];
+        if(rowCF[i]>cp.CF)
+          {
+            cp.combIndex= rowComb[i];
+            cp.CF= rowCF[i];
+            cp.N= rowN[i]; cp.My= rowMy[i]; cp.Mz= rowMz[i];
+          }
+      }
+    return 0;
+  }
+
+//! @brief Return the i-th control point.
+const XC::CapacityFactorChecker::ControlPoint &XC::CapacityFactorChecker::getControlPoint(const size_t &i) const
+  {
+    if(i>=controlPoints.size())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; index: " << i << " out of range." << std::endl;
+        static const ControlPoint dummy(section_key(-1,-1),nullptr,nullptr);
+        return dummy;
+      }
+    return controlPoints[i];
+  }
+
+//! @brief Return true if the internal forces table has rows for
+//! the i-th control point (otherwise its capacity factor and
+//! combination are meaningless).
+bool XC::CapacityFactorChecker::hasResults(const size_t &i) const
+  { return (getControlPoint(i).combIndex>=0); }
+
+//! @brief Return the number of control points without rows in the
+//! internal forces table.
+size_t XC::CapacityFactorChecker::getNumControlPointsWithoutResults(void) const
+  {
+    size_t retval= 0;
+    for(std::vector<ControlPoint>::const_iterator i= controlPoints.begin();i!=controlPoints.end();i++)
+      if(i->combIndex<0)
+        retval++;
+    return retval;
+  }
+
+//! @brief Return the element tag of the i-th control point.
+int XC::CapacityFactorChecker::getElementTag(const size_t &i) const
+  { return getControlPoint(i).key.first; }
+
+//! @brief Return the section index of the i-th control point.
+int XC::CapacityFactorChecker::getSectionIndex(const size_t &i) const
+  { return getControlPoint(i).key.second; }
+
+//! @brief Return the name of the worst combination for the i-th control point.
+std::string XC::CapacityFactorChecker::getCombinationName(const size_t &i) const
+  {
+    const int ic= getControlPoint(i).combIndex;
+    return (ic<0 ? std::string("nil") : combNames[ic]);
+  }
+
+//! @brief Return the worst capacity factor for the i-th control point.
+double XC::CapacityFactorChecker::getCapacityFactor(const size_t &i) const
+  { return getControlPoint(i).CF; }
+
+//! @brief Return the axial force for the worst case of the i-th control point.
+double XC::CapacityFactorChecker::getN(const size_t &i) const
+  { return getControlPoint(i).N; }
+
+//! @brief Return the bending moment about y axis for the worst case of the i-th control point.
+double XC::CapacityFactorChecker::getMy(const size_t &i) const
+  { return getControlPoint(i).My; }
+
+//! @brief Return the bending moment about z axis for the worst case of the i-th control point.
+double XC::CapacityFactorChecker::getMz(const size_t &i) const
+  { return getControlPoint(i).Mz; }
+
+//! @brief Return the maximum capacity factor over all the control points.
+double XC::CapacityFactorChecker::getMaxCapacityFactor(void) const
+  {
+    double retval= -1.0;
+    for(std::vector<ControlPoint>::const_iterator i= controlPoints.begin();i!=controlPoints.end();i++)
+      retval= std::max(retval,i->CF);
+    return retval;
+  }
+
+//! @brief Return the capacity factors computed for each row of the
+//! internal forces table.
+XC::Vector XC::CapacityFactorChecker::getRowCapacityFactors(void) const
+  {
+    const size_t sz= rowCF.size();
+    Vector retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= rowCF[i];
+    return retval;
+  }
@@ -0,0 +1,136 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CapacityFactorChecker.h
+
+#ifndef CAPACITYFACTORCHECKER_H
+#define CAPACITYFACTORCHECKER_H
+
+#include "xc_utils/src/kernel/CommandEntity.h"
+#include "material/section/interaction_diagram/InteractionDiagram.h"
+#include "material/section/interaction_diagram/InteractionDiagram2d.h"
+#include <map>
+#include <deque>
+#include <vector>
+#include <string>
+
+namespace XC {
+class Vector;
+class FiberSectionBase;
+class InteractionDiagramData;
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Batch checking of normal stresses (capacity factors) over the
+//! sections of the elements.
+//!
+//! Each control point (pair element tag, section index) is assigned an
+//! interaction diagram (2D or 3D). The internal forces obtained for each
+//! combination are appended to a table (or read from a ResultStore file)
+//! and the capacity factors are computed directly from the diagrams,
+//! without building a model, so no nodes, elements or solver are
+//! involved. For each control point the checker keeps the worst case
+//! (combination with the biggest capacity factor). The control points
+//! without rows in the internal forces table have no results (see
+//! hasResults).
+//!
+//! 3D diagrams are checked with (N, My, Mz), 2D diagrams with (N, My).
+class CapacityFactorChecker: public CommandEntity
+  {
+  public:
+    typedef std::pair<int,int> section_key; //!< (element tag, section index)
+  private:
+    //! @brief Control point data and results.
+    struct ControlPoint
+      {
+        section_key key; //!< element tag and section index.
+        const InteractionDiagram *diag3d; //!< 3D interaction diagram.
+        const InteractionDiagram2d *diag2d; //!< 2D interaction diagram.
+        int combIndex; //!< index of the worst combination.
+        double CF; //!< worst capacity factor.
+        double N; //!< axial force for the worst case.
+        double My; //!< bending moment about y axis for the worst case.
+        double Mz; //!< bending moment about z axis for the worst case.
+        ControlPoint(const section_key &,const InteractionDiagram *,const InteractionDiagram2d *);
+        void reset(void);
+      };
+    std::vector<ControlPoint> controlPoints; //!< control points.
+    std::map<section_key,size_t> controlPointIndexes; //!< index of each control point.
+    std::deque<InteractionDiagram> diagrams3d; //!< diagrams computed from fiber sections.
+    std::deque<InteractionDiagram2d> diagrams2d; //!< diagrams computed from fiber sections.
+    std::map<const FiberSectionBase *,const InteractionDiagram *> sectionDiagrams3d; //!< diagram computed for each section.
+    std::map<const FiberSectionBase *,const InteractionDiagram2d *> sectionDiagrams2d; //!< diagram computed for each section.
+
+    std::vector<std::string> combNames; //!< combination names.
+    std::map<std::string,int> combIndexes; //!< index of each combination name.
+    std::vector<int> rowComb; //!< combination index for each row.
+    std::vector<size_t> rowControlPoint; //!< control point for each row.
+    std::vector<double> rowN; //!< axial force for each row.
+    std::vector<double> rowMy; //!< bending moment about y axis for each row.
+    std::vector<double> rowMz; //!< bending moment about z axis for each row.
+    std::vector<double> rowCF; //!< capacity factor for each row.
+    size_t numSkippedRows; //!< rows without control point.
+
+    void setControlPoint(const int &,const int &,const InteractionDiagram *,const InteractionDiagram2d *);
+    int getCombinationIndex(const std::string &);
+    bool appendRow(const int &,const int &,const int &,const double &,const double &,const double &);
+    const ControlPoint &getControlPoint(const size_t &) const;
+  public:
+    CapacityFactorChecker(CommandEntity *owner= nullptr);
+
+    void setInteractionDiagram(const int &,const int &,const InteractionDiagram &);
+    void setInteractionDiagram2d(const int &,const int &,const InteractionDiagram2d &);
+    void setFiberSection(const int &,const int &,const FiberSectionBase &,const InteractionDiagramData &,const bool &threeDim= true);
+    inline size_t getNumControlPoints(void) const
+      { return controlPoints.size(); }
+
+    bool addInternalForces(const std::string &,const int &,const int &,const Vector &);
+    int readResultStore(const std::string &);
+    inline size_t getNumRows(void) const
+      { return rowComb.size(); }
+    inline size_t getNumSkippedRows(void) const
+      { return numSkippedRows; }
+    void clearInternalForces(void);
+    void clearAll(void);
+
+    int run(const size_t &numThreads= 0);
+
+    bool hasResults(const size_t &) const;
+    size_t getNumControlPointsWithoutResults(void) const;
+    int getElementTag(const size_t &) const;
+    int getSectionIndex(const size_t &) const;
+    std::string getCombinationName(const size_t &) const;
+    double getCapacityFactor(const size_t &) const;
+    double getN(const size_t &) const;
+    double getMy(const size_t &) const;
+    double getMz(const size_t &) const;
+    double getMaxCapacityFactor(void) const;
+    Vector getRowCapacityFactors(void) const;
+  };
+
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,472 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultStore.cc
+
+#include "ResultStore.h"
+#include "preprocessor/set_mgmt/Set.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/truss_beam_column/elasticBeamColumn/ElasticBeam2d.h"
+#include "domain/mesh/element/truss_beam_column/elasticBeamColumn/ElasticBeam3d.h"
+#include "domain/mesh/element/truss_beam_column/NLForceBeamColumn2dBase.h"
+#include "domain/mesh/element/truss_beam_column/NLForceBeamColumn3dBase.h"
+#include "domain/mesh/element/plane/shell/ShellMITC4Base.h"
+#include "domain/mesh/element/plane/shell/ShellNL.h"
+#include "utility/matrix/ID.h"
+#include "utility/matrix/Vector.h"
+#include <cmath>
+
+const char XC::ResultStore::magic[8]= {'X','C','R','S','T','O','R','E'};
+const int32_t XC::ResultStore::version= 1;
+
+namespace XC {
+
+//! @brief Append the internal forces at both ends of a 2D beam.
+template <class BEAM>
+void append_beam2d_internal_forces(BEAM &e,std::vector<std::vector<double> > &columns)
+  {
+    e.getResistingForce();
+    const double row0[ResultStore::numInternalForcesComponents]= {e.getN1(),e.getV1(),0.0,0.0,0.0,e.getM1()};
+    const double row1[ResultStore::numInternalForcesComponents]= {e.getN2(),e.getV2(),0.0,0.0,0.0,e.getM2()};
+    for(size_t j= 0;j<ResultStore::numInternalForcesComponents;j++)
+      {
+        columns[j].push_back(row0[j]);
+        columns[j].push_back(row1[j]);
+      }
+  }
+
+//! @brief Append the internal forces at both ends of a 3D beam.
+template <class BEAM>
+void append_beam3d_internal_forces(BEAM &e,std::vector<std::vector<double> > &columns)
+  {
+    e.getResistingForce();
+    const double row0[ResultStore::numInternalForcesComponents]= {e.getN1(),e.getVy1(),e.getVz1(),e.getT1(),e.getMy1(),e.getMz1()};
+    const double row1[ResultStore::numInternalForcesComponents]= {e.getN2(),e.getVy2(),e.getVz2(),e.getT2(),e.getMy2(),e.getMz2()};
+    for(size_t j= 0;j<ResultStore::numInternalForcesComponents;j++)
+      {
+        columns[j].push_back(row0[j]);
+        columns[j].push_back(row1[j]);
+      }
+  }
+
+//! @brief Computes the components of a (membrane, bending or shear)
+//! internal forces tensor in a system rotated theta radians with
+//! respect to the z(3) axis.
+inline void transform_shell_internal_forces(double &f1,double &f2,double &f12,const double &theta)
+  {
+    const double cos2T= cos(2*theta);
+    const double sin2T= sin(2*theta);
+    const double tmpA= (f1+f2)/2.0;
+    const double tmpB= (f1-f2)/2.0*cos2T+f12*sin2T;
+    const double tmp12= -(f1-f2)/2.0*sin2T+f12*cos2T;
+    f1= tmpA+tmpB;
+    f2= tmpA-tmpB;
+    f12= tmp12;
+  }
+
+//! @brief Append the Wood-Armer internal forces (one row for each axis)
+//! obtained from the average internal forces in the shell element.
+template <class SHELL>
+void append_shell_internal_forces(SHELL &e,std::vector<std::vector<double> > &columns)
+  {
+    e.getResistingForce();
+    const SectionFDPhysicalProperties::material_vector &mat= e.getPhysicalProperties().getMaterialsVector();
+    double n1= mat.getMeanGeneralizedStressByName("n1");
+    double n2= mat.getMeanGeneralizedStressByName("n2");
+    double n12= mat.getMeanGeneralizedStressByName("n12");
+    double m1= mat.getMeanGeneralizedStressByName("m1");
+    double m2= mat.getMeanGeneralizedStressByName("m2");
+    double m12= mat.getMeanGeneralizedStressByName("m12");
+    double q13= mat.getMeanGeneralizedStressByName("q13");
+    double q23= mat.getMeanGeneralizedStressByName("q23");
+    if(e.hasPyProp("theta"))
+      {
+        const double theta= boost::python::extract<double>(e.getPyProp("theta"));
+        transform_shell_internal_forces(n1,n2,n12,theta);
+        transform_shell_internal_forces(m1,m2,m12,theta);
+        double tmp= 0.0;
+        transform_shell_internal_forces(q13,q23,tmp,theta);
+      }
+    const double row0[ResultStore::numInternalForcesComponents]= {n1,q13,n12,0.0,m1+copysign(m12,m1),0.0};
+    const double row1[ResultStore::numInternalForcesComponents]= {n2,q23,n12,0.0,m2+copysign(m12,m2),0.0};
+    for(size_t j= 0;j<ResultStore::numInternalForcesComponents;j++)
+      {
+        columns[j].push_back(row0[j]);
+        columns[j].push_back(row1[j]);
+      }
+  }
+
+template <class T>
+inline void write_column(std::ofstream &out,const std::vector<T> &v)
+  {
+    if(!v.empty())
+      out.write(reinterpret_cast<const char *>(&v[0]),v.size()*sizeof(T));
+  }
+
+template <class T>
+inline bool read_column(std::ifstream &in,std::vector<T> &v,const size_t &sz)
+  {
+    v.resize(sz);
+    if(sz>0)
+      in.read(reinterpret_cast<char *>(&v[0]),sz*sizeof(T));
+    return in.good();
+  }
+
+} // end of XC namespace
+
+//! @brief Constructor.
+XC::ResultStore::ResultStore(CommandEntity *owr)
+  : CommandEntity(owr) {}
+
+//! @brief Destructor.
+XC::ResultStore::~ResultStore(void)
+  { close(); }
+
+//! @brief Open the file to write the results in. If append is false
+//! the previous contents of the file are discarded.
+bool XC::ResultStore::open(const std::string &fName,const bool &append)
+  {
+    close();
+    fileName= fName;
+    bool writeHeader= !append;
+    if(append)
+      {
+        std::ifstream tmp(fileName.c_str(),std::ios::binary);
+        writeHeader= !tmp.good() || (tmp.peek()==std::ifstream::traits_type::eof());
+      }
+    std::ios_base::openmode mode= std::ios::binary | std::ios::out;
+    if(append)
+      mode|= std::ios::app;
+    else
+      mode|= std::ios::trunc;
+    out.open(fileName.c_str(),mode);
+    if(!out.good())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'.\n";
+        return false;
+      }
+    if(writeHeader)
+      {
+        out.write(magic,sizeof(magic));
+        out.write(reinterpret_cast<const char *>(&version),sizeof(version));
+      }
+    return true;
+  }
+
+//! @brief Close the file.
+void XC::ResultStore::close(void)
+  {
+    if(out.is_open())
+      out.close();
+  }
+
+//! @brief Write the header of a chunk.
+void XC::ResultStore::writeChunkHeader(const chunk_kind &k,const std::string &combName,const size_t &nRows,const size_t &nCols)
+  {
+    const int32_t header[2]= {k,static_cast<int32_t>(combName.size())};
+    out.write(reinterpret_cast<const char *>(header),sizeof(header));
+    out.write(combName.c_str(),combName.size());
+    const int32_t dims[2]= {static_cast<int32_t>(nRows),static_cast<int32_t>(nCols)};
+    out.write(reinterpret_cast<const char *>(dims),sizeof(dims));
+  }
+
+//! @brief Write the displacements of the nodes of the set
+//! for the current state of the model.
+//!
+//! @param combName: name of the combination.
+//! @param s: set of nodes.
+int XC::ResultStore::dumpDisplacements(const std::string &combName,const Set &s)
+  {
+    if(!isOpen())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; store not open." << std::endl;
+        return -1;
+      }
+    const DqPtrsNode &nodes= s.getNodes();
+    size_t nCols= 0;
+    for(DqPtrsNode::const_iterator i= nodes.begin();i!=nodes.end();i++)
+      nCols= std::max(nCols,size_t((*i)->getNumberDOF()));
+    const size_t nRows= nodes.size();
+    std::vector<int32_t> tags;
+    tags.reserve(nRows);
+    std::vector<double> values(nRows*nCols,0.0);
+    size_t row= 0;
+    for(DqPtrsNode::const_iterator i= nodes.begin();i!=nodes.end();i++,row++)
+      {
+        const Node *n= *i;
+        tags.push_back(n->getTag());
+        const Vector &disp= n->getDisp();
+        const size_t sz= disp.Size();
+        for(size_t j= 0;j<sz;j++)
+          values[j*nRows+row]= disp(j);
+      }
+    writeChunkHeader(NODAL_DISPLACEMENTS,combName,nRows,nCols);
+    write_column(out,tags);
+    write_column(out,values);
+    return (out.good() ? 0 : -1);
+  }
+
+//! @brief Append the internal forces of the element to the columns.
+//! Return false if the element type is not supported.
+bool XC::ResultStore::appendInternalForces(Element *e,std::vector<int32_t> &tags,std::vector<int32_t> &sections,std::vector<std::vector<double> > &columns) const
+  {
+    bool retval= true;
+    if(ElasticBeam2d *b= dynamic_cast<ElasticBeam2d *>(e))
+      append_beam2d_internal_forces(*b,columns);
+    else if(ElasticBeam3d *b= dynamic_cast<ElasticBeam3d *>(e))
+      append_beam3d_internal_forces(*b,columns);
+    else if(NLForceBeamColumn2dBase *b= dynamic_cast<NLForceBeamColumn2dBase *>(e))
+      append_beam2d_internal_forces(*b,columns);
+    else if(NLForceBeamColumn3dBase *b= dynamic_cast<NLForceBeamColumn3dBase *>(e))
+      append_beam3d_internal_forces(*b,columns);
+    else if(ShellMITC4Base *sh= dynamic_cast<ShellMITC4Base *>(e))
+      append_shell_internal_forces(*sh,columns);
+    else if(ShellNL *sh= dynamic_cast<ShellNL *>(e))
+      append_shell_internal_forces(*sh,columns);
+    else
+      retval= false;
+    if(retval)
+      {
+        const int32_t tag= e->getTag();
+        tags.push_back(tag); sections.push_back(0);
+        tags.push_back(tag); sections.push_back(1);
+      }
+    return retval;
+  }
+
+//! @brief Write the internal forces of the elements of the set
+//! for the current state of the model. For beam elements the rows
+//! correspond to the internal forces at its back (section 0) and
+//! front (section 1) ends. For shell elements the rows correspond
+//! to the Wood-Armer internal forces for each axis.
+//!
+//! @param combName: name of the combination.
+//! @param s: set of elements.
+int XC::ResultStore::dumpInternalForces(const std::string &combName,const Set &s)
+  {
+    if(!isOpen())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; store not open." << std::endl;
+        return -1;
+      }
+    const DqPtrsElem &elements= s.getElements();
+    const size_t maxRows= 2*elements.size();
+    std::vector<int32_t> tags;
+    tags.reserve(maxRows);
+    std::vector<int32_t> sections;
+    sections.reserve(maxRows);
+    std::vector<std::vector<double> > columns(numInternalForcesComponents);
+    for(size_t j= 0;j<numInternalForcesComponents;j++)
+      columns[j].reserve(maxRows);
+    for(DqPtrsElem::const_iterator i= elements.begin();i!=elements.end();i++)
+      {
+        Element *e= *i;
+        if(!appendInternalForces(e,tags,sections,columns))
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; element type: '" << e->getClassName()
+                    << "' not implemented." << std::endl;
+      }
+    writeChunkHeader(ELEMENT_INTERNAL_FORCES,combName,tags.size(),numInternalForcesComponents);
+    write_column(out,tags);
+    write_column(out,sections);
+    for(size_t j= 0;j<numInternalForcesComponents;j++)
+      write_column(out,columns[j]);
+    return (out.good() ? 0 : -1);
+  }
+
+//! @brief Write the nodal displacements and the element internal
+//! forces of the set for the current state of the model.
+int XC::ResultStore::dump(const std::string &combName,const Set &s)
+  {
+    int retval= dumpInternalForces(combName,s);
+    if(retval==0)
+      retval= dumpDisplacements(combName,s);
+    return retval;
+  }
+
+//! @brief Constructor.
+XC::ResultStoreReader::ResultStoreReader(CommandEntity *owr)
+  : CommandEntity(owr), kind(-1), numColumns(0) {}
+
+//! @brief Open the file to read and check its header.
+bool XC::ResultStoreReader::open(const std::string &fileName)
+  {
+    close();
+    in.open(fileName.c_str(),std::ios::binary | std::ios::in);
+    if(!in.good())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; can't open file: '" << fileName << "'.\n";
+        return false;
+      }
+    char m[sizeof(ResultStore::magic)];
+    int32_t v= 0;
+    in.read(m,sizeof(m));
+    in.read(reinterpret_cast<char *>(&v),sizeof(v));
+    if(!in.good() || !std::equal(m,m+sizeof(m),ResultStore::magic) || (v!=ResultStore::version))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; file: '" << fileName
+                  << "' is not a result store (or its version is not supported).\n";
+        close();
+        return false;
+      }
+    return true;
+  }
+
+//! @brief Close the file.
+void XC::ResultStoreReader::close(void)
+  {
+    if(in.is_open())
+      in.close();
+    kind= -1;
+    combName.clear();
+    tags.clear();
+    sections.clear();
+    values.clear();
+    numColumns= 0;
+  }
+
+//! @brief Read the header of the next chunk.
+//! @param nRows: number of rows of the chunk.
+bool XC::ResultStoreReader::readChunkHeader(size_t &nRows)
+  {
+    if(!in.is_open())
+      return false;
+    int32_t header[2]= {-1,0};
+    in.read(reinterpret_cast<char *>(header),sizeof(header));
+    if(!in.good())
+      return false;
+    kind= header[0];
+    combName.resize(header[1]);
+    if(header[1]>0)
+      in.read(&combName[0],header[1]);
+    int32_t dims[2]= {0,0};
+    in.read(reinterpret_cast<char *>(dims),sizeof(dims));
+    nRows= dims[0];
+    numColumns= dims[1];
+    return in.good();
+  }
+
+//! @brief Read the next chunk; return false when there are no more
+//! chunks in the file.
+bool XC::ResultStoreReader::next(void)
+  {
+    size_t nRows= 0;
+    bool retval= readChunkHeader(nRows);
+    if(retval)
+      {
+        retval= read_column(in,tags,nRows);
+        if(kind==ResultStore::ELEMENT_INTERNAL_FORCES)
+          retval= retval && read_column(in,sections,nRows);
+        else
+          sections.clear();
+        retval= retval && read_column(in,values,nRows*numColumns);
+        if(!retval)
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; truncated chunk for combination: '"
+                    << combName << "'.\n";
+      }
+    return retval;
+  }
+
+//! @brief Read the next chunk of the kind being passed as parameter
+//! (other chunks are skipped without reading its data).
+bool XC::ResultStoreReader::next(const int &k)
+  {
+    size_t nRows= 0;
+    std::streampos chunkBegin= in.tellg();
+    while(readChunkHeader(nRows))
+      {
+        if(kind==k)
+          {
+            in.seekg(chunkBegin);
+            return next();
+          }
+        std::streamoff chunkSize= nRows*(sizeof(int32_t)+numColumns*sizeof(double));
+        if(kind==ResultStore::ELEMENT_INTERNAL_FORCES)
+          chunkSize+= nRows*sizeof(int32_t);
+        in.seekg(chunkSize,std::ios::cur);
+        chunkBegin= in.tellg();
+      }
+    return false;
+  }
+
+//! @brief Return the tags of the current chunk.
+XC::ID XC::ResultStoreReader::getTags(void) const
+  {
+    const size_t sz= tags.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= tags[i];
+    return retval;
+  }
+
+//! @brief Return the section indexes of the current chunk.
+XC::ID XC::ResultStoreReader::getSections(void) const
+  {
+    const size_t sz= sections.size();
+    ID retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval[i]= sections[i];
+    return retval;
+  }
+
+//! @brief Return the j-th column of the current chunk.
+XC::Vector XC::ResultStoreReader::getColumn(const size_t &j) const
+  {
+    const size_t nRows= tags.size();
+    Vector retval(nRows);
+    if(j<numColumns)
+      {
+        const double *ptr= getColumnPtr(j);
+        for(size_t i= 0;i<nRows;i++)
+          retval[i]= ptr[i];
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; column index: " << j << " out of range." << std::endl;
+    return retval;
+  }
+
+//! @brief Return the i-th row of the current chunk.
+XC::Vector XC::ResultStoreReader::getRow(const size_t &i) const
+  {
+    Vector retval(numColumns);
+    if(i<tags.size())
+      {
+        for(size_t j= 0;j<numColumns;j++)
+          retval[j]= getValue(i,j);
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; row index: " << i << " out of range." << std::endl;
+    return retval;
+  }
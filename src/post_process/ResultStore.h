@@ -0,0 +1,136 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ResultStore.h
+
+#ifndef RESULTSTORE_H
+#define RESULTSTORE_H
+
+#include "xc_utils/src/kernel/CommandEntity.h"
+#include <fstream>
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+namespace XC {
+class Set;
+class Element;
+class ID;
+class Vector;
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Binary columnar store for the results obtained for each
+//! load combination (nodal displacements and element internal forces).
+//!
+//! The file is a sequence of chunks (one for each combination and
+//! kind of result). Each chunk contains a header (kind, combination
+//! name, number of rows and number of columns) followed by the
+//! columns: node or element tags (int32), section indexes (int32, only
+//! for internal forces) and the value columns (double).
+//! Internal forces columns are: N, Vy, Vz, T, My, Mz; displacement
+//! columns are the components of the nodal displacement vector (padded
+//! with zeros when the nodes of the set have different number of DOFs).
+class ResultStore: public CommandEntity
+  {
+  public:
+    enum chunk_kind {NODAL_DISPLACEMENTS= 0,ELEMENT_INTERNAL_FORCES= 1};
+    static const char magic[8];
+    static const int32_t version;
+    static const size_t numInternalForcesComponents= 6;
+  private:
+    std::ofstream out; //!< output stream.
+    std::string fileName; //!< name of the file.
+
+    void writeChunkHeader(const chunk_kind &,const std::string &,const size_t &,const size_t &);
+    bool appendInternalForces(Element *,std::vector<int32_t> &,std::vector<int32_t> &,std::vector<std::vector<double> > &) const;
+  public:
+    ResultStore(CommandEntity *owner= nullptr);
+    ~ResultStore(void);
+
+    bool open(const std::string &,const bool &append= false);
+    void close(void);
+    inline bool isOpen(void) const
+      { return out.is_open(); }
+    inline const std::string &getFileName(void) const
+      { return fileName; }
+
+    int dumpDisplacements(const std::string &,const Set &);
+    int dumpInternalForces(const std::string &,const Set &);
+    int dump(const std::string &,const Set &);
+  };
+
+//! @ingroup POST_PROCESS
+//
+//! @brief Reads (chunk by chunk and without any text parsing) the
+//! files written by ResultStore.
+class ResultStoreReader: public CommandEntity
+  {
+    std::ifstream in; //!< input stream.
+    int kind; //!< kind of the current chunk.
+    std::string combName; //!< combination name of the current chunk.
+    std::vector<int32_t> tags; //!< tags of the current chunk.
+    std::vector<int32_t> sections; //!< section indexes of the current chunk.
+    std::vector<double> values; //!< values of the current chunk (column by column).
+    size_t numColumns; //!< number of value columns of the current chunk.
+
+    bool readChunkHeader(size_t &);
+  public:
+    ResultStoreReader(CommandEntity *owner= nullptr);
+
+    bool open(const std::string &);
+    void close(void);
+    bool next(void);
+    bool next(const int &);
+
+    inline int getKind(void) const
+      { return kind; }
+    inline bool isNodal(void) const
+      { return (kind==ResultStore::NODAL_DISPLACEMENTS); }
+    inline const std::string &getCombinationName(void) const
+      { return combName; }
+    inline size_t getNumRows(void) const
+      { return tags.size(); }
+    inline size_t getNumColumns(void) const
+      { return numColumns; }
+    //! @brief Return a pointer to the values of the j-th column.
+    inline const double *getColumnPtr(const size_t &j) const
+      { return &values[j*tags.size()]; }
+    inline double getValue(const size_t &i,const size_t &j) const
+      { return values[j*tags.size()+i]; }
+    inline int getTag(const size_t &i) const
+      { return tags[i]; }
+    inline int getSection(const size_t &i) const
+      { return sections[i]; }
+    ID getTags(void) const;
+    ID getSections(void) const;
+    Vector getColumn(const size_t &) const;
+    Vector getRow(const size_t &) const;
+  };
+
+} // end of XC namespace
+
+#endif
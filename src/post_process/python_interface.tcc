@@ -47,3 +47,56 @@ class_<XC::MapFields, bases<CommandEntity,dq_fields> >("MapFields")
   .def("newField",make_function( &XC::MapFields::newField, return_internal_reference<>() ),"Defines a new field.")
   ;
 
+
+class_<XC::ResultStore, bases<CommandEntity>, boost::noncopyable >("ResultStore", no_init)
+  .def("open",&XC::ResultStore::open,"open(fileName,append): open the file to write the results in.")
+  .def("close",&XC::ResultStore::close,"Close the file.")
+  .add_property("isOpen",&XC::ResultStore::isOpen,"True if the file is open.")
+  .add_property("fileName", make_function( &XC::ResultStore::getFileName, return_value_policy<return_by_value>() ),"Name of the file.")
+  .def("dumpDisplacements",&XC::ResultStore::dumpDisplacements,"dumpDisplacements(combName,set): write the displacements of the nodes of the set.")
+  .def("dumpInternalForces",&XC::ResultStore::dumpInternalForces,"dumpInternalForces(combName,set): write the internal forces of the elements of the set.")
+  .def("dump",&XC::ResultStore::dump,"dump(combName,set): write internal forces and displacements.")
+  ;
+
+bool (XC::ResultStoreReader::*nextChunk)(void)= &XC::ResultStoreReader::next;
+bool (XC::ResultStoreReader::*nextChunkOfKind)(const int &)= &XC::ResultStoreReader::next;
+class_<XC::ResultStoreReader, bases<CommandEntity>, boost::noncopyable >("ResultStoreReader")
+  .def("open",&XC::ResultStoreReader::open,"open(fileName): open a result store file.")
+  .def("close",&XC::ResultStoreReader::close,"Close the file.")
+  .def("next",nextChunk,"Read the next chunk; return false at the end of the file.")
+  .def("nextOfKind",nextChunkOfKind,"nextOfKind(kind): read the next chunk of the kind (0: displacements, 1: internal forces) skipping the others.")
+  .add_property("kind",&XC::ResultStoreReader::getKind,"Kind of the current chunk (0: displacements, 1: internal forces).")
+  .add_property("isNodal",&XC::ResultStoreReader::isNodal,"True if the current chunk contains nodal displacements.")
+  .add_property("combinationName", make_function( &XC::ResultStoreReader::getCombinationName, return_value_policy<return_by_value>() ),"Combination name of the current chunk.")
+  .add_property("numRows",&XC::ResultStoreReader::getNumRows,"Number of rows of the current chunk.")
+  .add_property("numColumns",&XC::ResultStoreReader::getNumColumns,"Number of value columns of the current chunk.")
+  .def("getTags",&XC::ResultStoreReader::getTags,"Return the node or element tags of the current chunk.")
+  .def("getSections",&XC::ResultStoreReader::getSections,"Return the section indexes of the current chunk.")
+  .def("getColumn",&XC::ResultStoreReader::getColumn,"getColumn(j): return the j-th value column of the current chunk.")
+  .def("getRow",&XC::ResultStoreReader::getRow,"getRow(i): return the values of the i-th row of the current chunk.")
+  ;
+
+class_<XC::CapacityFactorChecker, bases<CommandEntity>, boost::noncopyable >("CapacityFactorChecker")
+  .def("setInteractionDiagram",&XC::CapacityFactorChecker::setInteractionDiagram,with_custodian_and_ward<1,4>(),"setInteractionDiagram(elemTag,sectionIndex,diagram): assign a 3D interaction diagram to the section of the element.")
+  .def("setInteractionDiagram2d",&XC::CapacityFactorChecker::setInteractionDiagram2d,with_custodian_and_ward<1,4>(),"setInteractionDiagram2d(elemTag,sectionIndex,diagram): assign a 2D interaction diagram to the section of the element.")
+  .def("setFiberSection",&XC::CapacityFactorChecker::setFiberSection,"setFiberSection(elemTag,sectionIndex,section,diagramData,threeDim): assign the interaction diagram of the fiber section to the section of the element.")
+  .add_property("numControlPoints",&XC::CapacityFactorChecker::getNumControlPoints,"Number of (element, section) pairs to check.")
+  .def("addInternalForces",&XC::CapacityFactorChecker::addInternalForces,"addInternalForces(combName,elemTag,sectionIndex,[N,Vy,Vz,T,My,Mz]): append a row to the internal forces table.")
+  .def("readResultStore",&XC::CapacityFactorChecker::readResultStore,"readResultStore(fileName): append the internal forces read from a result store file.")
+  .add_property("numRows",&XC::CapacityFactorChecker::getNumRows,"Number of rows of the internal forces table.")
+  .add_property("numSkippedRows",&XC::CapacityFactorChecker::getNumSkippedRows,"Number of internal forces rows without control point.")
+  .def("clearInternalForces",&XC::CapacityFactorChecker::clearInternalForces,"Remove the internal forces table and the results.")
+  .def("clearAll",&XC::CapacityFactorChecker::clearAll,"Remove control points, diagrams and internal forces.")
+  .def("run",&XC::CapacityFactorChecker::run,"run(numThreads): compute the capacity factors (numThreads= 0: one thread for each hardware thread).")
+  .def("hasResults",&XC::CapacityFactorChecker::hasResults,"hasResults(i): true if the internal forces table has rows for the i-th control point.")
+  .add_property("numControlPointsWithoutResults",&XC::CapacityFactorChecker::getNumControlPointsWithoutResults,"Number of control points without rows in the internal forces table.")
+  .def("getElementTag",&XC::CapacityFactorChecker::getElementTag,"getElementTag(i): element tag of the i-th control point.")
+  .def("getSectionIndex",&XC::CapacityFactorChecker::getSectionIndex,"getSectionIndex(i): section index of the i-th control point.")
+  .def("getCombinationName",&XC::CapacityFactorChecker::getCombinationName,"getCombinationName(i): worst combination for the i-th control point.")
+  .def("getCapacityFactor",&XC::CapacityFactorChecker::getCapacityFactor,"getCapacityFactor(i): worst capacity factor for the i-th control point.")
+  .def("getN",&XC::CapacityFactorChecker::getN,"getN(i): axial force for the worst case of the i-th control point.")
+  .def("getMy",&XC::CapacityFactorChecker::getMy,"getMy(i): bending moment about y axis for the worst case of the i-th control point.")
+  .def("getMz",&XC::CapacityFactorChecker::getMz,"getMz(i): bending moment about z axis for the worst case of the i-th control point.")
+  .add_property("maxCapacityFactor",&XC::CapacityFactorChecker::getMaxCapacityFactor,"Maximum capacity factor over all the control points.")
+  .def("getRowCapacityFactors",&XC::CapacityFactorChecker::getRowCapacityFactors,"Return the capacity factors computed for each row of the internal forces table.")
+  ;
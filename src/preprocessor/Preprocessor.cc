@@ -29,6 +29,7 @@
 #include "Preprocessor.h"
 #include "FEProblem.h"
 #include "domain/domain/Domain.h"
+#include "domain/domain/partitioned/PartitionedDomain.h"
 #include "domain/mesh/node/Node.h"
 #include "domain/mesh/element/Element.h"
 #include "preprocessor/set_mgmt/SetEstruct.h"
@@ -127,6 +128,35 @@ XC::SetEstruct *XC::Preprocessor::busca_set_estruct(const std::string &nmb)
     return retval;
   }
 
+//! @brief Replace the domain by a partitioned one, that can be split
+//! in subdomains (see PartitionedDomain::partition). The domain must
+//! be empty (call this method before defining the model).
+bool XC::Preprocessor::usePartitionedDomain(void)
+  {
+    bool retval= (dynamic_cast<PartitionedDomain *>(domain)!=nullptr);
+    if(!retval)
+      {
+        if(domain && ((domain->getNumNodes()>0) || (domain->getNumElements()>0)))
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; the domain is not empty, define the model"
+                    << " after calling this method." << std::endl;
+        else
+          {
+            DataOutputHandler::map_output_handlers *oh= nullptr;
+            if(domain)
+              {
+                oh= domain->getOutputHandlers();
+                if(FEProblem::theActiveDomain==domain)
+                  FEProblem::theActiveDomain= nullptr;
+                delete domain;
+              }
+            domain= new PartitionedDomain(this,oh);
+            retval= true;
+          }
+      }
+    return retval;
+  }
+
 //! @brief Domain setup to solve for a new load pattern.
 void XC::Preprocessor::resetLoadCase(void)
   { 
@@ -146,6 +146,7 @@ class Preprocessor: public CommandEntity, public MovableObject
 
     void resetLoadCase(void);
     void clearAll(void);
+    bool usePartitionedDomain(void);
 
     static void setDeadSRF(const double &);
 
@@ -76,6 +76,7 @@ class_<XC::Preprocessor, bases<CommandEntity>, boost::noncopyable >("Preprocesso
   .add_property("getDomain", make_function( getDomainRf, return_internal_reference<>() ))
   .def("resetLoadCase",&XC::Preprocessor::resetLoadCase)
   .def("setDeadSRF",XC::Preprocessor::setDeadSRF,"Assigns Stress Reduction Factor for element deactivation.")
+  .def("usePartitionedDomain",&XC::Preprocessor::usePartitionedDomain,"Replace the (empty) domain by a partitioned one, that can be split in subdomains. Call it before defining the model.")
   ;
 
   }
@@ -137,6 +137,9 @@
 #include "material/section/repres/geom_section/GeomSection.h"
 #include "material/section/interaction_diagram/InteractionDiagram.h"
 #include "material/section/interaction_diagram/InteractionDiagram2d.h"
+#include "utility/ThreadPool.h"
+#include <algorithm>
+#include <boost/python/extract.hpp>
 
 //Plate section.
 #include "material/section/plate_section/ElasticPlateSection.h"
@@ -583,6 +586,82 @@ XC::InteractionDiagram *XC::MaterialHandler::calcInteractionDiagram(const std::s
     return diagI;     
   }
 
+//! @brief Computes the interaction diagrams of the sections whose names
+//! are being passed as parameter.
+//!
+//! The sections are distributed between the threads specified in
+//! diag_data (each section is computed by a single thread on its
+//! own copy). The diagrams are stored with the name "diagInt"+section name.
+//! Returns the number of diagrams computed.
+size_t XC::MaterialHandler::calcInteractionDiagrams(const std::vector<std::string> &cod_sccs,const InteractionDiagramData &diag_data)
+  {
+    std::vector<std::string> names;
+    std::vector<const FiberSectionBase *> sections;
+    for(std::vector<std::string>::const_iterator i= cod_sccs.begin();i!=cod_sccs.end();i++)
+      {
+        const_iterator mat= materials.find(*i);
+        if(mat!=materials.end())
+          {
+            const FiberSectionBase *tmp= dynamic_cast<const FiberSectionBase *>(mat->second);
+            if(tmp)
+              {
+                names.push_back(*i);
+                sections.push_back(tmp);
+              }
+            else
+              std::cerr << getClassName() << "::" << __FUNCTION__
+                        << "; material: '" << *i
+                        << "' is not a fiber section material." << std::endl;
+          }
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; material: '" << *i
+                    << "' not found. Ignored." << std::endl;
+      }
+    const size_t sz= sections.size();
+    std::vector<InteractionDiagram *> diagrams(sz,nullptr);
+    size_t numThreads= diag_data.getNumThreads();
+    if(numThreads==0)
+      numThreads= ThreadPool::getHardwareConcurrency();
+    numThreads= std::min(numThreads,sz);
+    InteractionDiagramData sectionData(diag_data);
+    if(numThreads>1)
+      {
+        sectionData.setNumThreads(1); //One thread for each section.
+        ThreadPool pool(numThreads);
+        pool.parallel_for(sz,[&](const size_t &i,const size_t &)
+          { diagrams[i]= new InteractionDiagram(calc_interaction_diagram(*sections[i],sectionData)); },1);
+      }
+    else
+      for(size_t i= 0;i<sz;i++)
+        diagrams[i]= new InteractionDiagram(calc_interaction_diagram(*sections[i],sectionData));
+    for(size_t i= 0;i<sz;i++)
+      {
+        const std::string cod_diag= "diagInt"+names[i];
+        interaction_diagram_iterator j= interaction_diagrams.find(cod_diag);
+        if(j!=interaction_diagrams.end()) //Diagram exists.
+          {
+            std::clog << getClassName() << "::" << __FUNCTION__
+                      << "; warning! interaction diagram: '"
+                      << cod_diag << "' redefined." << std::endl;
+            delete j->second;
+          }
+        interaction_diagrams[cod_diag]= diagrams[i];
+      }
+    return sz;
+  }
+
+//! @brief Computes the interaction diagrams of the sections whose names
+//! are in the python list being passed as parameter.
+size_t XC::MaterialHandler::calcInteractionDiagramsPy(const boost::python::list &l,const InteractionDiagramData &diag_data)
+  {
+    std::vector<std::string> cod_sccs;
+    const size_t sz= len(l);
+    for(size_t i=0; i<sz; i++)
+      cod_sccs.push_back(boost::python::extract<std::string>(l[i]));
+    return calcInteractionDiagrams(cod_sccs,diag_data);
+  }
+
 //! @brief New 2D interaction diagram (N-My)
 XC::InteractionDiagram2d *XC::MaterialHandler::calcInteractionDiagramNMy(const std::string &cod_scc,const InteractionDiagramData &diag_data)
   {
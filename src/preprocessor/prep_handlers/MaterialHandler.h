@@ -31,6 +31,8 @@
 
 #include "PrepHandler.h"
 #include <map>
+#include <vector>
+#include <boost/python/list.hpp>
 
 namespace XC {
 class Material;
@@ -98,6 +100,8 @@ class MaterialHandler: public PrepHandler
     GeomSection &getGeomSection(const std::string &);
     InteractionDiagram *newInteractionDiagram(const std::string &);
     InteractionDiagram *calcInteractionDiagram(const std::string &,const InteractionDiagramData &diag_data);
+    size_t calcInteractionDiagrams(const std::vector<std::string> &,const InteractionDiagramData &diag_data);
+    size_t calcInteractionDiagramsPy(const boost::python::list &,const InteractionDiagramData &diag_data);
     InteractionDiagram &getInteractionDiagram(const std::string &);
     InteractionDiagram2d *new2DInteractionDiagram(const std::string &);
     InteractionDiagram2d *calcInteractionDiagramNMy(const std::string &,const InteractionDiagramData &diag_data);
@@ -53,6 +53,8 @@ class_<XC::MaterialHandler, bases<XC::PrepHandler>, boost::noncopyable >("Materi
   .def("interactionDiagExists",&XC::MaterialHandler::InteractionDiagramExists,"True if intecractions diagram is already defined.")
   .def("newInteractionDiagram", &XC::MaterialHandler::newInteractionDiagram,return_internal_reference<>())
   .def("calcInteractionDiagram", &XC::MaterialHandler::calcInteractionDiagram,return_internal_reference<>())
+  .def("calcInteractionDiagrams", &XC::MaterialHandler::calcInteractionDiagramsPy,"Computes the interaction diagrams of the sections whose names are in the list, distributing them between the threads specified in the diagram parameters (numThreads). Each diagram is stored as 'diagInt'+section name.")
+  .def("getInteractionDiagram", &XC::MaterialHandler::getInteractionDiagram,return_internal_reference<>(),"Returns the interaction diagram whose name is given.")
   .def("interactionDiag2dExists",&XC::MaterialHandler::InteractionDiagramExists2d,"True if intecractions diagram is already defined.")
   .def("new2DInteractionDiagram", &XC::MaterialHandler::new2DInteractionDiagram,return_internal_reference<>())
   .def("calcInteractionDiagramNMy", &XC::MaterialHandler::calcInteractionDiagramNMy,return_internal_reference<>())
@@ -34,6 +34,8 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include <deque>
 #include <set>
+#include <unordered_set>
+#include <unordered_map>
 #include "utility/actor/actor/MovableID.h"
 #include <boost/iterator/indirect_iterator.hpp>
 
@@ -63,6 +65,16 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     typedef typename lst_ptr::const_reference const_reference;
     typedef typename lst_ptr::size_type size_type;
     typedef boost::indirect_iterator<iterator> indIterator;
+  private:
+    std::unordered_set<const T *> ptrIndex; //!< hashed index for membership queries.
+    mutable std::unordered_map<int, T *> tagIndex; //!< tag to pointer index (lazy).
+    mutable size_t tagIndexed; //!< number of objects already in tagIndex.
+    mutable bool tagIndexOk; //!< false if tagIndex must be rebuilt.
+    void update_tag_index(void) const;
+  protected:
+    iterator erase(iterator);
+    void remove(const DqPtrs &);
+    void intersect(const DqPtrs &);
   public:
     DqPtrs(CommandEntity *owr= nullptr);
     DqPtrs(const DqPtrs &);
@@ -94,12 +106,12 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
     inline size_type size(void) const
       { return lst_ptr::size(); }
     bool in(const T *) const;
+    T *findTag(const int &) const;
     //void sort_on_prop(const std::string &cod,const bool &ascending= true);
 
     const ID &getTags(void) const;
     template <class InputIterator>
-    void insert(iterator pos, InputIterator f, InputIterator l)
-      { lst_ptr::insert(pos,f,l); }
+    void insert(iterator pos, InputIterator f, InputIterator l);
 
     
     int sendTags(int posSz,int posDbTag,DbTagData &dt,CommParameters &cp);
@@ -110,24 +122,29 @@ class DqPtrs: public CommandEntity, protected std::deque<T *>
 //! @brief Constructor.
 template <class T>
 DqPtrs<T>::DqPtrs(CommandEntity *owr)
-  : CommandEntity(owr),lst_ptr() {}
+  : CommandEntity(owr),lst_ptr(), tagIndexed(0), tagIndexOk(false) {}
 
 //! @brief Copy constructor.
 template <class T>
 DqPtrs<T>::DqPtrs(const DqPtrs<T> &other)
-  : CommandEntity(other), lst_ptr(other)
-  {}
+  : CommandEntity(other), lst_ptr(other), ptrIndex(other.ptrIndex),
+    tagIndexed(0), tagIndexOk(false) {}
 
-//! @brief Copy from deque container.
+//! @brief Copy from deque container (repeated pointers are ignored).
 template <class T>
 DqPtrs<T>::DqPtrs(const std::deque<T *> &ts)
-  : CommandEntity(), lst_ptr(ts)
-  {}
+  : CommandEntity(), lst_ptr(), tagIndexed(0), tagIndexOk(false)
+  {
+    ptrIndex.reserve(ts.size());
+    for(typename std::deque<T *>::const_iterator i= ts.begin();i!=ts.end();i++)
+      push_back(*i);
+  }
 
 //! @brief Copy from set container.
 template <class T>
 DqPtrs<T>::DqPtrs(const std::set<const T *> &st)
-  : CommandEntity(), lst_ptr()
+  : CommandEntity(), lst_ptr(), ptrIndex(st.begin(),st.end()),
+    tagIndexed(0), tagIndexOk(false)
   {
     typename std::set<const T *>::const_iterator k;
     k= st.begin();
@@ -141,6 +158,8 @@ DqPtrs<T> &DqPtrs<T>::operator=(const DqPtrs &other)
   {
     CommandEntity::operator=(other);
     lst_ptr::operator=(other);
+    ptrIndex= other.ptrIndex;
+    tagIndexOk= false;
     return *this;
   }
 
@@ -158,6 +177,7 @@ DqPtrs<T> &DqPtrs<T>::operator+=(const DqPtrs &other)
 template <class T>
 void DqPtrs<T>::extend(const DqPtrs &other)
   {
+    ptrIndex.reserve(size()+other.size());
     for(register const_iterator i= other.begin();i!=other.end();i++)
       push_back(*i);
   }
@@ -165,7 +185,12 @@ void DqPtrs<T>::extend(const DqPtrs &other)
 //! @brief Clears out the list of pointers.
 template<class T>
 void DqPtrs<T>::clear(void)
-  { lst_ptr::clear(); }
+  {
+    lst_ptr::clear();
+    ptrIndex.clear();
+    tagIndex.clear();
+    tagIndexOk= false;
+  }
 
 //! @brief Clears out the list of pointers and erases the properties of the object (if any).
 template<class T>
@@ -186,17 +211,114 @@ const T &DqPtrs<T>::get(const size_t &i) const
 //! @brief Returns true if the pointer is in the container.
 template<class T>
 bool DqPtrs<T>::in(const T *ptr) const
+  { return (ptrIndex.find(ptr)!=ptrIndex.end()); }
+
+//! @brief Brings the tag to pointer index up to date (the objects
+//! appended with push_back are indexed incrementally, any other
+//! modification of the container forces a rebuild).
+template<class T>
+void DqPtrs<T>::update_tag_index(void) const
   {
-    bool retval= false;
-    for(const_iterator i= begin();i!= end();i++)
-      if(*i==ptr)
-        {
-          retval= true;
-          break;
-        }
+    if(!tagIndexOk)
+      {
+        tagIndex.clear();
+        tagIndex.reserve(size());
+        tagIndexed= 0;
+        tagIndexOk= true;
+      }
+    for(const_iterator i= begin()+tagIndexed;i!= end();i++)
+      tagIndex.emplace((*i)->getTag(),*i); //First one wins.
+    tagIndexed= size();
+  }
+
+//! @brief Returns a pointer to the object identified by the tag
+//! (nullptr if not found).
+//!
+//! The tag index is built on the first query; if the tag of a
+//! member object changes afterwards the index is rebuilt when the
+//! stale entry is detected.
+template<class T>
+T *DqPtrs<T>::findTag(const int &tag) const
+  {
+    update_tag_index();
+    T *retval= nullptr;
+    typename std::unordered_map<int, T *>::const_iterator i= tagIndex.find(tag);
+    if(i!=tagIndex.end())
+      {
+        retval= i->second;
+        if(retval->getTag()!=tag) //Stale entry.
+          {
+            tagIndexOk= false;
+            update_tag_index();
+            i= tagIndex.find(tag);
+            retval= (i!=tagIndex.end() ? i->second : nullptr);
+          }
+      }
     return retval;
   }
 
+//! @brief Inserts the pointers in [f,l) before pos, ignoring
+//! the ones that are already in the container.
+template <class T> template <class InputIterator>
+void DqPtrs<T>::insert(iterator pos, InputIterator f, InputIterator l)
+  {
+    std::deque<T *> tmp;
+    for(InputIterator i= f;i!=l;i++)
+      {
+        T *t= *i;
+        if(t && ptrIndex.insert(t).second) //New element.
+          tmp.push_back(t);
+      }
+    if(pos!=end())
+      tagIndexOk= false;
+    lst_ptr::insert(pos,tmp.begin(),tmp.end());
+  }
+
+//! @brief Removes the object pointed by the iterator from the container.
+template <class T>
+typename DqPtrs<T>::iterator DqPtrs<T>::erase(iterator i)
+  {
+    ptrIndex.erase(*i);
+    tagIndexOk= false;
+    return lst_ptr::erase(i);
+  }
+
+//! @brief Removes the objects that also belong to the container
+//! being passed as parameter (preserves the order of the remaining ones).
+template <class T>
+void DqPtrs<T>::remove(const DqPtrs &other)
+  {
+    iterator j= begin();
+    for(iterator i= begin();i!=end();i++)
+      {
+        T *t= *i;
+        if(other.in(t))
+          ptrIndex.erase(t);
+        else
+          { *j= t; j++; }
+      }
+    lst_ptr::erase(j,end());
+    tagIndexOk= false;
+  }
+
+//! @brief Removes the objects that don't belong to the container
+//! being passed as parameter (preserves the order of the remaining ones).
+template <class T>
+void DqPtrs<T>::intersect(const DqPtrs &other)
+  {
+    iterator j= begin();
+    for(iterator i= begin();i!=end();i++)
+      {
+        T *t= *i;
+        if(other.in(t))
+          { *j= t; j++; }
+        else
+          ptrIndex.erase(t);
+      }
+    lst_ptr::erase(j,end());
+    tagIndexOk= false;
+  }
+
 
 template <class T>
 bool DqPtrs<T>::push_back(T *t)
@@ -204,7 +326,7 @@ bool DqPtrs<T>::push_back(T *t)
     bool retval= false;
     if(t)
       {
-        if(find(begin(),end(),t) == end()) //It's a new element.
+        if(ptrIndex.insert(t).second) //New element.
           {
             lst_ptr::push_back(t);
             retval= true;
@@ -222,9 +344,10 @@ bool DqPtrs<T>::push_front(T *t)
     bool retval= false;
     if(t)
       {
-        if(find(begin(),end(),t) == end()) //New element.
+        if(ptrIndex.insert(t).second) //New element.
           {
             lst_ptr::push_front(t);
+            tagIndexOk= false;
             retval= true;
           }
       }
@@ -52,44 +52,12 @@ XC::DqPtrsConstraint::DqPtrsConstraint(const std::set<const Constraint *> &st)
 //! @brief Returns (if it exists) a pointer to the element
 //! identified by the tag being passed as parameter.
 XC::Constraint *XC::DqPtrsConstraint::buscaConstrainto(const int &tag)
-  {
-    Constraint *retval= nullptr;
-    Constraint *tmp= nullptr;
-    for(iterator i= begin();i!=end();i++)
-      {
-        tmp= *i;
-        if(tmp)
-          {
-            if(tag == tmp->getTag())
-              {
-                retval= tmp;
-                break;
-              }
-          }
-      }
-    return retval;
-  }
+  { return findTag(tag); }
 
 //! @brief Returns (if it exists) a pointer to the element
 //! identified by the tag being passed as parameter.
 const XC::Constraint *XC::DqPtrsConstraint::buscaConstrainto(const int &tag) const
-  {
-    const Constraint *retval= nullptr;
-    const Constraint *tmp= nullptr;
-    for(const_iterator i= begin();i!=end();i++)
-      {
-        tmp= *i;
-        if(tmp)
-          {
-            if(tag == tmp->getTag())
-              {
-                retval= tmp;
-                break;
-              }
-          }
-      }
-    return retval;
-  }
+  { return findTag(tag); }
 
 //!  @brief Set indices to the objects to allow its use in VTK. 
 void XC::DqPtrsConstraint::numera(void)
@@ -27,6 +27,8 @@
 
 #include "DqPtrsElem.h"
 #include "domain/mesh/element/Element.h"
+#include "domain/mesh/ResultTables.h"
+#include "utility/matrix/ID.h"
 #include "domain/mesh/element/utils/NodePtrsWithIDs.h"
 #include "preprocessor/multi_block_topology/trf/TrfGeom.h"
 #include "xc_utils/src/geom/d1/Polyline3d.h"
@@ -65,44 +67,12 @@ XC::DqPtrsElem &XC::DqPtrsElem::operator=(const DqPtrsElem &other)
 //! @brief Returns (if it exists) a pointer to the element
 //! identified by the tag being passed as parameter.
 XC::Element *XC::DqPtrsElem::findElement(const int &tag)
-  {
-    Element *retval= nullptr;
-    Element *tmp= nullptr;
-    for(iterator i= begin();i!=end();i++)
-      {
-        tmp= *i;
-        if(tmp)
-          {
-            if(tag == tmp->getTag())
-              {
-                retval= tmp;
-                break;
-              }
-          }
-      }
-    return retval;
-  }
+  { return findTag(tag); }
 
 //! @brief Returns (if it exists) a pointer to the element
 //! identified by the tag being passed as parameter.
 const XC::Element *XC::DqPtrsElem::findElement(const int &tag) const
-  {
-    const Element *retval= nullptr;
-    const Element *tmp= nullptr;
-    for(const_iterator i= begin();i!=end();i++)
-      {
-        tmp= *i;
-        if(tmp)
-          {
-            if(tag == tmp->getTag())
-              {
-                retval= tmp;
-                break;
-              }
-          }
-      }
-    return retval;
-  }
+  { return findTag(tag); }
 
 //! @brief Returns the number of elements of the set which are active.
 size_t XC::DqPtrsElem::getNumLiveElements(void) const
@@ -188,6 +158,21 @@ std::set<int> XC::DqPtrsElem::getTags(void) const
     return retval;
   }
 
+//! @brief Returns the tags of the elements in the order of the container
+//! (the order of the rows of the tables returned by the methods below).
+XC::ID XC::DqPtrsElem::getTagsTable(void) const
+  { return element_tags_table(std::vector<const Element *>(begin(),end())); }
+
+//! @brief Returns a matrix whose rows are the resisting forces of the
+//! elements (see element_resisting_force_table).
+XC::Matrix XC::DqPtrsElem::getResistingForcesTable(void) const
+  { return element_resisting_force_table(std::vector<const Element *>(begin(),end())); }
+
+//! @brief Returns a matrix with the generalized stresses on each
+//! integration point of the elements (see element_generalized_stress_table).
+XC::Matrix XC::DqPtrsElem::getGeneralizedStressesTable(void) const
+  { return element_generalized_stress_table(std::vector<const Element *>(begin(),end())); }
+
 //! @brief Returns the boundary of the element set.
 BND3d XC::DqPtrsElem::Bnd(const double &factor) const
   {
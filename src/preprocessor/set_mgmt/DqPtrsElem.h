@@ -39,6 +39,8 @@ class BND3d;
 
 namespace XC {
 class TrfGeom;
+class ID;
+class Matrix;
 
 //!  @ingroup Set
 //! 
@@ -60,6 +62,9 @@ class DqPtrsElem: public DqPtrsKDTree<Element,KDTreeElements>
     void alive_elements(void);
 
     std::set<int> getTags(void) const;
+    ID getTagsTable(void) const;
+    Matrix getResistingForcesTable(void) const;
+    Matrix getGeneralizedStressesTable(void) const;
 
     void calc_resisting_force(void);
 
@@ -174,28 +174,12 @@ BND3d DqPtrsEntities<T>::Bnd(void) const
 //! @brief Removes the objects that belongs also to the parameter.
 template <class T>
 void DqPtrsEntities<T>::remove(const DqPtrsEntities<T> &other)
-  {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j!=this->end()) //Found.
-	  this->erase(j);
-      }
-  }
+  { DqPtrs<T>::remove(other); }
 
-//! @brief Removes the objects that belongs also to the parameter.
+//! @brief Removes the objects that don't belong to the parameter.
 template <class T>
 void DqPtrsEntities<T>::intersect(const DqPtrsEntities<T> &other)
-  {
-    for(const_iterator i= other.begin();i!= other.end();i++)
-      {
-        const T *t= (*i);
-	iterator j= find(this->begin(),this->end(),t);
-	if(j==this->end()) //Not found
-	  this->erase(j);
-      }
-  }
+  { DqPtrs<T>::intersect(other); }
 
 //! @brief -= (difference) operator.
 template <class T>
@@ -230,9 +214,8 @@ DqPtrsEntities<T> operator-(const DqPtrsEntities<T> &a,const DqPtrsEntities<T> &
     DqPtrsEntities<T> retval;
     for(typename DqPtrsEntities<T>::const_iterator i= a.begin();i!= a.end();i++)
       {
-        const T *t= (*i);
-	const typename DqPtrsEntities<T>::const_iterator j= find(b.begin(),b.end(),t);
-	if(j==b.end()) //Not found in b.
+        T *t= (*i);
+	if(!b.in(t)) //Not found in b.
 	  retval.push_back(t);
       }
     return retval;
@@ -245,9 +228,8 @@ DqPtrsEntities<T> operator*(const DqPtrsEntities<T> &a,const DqPtrsEntities<T> &
     DqPtrsEntities<T> retval;
     for(typename DqPtrsEntities<T>::const_iterator i= a.begin();i!= a.end();i++)
       {
-        const T *t= (*i);
-	const typename DqPtrsEntities<T>::const_iterator j= find(b.begin(),b.end(),t);
-	if(j!=b.end()) //Found also in b.
+        T *t= (*i);
+	if(b.in(t)) //Found also in b.
 	  retval.push_back(t);
       }
     return retval;
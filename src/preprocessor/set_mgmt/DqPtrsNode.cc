@@ -27,6 +27,8 @@
 
 #include "DqPtrsNode.h"
 #include "domain/mesh/node/Node.h"
+#include "domain/mesh/ResultTables.h"
+#include "utility/matrix/ID.h"
 #include "preprocessor/multi_block_topology/trf/TrfGeom.h"
 #include "xc_basic/src/funciones/algebra/ExprAlgebra.h"
 #include "xc_utils/src/geom/pos_vec/Pos3d.h"
@@ -86,44 +88,12 @@ void XC::DqPtrsNode::transforma(const TrfGeom &trf)
 //! @brief Returns (if it exists) a pointer to the node
 //! cuyo tag is being passed as parameter.
 XC::Node *XC::DqPtrsNode::findNode(const int &tag)
-  {
-    Node *retval= nullptr;
-    Node *tmp= nullptr;
-    for(iterator i= begin();i!=end();i++)
-      {
-        tmp= *i;
-        if(tmp)
-          {
-            if(tag == tmp->getTag())
-              {
-                retval= tmp;
-                break;
-              }
-          }
-      }
-    return retval;
-  }
+  { return findTag(tag); }
 
 //! @brief Returns (if it exists) a pointer to the node
 //! cuyo tag is being passed as parameter.
 const XC::Node *XC::DqPtrsNode::findNode(const int &tag) const
-  {
-    const Node *retval= nullptr;
-    const Node *tmp= nullptr;
-    for(const_iterator i= begin();i!=end();i++)
-      {
-        tmp= *i;
-        if(tmp)
-          {
-            if(tag == tmp->getTag())
-              {
-                retval= tmp;
-                break;
-              }
-          }
-      }
-    return retval;
-  }
+  { return findTag(tag); }
 
 //! @brief Returns the number of nodes of the set which are active.
 size_t XC::DqPtrsNode::getNumLiveNodes(void) const
@@ -167,11 +137,7 @@ void XC::DqPtrsNode::numera(void)
 //! @brief Returns true if the node identified by the tag
 //! being passed as parameter, belongs to the set.
 bool XC::DqPtrsNode::InNodeTag(const int tag_node) const
-  {
-    for(const_iterator i= begin();i!=end();i++)
-      if(tag_node == (*i)->getTag()) return true;
-    return false;
-  }
+  { return (findTag(tag_node)!=nullptr); }
 
 //! @brief Returns true if the nodes, with the tags
 //! are being passed as parameter, belong to the set.
@@ -192,6 +158,23 @@ std::set<int> XC::DqPtrsNode::getTags(void) const
     return retval;
   }
 
+//! @brief Returns the tags of the nodes in the order of the container
+//! (the order of the rows of the tables returned by the methods below).
+XC::ID XC::DqPtrsNode::getTagsTable(void) const
+  { return node_tags_table(std::vector<const Node *>(begin(),end())); }
+
+//! @brief Returns a matrix whose rows are the coordinates of the nodes.
+XC::Matrix XC::DqPtrsNode::getCoordinatesTable(void) const
+  { return node_coordinates_table(std::vector<const Node *>(begin(),end())); }
+
+//! @brief Returns a matrix whose rows are the displacements of the nodes.
+XC::Matrix XC::DqPtrsNode::getDisplacementsTable(void) const
+  { return node_disp_table(std::vector<const Node *>(begin(),end())); }
+
+//! @brief Returns a matrix whose rows are the reactions of the nodes.
+XC::Matrix XC::DqPtrsNode::getReactionsTable(void) const
+  { return node_reaction_table(std::vector<const Node *>(begin(),end())); }
+
 //! @brief Return a container with the nodes that lie inside the
 //! geometric object.
 //!
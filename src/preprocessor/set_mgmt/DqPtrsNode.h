@@ -41,6 +41,8 @@ class BND3d;
 
 namespace XC {
 class TrfGeom;
+class ID;
+class Matrix;
 
 //!  @ingroup Set
 //! 
@@ -64,6 +66,10 @@ class DqPtrsNode: public DqPtrsKDTree<Node,KDTreeNodes>
     bool InNodeTag(const int ) const;
     bool InNodeTags(const ID &) const;
     std::set<int> getTags(void) const;
+    ID getTagsTable(void) const;
+    Matrix getCoordinatesTable(void) const;
+    Matrix getDisplacementsTable(void) const;
+    Matrix getReactionsTable(void) const;
     DqPtrsNode pickNodesInside(const GeomObj3d &, const double &tol= 0.0);
     BND3d Bnd(const double &) const;
     Pos3d getCentroid(const double &) const;
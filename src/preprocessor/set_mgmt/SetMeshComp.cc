@@ -272,44 +272,12 @@ const XC::Element *XC::SetMeshComp::findElement(const int &tag) const
 //! @brief Returns, if it exists, a pointer to the constraint
 //! which tag is being passed as parameter.
 XC::Constraint *XC::SetMeshComp::buscaConstraint(const int &tag)
-  {
-    Constraint *retval= nullptr;
-    Constraint *tmp= nullptr;
-    for(lst_ptr_constraints::iterator i= constraints.begin();i!=constraints.end();i++)
-      {
-        tmp= *i;
-        if(tmp)
-          {
-            if(tag == tmp->getTag())
-              {
-                retval= tmp;
-                break;
-              }
-          }
-      }
-    return retval;
-  }
+  { return constraints.buscaConstrainto(tag); }
 
 //! @brief Returns, if it exists, a pointer to the constraint
 //! which tag is being passed as parameter.
 const XC::Constraint *XC::SetMeshComp::buscaConstraint(const int &tag) const
-  {
-    const Constraint *retval= nullptr;
-    const Constraint *tmp= nullptr;
-    for(lst_ptr_constraints::const_iterator i= constraints.begin();i!=constraints.end();i++)
-      {
-        tmp= *i;
-        if(tmp)
-          {
-            if(tag == tmp->getTag())
-              {
-                retval= tmp;
-                break;
-              }
-          }
-      }
-    return retval;
-  }
+  { return constraints.buscaConstrainto(tag); }
 
 //! @brief Returns the number of active elements.
 size_t XC::SetMeshComp::getNumLiveElements(void) const
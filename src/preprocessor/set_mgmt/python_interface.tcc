@@ -29,19 +29,27 @@ class_<dq_ptrs_node, bases<CommandEntity>, boost::noncopyable >("dq_ptrs_node",n
   .def("at",make_function(&dq_ptrs_node::get, return_internal_reference<>() ), "Access specified node with bounds checking.")
   .def("__getitem__",make_function(&dq_ptrs_node::get, return_internal_reference<>() ), "Access specified node with bounds checking.")
   .def("getTags",make_function(&dq_ptrs_node::getTags, return_internal_reference<>() ),"Returns node identifiers.")
+  .def("__contains__",&dq_ptrs_node::in, "Returns true if the node is in the container.")
   .def("clear",&dq_ptrs_node::clear,"Removes all items.")
   ;
 
 XC::Node *(XC::DqPtrsNode::*getNearestNodeDqPtrs)(const Pos3d &)= &XC::DqPtrsNode::getNearest;
+XC::Node *(XC::DqPtrsNode::*findNodeDqPtrs)(const int &)= &XC::DqPtrsNode::findNode;
 class_<XC::DqPtrsNode, bases<dq_ptrs_node> >("DqPtrsNode",no_init)
   .def("append", &XC::DqPtrsNode::push_back,"Appends node at the end of the list.")
   .def("pushFront", &XC::DqPtrsNode::push_front,"Push node at the beginning of the list.")
   .add_property("getNumLiveNodes", &XC::DqPtrsNode::getNumLiveNodes)
   .add_property("getNumDeadNodes", &XC::DqPtrsNode::getNumDeadNodes)
   .def("getNearestNode",make_function(getNearestNodeDqPtrs, return_internal_reference<>() ),"Returns nearest node.")
+  .def("findNode",make_function(findNodeDqPtrs, return_internal_reference<>() ),"findNode(tag) returns the node with the tag (None if not found).")
+  .def("hasNodeTag",&XC::DqPtrsNode::InNodeTag,"hasNodeTag(tag) returns true if the node with the tag is in the container.")
   .def("pickNodesInside",&XC::DqPtrsNode::pickNodesInside,"pickNodesInside(geomObj,tol) return the nodes inside the geometric object.")
   .def("getBnd", &XC::DqPtrsNode::Bnd, "Returns nodes boundary.")
   .def("getCentroid", &XC::DqPtrsNode::getCentroid, "Returns nodes centroid.")
+  .def("getTagsTable", &XC::DqPtrsNode::getTagsTable, "Returns the node identifiers in the order of the rows of the tables below.")
+  .def("getCoordinatesTable", &XC::DqPtrsNode::getCoordinatesTable, "Returns a matrix whose rows are the node coordinates.")
+  .def("getDisplacementsTable", &XC::DqPtrsNode::getDisplacementsTable, "Returns a matrix whose rows are the node displacements.")
+  .def("getReactionsTable", &XC::DqPtrsNode::getReactionsTable, "Returns a matrix whose rows are the node reactions.")
   .def(self += self)
   .def(self + self)
   .def(self - self)
@@ -56,16 +64,19 @@ class_<dq_ptrs_element, bases<CommandEntity>, boost::noncopyable >("dq_ptrs_elem
   .def("at",make_function(&dq_ptrs_element::get, return_internal_reference<>() ), "Access specified element with bounds checking.")
   .def("__getitem__",make_function(&dq_ptrs_element::get, return_internal_reference<>() ), "Access specified element with bounds checking.")
   .def("getTags",make_function(&dq_ptrs_element::getTags, return_internal_reference<>() ),"Returns element identifiers.")
+  .def("__contains__",&dq_ptrs_element::in, "Returns true if the element is in the container.")
   .def("clear",&dq_ptrs_element::clear,"Removes all items.")
   ;
 
 XC::Element *(XC::DqPtrsElem::*getNearestElementDqPtrs)(const Pos3d &)= &XC::DqPtrsElem::getNearest;
+XC::Element *(XC::DqPtrsElem::*findElementDqPtrs)(const int &)= &XC::DqPtrsElem::findElement;
 class_<XC::DqPtrsElem, bases<dq_ptrs_element> >("DqPtrsElem",no_init)
   .def("append", &XC::DqPtrsElem::push_back,"Appends element at the end of the list.")
   .def("pushFront", &XC::DqPtrsElem::push_front,"Push element at the beginning of the list.")
   .add_property("getNumLiveElements", &XC::DqPtrsElem::getNumLiveElements)
   .add_property("getNumDeadElements", &XC::DqPtrsElem::getNumDeadElements)
   .def("getNearestElement",make_function(getNearestElementDqPtrs, return_internal_reference<>() ),"Returns nearest element.")
+  .def("findElement",make_function(findElementDqPtrs, return_internal_reference<>() ),"findElement(tag) returns the element with the tag (None if not found).")
   .def("getBnd", &XC::DqPtrsElem::Bnd, "Returns elements boundary.")
   .def("getContours",&XC::DqPtrsElem::getContours,"Returns contour(s) from the element set in the form of closed 3D polylines.")
   .def("pickElemsInside",&XC::DqPtrsElem::pickElemsInside,"pickElemsInside(geomObj,tol) return the elements inside the geometric object.") 
@@ -74,6 +85,9 @@ class_<XC::DqPtrsElem, bases<dq_ptrs_element> >("DqPtrsElem",no_init)
   .def("getTypes",&XC::DqPtrsElem::getTypesPy,"getElementTypes() return a list with the element types in the container.")
   .def("getMaterials",&XC::DqPtrsElem::getMaterialNamesPy,"getElementMaterials() return a list with the names of the element materials in the container.")
   .def("pickElemsOfMaterial",&XC::DqPtrsElem::pickElemsOfMaterial,"pickElemsOfMaterial(materialName) return the elements that have that material.")
+  .def("getTagsTable", &XC::DqPtrsElem::getTagsTable, "Returns the element identifiers in the order of the rows of the tables below.")
+  .def("getResistingForcesTable", &XC::DqPtrsElem::getResistingForcesTable, "Returns a matrix whose rows are the element resisting forces (global coordinates).")
+  .def("getGeneralizedStressesTable", &XC::DqPtrsElem::getGeneralizedStressesTable, "Returns a matrix with a row for each integration point of the elements: element tag, integration point index and generalized stresses on it.")
   .def(self += self)
   .def(self + self)
   .def(self - self)
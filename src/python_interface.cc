@@ -23,6 +23,7 @@
 
 
 #include "FEProblem.h"
+#include "post_process/CapacityFactorChecker.h"
 #include "python_interface.h"
 
 void export_utility(void);
@@ -77,6 +78,12 @@ BOOST_PYTHON_MODULE(xc)
     export_solution(); //Solution routines exposition.
 
 #include "post_process/python_interface.tcc"
+#include "reliability/analysis/randomNumber/python_interface.tcc"
+#include "reliability/domain/components/python_interface.tcc"
+#include "reliability/analysis/gFunction/python_interface.tcc"
+#include "reliability/analysis/sensitivity/python_interface.tcc"
+#include "reliability/analysis/transformation/python_interface.tcc"
+#include "reliability/analysis/analysis/python_interface.tcc"
 
     XC::Domain *(XC::FEProblem::*getDomainRef)(void)= &XC::FEProblem::getDomain;
     XC::Preprocessor &(XC::FEProblem::*getPreprocessorRef)(void)= &XC::FEProblem::getPreprocessor;
@@ -90,6 +97,8 @@ BOOST_PYTHON_MODULE(xc)
       .add_property("getDatabase", make_function( &XC::FEProblem::getDataBase, return_internal_reference<>() ),"Return a reference to the data base")
       .def("newDatabase", make_function( &XC::FEProblem::defineDatabase, return_internal_reference<>() ),"Create a data base")
       .add_property("getFields", make_function( &XC::FEProblem::getFields, return_internal_reference<>() ),"Return fields definition (export).")
+      .add_property("getResultStore", make_function( &XC::FEProblem::getResultStore, return_internal_reference<>() ),"Return the binary store for combination results.")
+      .def("dumpCombinationResults",&XC::FEProblem::dumpCombinationResults,"dumpCombinationResults(combName,set): write the element internal forces and the nodal displacements of the set for the current state in the result store.")
       .def("clearAll",&XC::FEProblem::clearAll,"Delete all entities in the FE problem.")
    ;
     def("getXCVersion",XC::getXCVersion);
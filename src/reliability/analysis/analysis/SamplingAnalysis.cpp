@@ -66,6 +66,7 @@
 #include <reliability/analysis/gFunction/GFunEvaluator.h>
 #include <reliability/analysis/gFunction/BasicGFunEvaluator.h>
 #include <reliability/analysis/randomNumber/RandomNumberGenerator.h>
+#include <reliability/analysis/randomNumber/CounterRandGenerator.h>
 #include <reliability/domain/components/RandomVariable.h>
 #include <reliability/domain/distributions/NormalRV.h>
 #include <utility/matrix/Vector.h>
@@ -110,8 +111,75 @@ XC::SamplingAnalysis::SamplingAnalysis(	ReliabilityDomain *passedReliabilityDoma
 	fileName= passedFileName;
 	startPoint = pStartPoint;
 	analysisTypeTag = passedAnalysisTypeTag;
+	firstSample = 0;
+	latinHypercubeSize = 0;
 }
 
+//! @brief Constructor (samples around the origin of the standard
+//! normal space without printing the progress of the analysis).
+//!
+//! @param passedNumberOfSimulations: maximum number of simulations.
+//! @param passedTargetCOV: target coefficient of variation.
+//! @param passedSamplingStdv: standard deviation of the sampling distribution.
+//! @param passedFileName: name of the output file.
+//! @param passedAnalysisTypeTag: 1: failure probability, 2: response
+//! statistics, 3: values of the limit-state functions (to the output file).
+XC::SamplingAnalysis::SamplingAnalysis(ReliabilityDomain &passedReliabilityDomain,
+					ProbabilityTransformation &passedProbabilityTransformation,
+					GFunEvaluator &passedGFunEvaluator,
+					RandomNumberGenerator &passedRandomNumberGenerator,
+					const int &passedNumberOfSimulations,
+					const double &passedTargetCOV,
+					const double &passedSamplingStdv,
+					const std::string &passedFileName,
+					const int &passedAnalysisTypeTag)
+:ReliabilityAnalysis()
+{
+	theReliabilityDomain = &passedReliabilityDomain;
+	theProbabilityTransformation = &passedProbabilityTransformation;
+	theGFunEvaluator = &passedGFunEvaluator;
+	theRandomNumberGenerator = &passedRandomNumberGenerator;
+	numberOfSimulations = passedNumberOfSimulations;
+	targetCOV = passedTargetCOV;
+	samplingStdv = passedSamplingStdv;
+	printFlag = 0;
+	fileName= passedFileName;
+	startPoint = 0;
+	analysisTypeTag = passedAnalysisTypeTag;
+	firstSample = 0;
+	latinHypercubeSize = 0;
+}
+
+//! @brief Sets the index of the first sample.
+//!
+//! When the random number generator is counter based (see
+//! CounterRandGenerator) the k-th simulation uses the
+//! (firstSample+k-1)-th sample of the stream. So the simulations can be
+//! distributed between several workers, each one with its own model
+//! and a different range of samples, and the results don't depend
+//! on the number of workers.
+void XC::SamplingAnalysis::setFirstSample(const int &i)
+  { firstSample= i; }
+
+//! @brief Return the index of the first sample.
+int XC::SamplingAnalysis::getFirstSample(void) const
+  { return firstSample; }
+
+//! @brief Sets the number of samples of the Latin hypercube design
+//! (if zero plain Monte Carlo sampling is used). When the simulations
+//! are distributed between several workers this is the total number
+//! of samples. If there are more simulations than samples in the
+//! design, the following ones belong to new replicates of the design
+//! (with different strata permutations). The target coefficient of
+//! variation is ignored, so all the simulations are run.
+//! Requires a counter based random number generator.
+void XC::SamplingAnalysis::setLatinHypercubeSize(const int &n)
+  { latinHypercubeSize= n; }
+
+//! @brief Return the number of samples of the Latin hypercube design.
+int XC::SamplingAnalysis::getLatinHypercubeSize(void) const
+  { return latinHypercubeSize; }
+
 
 
 
@@ -300,12 +368,30 @@ XC::SamplingAnalysis::analyze(void)
 	bool FEconvergence;
 
 
+	// With a counter based generator the samples are
+	// identified by its index in the stream.
+	CounterRandGenerator *theCounterGenerator = dynamic_cast<CounterRandGenerator *>(theRandomNumberGenerator);
+	bool useLatinHypercube = false;
+	if (latinHypercubeSize > 0) {
+		if (theCounterGenerator == 0) {
+			std::cerr << "XC::SamplingAnalysis::analyze() - Latin hypercube sampling" << std::endl
+				<< " requires a counter based random number generator;" << std::endl
+				<< " plain Monte Carlo sampling will be used." << std::endl;
+		}
+		else {
+			useLatinHypercube = true;
+		}
+	}
+
+
 	// Prepare output file
 	std::ofstream resultsOutputFile(fileName.c_str(), ios::out );
 
 
 	bool isFirstSimulation = true;
-	while( (k<=numberOfSimulations) && (govCov>targetCOV) || (k<=2) )
+	// With Latin hypercube sampling the design must be completed,
+	// so the target coefficient of variation is not checked.
+	while( (k<=numberOfSimulations) && (useLatinHypercube || (govCov>targetCOV)) || (k<=2) )
            {
 
 		// Keep the user posted
@@ -315,19 +401,39 @@ XC::SamplingAnalysis::analyze(void)
 
 		
 		// Create array of standard normal random numbers
-		if (isFirstSimulation) {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
+		if (theCounterGenerator) {
+			const int sample = firstSample+k-1;
+			theCounterGenerator->setSampleIndex(sample);
+			if (useLatinHypercube) {
+				// Random point inside the stratum of each variable.
+				result = theCounterGenerator->generate_nLatinHypercubeStdNormalNumbers(numRV,latinHypercubeSize);
+			}
+			else {
+				result = theCounterGenerator->generate_nIndependentStdNormalNumbers(numRV);
+			}
+			if (result < 0) {
+				std::cerr << "XC::SamplingAnalysis::analyze() - could not generate" << std::endl
+					<< " random numbers for simulation." << std::endl;
+				return -1;
+			}
+			randomArray = theCounterGenerator->getGeneratedNumbers();
+			seed = theCounterGenerator->getSeed();
 		}
 		else {
-			result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
-		}
-		seed = theRandomNumberGenerator->getSeed();
-		if (result < 0) {
-			std::cerr << "XC::SamplingAnalysis::analyze() - could not generate" << std::endl
-				<< " random numbers for simulation." << std::endl;
-			return -1;
+			if (isFirstSimulation) {
+				result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV,seed);
+			}
+			else {
+				result = theRandomNumberGenerator->generate_nIndependentStdNormalNumbers(numRV);
+			}
+			seed = theRandomNumberGenerator->getSeed();
+			if (result < 0) {
+				std::cerr << "XC::SamplingAnalysis::analyze() - could not generate" << std::endl
+					<< " random numbers for simulation." << std::endl;
+				return -1;
+			}
+			randomArray = theRandomNumberGenerator->getGeneratedNumbers();
 		}
-		randomArray = theRandomNumberGenerator->getGeneratedNumbers();
 
 		// Compute the point in standard normal space
 		u = startPointY + chol_covariance * randomArray;
@@ -359,6 +465,13 @@ XC::SamplingAnalysis::analyze(void)
 		}
 
 
+		// With a counter based generator each row of g-function values
+		// starts with the index of the sample, so the files written by
+		// workers running different ranges of samples can be merged.
+		if (analysisTypeTag == 3 && theCounterGenerator) {
+			resultsOutputFile << firstSample+k-1 << "  ";
+		}
+
 		// Loop over number of limit-state functions
 		for (int lsf=0; lsf<numLsf; lsf++ ) {
 
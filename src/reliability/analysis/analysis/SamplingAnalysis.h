@@ -85,6 +85,8 @@ private:
 	std::string fileName;
 	Vector *startPoint;
 	int analysisTypeTag;
+	int firstSample; //!< index of the first sample in the stream of a counter based generator.
+	int latinHypercubeSize; //!< number of samples of the Latin hypercube design (0: plain Monte Carlo).
 
 public:
 	SamplingAnalysis(	ReliabilityDomain *passedReliabilityDomain,
@@ -98,6 +100,20 @@ public:
 						const std::string &fName,
 						Vector *startPoint,
 						int analysisTypeTag);
+	SamplingAnalysis(ReliabilityDomain &,
+			ProbabilityTransformation &,
+			GFunEvaluator &,
+			RandomNumberGenerator &,
+			const int &numberOfSimulations,
+			const double &targetCOV,
+			const double &samplingStdv,
+			const std::string &fName,
+			const int &analysisTypeTag);
+
+	void setFirstSample(const int &);
+	int getFirstSample(void) const;
+	void setLatinHypercubeSize(const int &);
+	int getLatinHypercubeSize(void) const;
 
 	int analyze(void);
 };
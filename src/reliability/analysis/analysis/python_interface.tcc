@@ -0,0 +1,37 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+
+class_<XC::ReliabilityAnalysis, boost::noncopyable >("ReliabilityAnalysis", "Base class for reliability analyses.", no_init)
+  .def("analyze", &XC::ReliabilityAnalysis::analyze, "Run the analysis.")
+  ;
+
+class_<XC::SamplingAnalysis, bases<XC::ReliabilityAnalysis>, boost::noncopyable >("SamplingAnalysis", "SamplingAnalysis(reliabilityDomain,probabilityTransformation,gFunEvaluator,randomNumberGenerator,numberOfSimulations,targetCOV,samplingStdv,fileName,analysisTypeTag): sampling analysis (analysisTypeTag 1: failure probability, 2: response statistics, 3: values of the limit-state functions written to the output file).", init<XC::ReliabilityDomain &, XC::ProbabilityTransformation &, XC::GFunEvaluator &, XC::RandomNumberGenerator &, int, double, double, std::string, int>()[with_custodian_and_ward<1,2, with_custodian_and_ward<1,3, with_custodian_and_ward<1,4, with_custodian_and_ward<1,5> > > >()])
+  .add_property("firstSample", &XC::SamplingAnalysis::getFirstSample, &XC::SamplingAnalysis::setFirstSample, "Index of the first sample in the stream of a counter based generator.")
+  .add_property("latinHypercubeSize", &XC::SamplingAnalysis::getLatinHypercubeSize, &XC::SamplingAnalysis::setLatinHypercubeSize, "Number of samples of the Latin hypercube design (0: plain Monte Carlo sampling).")
+  ;
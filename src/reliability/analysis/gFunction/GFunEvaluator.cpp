@@ -76,6 +76,16 @@ XC::GFunEvaluator::GFunEvaluator(Tcl_Interp *passedTclInterp, ReliabilityDomain
     numberOfEvaluations = 0;
 }
 
+XC::GFunEvaluator::~GFunEvaluator(void)
+  {}
+
+//! @brief Run the analysis for the realization x starting from the
+//! current state of the domain (i.e. restored from a snapshot) instead
+//! of repeating the whole load history. By default the whole analysis
+//! is repeated.
+int XC::GFunEvaluator::runGFunAnalysisFromCurrentState(Vector x)
+  { return runGFunAnalysis(x); }
+
 double XC::GFunEvaluator::getG()
   { return g; }
 
@@ -88,6 +98,11 @@ int XC::GFunEvaluator::initializeNumberOfEvaluations()
 int XC::GFunEvaluator::getNumberOfEvaluations()
   { return numberOfEvaluations; }
 
+//! @brief Return the interpreter used to evaluate the limit-state
+//! functions.
+Tcl_Interp *XC::GFunEvaluator::getTclInterp(void)
+  { return theTclInterp; }
+
 
 int XC::GFunEvaluator::evaluateG(Vector x)
   {
@@ -104,7 +119,8 @@ int XC::GFunEvaluator::evaluateG(Vector x)
 
 
     // Set value of GFun-specific parameters in the limit-state function
-    this->tokenizeSpecials(theExpression);
+    if(this->tokenizeSpecials(theExpression)<0)
+      return -1;
 
 
     // Initial declarations
@@ -78,17 +78,22 @@ protected:
 
 public:
 	GFunEvaluator(Tcl_Interp *theTclInterp, ReliabilityDomain *theReliabilityDomain);
+	virtual ~GFunEvaluator(void);
 
 	// Methods provided by base class
 	int		evaluateG(Vector x);
 	double	getG();
 	int     initializeNumberOfEvaluations();
 	int     getNumberOfEvaluations();
+	Tcl_Interp *getTclInterp(void);
 
 	// Methods to be implemented by specific classes
 	virtual int		runGFunAnalysis(Vector x)	=0;
 	virtual int tokenizeSpecials(const std::string &theExpression)	=0;
 
+	// Run the analysis starting from the current state of the domain
+	virtual int		runGFunAnalysisFromCurrentState(Vector x);
+
 	// Methods implemented by SOME specific classes (random vibrations stuff)
 	virtual void    setNsteps(int nsteps);
 	virtual double  getDt();
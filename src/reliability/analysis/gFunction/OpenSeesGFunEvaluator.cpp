@@ -109,15 +109,7 @@ XC::OpenSeesGFunEvaluator::runGFunAnalysis(Vector x)
 
 
 	// Put random variables into the structural domain according to the RandomVariablePositioners
-	int numberOfRandomVariablePositioners = theReliabilityDomain->getNumberOfRandomVariablePositioners();
-	RandomVariablePositioner *theRandomVariablePositioner;
-	int rvNumber;
-	int i;
-	for ( i=1 ; i<=numberOfRandomVariablePositioners ; i++ )  {
-		theRandomVariablePositioner = theReliabilityDomain->getRandomVariablePositionerPtr(i);
-		rvNumber				= theRandomVariablePositioner->getRvNumber();
-		theRandomVariablePositioner->update(x(rvNumber-1));
-	}
+	updateRandomVariablePositioners(x);
 
 
 	// Run the structural analysis according to user specified scheme
@@ -155,6 +147,48 @@ XC::OpenSeesGFunEvaluator::runGFunAnalysis(Vector x)
 
 
 
+//! @brief Put the random variables into the structural domain
+//! according to the RandomVariablePositioners.
+void
+XC::OpenSeesGFunEvaluator::updateRandomVariablePositioners(const Vector &x)
+{
+	int numberOfRandomVariablePositioners = theReliabilityDomain->getNumberOfRandomVariablePositioners();
+	RandomVariablePositioner *theRandomVariablePositioner;
+	int rvNumber;
+	for (int i=1 ; i<=numberOfRandomVariablePositioners ; i++ )  {
+		theRandomVariablePositioner = theReliabilityDomain->getRandomVariablePositionerPtr(i);
+		rvNumber				= theRandomVariablePositioner->getRvNumber();
+		theRandomVariablePositioner->update(x(rvNumber-1));
+	}
+}
+
+//! @brief Set the command used to restore the equilibrium when the
+//! analysis starts from the current state of the domain (i.e.
+//! "[analyze 1]" with a zero load increment integrator). If empty
+//! the whole analysis is repeated.
+void
+XC::OpenSeesGFunEvaluator::setRestartCommand(const std::string &cmd)
+{
+	restartCommand= cmd;
+}
+
+//! @brief Put the random variables into the structural domain and
+//! run the restart command without reverting the domain to its
+//! initial state, so the load history is not repeated.
+int
+XC::OpenSeesGFunEvaluator::runGFunAnalysisFromCurrentState(Vector x)
+{
+	if (restartCommand.empty())
+		return runGFunAnalysis(x);
+
+	updateRandomVariablePositioners(x);
+
+	double result = 0;
+	Tcl_ExprDouble( theTclInterp, restartCommand.c_str(), &result);
+	return ((int)result);
+}
+
+
 int
 XC::OpenSeesGFunEvaluator::tokenizeSpecials(const std::string &theExpression)
 {
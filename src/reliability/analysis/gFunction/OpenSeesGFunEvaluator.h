@@ -77,7 +77,9 @@ private:
 	int removeRecorders();
 	char *rec_node_occurrence(char tempchar[100], bool createRecorders, int &line, int &column);
 	char *rec_element_occurrence(char tempchar[100], bool createRecorders, int &line, int &column);
+	void updateRandomVariablePositioners(const Vector &x);
 	std::string fileName;
+	std::string restartCommand;
 	int nsteps;
 	double dt;
 
@@ -89,6 +91,8 @@ public:
 						ReliabilityDomain *passedReliabilityDomain,
 						int nsteps, double dt);
 	int		runGFunAnalysis(Vector x);
+	int		runGFunAnalysisFromCurrentState(Vector x);
+	void	setRestartCommand(const std::string &);
 	int		tokenizeSpecials(const std::string &theExpression);
 
 	void    setNsteps(int nsteps);
@@ -0,0 +1,150 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PythonGFunEvaluator.cc
+
+#include "PythonGFunEvaluator.h"
+#include <tcl.h>
+#include <sstream>
+#include <iomanip>
+#include <limits>
+
+//! @brief Constructor.
+XC::PythonGFunEvaluator::PythonGFunEvaluator(ReliabilityDomain &rd)
+  : GFunEvaluator(Tcl_CreateInterp(),&rd) {}
+
+//! @brief Destructor (deletes the interpreter).
+XC::PythonGFunEvaluator::~PythonGFunEvaluator(void)
+  {
+    if(theTclInterp)
+      Tcl_DeleteInterp(theTclInterp);
+    theTclInterp= nullptr;
+  }
+
+//! @brief Set the callable that runs the analysis.
+void XC::PythonGFunEvaluator::setAnalysisCallback(const boost::python::object &f)
+  { analysisCallback= f; }
+
+//! @brief Set the callable that runs the analysis from the
+//! current state of the domain (if None the whole analysis is repeated).
+void XC::PythonGFunEvaluator::setRestartCallback(const boost::python::object &f)
+  { restartCallback= f; }
+
+//! @brief Set the callable that returns the values of the responses.
+void XC::PythonGFunEvaluator::setResponseCallback(const boost::python::object &f)
+  { responseCallback= f; }
+
+//! @brief Assign a value to a variable of the limit-state
+//! function expressions.
+int XC::PythonGFunEvaluator::setVariable(const std::string &name,const double &value)
+  {
+    std::ostringstream cmd;
+    cmd << "set " << name << " "
+        << std::setprecision(std::numeric_limits<double>::digits10+2)
+        << value;
+    const int result= Tcl_Eval(theTclInterp,cmd.str().c_str());
+    if(result!=TCL_OK)
+      {
+        std::cerr << "XC::PythonGFunEvaluator::" << __FUNCTION__
+                  << "; can't assign the value of the variable: '"
+                  << name << "'." << std::endl;
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Call the analysis callback being passed as parameter and
+//! return its result (a negative number if it fails).
+int XC::PythonGFunEvaluator::call_analysis(const boost::python::object &callback,const Vector &x)
+  {
+    int retval= -1;
+    if(callback.is_none())
+      std::cerr << "XC::PythonGFunEvaluator::" << __FUNCTION__
+                << "; analysis callback not defined." << std::endl;
+    else
+      {
+        try
+          {
+            boost::python::object result= callback(x);
+            retval= 0;
+            if(!result.is_none())
+              retval= boost::python::extract<int>(result);
+          }
+        catch(boost::python::error_already_set &)
+          {
+            std::cerr << "XC::PythonGFunEvaluator::" << __FUNCTION__
+                      << "; error executing callback." << std::endl;
+            PyErr_Print();
+            retval= -1;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Run the analysis for the realization x of the random variables.
+int XC::PythonGFunEvaluator::runGFunAnalysis(Vector x)
+  { return call_analysis(analysisCallback,x); }
+
+//! @brief Run the analysis for the realization x starting from the
+//! current state of the domain (if there is no restart callback the
+//! whole analysis is repeated).
+int XC::PythonGFunEvaluator::runGFunAnalysisFromCurrentState(Vector x)
+  {
+    if(restartCallback.is_none())
+      return runGFunAnalysis(x);
+    else
+      return call_analysis(restartCallback,x);
+  }
+
+//! @brief Assign the values returned by the response callback to
+//! the variables of the limit-state function expressions.
+int XC::PythonGFunEvaluator::tokenizeSpecials(const std::string &)
+  {
+    int retval= 0;
+    if(!responseCallback.is_none())
+      {
+        try
+          {
+            boost::python::dict responses= boost::python::extract<boost::python::dict>(responseCallback());
+            const boost::python::list items= responses.items();
+            const size_t sz= boost::python::len(items);
+            for(size_t i= 0;(i<sz) && (retval==0);i++)
+              {
+                const std::string name= boost::python::extract<std::string>(items[i][0]);
+                const double value= boost::python::extract<double>(items[i][1]);
+                retval= setVariable(name,value);
+              }
+          }
+        catch(boost::python::error_already_set &)
+          {
+            std::cerr << "XC::PythonGFunEvaluator::" << __FUNCTION__
+                      << "; error executing callback." << std::endl;
+            PyErr_Print();
+            retval= -1;
+          }
+      }
+    return retval;
+  }
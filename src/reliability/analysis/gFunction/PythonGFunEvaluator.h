@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PythonGFunEvaluator.h
+
+#ifndef PythonGFunEvaluator_h
+#define PythonGFunEvaluator_h
+
+#include "GFunEvaluator.h"
+#include <boost/python.hpp>
+
+namespace XC {
+//! @brief Limit-state function evaluator that runs the analyses
+//! through Python callables.
+//!
+//! The analysis callback receives the realization of the random
+//! variables (as a Vector), assigns their values to the model and
+//! runs the analysis; it returns a negative number if the analysis
+//! fails. The restart callback (optional) does the same starting
+//! from the current state of the domain (see
+//! runGFunAnalysisFromCurrentState). The response callback returns
+//! a dictionary with the values of the quantities that appear in
+//! the limit-state function expressions (i.e. {'uy': 1e-3} for
+//! the expression "{deltaMax}-{uy}").
+//!
+//! The object owns the interpreter used to evaluate the expressions.
+class PythonGFunEvaluator: public GFunEvaluator
+  {
+  private:
+    boost::python::object analysisCallback; //!< Python callable that runs the analysis.
+    boost::python::object restartCallback; //!< Python callable that runs the analysis from the current state.
+    boost::python::object responseCallback; //!< Python callable that returns the values of the responses.
+
+    int call_analysis(const boost::python::object &,const Vector &);
+    PythonGFunEvaluator(const PythonGFunEvaluator &);
+    PythonGFunEvaluator &operator=(const PythonGFunEvaluator &);
+  public:
+    PythonGFunEvaluator(ReliabilityDomain &);
+    ~PythonGFunEvaluator(void);
+
+    void setAnalysisCallback(const boost::python::object &);
+    //! @brief Return the callable that runs the analysis.
+    inline boost::python::object getAnalysisCallback(void) const
+      { return analysisCallback; }
+    void setRestartCallback(const boost::python::object &);
+    //! @brief Return the callable that runs the analysis from the current state.
+    inline boost::python::object getRestartCallback(void) const
+      { return restartCallback; }
+    void setResponseCallback(const boost::python::object &);
+    //! @brief Return the callable that returns the values of the responses.
+    inline boost::python::object getResponseCallback(void) const
+      { return responseCallback; }
+
+    int setVariable(const std::string &,const double &);
+    int runGFunAnalysis(Vector x);
+    int runGFunAnalysisFromCurrentState(Vector x);
+    int tokenizeSpecials(const std::string &theExpression);
+  };
+} // end of XC namespace
+
+#endif
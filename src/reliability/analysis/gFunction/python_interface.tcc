@@ -0,0 +1,43 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::GFunEvaluator, boost::noncopyable >("GFunEvaluator", "Base class for limit-state function evaluators.", no_init)
+  .def("runGFunAnalysis", &XC::GFunEvaluator::runGFunAnalysis, "runGFunAnalysis(x): run the analysis for the realization x of the random variables.")
+  .def("runGFunAnalysisFromCurrentState", &XC::GFunEvaluator::runGFunAnalysisFromCurrentState, "runGFunAnalysisFromCurrentState(x): run the analysis for the realization x starting from the current state of the domain.")
+  .def("evaluateG", &XC::GFunEvaluator::evaluateG, "evaluateG(x): evaluate the active limit-state function.")
+  .def("getG", &XC::GFunEvaluator::getG, "Return the last computed value of the limit-state function.")
+  .add_property("numberOfEvaluations", &XC::GFunEvaluator::getNumberOfEvaluations, "Return the number of evaluations of the limit-state functions.")
+  .def("initializeNumberOfEvaluations", &XC::GFunEvaluator::initializeNumberOfEvaluations, "Set the number of evaluations to zero.")
+  ;
+
+class_<XC::PythonGFunEvaluator, bases<XC::GFunEvaluator>, boost::noncopyable >("PythonGFunEvaluator", "Limit-state function evaluator that runs the analyses through Python callables.", init<XC::ReliabilityDomain &>()[with_custodian_and_ward<1,2>()])
+  .add_property("analysisCallback", &XC::PythonGFunEvaluator::getAnalysisCallback, &XC::PythonGFunEvaluator::setAnalysisCallback, "Callable f(x) that assigns the realization x of the random variables to the model and runs the analysis (returns a negative number if the analysis fails).")
+  .add_property("restartCallback", &XC::PythonGFunEvaluator::getRestartCallback, &XC::PythonGFunEvaluator::setRestartCallback, "Callable f(x) that runs the analysis starting from the current state of the domain (if None the whole analysis is repeated).")
+  .add_property("responseCallback", &XC::PythonGFunEvaluator::getResponseCallback, &XC::PythonGFunEvaluator::setResponseCallback, "Callable f() that returns a dictionary with the values of the variables of the limit-state functions.")
+  .def("setVariable", &XC::PythonGFunEvaluator::setVariable, "setVariable(name,value): assign a value to a variable of the limit-state functions.")
+  ;
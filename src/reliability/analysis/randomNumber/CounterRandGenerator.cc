@@ -0,0 +1,210 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CounterRandGenerator.cc
+
+#include <reliability/analysis/randomNumber/CounterRandGenerator.h>
+#include <reliability/domain/distributions/NormalRV.h>
+#include <algorithm>
+#include <iostream>
+
+//! @brief Constructor.
+//!
+//! @param seed: seed of the generator.
+XC::CounterRandGenerator::CounterRandGenerator(int seed)
+  :RandomNumberGenerator(), generatedNumbers(), key(seed), sampleIndex(0),
+   lhsStrata(), lhsSize(0), lhsReplicate(-1) {}
+
+//! @brief Finalizer of the SplitMix64 generator (bijective mixing
+//! of the bits of its argument).
+unsigned long long XC::CounterRandGenerator::mix(unsigned long long z)
+  {
+    z= (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z= (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return z ^ (z >> 31);
+  }
+
+//! @brief Return a number uniformly distributed in the open
+//! interval (0,1).
+//!
+//! This method is thread safe: the result depends only on its
+//! arguments and the seed of the generator.
+//! @param sample: index of the sample.
+//! @param component: index of the number inside the sample.
+//! @param stream: index of the stream (allows to draw independent
+//!                numbers for the same sample and component).
+double XC::CounterRandGenerator::getUniform(const int &sample,const int &component,const int &stream) const
+  {
+    const unsigned long long golden= 0x9e3779b97f4a7c15ULL;
+    unsigned long long h= mix(key+golden*(static_cast<unsigned long long>(sample)+1));
+    h= mix(h+golden*(static_cast<unsigned long long>(component)+1));
+    h= mix(h+golden*(static_cast<unsigned long long>(stream)+1));
+    // 53 random bits, shifted half a step so 0 and 1 are never returned.
+    return (static_cast<double>(h >> 11)+0.5)/9007199254740992.0;
+  }
+
+//! @brief Computes the strata of a Latin hypercube design for the
+//! component being passed as parameter.
+//!
+//! The i-th sample of the design lies in the interval
+//! \f$[strata_i/n, (strata_i+1)/n)\f$, where \f$strata\f$ is a random
+//! permutation of \f$0,1,...,n-1\f$ that depends only on the seed, the
+//! component and the replicate.
+//! @param numSamples: number of samples of the design.
+//! @param component: index of the component (random variable).
+//! @param strata: permutation of the strata.
+//! @param replicate: index of the replicate of the design (each one
+//!                   uses a different permutation).
+void XC::CounterRandGenerator::getLatinHypercubeStrata(const int &numSamples,const int &component,std::vector<int> &strata,const int &replicate) const
+  {
+    strata.resize(numSamples);
+    for(int i= 0;i<numSamples;i++)
+      strata[i]= i;
+    // Fisher-Yates shuffle (stream 0 is used by the plain samples).
+    const int stream= replicate+1;
+    for(int i= numSamples-1;i>0;i--)
+      {
+        int j= static_cast<int>(getUniform(i,component,stream)*(i+1));
+        if(j>i) j= i;
+        std::swap(strata[i],strata[j]);
+      }
+  }
+
+//! @brief Return the strata of the replicate and component being passed
+//! as parameter (they are cached, so the permutations are computed
+//! only once for each replicate).
+const std::vector<int> &XC::CounterRandGenerator::get_lhs_strata(const int &numSamples,const int &replicate,const int &component)
+  {
+    if((numSamples!=lhsSize) || (replicate!=lhsReplicate))
+      {
+        lhsStrata.clear();
+        lhsSize= numSamples;
+        lhsReplicate= replicate;
+      }
+    if(component>=static_cast<int>(lhsStrata.size()))
+      lhsStrata.resize(component+1);
+    std::vector<int> &retval= lhsStrata[component];
+    if(retval.empty())
+      getLatinHypercubeStrata(numSamples,component,retval,replicate);
+    return retval;
+  }
+
+//! @brief Return the number in (0,1) corresponding to the component of
+//! the sample being passed as parameter in a Latin hypercube design.
+//!
+//! The samples \f$rn, rn+1, ..., rn+n-1\f$ form the r-th replicate of
+//! the design: each one has its own permutation of the strata, so a run
+//! longer than the design doesn't repeat its points. Inside its stratum
+//! the number is random and depends on the index of the sample.
+//! This method is not thread safe (the strata are cached).
+//! @param sample: index of the sample.
+//! @param numSamples: number of samples of the design.
+//! @param component: index of the component (random variable).
+double XC::CounterRandGenerator::getLatinHypercubeUniform(const int &sample,const int &numSamples,const int &component)
+  {
+    const int replicate= sample/numSamples;
+    const int s= sample%numSamples;
+    const std::vector<int> &strata= get_lhs_strata(numSamples,replicate,component);
+    return (strata[s]+getUniform(sample,component))/numSamples;
+  }
+
+//! @brief Generates the numbers of the next sample of a Latin
+//! hypercube design, with standard normal distribution.
+//!
+//! @param n: number of values to generate.
+//! @param numSamples: number of samples of the design.
+int XC::CounterRandGenerator::generate_nLatinHypercubeStdNormalNumbers(int n, int numSamples)
+  {
+    if(numSamples<1)
+      {
+        std::cerr << "CounterRandGenerator::" << __FUNCTION__
+                  << "; the number of samples of the design must be"
+                  << " positive." << std::endl;
+        return -1;
+      }
+    NormalRV aStdNormRV(1,0.0,1.0,0.0);
+    generatedNumbers.resize(n);
+    for(int j=0; j<n; j++)
+      generatedNumbers(j)= aStdNormRV.getInverseCDFvalue(getLatinHypercubeUniform(sampleIndex,numSamples,j));
+    sampleIndex++;
+    return 0;
+  }
+
+//! @brief Sets the index of the next sample to generate.
+void XC::CounterRandGenerator::setSampleIndex(const int &i)
+  { sampleIndex= i; }
+
+//! @brief Generates the numbers of the next sample, uniformly
+//! distributed between lower and upper.
+//!
+//! @param n: number of values to generate.
+//! @param lower: lower bound.
+//! @param upper: upper bound.
+//! @param seedIn: if not zero, the generator is restarted with this seed.
+int XC::CounterRandGenerator::generate_nIndependentUniformNumbers(int n, double lower, double upper, int seedIn)
+  {
+    if(seedIn!=0)
+      {
+        key= seedIn;
+        sampleIndex= 0;
+        lhsStrata.clear();
+      }
+    generatedNumbers.resize(n);
+    for(int j=0; j<n; j++)
+      generatedNumbers(j)= (upper-lower)*getUniform(sampleIndex,j) + lower;
+    sampleIndex++;
+    return 0;
+  }
+
+//! @brief Generates the numbers of the next sample, with standard
+//! normal distribution.
+//!
+//! @param n: number of values to generate.
+//! @param seedIn: if not zero, the generator is restarted with this seed.
+int XC::CounterRandGenerator::generate_nIndependentStdNormalNumbers(int n, int seedIn)
+  {
+    if(seedIn!=0)
+      {
+        key= seedIn;
+        sampleIndex= 0;
+        lhsStrata.clear();
+      }
+    NormalRV aStdNormRV(1,0.0,1.0,0.0);
+    generatedNumbers.resize(n);
+    for(int j=0; j<n; j++)
+      generatedNumbers(j)= aStdNormRV.getInverseCDFvalue(getUniform(sampleIndex,j));
+    sampleIndex++;
+    return 0;
+  }
+
+//! @brief Return the numbers of the last sample.
+const XC::Vector &XC::CounterRandGenerator::getGeneratedNumbers(void) const
+  { return generatedNumbers; }
+
+//! @brief Return the seed of the generator (the sample index
+//! is needed too to restart a sequence, see setSampleIndex).
+int XC::CounterRandGenerator::getSeed(void)
+  { return static_cast<int>(key); }
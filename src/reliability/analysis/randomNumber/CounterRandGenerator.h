@@ -0,0 +1,76 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CounterRandGenerator.h
+
+#ifndef CounterRandGenerator_h
+#define CounterRandGenerator_h
+
+#include <reliability/analysis/randomNumber/RandomNumberGenerator.h>
+#include <vector>
+
+namespace XC {
+//! @brief Counter based random number generator.
+//!
+//! The j-th number of the k-th sample is obtained by hashing the seed
+//! together with k and j, no state is carried from one number to the
+//! next one. So the numbers of a sample don't depend on the order in
+//! which the samples are generated; the samples can be distributed
+//! between several workers (each one with its own model) and the
+//! results are the same regardless of their number.
+class CounterRandGenerator: public RandomNumberGenerator
+  {
+  private:
+    Vector generatedNumbers;
+    unsigned long long key; //!< seed of the generator.
+    int sampleIndex; //!< index of the next sample to generate.
+    std::vector<std::vector<int> > lhsStrata; //!< strata of the current Latin hypercube replicate (one permutation for each component).
+    int lhsSize; //!< number of samples of the Latin hypercube design stored in lhsStrata.
+    int lhsReplicate; //!< replicate stored in lhsStrata.
+
+    const std::vector<int> &get_lhs_strata(const int &,const int &,const int &);
+
+    static unsigned long long mix(unsigned long long);
+  public:
+    CounterRandGenerator(int seed= 1);
+
+    int generate_nIndependentStdNormalNumbers(int n, int seed=0);
+    int generate_nIndependentUniformNumbers(int n, double lower, double upper, int seed=0);
+    const Vector &getGeneratedNumbers(void) const;
+    int getSeed(void);
+
+    void setSampleIndex(const int &);
+    //! @brief Return the index of the next sample to generate.
+    inline int getSampleIndex(void) const
+      { return sampleIndex; }
+    double getUniform(const int &,const int &,const int &stream= 0) const;
+    void getLatinHypercubeStrata(const int &,const int &,std::vector<int> &,const int &replicate= 0) const;
+    double getLatinHypercubeUniform(const int &,const int &,const int &);
+    int generate_nLatinHypercubeStdNormalNumbers(int n, int numSamples);
+  };
+} // end of XC namespace
+
+#endif
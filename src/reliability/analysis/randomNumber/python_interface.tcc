@@ -0,0 +1,41 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::RandomNumberGenerator, boost::noncopyable >("RandomNumberGenerator", "Base class for random number generators.", no_init)
+  .def("generate_nIndependentStdNormalNumbers", &XC::RandomNumberGenerator::generate_nIndependentStdNormalNumbers, "generate_nIndependentStdNormalNumbers(n,seed): generate n numbers with standard normal distribution (if seed is not zero the generator is restarted with it).")
+  .def("generate_nIndependentUniformNumbers", &XC::RandomNumberGenerator::generate_nIndependentUniformNumbers, "generate_nIndependentUniformNumbers(n,lower,upper,seed): generate n numbers uniformly distributed between lower and upper (if seed is not zero the generator is restarted with it).")
+  .def("getGeneratedNumbers", &XC::RandomNumberGenerator::getGeneratedNumbers, return_value_policy<copy_const_reference>(), "Return the last generated numbers.")
+  .def("getSeed", &XC::RandomNumberGenerator::getSeed, "Return the seed of the generator.")
+  ;
+
+class_<XC::CounterRandGenerator, bases<XC::RandomNumberGenerator>, boost::noncopyable >("CounterRandGenerator", "Counter based random number generator (the numbers of each sample depend only on the seed and the index of the sample).", init<int>())
+  .add_property("sampleIndex", &XC::CounterRandGenerator::getSampleIndex, &XC::CounterRandGenerator::setSampleIndex, "Index of the next sample to generate.")
+  .def("getUniform", &XC::CounterRandGenerator::getUniform, "getUniform(sample,component,stream): return the number in (0,1) corresponding to the arguments.")
+  .def("getLatinHypercubeUniform", &XC::CounterRandGenerator::getLatinHypercubeUniform, "getLatinHypercubeUniform(sample,numSamples,component): return the number in (0,1) corresponding to the component of the sample in a Latin hypercube design with numSamples samples.")
+  .def("generate_nLatinHypercubeStdNormalNumbers", &XC::CounterRandGenerator::generate_nLatinHypercubeStdNormalNumbers, "generate_nLatinHypercubeStdNormalNumbers(n,numSamples): generate the n numbers (standard normal distribution) of the next sample of a Latin hypercube design with numSamples samples.")
+  ;
@@ -64,9 +64,13 @@
 #include <reliability/domain/components/LimitStateFunction.h>
 #include <reliability/analysis/gFunction/GFunEvaluator.h>
 #include <reliability/domain/components/RandomVariable.h>
+#include "domain/domain/Domain.h"
+#include "domain/domain/DomainSnapshots.h"
+#include "FEProblem.h"
 #include <tcl.h>
 
 #include <fstream>
+#include <limits>
 #include <iomanip>
 #include <iostream>
 using std::ifstream;
@@ -89,6 +93,8 @@ XC::FiniteDifferenceGradGEvaluator::FiniteDifferenceGradGEvaluator(
 	perturbationFactor = passedPerturbationFactor;
 	doGradientCheck = PdoGradientCheck;
 	reComputeG = pReComputeG;
+	restartFromMeanPoint = false;
+	snapshotTag = defaultSnapshotTag;
 
 	int nrv = passedReliabilityDomain->getNumberOfRandomVariables();
 	grad_g = new Vector(nrv);
@@ -98,6 +104,30 @@ XC::FiniteDifferenceGradGEvaluator::FiniteDifferenceGradGEvaluator(
 	DgDpar = 0;
 }
 
+//! @brief Constructor (the limit-state functions are evaluated
+//! with the interpreter of the GFunEvaluator).
+XC::FiniteDifferenceGradGEvaluator::FiniteDifferenceGradGEvaluator(
+					GFunEvaluator &passedGFunEvaluator,
+					ReliabilityDomain &passedReliabilityDomain,
+					const double &passedPerturbationFactor,
+					const bool &pReComputeG)
+:GradGEvaluator(&passedReliabilityDomain, passedGFunEvaluator.getTclInterp())
+{
+	theGFunEvaluator = &passedGFunEvaluator;
+	perturbationFactor = passedPerturbationFactor;
+	doGradientCheck = false;
+	reComputeG = pReComputeG;
+	restartFromMeanPoint = false;
+	snapshotTag = defaultSnapshotTag;
+
+	int nrv = passedReliabilityDomain.getNumberOfRandomVariables();
+	grad_g = new Vector(nrv);
+	grad_g_matrix = 0;
+
+	DgDdispl = 0;
+	DgDpar = 0;
+}
+
 XC::FiniteDifferenceGradGEvaluator::~FiniteDifferenceGradGEvaluator()
 {
 	delete grad_g;
@@ -133,6 +163,98 @@ XC::FiniteDifferenceGradGEvaluator::getAllGradG()
 	}
 }
 
+//! @brief Tag reserved for the snapshot of the mean point (unlikely
+//! to be used by the user).
+const int XC::FiniteDifferenceGradGEvaluator::defaultSnapshotTag= std::numeric_limits<int>::min();
+
+//! @brief If true, the analyses of the perturbed realizations start
+//! from the state of the domain obtained for the mean point (kept in
+//! memory as a snapshot, see setSnapshotTag and Domain::takeSnapshot)
+//! instead of repeating the whole load history.
+//! See GFunEvaluator::runGFunAnalysisFromCurrentState.
+//!
+//! The value of the limit-state functions at the mean point is
+//! computed again restarting from the snapshot, so the restart
+//! analysis is the same for the mean and the perturbed realizations.
+//! Even so, the option is meant for responses that don't depend on
+//! the load path (i.e. elastic models); otherwise the restart can't
+//! reproduce the state obtained repeating the load history.
+void XC::FiniteDifferenceGradGEvaluator::setRestartFromMeanPoint(const bool &b)
+  { restartFromMeanPoint= b; }
+
+//! @brief Return true if the perturbed analyses start from the
+//! state at the mean point.
+bool XC::FiniteDifferenceGradGEvaluator::getRestartFromMeanPoint(void) const
+  { return restartFromMeanPoint; }
+
+//! @brief Set the tag of the snapshot used to keep the state at the
+//! mean point (it must not be used by any other snapshot of the domain).
+void XC::FiniteDifferenceGradGEvaluator::setSnapshotTag(const int &tag)
+  { snapshotTag= tag; }
+
+//! @brief Return the tag of the snapshot used to keep the state at
+//! the mean point.
+int XC::FiniteDifferenceGradGEvaluator::getSnapshotTag(void) const
+  { return snapshotTag; }
+
+//! @brief Return the perturbation factor (the perturbation of each
+//! random variable is its standard deviation divided by this factor).
+double XC::FiniteDifferenceGradGEvaluator::getPerturbationFactor(void) const
+  { return perturbationFactor; }
+
+//! @brief Store the current state of the domain (the one
+//! obtained for the mean point) and return the domain (null if
+//! the perturbed analyses must repeat the load history).
+XC::Domain *XC::FiniteDifferenceGradGEvaluator::takeMeanPointSnapshot(void)
+  {
+    Domain *retval= nullptr;
+    if(restartFromMeanPoint)
+      {
+        retval= FEProblem::theActiveDomain;
+        if(retval && retval->getSnapshots().exists(snapshotTag))
+          {
+	    std::cerr << "XC::FiniteDifferenceGradGEvaluator::" << __FUNCTION__
+	              << "; the snapshot with tag: " << snapshotTag
+	              << " already exists, the whole analysis will be repeated."
+	              << std::endl;
+            retval= nullptr;
+          }
+        else if(!retval || (retval->takeSnapshot(snapshotTag)!=0))
+          {
+	    std::cerr << "XC::FiniteDifferenceGradGEvaluator::" << __FUNCTION__
+	              << "; can't store the state at the mean point,"
+	              << " the whole analysis will be repeated." << std::endl;
+            retval= nullptr;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Run the analysis for the perturbed realization of the
+//! random variables.
+int XC::FiniteDifferenceGradGEvaluator::runPerturbedAnalysis(Domain *theDomain, const Vector &perturbed_x)
+  {
+    if(theDomain)
+      {
+        if(theDomain->restoreSnapshot(snapshotTag)!=0)
+          return -1;
+        return theGFunEvaluator->runGFunAnalysisFromCurrentState(perturbed_x);
+      }
+    else
+      return theGFunEvaluator->runGFunAnalysis(perturbed_x);
+  }
+
+//! @brief Restore the state at the mean point and free the
+//! memory used to store it.
+void XC::FiniteDifferenceGradGEvaluator::releaseMeanPointSnapshot(Domain *theDomain)
+  {
+    if(theDomain)
+      {
+        theDomain->restoreSnapshot(snapshotTag);
+        theDomain->getSnapshots().remove(snapshotTag);
+      }
+  }
+
 int
 XC::FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue, Vector passed_x)
 {
@@ -169,6 +291,23 @@ XC::FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue, Vector passed
 	double stdv;
 
 
+	// Keep the state at the mean point (if requested)
+	Domain *theDomain = takeMeanPointSnapshot();
+	if (theDomain) {
+		// Value at the mean point obtained with the restart analysis
+		result = runPerturbedAnalysis(theDomain, passed_x);
+		if (result >= 0)
+			result = theGFunEvaluator->evaluateG(passed_x);
+		if (result < 0) {
+			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
+				<< " could not evaluate limit-state function at the mean point. " << std::endl;
+			releaseMeanPointSnapshot(theDomain);
+			return -1;
+		}
+		gFunValue = theGFunEvaluator->getG();
+	}
+
+
 	// For each random variable: perturb and run analysis again
 	for ( i=0 ; i<numberOfRandomVariables ; i++ )
 	{
@@ -190,16 +329,18 @@ XC::FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue, Vector passed
 
 
 		// Evaluate limit-state function
-		result = theGFunEvaluator->runGFunAnalysis(perturbed_x);
+		result = runPerturbedAnalysis(theDomain, perturbed_x);
 		if (result < 0) {
 			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
 				<< " could not run analysis to evaluate limit-state function. " << std::endl;
+			releaseMeanPointSnapshot(theDomain);
 			return -1;
 		}
 		result = theGFunEvaluator->evaluateG(perturbed_x);
 		if (result < 0) {
 			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
 				<< " could not tokenize limit-state function. " << std::endl;
+			releaseMeanPointSnapshot(theDomain);
 			return -1;
 		}
 		gFunValueAStepAhead = theGFunEvaluator->getG();
@@ -208,6 +349,7 @@ XC::FiniteDifferenceGradGEvaluator::computeGradG(double gFunValue, Vector passed
 		// Compute the derivative by finite difference
 		(*grad_g)(i) = (gFunValueAStepAhead - gFunValue) / h;
 	}
+	releaseMeanPointSnapshot(theDomain);
 
 
 	if (doGradientCheck) {
@@ -258,6 +400,25 @@ XC::FiniteDifferenceGradGEvaluator::computeAllGradG(Vector gFunValues, Vector pa
 	int result;
 
 
+	// Keep the state at the mean point (if requested)
+	Domain *theDomain = takeMeanPointSnapshot();
+	if (theDomain) {
+		// Values at the mean point obtained with the restart analysis
+		result = runPerturbedAnalysis(theDomain, passed_x);
+		for (int j=1; (j<=lsf) && (result>=0); j++) {
+			theReliabilityDomain->setTagOfActiveLimitStateFunction(j);
+			result = theGFunEvaluator->evaluateG(passed_x);
+			gFunValues(j-1) = theGFunEvaluator->getG();
+		}
+		if (result < 0) {
+			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
+				<< " could not evaluate limit-state functions at the mean point. " << std::endl;
+			releaseMeanPointSnapshot(theDomain);
+			return -1;
+		}
+	}
+
+
 	// For each random variable: perturb and run analysis again
 
 	for (int i=1; i<=nrv; i++) {
@@ -280,10 +441,11 @@ XC::FiniteDifferenceGradGEvaluator::computeAllGradG(Vector gFunValues, Vector pa
 
 
 		// Evaluate limit-state function
-		result = theGFunEvaluator->runGFunAnalysis(perturbed_x);
+		result = runPerturbedAnalysis(theDomain, perturbed_x);
 		if (result < 0) {
 			std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
 				<< " could not run analysis to evaluate limit-state function. " << std::endl;
+			releaseMeanPointSnapshot(theDomain);
 			return -1;
 		}
 
@@ -299,6 +461,7 @@ XC::FiniteDifferenceGradGEvaluator::computeAllGradG(Vector gFunValues, Vector pa
 			if (result < 0) {
 				std::cerr << "XC::FiniteDifferenceGradGEvaluator::evaluate_grad_g() - " << std::endl
 					<< " could not tokenize limit-state function. " << std::endl;
+				releaseMeanPointSnapshot(theDomain);
 				return -1;
 			}
 			gFunValueAStepAhead = theGFunEvaluator->getG();
@@ -308,6 +471,7 @@ XC::FiniteDifferenceGradGEvaluator::computeAllGradG(Vector gFunValues, Vector pa
 
 		}
 	}
+	releaseMeanPointSnapshot(theDomain);
 
 	return 0;
 }
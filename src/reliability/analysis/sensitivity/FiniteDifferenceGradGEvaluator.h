@@ -72,6 +72,7 @@ using std::ofstream;
 
 namespace XC {
   class GFunEvaluator;
+  class Domain;
 class FiniteDifferenceGradGEvaluator : public GradGEvaluator
 {
 private:
@@ -85,6 +86,14 @@ private:
 	double perturbationFactor;
 	bool doGradientCheck;
 	bool reComputeG;
+	bool restartFromMeanPoint; //!< if true the perturbed analyses start from the state at the mean point.
+	int snapshotTag; //!< tag of the domain snapshot with the state at the mean point.
+
+	static const int defaultSnapshotTag; //!< tag reserved for the snapshot of the mean point.
+
+	Domain *takeMeanPointSnapshot(void);
+	int runPerturbedAnalysis(Domain *, const Vector &perturbed_x);
+	void releaseMeanPointSnapshot(Domain *);
 public:
 	FiniteDifferenceGradGEvaluator(GFunEvaluator *passedGFunEvaluator,
 				ReliabilityDomain *passedReliabilityDomain,
@@ -92,6 +101,10 @@ public:
 				double perturbationFactor,
 				bool doGradientCheck,
 				bool reComputeG);
+	FiniteDifferenceGradGEvaluator(GFunEvaluator &,
+				ReliabilityDomain &,
+				const double &perturbationFactor,
+				const bool &reComputeG);
 	~FiniteDifferenceGradGEvaluator();
 
 	int		computeGradG(double gFunValue, Vector passed_x);
@@ -101,6 +114,12 @@ public:
 	Matrix	getAllGradG();
 
 	Matrix  getDgDdispl();
+
+	void setRestartFromMeanPoint(const bool &);
+	bool getRestartFromMeanPoint(void) const;
+	void setSnapshotTag(const int &);
+	int getSnapshotTag(void) const;
+	double getPerturbationFactor(void) const;
 };
 } // end of XC namespace
 
@@ -0,0 +1,40 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::GradGEvaluator, boost::noncopyable >("GradGEvaluator", "Base class for the evaluators of the gradient of the limit-state functions.", no_init)
+  .def("computeGradG", &XC::GradGEvaluator::computeGradG, "computeGradG(g,x): compute the gradient of the active limit-state function at x (g: value of the function at x).")
+  .def("computeAllGradG", &XC::GradGEvaluator::computeAllGradG, "computeAllGradG(gValues,x): compute the gradients of all the limit-state functions at x (gValues: values of the functions at x).")
+  .def("getGradG", &XC::GradGEvaluator::getGradG, "Return the last computed gradient.")
+  .def("getAllGradG", &XC::GradGEvaluator::getAllGradG, "Return the last computed gradients (a column for each limit-state function).")
+  ;
+
+class_<XC::FiniteDifferenceGradGEvaluator, bases<XC::GradGEvaluator>, boost::noncopyable >("FiniteDifferenceGradGEvaluator", "Forward finite difference gradient of the limit-state functions.", init<XC::GFunEvaluator &, XC::ReliabilityDomain &, double, bool>()[with_custodian_and_ward<1,2, with_custodian_and_ward<1,3> >()])
+  .add_property("perturbationFactor", &XC::FiniteDifferenceGradGEvaluator::getPerturbationFactor, "Return the perturbation factor (the perturbation of each random variable is its standard deviation divided by this factor).")
+  .add_property("restartFromMeanPoint", &XC::FiniteDifferenceGradGEvaluator::getRestartFromMeanPoint, &XC::FiniteDifferenceGradGEvaluator::setRestartFromMeanPoint, "If true the perturbed analyses start from the state of the domain at the mean point.")
+  .add_property("snapshotTag", &XC::FiniteDifferenceGradGEvaluator::getSnapshotTag, &XC::FiniteDifferenceGradGEvaluator::setSnapshotTag, "Tag of the domain snapshot used to keep the state at the mean point.")
+  ;
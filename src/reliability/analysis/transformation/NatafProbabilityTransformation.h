@@ -64,6 +64,7 @@
 #include <utility/matrix/Matrix.h>
 #include <reliability/domain/components/ReliabilityDomain.h>
 #include <reliability/analysis/misc/MatrixOperations.h>
+#include <reliability/analysis/transformation/ProbabilityTransformation.h>
 
 namespace XC {
 class NatafProbabilityTransformation : public ProbabilityTransformation
@@ -0,0 +1,40 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+
+class_<XC::ProbabilityTransformation, boost::noncopyable >("ProbabilityTransformation", "Base class for the transformations between the original and the standard normal spaces.", no_init)
+  .def("set_x", &XC::ProbabilityTransformation::set_x, "set_x(x): set the point in the original space.")
+  .def("set_u", &XC::ProbabilityTransformation::set_u, "set_u(u): set the point in the standard normal space.")
+  .def("transform_x_to_u", &XC::ProbabilityTransformation::transform_x_to_u, "Transform x into the standard normal space.")
+  .def("transform_u_to_x", &XC::ProbabilityTransformation::transform_u_to_x, "Transform u into the original space.")
+  .def("get_x", &XC::ProbabilityTransformation::get_x, "Return the point in the original space.")
+  .def("get_u", &XC::ProbabilityTransformation::get_u, "Return the point in the standard normal space.")
+  ;
+
+class_<XC::NatafProbabilityTransformation, bases<XC::ProbabilityTransformation>, boost::noncopyable >("NatafProbabilityTransformation", "Nataf transformation.", init<XC::ReliabilityDomain *, int>()[with_custodian_and_ward<1,2>()])
+  ;
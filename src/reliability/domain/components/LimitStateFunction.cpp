@@ -67,7 +67,13 @@ XC::LimitStateFunction::LimitStateFunction(int passedTag,const std::string &pass
   {
     originalExpression= passedExpression;
     expressionWithAddition= passedExpression;
-    tokenizedExpression= passedExpression;
+    tokenizeIt(expressionWithAddition);
+  }
+
+void XC::LimitStateFunction::Print(std::ostream &s, int flag)
+  {
+    s << "LimitStateFunction tag: " << this->getTag()
+      << " expression: " << expressionWithAddition << std::endl;
   }
 
 
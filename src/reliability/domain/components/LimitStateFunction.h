@@ -110,6 +110,7 @@ class LimitStateFunction : public ReliabilityDomainComponent
     const std::string &getTokenizedExpression(void) const;
     int addExpression(const std::string &expression);
     int removeAddedExpression(void);
+    void Print(std::ostream &s, int flag =0);
   };
 } // end of XC namespace
 
@@ -68,6 +68,9 @@
 #include <reliability/domain/modulatingFunction/ModulatingFunction.h>
 #include <reliability/domain/filter/Filter.h>
 #include <reliability/domain/spectrum/Spectrum.h>
+#include <reliability/domain/distributions/NormalRV.h>
+#include <reliability/domain/distributions/LognormalRV.h>
+#include <reliability/domain/distributions/UniformRV.h>
 
 
 XC::ReliabilityDomain::ReliabilityDomain()
@@ -144,6 +147,55 @@ bool XC::ReliabilityDomain::addFilter(Filter *theFilter)
     return result;
   }
 
+//! @brief Creates a random variable and adds it to the domain.
+//!
+//! @param type: distribution type ("normal", "lognormal" or "uniform").
+//! @param tag: identifier of the random variable.
+//! @param mean: mean value.
+//! @param stdv: standard deviation.
+XC::RandomVariable *XC::ReliabilityDomain::newRandomVariable(const std::string &type, const int &tag, const double &mean, const double &stdv)
+  {
+    RandomVariable *retval= nullptr;
+    if(type=="normal")
+      retval= new NormalRV(tag,mean,stdv);
+    else if(type=="lognormal")
+      retval= new LognormalRV(tag,mean,stdv);
+    else if(type=="uniform")
+      retval= new UniformRV(tag,mean,stdv);
+    else
+      std::cerr << "XC::ReliabilityDomain::" << __FUNCTION__
+                << "; distribution type: '" << type
+                << "' unknown." << std::endl;
+    if(retval && !addRandomVariable(retval))
+      {
+        std::cerr << "XC::ReliabilityDomain::" << __FUNCTION__
+                  << "; can't add the random variable with tag: "
+                  << tag << std::endl;
+        delete retval;
+        retval= nullptr;
+      }
+    return retval;
+  }
+
+//! @brief Creates a limit-state function and adds it to the domain.
+//!
+//! @param tag: identifier of the limit-state function.
+//! @param expression: expression of the function (variable names
+//! between braces, i.e. "{deltaMax}-{uy}").
+XC::LimitStateFunction *XC::ReliabilityDomain::newLimitStateFunction(const int &tag, const std::string &expression)
+  {
+    LimitStateFunction *retval= new LimitStateFunction(tag,expression);
+    if(!addLimitStateFunction(retval))
+      {
+        std::cerr << "XC::ReliabilityDomain::" << __FUNCTION__
+                  << "; can't add the limit-state function with tag: "
+                  << tag << std::endl;
+        delete retval;
+        retval= nullptr;
+      }
+    return retval;
+  }
+
 
 
 
@@ -88,6 +88,10 @@ class ReliabilityDomain
 	virtual bool addFilter(Filter *theFilter);
 	virtual bool addSpectrum(Spectrum *theSpectrum);
 
+	// Member functions to create components
+	RandomVariable *newRandomVariable(const std::string &, const int &, const double &, const double &);
+	LimitStateFunction *newLimitStateFunction(const int &, const std::string &);
+
 	// Member functions to get components from the domain
 	RandomVariable *getRandomVariablePtr(int tag);
 	CorrelationCoefficient *getCorrelationCoefficientPtr(int tag);
@@ -0,0 +1,56 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::ReliabilityDomainComponent, bases<XC::TaggedObject>, boost::noncopyable >("ReliabilityDomainComponent", no_init)
+  ;
+
+class_<XC::RandomVariable, bases<XC::ReliabilityDomainComponent>, boost::noncopyable >("RandomVariable", "Base class for random variables.", no_init)
+  .def("getType", &XC::RandomVariable::getType, "Return the distribution type.")
+  .def("getMean", &XC::RandomVariable::getMean, "Return the mean value.")
+  .def("getStdv", &XC::RandomVariable::getStdv, "Return the standard deviation.")
+  .def("getStartValue", &XC::RandomVariable::getStartValue, "Return the start value.")
+  ;
+
+class_<XC::LimitStateFunction, bases<XC::ReliabilityDomainComponent>, boost::noncopyable >("LimitStateFunction", no_init)
+  .def("getExpression", &XC::LimitStateFunction::getExpression, return_value_policy<copy_const_reference>(), "Return the expression of the function.")
+  .def("getTokenizedExpression", &XC::LimitStateFunction::getTokenizedExpression, return_value_policy<copy_const_reference>(), "Return the expression of the function as evaluated by the interpreter.")
+  .def_readonly("simulationReliabilityIndexBeta", &XC::LimitStateFunction::SimulationReliabilityIndexBeta, "Reliability index obtained by the last sampling analysis.")
+  .def_readonly("simulationProbabilityOfFailure", &XC::LimitStateFunction::SimulationProbabilityOfFailure_pfsim, "Probability of failure obtained by the last sampling analysis.")
+  .def_readonly("simulationCoefficientOfVariation", &XC::LimitStateFunction::CoefficientOfVariationOfPfFromSimulation, "Coefficient of variation of the probability of failure obtained by the last sampling analysis.")
+  .def_readonly("numberOfSimulations", &XC::LimitStateFunction::NumberOfSimulations, "Number of simulations of the last sampling analysis.")
+  ;
+
+class_<XC::ReliabilityDomain, boost::noncopyable >("ReliabilityDomain", "Container for the random variables and the limit-state functions.")
+  .def("newRandomVariable", &XC::ReliabilityDomain::newRandomVariable, return_internal_reference<>(), "newRandomVariable(type,tag,mean,stdv): create a random variable (type: 'normal', 'lognormal' or 'uniform').")
+  .def("newLimitStateFunction", &XC::ReliabilityDomain::newLimitStateFunction, return_internal_reference<>(), "newLimitStateFunction(tag,expression): create a limit-state function (variable names between braces, i.e. '{deltaMax}-{uy}').")
+  .def("getRandomVariable", &XC::ReliabilityDomain::getRandomVariablePtr, return_internal_reference<>(), "Return the random variable with the tag being passed as parameter.")
+  .def("getLimitStateFunction", &XC::ReliabilityDomain::getLimitStateFunctionPtr, return_internal_reference<>(), "Return the limit-state function with the tag being passed as parameter.")
+  .add_property("numberOfRandomVariables", &XC::ReliabilityDomain::getNumberOfRandomVariables, "Return the number of random variables.")
+  .add_property("numberOfLimitStateFunctions", &XC::ReliabilityDomain::getNumberOfLimitStateFunctions, "Return the number of limit-state functions.")
+  .add_property("tagOfActiveLimitStateFunction", &XC::ReliabilityDomain::getTagOfActiveLimitStateFunction, &XC::ReliabilityDomain::setTagOfActiveLimitStateFunction, "Tag of the active limit-state function.")
+  ;
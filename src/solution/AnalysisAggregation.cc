@@ -55,6 +55,7 @@
 
 #include <utility/actor/objectBroker/FEM_ObjectBroker.h>
 #include "utility/matrix/ID.h"
+#include "utility/ThreadPool.h"
 
 #include "boost/any.hpp"
 
@@ -79,6 +80,8 @@ bool XC::AnalysisAggregation::alloc_soln_algo(const std::string &nmb)
       theSolnAlgo=new KrylovNewton(this);
     else if(nmb=="linear_soln_algo")
       theSolnAlgo=new Linear(this);
+    else if(nmb=="linear_superposition_soln_algo")
+      theSolnAlgo=new LinearSuperposition(this);
     else if(nmb=="modified_newton_soln_algo")
       theSolnAlgo=new ModifiedNewton(this);
     else if(nmb=="newton_raphson_soln_algo")
@@ -93,6 +96,8 @@ bool XC::AnalysisAggregation::alloc_soln_algo(const std::string &nmb)
       theSolnAlgo=new StandardEigenAlgo(this);
     else if(nmb=="linear_buckling_soln_algo")
       theSolnAlgo=new LinearBucklingAlgo(this);
+    else if(nmb=="domain_decomp_algo")
+      theSolnAlgo=new DomainDecompAlgo(this);
     else
       std::cerr << getClassName() << "::" << __FUNCTION__
 	        << "; solution algorithm: '"
@@ -303,6 +308,8 @@ bool XC::AnalysisAggregation::alloc_system_of_equations(const std::string &nmb,A
       theSOE=new BandArpackppSOE(this);
     else if(nmb=="sym_arpack_soe")
       theSOE=new SymArpackSOE(this);
+    else if(nmb=="sparse_arpack_soe")
+      theSOE=new SparseArpackSOE(this);
     else if(nmb=="sym_band_eigen_soe")
       theSOE=new SymBandEigenSOE(this);
     else if(nmb=="full_gen_eigen_soe")
@@ -337,6 +344,8 @@ bool XC::AnalysisAggregation::alloc_system_of_equations(const std::string &nmb,A
       theSOE=new DistributedSparseGenRowLinSOE(this);
     else if(nmb=="sym_sparse_lin_soe")
       theSOE =new SymSparseLinSOE(this);
+    else if(nmb=="multifrontal_spd_lin_soe")
+      theSOE =new MultifrontalSPDLinSOE(this);
 //     else if(nmb=="umfpack_gen_lin_soe")
 //       theSOE =new UmfpackGenLinSOE();
     else
@@ -441,16 +450,28 @@ XC::ConvergenceTest &XC::AnalysisAggregation::newConvergenceTest(const std::stri
     return *theTest;
   }
 
+//! @brief Destroys the thread pool.
+void XC::AnalysisAggregation::free_thread_pool(void)
+  {
+    if(threadPool)
+      {
+        delete threadPool;
+        threadPool= nullptr;
+      }
+  }
+
 void XC::AnalysisAggregation::free_mem(void)
   {
     free_soln_algo();
     free_integrator();
     free_system_of_equations();
     free_conv_test();
+    free_thread_pool();
   }
 
 void XC::AnalysisAggregation::copy(const AnalysisAggregation &other)
   {
+    setNumThreads(other.numThreads);
     if(other.theSolnAlgo) copy_soln_algo(other.theSolnAlgo);
     if(other.theIntegrator) copy_integrator(other.theIntegrator);
     if(other.theSOE) copy_system_of_equations(other.theSOE);
@@ -460,7 +481,7 @@ void XC::AnalysisAggregation::copy(const AnalysisAggregation &other)
 //! @brief Default constructor.
 XC::AnalysisAggregation::AnalysisAggregation(Analysis *owr,ModelWrapper *b)
   : CommandEntity(owr), base(b), theSolnAlgo(nullptr),theIntegrator(nullptr),
-    theSOE(nullptr), theTest(nullptr)
+    theSOE(nullptr), theTest(nullptr), numThreads(1), threadPool(nullptr)
   {
     if(base)
       base->set_owner(this);
@@ -470,7 +491,7 @@ XC::AnalysisAggregation::AnalysisAggregation(Analysis *owr,ModelWrapper *b)
 //! @brief Copy constructor.
 XC::AnalysisAggregation::AnalysisAggregation(const AnalysisAggregation &other)
   : CommandEntity(other), base(other.base), theSolnAlgo(nullptr),theIntegrator(nullptr),
-    theSOE(nullptr), theTest(nullptr)
+    theSOE(nullptr), theTest(nullptr), numThreads(1), threadPool(nullptr)
   {
     if(base)
       base->set_owner(this);
@@ -497,6 +518,30 @@ XC::AnalysisAggregation::~AnalysisAggregation(void)
 void XC::AnalysisAggregation::clearAll(void)
   { free_mem(); }
 
+//! @brief Set the number of threads used to compute the element
+//! state, tangents and residuals (zero means as many as the
+//! hardware supports).
+void XC::AnalysisAggregation::setNumThreads(const size_t &n)
+  {
+    const size_t tmp= (n>0 ? n : ThreadPool::getHardwareConcurrency());
+    if(tmp!=numThreads)
+      {
+        free_thread_pool();
+        numThreads= tmp;
+      }
+  }
+
+//! @brief Return a pointer to the thread pool (or a null pointer
+//! if the computations must be performed serially).
+XC::ThreadPool *XC::AnalysisAggregation::getThreadPool(void)
+  {
+    if(numThreads<2)
+      return nullptr;
+    if(!threadPool)
+      threadPool= new ThreadPool(numThreads);
+    return threadPool;
+  }
+
 XC::Analysis *XC::AnalysisAggregation::getAnalysis(void)
   { return dynamic_cast<Analysis *>(Owner()); }
 
@@ -63,6 +63,7 @@ class Analysis;
 
 class FEM_ObjectBroker;
 class ID;
+class ThreadPool;
 
 //!  @ingroup Solu
 //! 
@@ -93,6 +94,8 @@ class AnalysisAggregation: public CommandEntity
     Integrator *theIntegrator; //!< Integration scheme.
     SystemOfEqn *theSOE; //!< System of equations.
     ConvergenceTest *theTest; //!< Convergence test.
+    size_t numThreads; //!< Number of threads used in the element state determination.
+    ThreadPool *threadPool; //!< Pool of threads (created on demand).
 
     Analysis *getAnalysis(void);
     const Analysis *getAnalysis(void) const;    
@@ -114,6 +117,8 @@ class AnalysisAggregation: public CommandEntity
     bool alloc_conv_test(const std::string &);
     void copy_conv_test(ConvergenceTest *);
 
+    void free_thread_pool(void);
+
     void free_mem(void);
     void copy(const AnalysisAggregation &);
 
@@ -163,6 +168,13 @@ class AnalysisAggregation: public CommandEntity
     const ConvergenceTest *getConvergenceTestPtr(void) const;
     ConvergenceTest &newConvergenceTest(const std::string &);
 
+    //! @brief Return the number of threads used in the element
+    //! state determination.
+    inline size_t getNumThreads(void) const
+      { return numThreads; }
+    void setNumThreads(const size_t &);
+    ThreadPool *getThreadPool(void);
+
     virtual const DomainSolver *getDomainSolverPtr(void) const;
     virtual DomainSolver *getDomainSolverPtr(void);
     virtual const Subdomain *getSubdomainPtr(void) const;
@@ -29,10 +29,15 @@
 #include "UnbalAndTangent.h"
 
 
+//! @brief Return true if the vector and the matrix are owned
+//! by this object (not shared with other objects).
+bool XC::UnbalAndTangent::ownsStorage(void) const
+  { return (privateStorage || (nDOF>=unbalAndTangentArray.size())); }
+
 bool XC::UnbalAndTangent::free_mem(void)
   {
     // delete tangent and residual if created specially
-    if(nDOF>=unbalAndTangentArray.size())
+    if(ownsStorage())
       {
         if(theTangent) delete theTangent;
         theTangent= nullptr;
@@ -91,15 +96,16 @@ void XC::UnbalAndTangent::copy(const UnbalAndTangent &other)
 
 //! @brief Constructor.
 XC::UnbalAndTangent::UnbalAndTangent(const size_t &n,UnbalAndTangentStorage &a)
-  :nDOF(n), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(a) 
+  :nDOF(n), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(a), privateStorage(false)
   { alloc(); }
 
 //! @brief Copy constructor.
 XC::UnbalAndTangent::UnbalAndTangent(const UnbalAndTangent &other)
-  :nDOF(0), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(other.unbalAndTangentArray) 
+  :nDOF(0), theResidual(nullptr), theTangent(nullptr), unbalAndTangentArray(other.unbalAndTangentArray), privateStorage(false)
   {
     free_mem();
     nDOF= other.nDOF;
+    privateStorage= other.privateStorage;
     copy(other);
   }
 
@@ -107,12 +113,30 @@ XC::UnbalAndTangent::UnbalAndTangent(const UnbalAndTangent &other)
 XC::UnbalAndTangent &XC::UnbalAndTangent::operator=(const UnbalAndTangent &other)
   {
     free_mem();
+    theResidual= nullptr;
+    theTangent= nullptr;
     unbalAndTangentArray= other.unbalAndTangentArray;
     nDOF= other.nDOF;
+    privateStorage= other.privateStorage;
     copy(other);
     return *this;
   }
 
+//! @brief Make the object own its vector and matrix instead of
+//! sharing the class wide ones, so they can be computed concurrently
+//! with those of other objects.
+void XC::UnbalAndTangent::setPrivateStorage(void)
+  {
+    if(!ownsStorage())
+      {
+        privateStorage= true;
+        theResidual= new Vector(nDOF);
+        theTangent= new Matrix(nDOF, nDOF);
+      }
+    else
+      privateStorage= true;
+  }
+
 //! @brief destructor.
 XC::UnbalAndTangent::~UnbalAndTangent(void)
   { free_mem(); }
@@ -44,6 +44,8 @@ class UnbalAndTangent
     Vector *theResidual;
     Matrix *theTangent;
     UnbalAndTangentStorage &unbalAndTangentArray; //!< Reference to array of class wide vectors and matrices
+    bool privateStorage; //!< if true the object owns its vector and matrix.
+    bool ownsStorage(void) const;
     bool free_mem(void);
     void alloc(void);
     void copy(const UnbalAndTangent &);
@@ -56,6 +58,9 @@ class UnbalAndTangent
 
     inline const size_t &getNumDOF(void) const
       { return nDOF; }
+    inline bool hasPrivateStorage(void) const
+      { return privateStorage; }
+    void setPrivateStorage(void);
 
     const Matrix &getTangent(void) const;
     Matrix &getTangent(void);
@@ -65,6 +65,7 @@
 
 #include <solution/analysis/algorithm/equiSolnAlgo/Linear.h>
 #include <solution/analysis/model/AnalysisModel.h>
+#include <domain/domain/Domain.h>
 #include <solution/analysis/analysis/StaticAnalysis.h>
 #include <solution/analysis/integrator/StaticIntegrator.h>
 #include <solution/system_of_eqn/linearSOE/LinearSOE.h>
@@ -73,11 +74,79 @@
 
 //! @brief Constructor
 XC::Linear::Linear(AnalysisAggregation *owr)
-  :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_Linear) {}
+  :EquiSolnAlgo(owr,EquiALGORITHM_TAGS_Linear), reuseTangent(false), tangentFormed(false), stiffnessStamp(0) {}
+
+//! @brief Constructor (for the derived classes).
+XC::Linear::Linear(AnalysisAggregation *owr,int classTag)
+  :EquiSolnAlgo(owr,classTag), reuseTangent(false), tangentFormed(false), stiffnessStamp(0) {}
 
 XC::SolutionAlgorithm *XC::Linear::getCopy(void) const
   { return new Linear(*this); }
 
+//! @brief Activates or deactivates the reuse of the factored tangent
+//! between steps in linear models.
+void XC::Linear::setReuseTangent(const bool &b)
+  {
+    reuseTangent= b;
+    if(!reuseTangent)
+      tangentFormed= false;
+  }
+
+//! @brief Returns true if the factored tangent is reused between
+//! steps in linear models.
+bool XC::Linear::getReuseTangent(void) const
+  { return reuseTangent; }
+
+//! @brief Returns true if the system of equations contains a factored
+//! tangent that will be used in the next step.
+bool XC::Linear::isTangentFormed(void) const
+  { return tangentFormed; }
+
+//! @brief Forces the tangent to be formed and factored again in the
+//! next step. It must be called when something that the algorithm can't
+//! detect changes the stiffness of the model (material properties,
+//! cross section properties,...).
+void XC::Linear::invalidateTangent(void)
+  { tangentFormed= false; }
+
+//! @brief Sets the value of the tangentFormed flag; if true it stores
+//! the stiffness stamp of the domain (see check_tangent_formed).
+void XC::Linear::set_tangent_formed(const bool &b)
+  {
+    tangentFormed= b;
+    const Domain *dom= get_domain_ptr();
+    if(tangentFormed && dom)
+      stiffnessStamp= dom->getStiffnessStamp();
+  }
+
+//! @brief Discards the factored tangent if the stiffness of the
+//! domain has changed since it was formed (killed or reactivated
+//! elements,...). Returns the value of the tangentFormed flag.
+bool XC::Linear::check_tangent_formed(void)
+  {
+    const Domain *dom= get_domain_ptr();
+    if(tangentFormed && dom)
+      if(dom->getStiffnessStamp()!=stiffnessStamp)
+        invalidateTangent();
+    return tangentFormed;
+  }
+
+//! @brief Returns true if the tangent can be kept for the next
+//! steps: static analysis of a model whose elements have constant
+//! tangent.
+bool XC::Linear::tangent_reusable(void)
+  {
+    bool retval= false;
+    const AnalysisModel *theAnalysisModel= getAnalysisModelPtr();
+    if(theAnalysisModel)
+      {
+        IncrementalIntegrator *theIncIntegrator= getIncrementalIntegratorPtr();
+        if(dynamic_cast<StaticIntegrator *>(theIncIntegrator))
+          retval= theAnalysisModel->isTangentConstant();
+      }
+    return retval;
+  }
+
 //! @brief Performs the linear solution algorithm.
 int XC::Linear::resuelve(void)
   {
@@ -93,12 +162,16 @@ int XC::Linear::resuelve(void)
         return -5;
       }
 
-    if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
+    if(!check_tangent_formed()) //Otherwise the SOE has the factored tangent.
       {
-        std::cerr << getClassName() << "::" << __FUNCTION__
-                  << "; WARNING the XC::Integrator"
-                  << " failed in formTangent().\n";
-        return -1;
+        if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING the XC::Integrator"
+                      << " failed in formTangent().\n";
+            return -1;
+          }
+        set_tangent_formed(reuseTangent && tangent_reusable());
       }
 
     if(theIncIntegrator->formUnbalance()<0) //Builds load vector.
@@ -114,6 +187,7 @@ int XC::Linear::resuelve(void)
         std::cerr << getClassName() << "::" << __FUNCTION__
                   << "; WARNING the " << theSOE->getClassName()
                   << " failed in solve()\n";        
+        tangentFormed= false;
         return -3;
       }
 
@@ -157,6 +231,13 @@ int XC::Linear::solveCurrentStep(void)
 int XC::Linear::setConvergenceTest(ConvergenceTest *theNewTest)
   { return 0; }
 
+//! @brief Discards the factored tangent (the model has changed).
+int XC::Linear::domainChanged(void)
+  {
+    invalidateTangent();
+    return EquiSolnAlgo::domainChanged();
+  }
+
 //! Does  nothing. Returns 0.
 int XC::Linear::sendSelf(CommParameters &cp)
   { return 0; }
@@ -93,18 +93,41 @@ namespace XC {
 //! \f$U = U_{a} + \Delta U\f$.
 //! To start the iteration \f$U_a = U_{trial}\f$, i.e. the current trial
 //! response quantities are chosen as approximate solution quantities.
+//!
+//! If the "reuse tangent" option is activated and all the elements
+//! of the model have constant tangent (see Element::isTangentConstant)
+//! the stiffness matrix is formed and factored only once and reused
+//! in the following steps (load cases, combinations,...) until the
+//! domain changes, some element is killed or reactivated (see
+//! Domain::getStiffnessStamp) or invalidateTangent() is called (i.e.
+//! after modifying the properties of some material).
 class Linear: public EquiSolnAlgo
   {
     int resuelve();
   protected:
+    bool reuseTangent; //!< If true, keep the factored tangent between steps in linear models.
+    bool tangentFormed; //!< True if the SOE contains the factored tangent of a linear model.
+    int stiffnessStamp; //!< Stiffness stamp of the domain (see Domain::getStiffnessStamp) when the tangent was formed.
+
+    bool tangent_reusable(void);
+    void set_tangent_formed(const bool &);
+    bool check_tangent_formed(void);
+
     friend class AnalysisAggregation;
     friend class FEM_ObjectBroker;
     Linear(AnalysisAggregation *);
+    Linear(AnalysisAggregation *,int classTag);
     virtual SolutionAlgorithm *getCopy(void) const;
   public:
 
     int solveCurrentStep(void);
     int setConvergenceTest(ConvergenceTest *theNewTest);
+    int domainChanged(void);
+
+    void setReuseTangent(const bool &);
+    bool getReuseTangent(void) const;
+    bool isTangentFormed(void) const;
+    void invalidateTangent(void);
     
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
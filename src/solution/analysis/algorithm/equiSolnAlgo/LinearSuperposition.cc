@@ -0,0 +1,246 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LinearSuperposition.cc
+
+#include <solution/analysis/algorithm/equiSolnAlgo/LinearSuperposition.h>
+#include <solution/analysis/model/AnalysisModel.h>
+#include <solution/analysis/integrator/StaticIntegrator.h>
+#include <solution/system_of_eqn/linearSOE/LinearSOE.h>
+#include <domain/domain/Domain.h>
+#include <domain/mesh/Mesh.h>
+#include <domain/constraints/ConstrContainer.h>
+#include <domain/load/pattern/LoadPattern.h>
+#include <utility/matrix/Matrix.h>
+#include <vector>
+
+//! @brief Constructor
+XC::LinearSuperposition::LinearSuperposition(AnalysisAggregation *owr)
+  :Linear(owr,EquiALGORITHM_TAGS_LinearSuperposition), time(0.0) {}
+
+//! @brief Virtual constructor.
+XC::SolutionAlgorithm *XC::LinearSuperposition::getCopy(void) const
+  { return new LinearSuperposition(*this); }
+
+//! @brief Discards the stored load pattern responses.
+void XC::LinearSuperposition::clearResponses(void)
+  {
+    responses.clear();
+    invalidateTangent();
+  }
+
+//! @brief Returns the number of stored load pattern responses.
+size_t XC::LinearSuperposition::getNumResponses(void) const
+  { return responses.size(); }
+
+//! @brief Return true if the current step can be computed by superposition.
+bool XC::LinearSuperposition::superposition_available(void)
+  {
+    bool retval= (getAnalysisModelPtr() && getLinearSOEPtr() && get_domain_ptr());
+    if(retval)
+      retval= (dynamic_cast<StaticIntegrator *>(getIncrementalIntegratorPtr())!=nullptr);
+    if(retval)
+      {
+        const std::map<int,LoadPattern *> &lps= get_domain_ptr()->getConstraints().getLoadPatterns();
+        for(std::map<int,LoadPattern *>::const_iterator i= lps.begin();i!=lps.end();i++)
+          if(i->second->getNumSPs()>0) //Imposed displacements.
+            {
+              retval= false;
+              break;
+            }
+      }
+    return retval;
+  }
+
+//! @brief Computes the responses of the load patterns that are not
+//! already stored.
+//!
+//! The right hand side of each pattern is obtained applying only the loads
+//! of the pattern (with unit weighting factor) and substracting the
+//! unbalance without loads \p r0. All the right hand sides are solved
+//! together.
+int XC::LinearSuperposition::solve_load_patterns(const std::map<int,LoadPattern *> &lps,const Vector &r0)
+  {
+    std::vector<LoadPattern *> pending;
+    for(std::map<int,LoadPattern *>::const_iterator i= lps.begin();i!=lps.end();i++)
+      {
+        map_responses::const_iterator j= responses.find(i->first);
+        if((j==responses.end()) || (j->second.first!=i->second->getCurrentGeoTag()))
+          pending.push_back(i->second);
+      }
+    if(pending.empty())
+      return 0;
+
+    LinearSOE *theSOE= getLinearSOEPtr();
+    IncrementalIntegrator *theIncIntegrator= getIncrementalIntegratorPtr();
+    Mesh &mesh= get_domain_ptr()->getMesh();
+    const int neq= theSOE->getNumEqn();
+    const int nrhs= pending.size();
+    Matrix B(neq,nrhs);
+    for(int k= 0;k<nrhs;k++)
+      {
+        LoadPattern *lp= pending[k];
+        mesh.zeroLoads();
+        const double gamma_f= lp->GammaF();
+        lp->setGammaF(1.0);
+        lp->applyLoad(time);
+        lp->setGammaF(gamma_f);
+        if(theIncIntegrator->formUnbalance()<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING the integrator failed in formUnbalance()"
+                      << " for load pattern: " << lp->getTag() << std::endl;
+            return -2;
+          }
+        const Vector &b= theSOE->getB();
+        for(int i= 0;i<neq;i++)
+          B(i,k)= b(i)-r0(i);
+      }
+    Matrix X;
+    const int retval= theSOE->solve(B,X);
+    if(retval<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING the " << theSOE->getClassName()
+                  << " failed in solve()\n";        
+        return -3;
+      }
+    for(int k= 0;k<nrhs;k++)
+      {
+        Vector u(neq);
+        for(int i= 0;i<neq;i++)
+          u(i)= X(i,k);
+        responses[pending[k]->getTag()]= pattern_response(pending[k]->getCurrentGeoTag(),u);
+      }
+    return retval;
+  }
+
+//! @brief Performs the linear solution algorithm by superposition of the
+//! load pattern responses.
+//!
+//! This method:
+//! - forms the tangent stiffness matrix (only the first time).
+//! - forms the unbalance without loads \f$R_0\f$ (zero if the domain is at
+//! its initial state).
+//! - computes the responses of the active load patterns that are not
+//! already stored.
+//! - computes \f$\Delta U= \sum \gamma_i U_i + K^{-1} R_0\f$, where
+//! \f$\gamma_i\f$ is the weighting factor of the i-th active load pattern.
+//! - restores the loads of the active patterns and updates the domain
+//! with \f$\Delta U\f$.
+//!
+//! Returns 0 if successful, otherwise a warning message is
+//! printed and a negative number is returned (see Linear::solveCurrentStep).
+int XC::LinearSuperposition::solveCurrentStep(void)
+  {
+    if(!superposition_available())
+      {
+        clearResponses();
+        return Linear::solveCurrentStep();
+      }
+    LinearSOE *theSOE= getLinearSOEPtr();
+    IncrementalIntegrator *theIncIntegrator= getIncrementalIntegratorPtr();
+    Domain *dom= get_domain_ptr();
+    const double t= dom->getTimeTracker().getCurrentTime();
+    if(t!=time) //Loads depend on time.
+      {
+        clearResponses();
+        time= t;
+      }
+
+    if(!check_tangent_formed()) //Stiffness changed (or first step).
+      {
+        responses.clear();
+        if(theIncIntegrator->formTangent()<0) //Builds tangent stiffness matrix.
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING the integrator"
+                      << " failed in formTangent().\n";
+            return -1;
+          }
+        set_tangent_formed(true);
+      }
+
+    int retval= 0;
+    dom->getMesh().zeroLoads();
+    if(theIncIntegrator->formUnbalance()<0) //Unbalance without loads.
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; WARNING the integrator"
+                  << " failed in formUnbalance().\n";
+        retval= -2;
+      }
+    Vector deltaU(theSOE->getNumEqn());
+    if(retval==0)
+      {
+        const Vector r0= theSOE->getB();
+        const std::map<int,LoadPattern *> &lps= dom->getConstraints().getLoadPatterns();
+        retval= solve_load_patterns(lps,r0);
+        if(retval==0)
+          {
+            for(std::map<int,LoadPattern *>::const_iterator i= lps.begin();i!=lps.end();i++)
+              deltaU.addVector(1.0,responses[i->first].second,i->second->GammaF());
+            if(r0.Norm()>0.0) //Not in the initial state.
+              {
+                theSOE->setB(r0);
+                if(theSOE->solve()<0)
+                  {
+                    std::cerr << getClassName() << "::" << __FUNCTION__
+                              << "; WARNING the " << theSOE->getClassName()
+                              << " failed in solve()\n";        
+                    retval= -3;
+                  }
+                else
+                  deltaU.addVector(1.0,theSOE->getX(),1.0);
+              }
+          }
+      }
+    dom->applyLoad(t); //Restore the loads of the active patterns.
+    if(retval==0)
+      {
+        if(theIncIntegrator->update(deltaU) < 0) //Updates displacements.
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "the integrator failed in update()\n";        
+            retval= -4;
+          }
+      }
+    return retval;
+  }
+
+//! @brief Discards the stored responses (the model has changed).
+int XC::LinearSuperposition::domainChanged(void)
+  {
+    clearResponses();
+    return Linear::domainChanged();
+  }
+
+//! Sends the class name to the stream.
+void XC::LinearSuperposition::Print(std::ostream &s, int)
+  {
+    s << "\t " << getClassName() << " algorithm; "
+      << responses.size() << " load pattern responses stored.";
+  }
@@ -0,0 +1,90 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//LinearSuperposition.h
+
+#ifndef LinearSuperposition_h
+#define LinearSuperposition_h
+
+#include <solution/analysis/algorithm/equiSolnAlgo/Linear.h>
+#include "utility/matrix/Vector.h"
+#include <map>
+
+namespace XC {
+class LoadPattern;
+
+//! @ingroup EQSolAlgo
+//
+//! @brief Linear solution algorithm that obtains the response to the
+//! active load patterns by superposition.
+//!
+//! The stiffness matrix is formed and factored once. The response to
+//! each elementary load pattern (with unit weighting factor) is computed
+//! the first time the pattern is found in the domain (all the new
+//! patterns are solved together as a block of right hand sides) and
+//! stored. The solution for the current step (i.e. for the current
+//! load combination) is obtained as the sum of the stored responses
+//! weighted by the factors of the combination, so the cost of each
+//! combination is a formUnbalance() and the update of the domain.
+//!
+//! Each response is stored with the counter of changes of the load
+//! pattern (see NodeLocker::getCurrentGeoTag) so it's computed again
+//! if loads are added to (or removed from) the pattern.
+//! The stored responses are discarded when the domain changes (new
+//! elements, constraints,...), its stiffness changes (killed or
+//! reactivated elements) or the pseudo-time of the step changes.
+//! If some of the active load patterns has single freedom constraints
+//! (imposed displacements) or the integrator is not a static one the
+//! algorithm falls back to the Linear one.
+//!
+//! Only valid for linear models: it assumes that the stiffness
+//! matrix doesn't depend on the loads or on the displacements.
+class LinearSuperposition: public Linear
+  {
+  private:
+    typedef std::pair<int,Vector> pattern_response; //!< (load pattern geoTag, displacement increment).
+    typedef std::map<int,pattern_response> map_responses;
+    map_responses responses; //!< Response to each load pattern (by load pattern tag).
+    double time; //!< Pseudo-time of the stored responses.
+
+    bool superposition_available(void);
+    int solve_load_patterns(const std::map<int,LoadPattern *> &,const Vector &);
+  protected:
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    LinearSuperposition(AnalysisAggregation *);
+    virtual SolutionAlgorithm *getCopy(void) const;
+  public:
+    int solveCurrentStep(void);
+    int domainChanged(void);
+    void clearResponses(void);
+    size_t getNumResponses(void) const;
+
+    void Print(std::ostream &s, int =0);    
+  };
+} // end of XC namespace
+
+#endif
@@ -33,7 +33,16 @@ class_<XC::Broyden, bases<XC::BFBRoydenBase>, boost::noncopyable >("Broyden", no
 
 class_<XC::KrylovNewton, bases<XC::EquiSolnAlgo>, boost::noncopyable >("KrylovNewton", no_init);
 
-class_<XC::Linear, bases<XC::EquiSolnAlgo>, boost::noncopyable >("Linear", no_init);
+class_<XC::Linear, bases<XC::EquiSolnAlgo>, boost::noncopyable >("Linear", no_init)
+  .add_property("reuseTangent", &XC::Linear::getReuseTangent, &XC::Linear::setReuseTangent,"If true and all the elements have constant tangent, the stiffness matrix is formed and factored only once (linear static analysis).")
+  .add_property("tangentFormed", &XC::Linear::isTangentFormed,"True if the factored stiffness matrix will be reused in the next step.")
+  .def("invalidateTangent", &XC::Linear::invalidateTangent,"Forces the stiffness matrix to be formed again in the next step (i.e. after changing material properties).")
+  ;
+
+class_<XC::LinearSuperposition, bases<XC::Linear>, boost::noncopyable >("LinearSuperposition", no_init)
+  .add_property("numResponses", &XC::LinearSuperposition::getNumResponses,"Number of load pattern responses stored.")
+  .def("clearResponses", &XC::LinearSuperposition::clearResponses,"Discards the stored load pattern responses.")
+  ;
 
 class_<XC::NewtonBased, bases<XC::EquiSolnAlgo>, boost::noncopyable >("NewtonBased", no_init);
 
@@ -32,6 +32,7 @@
 #include <solution/analysis/algorithm/equiSolnAlgo/Broyden.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/KrylovNewton.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/Linear.h>
+#include <solution/analysis/algorithm/equiSolnAlgo/LinearSuperposition.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/ModifiedNewton.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/NewtonLineSearch.h>
 #include <solution/analysis/algorithm/equiSolnAlgo/NewtonRaphson.h>
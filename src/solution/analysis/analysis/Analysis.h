@@ -132,8 +132,8 @@ class Analysis: public CommandEntity
 
     inline AnalysisAggregation *getAnalysisAggregationPtr(void)
       { return solution_method; }
-    Domain *getDomainPtr(void);
-    const Domain *getDomainPtr(void) const;
+    virtual Domain *getDomainPtr(void);
+    virtual const Domain *getDomainPtr(void) const;
     ConstraintHandler *getConstraintHandlerPtr(void);
     DOF_Numberer *getDOF_NumbererPtr(void) const;
     AnalysisModel *getAnalysisModelPtr(void) const;
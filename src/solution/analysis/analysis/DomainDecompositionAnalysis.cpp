@@ -186,6 +186,14 @@ const XC::Subdomain *XC::DomainDecompositionAnalysis::getSubdomain(void) const
 XC::Subdomain *XC::DomainDecompositionAnalysis::getSubdomain(void)
   { return theSubdomain; }
 
+//! @brief Returns a pointer to the subdomain (the domain of this analysis).
+XC::Domain *XC::DomainDecompositionAnalysis::getDomainPtr(void)
+  { return theSubdomain; }
+
+//! @brief Returns a pointer to the subdomain (the domain of this analysis).
+const XC::Domain *XC::DomainDecompositionAnalysis::getDomainPtr(void) const
+  { return theSubdomain; }
+
 bool XC::DomainDecompositionAnalysis::doesIndependentAnalysis(void)
   { return false; }
 
@@ -208,7 +216,7 @@ int XC::DomainDecompositionAnalysis::domainChanged(void)
     int idSize= theExtNodes.Size();
     //    int theLastDOF= -1;
 
-    ID theLastDOFs(1);
+    ID theLastDOFs(idSize);
     int cnt= 0;
 
     // create an XC::ID containing the tags of the DOF_Groups that are to
@@ -228,6 +236,7 @@ int XC::DomainDecompositionAnalysis::domainChanged(void)
 		}
 	}
     }
+    theLastDOFs.resize(cnt);
 
     // we now invoke number() on the numberer which causes
     // equation numbers to be assigned to all the DOFs in the
@@ -254,6 +263,21 @@ int XC::DomainDecompositionAnalysis::domainChanged(void)
     return 0;
   }
 
+//! @brief Invokes domainChanged() if the subdomain has changed
+//! since the last call. Returns true in that case.
+bool XC::DomainDecompositionAnalysis::checkDomainChange(void)
+  {
+    bool retval= false;
+    const int stamp= theSubdomain->hasDomainChanged();
+    if(stamp != domainStamp)
+      {
+	domainStamp= stamp;
+	this->domainChanged();
+	retval= true;
+      }
+    return retval;
+  }
+
 //! @brief Returns the number of external equations.
 //!
 //! A method to return the number of external degrees-of-freedom on the
@@ -295,15 +319,8 @@ int XC::DomainDecompositionAnalysis::formTangent(void)
   {
     int result =0;
 
-    Domain *the_Domain= this->getDomainPtr();
-
     // we check to see if the domain has changed 
-    int stamp= the_Domain->hasDomainChanged();
-    if(stamp != domainStamp)
-      {
-	domainStamp= stamp;
-	this->domainChanged();
-      }
+    checkDomainChange();
     
     // if tangFormed == -1 then formTangent has already been
     // called for this state by formResidual() or formTangVectProduct()
@@ -341,15 +358,9 @@ int XC::DomainDecompositionAnalysis::formTangent(void)
 int XC::DomainDecompositionAnalysis::formResidual(void)
   {
     int result =0;
-    Domain *the_Domain= this->getDomainPtr();    
-    
+
     // we check to see if the domain has changed 
-    int stamp= the_Domain->hasDomainChanged();
-    if(stamp != domainStamp)
-      {
-	domainStamp= stamp;
-	this->domainChanged();
-      }
+    checkDomainChange();
     
     if(tangFormed == false)
       {
@@ -383,15 +394,8 @@ int XC::DomainDecompositionAnalysis::formTangVectProduct(Vector &u)
   {
     int result= 0;
 
-    Domain *the_Domain= this->getDomainPtr();
-    
     // we check to see if the domain has changed 
-    int stamp= the_Domain->hasDomainChanged();
-    if(stamp != domainStamp)
-      {
-	domainStamp= stamp;
-	this->domainChanged();
-      }
+    checkDomainChange();
     
     if(tangFormed == false)
       {
@@ -416,15 +420,8 @@ int XC::DomainDecompositionAnalysis::formTangVectProduct(Vector &u)
 //! on {\em theSolver().
 const XC::Matrix &XC::DomainDecompositionAnalysis::getTangent(void)
   {
-    Domain *the_Domain= this->getDomainPtr();
-    
     // we check to see if the domain has changed 
-    int stamp= the_Domain->hasDomainChanged();
-    if(stamp != domainStamp)
-      {
-	domainStamp= stamp;
-	this->domainChanged();
-      }
+    checkDomainChange();
 
     if(tangFormed == false)
       {	this->formTangent(); }
@@ -442,17 +439,9 @@ const XC::Matrix &XC::DomainDecompositionAnalysis::getTangent(void)
 //! Vector obtained from invoking getCondensedRHS() on the solver. 
 const XC::Vector &XC::DomainDecompositionAnalysis::getResidual(void)
   {
-    Domain *the_Domain= this->getDomainPtr();
-    
     // we check to see if the domain has changed 
-    // we check to see if the domain has changed 
-    int stamp= the_Domain->hasDomainChanged();
-    if(stamp != domainStamp)
-      {
-	domainStamp= stamp;
-	this->domainChanged();
-	this->formResidual();	
-      }    
+    if(checkDomainChange())
+      this->formResidual();
     theResidual= theSolver->getCondensedRHS();
     return theResidual;
   }
@@ -468,15 +457,8 @@ const XC::Vector &XC::DomainDecompositionAnalysis::getResidual(void)
 //! on \p theSolver.
 const XC::Vector &XC::DomainDecompositionAnalysis::getTangVectProduct()
   {
-    Domain *the_Domain= this->getDomainPtr();
-    
     // we check to see if the domain has changed 
-    int stamp= the_Domain->hasDomainChanged();
-    if(stamp != domainStamp)
-      {
-	domainStamp= stamp;
-	this->domainChanged();
-      }
+    checkDomainChange();
     return theSolver->getCondensedMatVect();
   }
 
@@ -122,6 +122,10 @@ class DomainDecompositionAnalysis: public Analysis, public MovableObject
     virtual void clearAll(void);	    
     virtual int initialize(void);
     virtual int domainChanged(void);
+    bool checkDomainChange(void);
+
+    virtual Domain *getDomainPtr(void);
+    virtual const Domain *getDomainPtr(void) const;
 
     // methods for non standard domain deomposition analysis
     virtual bool doesIndependentAnalysis(void);    
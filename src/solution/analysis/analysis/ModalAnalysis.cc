@@ -33,6 +33,16 @@
 
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
+#include "solution/analysis/model/AnalysisModel.h"
+#include "solution/analysis/model/DOF_GrpIter.h"
+#include "solution/analysis/model/dof_grp/DOF_Group.h"
+#include "solution/system_of_eqn/eigenSOE/EigenSOE.h"
+#include "preprocessor/set_mgmt/SetMeshComp.h"
+#include "domain/mesh/node/Node.h"
+#include "domain/mesh/element/Element.h"
+#include "domain/mesh/element/utils/NodePtrsWithIDs.h"
+#include "xc_utils/src/kernel/python_utils.h"
+#include <algorithm>
 
 //! @brief Constructor.
 XC::ModalAnalysis::ModalAnalysis(AnalysisAggregation *analysis_aggregation)
@@ -90,3 +100,220 @@ XC::Matrix XC::ModalAnalysis::getCQCModalCrossCorrelationCoefficients(const Vect
     return retval;
   }
 
+//! @brief Return the modal participation factors for a ground
+//! motion along the DOFs being passed as parameter (i.e. 0: x
+//! direction, 1: y direction,...).
+//! @param dofs: indexes of the node DOFs that move with the ground.
+XC::Vector XC::ModalAnalysis::getModalParticipationFactorsForDOFs(const std::set<int> &dofs) const
+  {
+    Vector retval;
+    const AnalysisModel *theModel= getAnalysisModelPtr();
+    const EigenSOE *theSOE= getEigenSOEPtr();
+    if(theModel && theSOE)
+      {
+        // influence vector.
+        Vector r(theSOE->getNumEqn());
+        DOF_GrpConstIter &theDOFGroups= theModel->getConstDOFs();
+        const DOF_Group *dofGroupPtr= nullptr;
+        while((dofGroupPtr= theDOFGroups()) != nullptr)
+          if(dofGroupPtr->getNodeTag()>=0) // DOF group of a node.
+            {
+              const ID &id= dofGroupPtr->getID();
+              for(std::set<int>::const_iterator i= dofs.begin();i!=dofs.end();i++)
+                if((*i>=0) && (*i<id.Size()) && (id(*i)>=0))
+                  r(id(*i))= 1.0;
+            }
+        retval= theSOE->getModalParticipationFactors(r);
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+	        << "; analysis model or system of equations not set."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Return the modal participation factors for a ground
+//! motion along the DOFs being passed as parameter.
+XC::Vector XC::ModalAnalysis::getModalParticipationFactorsForDOFs(const boost::python::list &l) const
+  { return getModalParticipationFactorsForDOFs(set_int_from_py_list(l)); }
+
+//! @brief Return the factors that, multiplied by the eigenvectors,
+//! give the maximum modal displacements for a ground motion along
+//! the DOFs being passed as parameter:
+//! q_i= participation_factor_i*spectral_acceleration_i/omega_i^2.
+XC::Vector XC::ModalAnalysis::getModalDisplacementFactors(const std::set<int> &dofs) const
+  {
+    Vector retval= getModalParticipationFactorsForDOFs(dofs);
+    const Vector accel= getModalAccelerations();
+    const Vector omega= getAngularFrequencies();
+    const int nm= std::min(retval.Size(),accel.Size());
+    for(int i= 0;i<nm;i++)
+      retval(i)*= accel(i)/sqr(omega(i));
+    return retval;
+  }
+
+//! @brief Return the maximum modal displacements of the nodes of the
+//! set. Each row of the matrix corresponds to a mode and each column
+//! to a DOF of a node (the DOFs of the first node of the set come
+//! first, then those of the second one and so on).
+//! @param s: set containing the nodes.
+//! @param dofs: direction of the ground motion.
+XC::Matrix XC::ModalAnalysis::getModalDisplacements(const SetMeshComp &s,const std::set<int> &dofs) const
+  {
+    const Vector q= getModalDisplacementFactors(dofs);
+    const int nm= q.Size();
+    int nCols= 0;
+    for(SetMeshComp::nod_const_iterator i= s.nodes_begin();i!=s.nodes_end();i++)
+      nCols+= (*i)->getNumberDOF();
+    Matrix retval(nm,nCols);
+    int offset= 0;
+    for(SetMeshComp::nod_const_iterator i= s.nodes_begin();i!=s.nodes_end();i++)
+      {
+        Node *n= *i;
+        const int ndof= n->getNumberDOF();
+        const Matrix &eigenvectors= n->getEigenvectors();
+        const int nv= std::min(nm,eigenvectors.noCols());
+        for(int k= 0;k<ndof;k++)
+          for(int m= 0;m<nv;m++)
+            retval(m,offset+k)= q(m)*eigenvectors(k,m);
+        offset+= ndof;
+      }
+    return retval;
+  }
+
+//! @brief Return the maximum modal displacements of the nodes of the set.
+XC::Matrix XC::ModalAnalysis::getModalDisplacements(const SetMeshComp &s,const boost::python::list &l) const
+  { return getModalDisplacements(s,set_int_from_py_list(l)); }
+
+//! @brief Return the maximum modal forces of the elements of the set
+//! (the forces on the element nodes in global coordinates). Each row
+//! of the matrix corresponds to a mode and each column to a component
+//! of the resisting force vector of an element. The forces of each
+//! element are obtained for all the modes at once multiplying the
+//! (initial) stiffness matrix of the element by the matrix of its
+//! modal displacements.
+//! @param s: set containing the elements.
+//! @param dofs: direction of the ground motion.
+XC::Matrix XC::ModalAnalysis::getModalElementForces(const SetMeshComp &s,const std::set<int> &dofs) const
+  {
+    const Vector q= getModalDisplacementFactors(dofs);
+    const int nm= q.Size();
+    int nCols= 0;
+    for(SetMeshComp::elem_const_iterator i= s.elem_begin();i!=s.elem_end();i++)
+      nCols+= (*i)->getNumDOF();
+    Matrix retval(nm,nCols);
+    Matrix U, F;
+    int offset= 0;
+    for(SetMeshComp::elem_const_iterator i= s.elem_begin();i!=s.elem_end();i++)
+      {
+        const Element *e= *i;
+        const int ndof= e->getNumDOF();
+        // modal displacements of the element nodes.
+        U.resize(ndof,nm);
+        U.Zero();
+        const NodePtrsWithIDs &theNodes= e->getNodePtrs();
+        int row= 0;
+        for(size_t j= 0;j<theNodes.size();j++)
+          {
+            Node *n= theNodes[j];
+            const int nn= n->getNumberDOF();
+            const Matrix &eigenvectors= n->getEigenvectors();
+            const int nv= std::min(nm,eigenvectors.noCols());
+            for(int m= 0;m<nv;m++)
+              for(int k= 0;k<nn;k++)
+                U(row+k,m)= q(m)*eigenvectors(k,m);
+            row+= nn;
+          }
+        F.resize(ndof,nm);
+        F.addMatrixProduct(0.0,e->getInitialStiff(),U,1.0);
+        for(int m= 0;m<nm;m++)
+          for(int k= 0;k<ndof;k++)
+            retval(m,offset+k)= F(k,m);
+        offset+= ndof;
+      }
+    return retval;
+  }
+
+//! @brief Return the maximum modal forces of the elements of the set.
+XC::Matrix XC::ModalAnalysis::getModalElementForces(const SetMeshComp &s,const boost::python::list &l) const
+  { return getModalElementForces(s,set_int_from_py_list(l)); }
+
+//! @brief Square root of the sum of the squares of the modal
+//! responses (one row for each mode, one column for each response
+//! quantity).
+XC::Vector XC::ModalAnalysis::getSRSS(const Matrix &R)
+  {
+    const int nm= R.noRows();
+    const int nq= R.noCols();
+    Vector retval(nq);
+    const double *col= R.getDataPtr();
+    for(int j= 0;j<nq;j++, col+= nm)
+      {
+        double s= 0.0;
+        for(int m= 0;m<nm;m++)
+          s+= col[m]*col[m];
+        retval(j)= sqrt(s);
+      }
+    return retval;
+  }
+
+//! @brief Complete quadratic combination of the modal responses (one
+//! row for each mode, one column for each response quantity). The
+//! columns are processed in blocks, multiplying the cross-correlation
+//! matrix by each block of modal responses.
+//! @param R: modal responses.
+//! @param zetas: damping ratio for each mode.
+XC::Vector XC::ModalAnalysis::getCQC(const Matrix &R, const Vector &zetas) const
+  {
+    const int nm= R.noRows();
+    const int nq= R.noCols();
+    Vector retval(nq);
+    const Matrix rho= getCQCModalCrossCorrelationCoefficients(zetas);
+    if(rho.noRows()!=nm)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the number of rows of the responses matrix ("
+		  << nm << ") doesn't match the number of modes ("
+		  << rho.noRows() << ").\n";
+        return retval;
+      }
+    const int blockSize= 64;
+    Matrix Rb, W;
+    for(int first= 0;first<nq;first+= blockSize)
+      {
+        const int nb= std::min(blockSize,nq-first);
+        Rb.resize(nm,nb);
+        std::copy(R.getDataPtr()+first*nm,R.getDataPtr()+(first+nb)*nm,Rb.getDataPtr());
+        W.resize(nm,nb);
+        W.addMatrixProduct(0.0,rho,Rb,1.0);
+        const double *r= Rb.getDataPtr();
+        const double *w= W.getDataPtr();
+        for(int j= 0;j<nb;j++, r+= nm, w+= nm)
+          {
+            double s= 0.0;
+            for(int m= 0;m<nm;m++)
+              s+= r[m]*w[m];
+            retval(first+j)= sqrt(std::max(s,0.0));
+          }
+      }
+    return retval;
+  }
+
+//! @brief Combination of the responses to the ground motion along
+//! each direction: the maximum of
+//! |Ex|+factor*(|Ey|+|Ez|), |Ey|+factor*(|Ex|+|Ez|) and
+//! |Ez|+factor*(|Ex|+|Ey|) (100-30 rule when factor= 0.3). Empty vectors
+//! are ignored (i.e. for two-dimensional problems).
+XC::Vector XC::ModalAnalysis::getDirectionalCombination(const Vector &Ex, const Vector &Ey, const Vector &Ez, const double &factor)
+  {
+    const int sz= std::max(Ex.Size(),std::max(Ey.Size(),Ez.Size()));
+    Vector retval(sz);
+    for(int i= 0;i<sz;i++)
+      {
+        const double ex= (i<Ex.Size() ? std::abs(Ex(i)) : 0.0);
+        const double ey= (i<Ey.Size() ? std::abs(Ey(i)) : 0.0);
+        const double ez= (i<Ez.Size() ? std::abs(Ez(i)) : 0.0);
+        retval(i)= std::max(ex+factor*(ey+ez),std::max(ey+factor*(ex+ez),ez+factor*(ex+ey)));
+      }
+    return retval;
+  }
@@ -32,9 +32,12 @@
 
 #include "EigenAnalysis.h"
 #include "xc_utils/src/geom/d1/function_from_points/FunctionFromPointsR_R.h"
+#include <set>
+#include <boost/python/list.hpp>
 
 namespace XC {
 class Matrix;
+class SetMeshComp;
 
 //! @ingroup AnalysisType
 //
@@ -59,6 +62,20 @@ class ModalAnalysis : public EigenAnalysis
 
     //Equivalent static load.
     Vector getEquivalentStaticLoad(int mode) const;
+
+    //Modal responses (rows: modes, columns: response quantities).
+    Vector getModalParticipationFactorsForDOFs(const std::set<int> &) const;
+    Vector getModalParticipationFactorsForDOFs(const boost::python::list &) const;
+    Vector getModalDisplacementFactors(const std::set<int> &) const;
+    Matrix getModalDisplacements(const SetMeshComp &,const std::set<int> &) const;
+    Matrix getModalDisplacements(const SetMeshComp &,const boost::python::list &) const;
+    Matrix getModalElementForces(const SetMeshComp &,const std::set<int> &) const;
+    Matrix getModalElementForces(const SetMeshComp &,const boost::python::list &) const;
+
+    //Modal combinations.
+    static Vector getSRSS(const Matrix &);
+    Vector getCQC(const Matrix &, const Vector &zetas) const;
+    static Vector getDirectionalCombination(const Vector &, const Vector &, const Vector &, const double &factor= 0.3);
   };
 
 } // end of XC namespace
@@ -76,7 +76,7 @@ const std::string stepNumberMessage= "In a static analysis, a number of steps gr
 
 //! @brief Constructor.
 XC::StaticAnalysis::StaticAnalysis(AnalysisAggregation *analysis_aggregation)
-  :Analysis(analysis_aggregation), domainStamp(0)
+  :Analysis(analysis_aggregation), domainStamp(0), structureStamp(0)
   {
     // AddingSensitivity:BEGIN ////////////////////////////////////
 #ifdef _RELIABILITY
@@ -136,24 +136,36 @@ int XC::StaticAnalysis::new_domain_step(int num_step)
 //! It's used in run_analysis_step method.
 int XC::StaticAnalysis::check_domain_change(int num_step,int numSteps)
   {
-    int result= 0;
-    int stamp= getDomainPtr()->hasDomainChanged();
+    const int result= update_domain_stamp();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; domainChanged failed"
+		  << " at step " << num_step << " of "
+		  << numSteps << std::endl;
+	if(num_step>1)
+    	  std::cerr << stepNumberMessage;
+        return -1;
+      }
+    return result;
+  }
 
+//! @brief Checks the domain stamp and, if the domain has changed,
+//! calls domainChanged or, if only the loads have changed (see
+//! Domain::addLoadPattern), loadsChanged.
+int XC::StaticAnalysis::update_domain_stamp(void)
+  {
+    int result= 0;
+    Domain *the_Domain= this->getDomainPtr();
+    const int stamp= the_Domain->hasDomainChanged();
     if(stamp != domainStamp)
       {
+        const bool sameStructure= (domainStamp!=0) && (the_Domain->getStructureStamp()==structureStamp);
         domainStamp= stamp;
-        result= domainChanged();
-
-        if(result < 0)
-          {
-            std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; domainChanged failed"
-		      << " at step " << num_step << " of "
-		      << numSteps << std::endl;
-	    if(num_step>1)
-    	      std::cerr << stepNumberMessage;
-            return -1;
-          }
+        if(sameStructure)
+          result= loadsChanged();
+        else
+          result= domainChanged();
       }
     return result;
   }
@@ -308,19 +320,12 @@ int XC::StaticAnalysis::analyze(int numSteps)
 
 int XC::StaticAnalysis::initialize(void)
   {
-    Domain *the_Domain= this->getDomainPtr();
-
     // check if domain has undergone change
-    int stamp= the_Domain->hasDomainChanged();
-    if(stamp != domainStamp)
+    if(update_domain_stamp() < 0)
       {
-        domainStamp= stamp;
-        if(this->domainChanged() < 0)
-          {
-            std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; domainChanged() failed\n";
-            return -1;
-          }
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; domainChanged() failed\n";
+        return -1;
       }
     if(getStaticIntegratorPtr()->initialize() < 0)
       {
@@ -349,7 +354,7 @@ int XC::StaticAnalysis::initialize(void)
 //! dof's. Once the equation numbers have been set the numberer then
 //! invokes setID() on all the FE\_Elements in the model. Finally
 //! the numberer invokes setNumEqn() on the model.
-//! - It invokes {\em setSize(theModel.getDOFGraph())} on {\em
+//! - It invokes {\em setSize(theModel.getDOFCSRGraph())} on {\em
 //! theSOE} which causes the system of equation to determine its size
 //! based on the connectivity of the dofs in the analysis model. 
 //! - Finally domainChanged() is invoked on both \p theIntegrator and 
@@ -361,6 +366,7 @@ int XC::StaticAnalysis::domainChanged(void)
   {
     Domain *the_Domain= this->getDomainPtr();
     domainStamp= the_Domain->hasDomainChanged();
+    structureStamp= the_Domain->getStructureStamp();
 
     getAnalysisModelPtr()->clearAll();
     getConstraintHandlerPtr()->clearAll();
@@ -400,7 +406,7 @@ int XC::StaticAnalysis::domainChanged(void)
 
     // we invoke setSize() on the LinearSOE which
     // causes that object to determine its size
-    Graph &theGraph= getAnalysisModelPtr()->getDOFGraph();
+    const CSRGraph &theGraph= getAnalysisModelPtr()->getDOFCSRGraph();
 
     result= getLinearSOEPtr()->setSize(theGraph);
     if(result < 0)
@@ -433,6 +439,26 @@ int XC::StaticAnalysis::domainChanged(void)
     return 0;
   }
 
+//! @brief Method invoked when only the loads of the domain have changed
+//! (a load pattern without single freedom constraints has been
+//! added, see Domain::addLoadPattern).
+//!
+//! The FE_Elements, DOF_Groups, equation numbers and the system of
+//! equations (and its factorization) remain valid, so only the
+//! integrator is informed (to compute again its reference load).
+int XC::StaticAnalysis::loadsChanged(void)
+  {
+    domainStamp= getDomainPtr()->hasDomainChanged();
+    const int result= getStaticIntegratorPtr()->domainChanged();
+    if(result < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "Integrator::domainChanged() failed." << std::endl;
+        return -5;
+      }
+    return result;
+  }
+
 // AddingSensitivity:BEGIN //////////////////////////////
 #ifdef _RELIABILITY
 int XC::StaticAnalysis::setSensitivityAlgorithm(SensitivityAlgorithm *passedSensitivityAlgorithm)
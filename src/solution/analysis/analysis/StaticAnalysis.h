@@ -79,6 +79,7 @@ class StaticAnalysis: public Analysis
   {
   protected:
     int domainStamp;
+    int structureStamp; //!< Structure stamp of the domain (see Domain::getStructureStamp) in the last call to domainChanged.
 
 // AddingSensitivity:BEGIN ///////////////////////////////
 #ifdef _RELIABILITY
@@ -88,6 +89,7 @@ class StaticAnalysis: public Analysis
 
     int new_domain_step(int num_step);
     int check_domain_change(int num_step,int numSteps);
+    int update_domain_stamp(void);
     int new_integrator_step(int num_step);
     int solve_current_step(int num_step);
     int compute_sensitivities_step(int num_step);
@@ -106,6 +108,7 @@ class StaticAnalysis: public Analysis
     virtual int analyze(int numSteps);
     int initialize(void);
     int domainChanged(void);
+    int loadsChanged(void);
 
     int setNumberer(DOF_Numberer &theNumberer);
     int setAlgorithm(EquiSolnAlgo &theAlgorithm);
@@ -78,6 +78,7 @@ class Subdomain;
 class SubstructuringAnalysis: public DomainDecompositionAnalysis
   {
     friend class ProcSolu;
+    friend class Subdomain;
     SubstructuringAnalysis(Subdomain &theDomain,DomainSolver &theSolver,AnalysisAggregation *s= nullptr);
     Analysis *getCopy(void) const;
   public:
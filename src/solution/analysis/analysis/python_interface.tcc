@@ -73,9 +73,20 @@ class_<XC::LinearBucklingEigenAnalysis, bases<XC::EigenAnalysis>, boost::noncopy
   .def("getEigenvalue", make_function(&XC::LinearBucklingEigenAnalysis::getEigenvalue, return_value_policy<copy_const_reference>()) )
   ;
 
+XC::Vector (XC::ModalAnalysis::*getModalParticipationFactorsForDOFsPy)(const boost::python::list &) const= &XC::ModalAnalysis::getModalParticipationFactorsForDOFs;
+XC::Matrix (XC::ModalAnalysis::*getModalDisplacementsPy)(const XC::SetMeshComp &,const boost::python::list &) const= &XC::ModalAnalysis::getModalDisplacements;
+XC::Matrix (XC::ModalAnalysis::*getModalElementForcesPy)(const XC::SetMeshComp &,const boost::python::list &) const= &XC::ModalAnalysis::getModalElementForces;
 class_<XC::ModalAnalysis , bases<XC::EigenAnalysis>, boost::noncopyable >("ModalAnalysis", no_init)
   .add_property("spectrum", make_function(&XC::ModalAnalysis::getSpectrum,return_internal_reference<>()),&XC::ModalAnalysis::setSpectrum,"Response spectrum,") 
   .def("getCQCModalCrossCorrelationCoefficients",&XC::ModalAnalysis::getCQCModalCrossCorrelationCoefficients,"Returns CQC correlation coefficients.")
+  .def("getModalParticipationFactorsForDOFs",getModalParticipationFactorsForDOFsPy,"getModalParticipationFactorsForDOFs(dofs): return the participation factors of the modes for a ground motion along the DOFs in the list (i.e. [0] for x direction).")
+  .def("getModalDisplacements",getModalDisplacementsPy,"getModalDisplacements(set,dofs): return the maximum modal displacements of the set nodes for a ground motion along the DOFs in the list (one row for each mode, one column for each node DOF).")
+  .def("getModalElementForces",getModalElementForcesPy,"getModalElementForces(set,dofs): return the maximum modal forces (resisting forces in global coordinates) of the set elements for a ground motion along the DOFs in the list (one row for each mode, one column for each element DOF).")
+  .def("getSRSS",&XC::ModalAnalysis::getSRSS,"getSRSS(modalResponses): square root of the sum of the squares of the modal responses (one row for each mode).")
+  .staticmethod("getSRSS")
+  .def("getCQC",&XC::ModalAnalysis::getCQC,"getCQC(modalResponses,zetas): complete quadratic combination of the modal responses (one row for each mode) with the damping ratios of the modes.")
+  .def("getDirectionalCombination",&XC::ModalAnalysis::getDirectionalCombination,"getDirectionalCombination(Ex,Ey,Ez,factor): combination of the responses to the ground motion along each direction (100-30 rule with factor= 0.3).")
+  .staticmethod("getDirectionalCombination")
   ;
 
 
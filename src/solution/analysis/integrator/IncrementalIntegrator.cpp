@@ -65,6 +65,7 @@
 #include <solution/analysis/model/dof_grp/DOF_Group.h>
 #include <solution/analysis/model/FE_EleIter.h>
 #include <solution/analysis/model/DOF_GrpIter.h>
+#include "utility/ThreadPool.h"
 
 
 //! @brief Constructor.
@@ -116,14 +117,52 @@ int XC::IncrementalIntegrator::formTangent(int statFlag)
     // loop through the FE_Elements adding their contributions to the tangent
     FE_Element *elePtr;
     FE_EleIter &theEles2= mdl->getFEs();    
-    while((elePtr = theEles2()) != 0)     
-      if(theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0)
-        {
-	  std::cerr << getClassName() << "::" << __FUNCTION__
-		    << "; WARNING failed in addA for ID "
-		    << elePtr->getID();	    
-	  result = -3;
-	}
+    ThreadPool *pool= (isEleTangentThreadSafe() ? getThreadPool() : nullptr);
+    if(!pool)
+      {
+        while((elePtr = theEles2()) != 0)     
+          if(theSOE->addA(elePtr->getTangent(this),elePtr->getID()) < 0)
+            {
+	      std::cerr << getClassName() << "::" << __FUNCTION__
+		        << "; WARNING failed in addA for ID "
+		        << elePtr->getID();	    
+	      result = -3;
+	    }
+      }
+    else
+      {
+        // compute concurrently the tangents of the thread safe
+        // elements, then assemble all of them serially.
+        std::vector<FE_Element *> theFEs;
+        std::vector<size_t> threadSafeFEs;
+        while((elePtr = theEles2()) != 0)
+          {
+            if(elePtr->isThreadSafe())
+              {
+                elePtr->setPrivateStorage();
+                threadSafeFEs.push_back(theFEs.size());
+              }
+            theFEs.push_back(elePtr);
+          }
+        std::vector<const Matrix *> tangents(theFEs.size(),nullptr);
+        pool->parallel_for(threadSafeFEs.size(),[&](const size_t &i,const size_t &)
+          {
+            const size_t j= threadSafeFEs[i];
+            tangents[j]= &theFEs[j]->getTangent(this);
+          });
+        for(size_t j= 0;j<theFEs.size();j++)
+          {
+            elePtr= theFEs[j];
+            const Matrix &tang= (tangents[j] ? *tangents[j] : elePtr->getTangent(this));
+            if(theSOE->addA(tang,elePtr->getID()) < 0)
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; WARNING failed in addA for ID "
+		          << elePtr->getID();	    
+	        result = -3;
+	      }
+          }
+      }
     return result;
   }
 
@@ -344,16 +383,64 @@ int XC::IncrementalIntegrator::formElementResidual(void)
     LinearSOE *theSOE= getLinearSOEPtr();
     AnalysisModel *mdl= getAnalysisModelPtr();
     FE_EleIter &theEles2 = mdl->getFEs();
-    while((elePtr= theEles2()) != nullptr)
+    ThreadPool *pool= (isEleResidualThreadSafe() ? getThreadPool() : nullptr);
+    if(!pool)
       {
-	if(theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0)
+        while((elePtr= theEles2()) != nullptr)
           {
-	    std::cerr << getClassName() << "::" << __FUNCTION__
-		      << "; WARNING failed in addB for ID: "
-		      << elePtr->getID();
-	    res = -2;
-	  }
+	    if(theSOE->addB(elePtr->getResidual(this),elePtr->getID()) <0)
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; WARNING failed in addB for ID: "
+		          << elePtr->getID();
+	        res = -2;
+	      }
+          }
+      }
+    else
+      {
+        // compute concurrently the residuals of the thread safe
+        // elements, then assemble all of them serially.
+        std::vector<FE_Element *> theFEs;
+        std::vector<size_t> threadSafeFEs;
+        while((elePtr = theEles2()) != nullptr)
+          {
+            if(elePtr->isThreadSafe())
+              {
+                elePtr->setPrivateStorage();
+                threadSafeFEs.push_back(theFEs.size());
+              }
+            theFEs.push_back(elePtr);
+          }
+        std::vector<const Vector *> residuals(theFEs.size(),nullptr);
+        pool->parallel_for(threadSafeFEs.size(),[&](const size_t &i,const size_t &)
+          {
+            const size_t j= threadSafeFEs[i];
+            residuals[j]= &theFEs[j]->getResidual(this);
+          });
+        for(size_t j= 0;j<theFEs.size();j++)
+          {
+            elePtr= theFEs[j];
+            const Vector &resid= (residuals[j] ? *residuals[j] : elePtr->getResidual(this));
+	    if(theSOE->addB(resid,elePtr->getID()) <0)
+              {
+	        std::cerr << getClassName() << "::" << __FUNCTION__
+		          << "; WARNING failed in addB for ID: "
+		          << elePtr->getID();
+	        res = -2;
+	      }
+          }
       }
     return res;	    
   }
 
+//! @brief Returns true if the residual of the thread safe elements
+//! (see FE_Element::isThreadSafe) can be formed concurrently.
+bool XC::IncrementalIntegrator::isEleResidualThreadSafe(void) const
+  { return true; }
+
+//! @brief Returns true if the tangent of the thread safe elements
+//! (see FE_Element::isThreadSafe) can be formed concurrently.
+bool XC::IncrementalIntegrator::isEleTangentThreadSafe(void) const
+  { return true; }
+
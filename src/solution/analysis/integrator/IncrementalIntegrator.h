@@ -102,6 +102,8 @@ class IncrementalIntegrator : public Integrator
     friend class IntegratorVectors;
     virtual int formNodalUnbalance(void);        
     virtual int formElementResidual(void);
+    virtual bool isEleResidualThreadSafe(void) const;
+    virtual bool isEleTangentThreadSafe(void) const;
     int statusFlag;
 
     IncrementalIntegrator(AnalysisAggregation *,int classTag);
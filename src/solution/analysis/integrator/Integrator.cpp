@@ -74,10 +74,10 @@ void XC::Integrator::applyLoadModel(double newTime)
   { getAnalysisModelPtr()->applyLoadDomain(newTime); }
 
 int XC::Integrator::updateModel(void)
-  { return getAnalysisModelPtr()->updateDomain(); }
+  { return getAnalysisModelPtr()->updateDomain(getThreadPool()); }
 
 int XC::Integrator::updateModel(double newTime, double dT)
-  { return getAnalysisModelPtr()->updateDomain(newTime,dT); }
+  { return getAnalysisModelPtr()->updateDomain(newTime,dT,getThreadPool()); }
 
 double XC::Integrator::getCurrentModelTime(void)
   { return getAnalysisModelPtr()->getCurrentDomainTime(); }
@@ -99,6 +99,17 @@ XC::AnalysisAggregation *XC::Integrator::getAnalysisAggregation(void)
 const XC::AnalysisAggregation *XC::Integrator::getAnalysisAggregation(void) const
   { return dynamic_cast<const AnalysisAggregation *>(Owner()); }
 
+//! @brief Returns a pointer to the thread pool used to compute
+//! the element state (nullptr if the computation is serial).
+XC::ThreadPool *XC::Integrator::getThreadPool(void)
+  {
+    ThreadPool *retval= nullptr;
+    AnalysisAggregation *aggregation= getAnalysisAggregation();
+    if(aggregation)
+      retval= aggregation->getThreadPool();
+    return retval;
+  }
+
 
 //! @brief Returns a pointer to the analysis model.
 //! 
@@ -77,6 +77,7 @@ class ID;
 class FEM_ObjectBroker;
 class RayleighDampingFactors;
 class AnalysisAggregation ;
+class ThreadPool;
 
 //! @ingroup AnalysisType
 //!
@@ -101,6 +102,7 @@ class Integrator: public MovableObject, public CommandEntity
   protected:
     AnalysisAggregation  *getAnalysisAggregation (void);
     const AnalysisAggregation  *getAnalysisAggregation (void) const;
+    ThreadPool *getThreadPool(void);
     void applyLoadModel(double newTime);
     int updateModel(void);
     int updateModel(double newTime, double dT);
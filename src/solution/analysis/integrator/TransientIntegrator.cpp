@@ -170,6 +170,18 @@ int XC::TransientIntegrator::formEleResidual(FE_Element *theEle)
     return 0;
   }
 
+//! @brief The inertia and damping forces of the elements are computed
+//! using class wide storage so the residual can't be formed concurrently.
+bool XC::TransientIntegrator::isEleResidualThreadSafe(void) const
+  { return false; }
+
+//! @brief The tangent of a transient integrator adds the mass and
+//! damping matrices of the elements (Element::getMass, Element::getDamp)
+//! which are not covered by Element::isThreadSafe, so it can't be
+//! formed concurrently.
+bool XC::TransientIntegrator::isEleTangentThreadSafe(void) const
+  { return false; }
+
 //! @brief Builds the unbalanced load vector of the node being passed
 //! as parameter.
 //!
@@ -179,6 +179,8 @@ class TransientIntegrator : public IncrementalIntegrator
   {
   protected:
     TransientIntegrator(AnalysisAggregation *,int classTag);
+    virtual bool isEleResidualThreadSafe(void) const;
+    virtual bool isEleTangentThreadSafe(void) const;
   public:
 
     virtual int formTangent(int statFlag);
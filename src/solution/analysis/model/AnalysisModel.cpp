@@ -100,7 +100,8 @@ XC::AnalysisModel::AnalysisModel(ModelWrapper *owr)
    numFE_Ele(0), numDOF_Grp(0), numEqn(0),
    theFEs(this,256,"FEs"), theDOFGroups(this,256,"DOFs"), theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false),
+   updateDOFCSRGraph(true), updateGroupCSRGraph(true), privateStorage(false) {}
 
 //! @brief Constructor.
 //!
@@ -112,7 +113,8 @@ XC::AnalysisModel::AnalysisModel(int theClassTag,CommandEntity *owr)
    numFE_Ele(0), numDOF_Grp(0), numEqn(0),
    theFEs(this,1024,"FEs"), theDOFGroups(this,1024,"DOFs"),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false),
+   updateDOFCSRGraph(true), updateGroupCSRGraph(true), privateStorage(false) {}
 
 //! @brief Copy constructor.
 XC::AnalysisModel::AnalysisModel(const AnalysisModel &other)
@@ -120,7 +122,9 @@ XC::AnalysisModel::AnalysisModel(const AnalysisModel &other)
    numFE_Ele(other.numFE_Ele), numDOF_Grp(other.numDOF_Grp), numEqn(other.numEqn),
    theFEs(other.theFEs), theDOFGroups(other.theDOFGroups),theFEiter(&theFEs), theDOFGroupiter(&theDOFGroups),
    theFEconst_iter(&theFEs), theDOFGroupconst_iter(&theDOFGroups),
-   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false) {}
+   myDOFGraph(*this), myGroupGraph(*this), updateGraphs(false),
+   updateDOFCSRGraph(true), updateGroupCSRGraph(true),
+   privateStorage(other.privateStorage) {}
 
 //! @brief Assignment operator.
 XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
@@ -135,6 +139,9 @@ XC::AnalysisModel &XC::AnalysisModel::operator=(const AnalysisModel &other)
     myDOFGraph= DOF_Graph(*this);
     myGroupGraph= DOF_GroupGraph(*this);
     updateGraphs= false; //Update just finished
+    updateDOFCSRGraph= true;
+    updateGroupCSRGraph= true;
+    privateStorage= other.privateStorage;
     return *this;
   }
 
@@ -190,8 +197,10 @@ bool XC::AnalysisModel::addFE_Element(FE_Element *theElement)
 	    if(retval) // o.k.
 	      {
 		theElement->setAnalysisModel(*this);
+		if(privateStorage)
+		  theElement->setPrivateStorage();
 		numFE_Ele++;
-		updateGraphs= true;
+		invalidateGraphs();
 	      }
 	  }
       }
@@ -383,8 +392,10 @@ bool XC::AnalysisModel::addDOF_Group(DOF_Group *theGroup)
     bool result= theDOFGroups.addComponent(theGroup);
     if(result == true)
       {
+        if(privateStorage)
+          theGroup->setPrivateStorage();
         numDOF_Grp++;
-        updateGraphs= true;
+        invalidateGraphs();
         return true;  // o.k.
       }
     else
@@ -518,7 +529,7 @@ void XC::AnalysisModel::clearAll(void)
     numFE_Ele=0;
     numDOF_Grp= 0;
     numEqn= 0;    
-    updateGraphs= true;
+    invalidateGraphs();
   }
 
 
@@ -542,7 +553,7 @@ XC::DOF_Group *XC::AnalysisModel::getDOF_GroupPtr(int tag)
     TaggedObject *other= theDOFGroups.getComponentPtr(tag);
     if(other)
       result= dynamic_cast<DOF_Group *>(other);
-    updateGraphs= true;
+    invalidateGraphs();
     return result;
   }
 
@@ -561,7 +572,7 @@ const XC::DOF_Group *XC::AnalysisModel::getDOF_GroupPtr(int tag) const
 XC::FE_EleIter &XC::AnalysisModel::getFEs()
   {
     theFEiter.reset();
-    updateGraphs= true;
+    invalidateGraphs();
     return theFEiter;
   }
 
@@ -572,10 +583,46 @@ XC::FE_EleConstIter &XC::AnalysisModel::getConstFEs() const
     return theFEconst_iter;
   }
 
+//! @brief Returns true if the tangent of all the FE_Elements of the
+//! model is constant (linear model, see Element::isTangentConstant).
+bool XC::AnalysisModel::isTangentConstant(void) const
+  {
+    bool retval= (getNumEqn()>0);
+    FE_EleConstIter &theEles= getConstFEs();
+    const FE_Element *elePtr= nullptr;
+    while((elePtr= theEles()) != nullptr)
+      if(!elePtr->isTangentConstant())
+        {
+          retval= false;
+          break;
+        }
+    return retval;
+  }
+
+//! @brief Makes the FE_Elements and DOF_Groups of the model (those
+//! already added and those added afterwards) use their own tangent
+//! and residual storage instead of the class wide one. This allows
+//! to run the analysis of this model concurrently with the analysis
+//! of other models (i.e. the subdomains of a PartitionedDomain).
+void XC::AnalysisModel::setPrivateStorage(void)
+  {
+    if(!privateStorage)
+      {
+        privateStorage= true;
+        TaggedObjectIter &theFEsIter= theFEs.getComponents();
+        TaggedObject *obj= nullptr;
+        while((obj= theFEsIter()) != nullptr)
+          dynamic_cast<FE_Element *>(obj)->setPrivateStorage();
+        TaggedObjectIter &theGroupsIter= theDOFGroups.getComponents();
+        while((obj= theGroupsIter()) != nullptr)
+          dynamic_cast<DOF_Group *>(obj)->setPrivateStorage();
+      }
+  }
+
 XC::DOF_GrpIter &XC::AnalysisModel::getDOFGroups()
   {
     theDOFGroupiter.reset();
-    updateGraphs= true;
+    invalidateGraphs();
     return theDOFGroupiter;
   }
 
@@ -653,6 +700,71 @@ const XC::Graph &XC::AnalysisModel::getDOFGroupGraph(void) const
     return myGroupGraph;
   }
 
+//! @brief Mark the graphs as outdated.
+void XC::AnalysisModel::invalidateGraphs(void) const
+  {
+    updateGraphs= true;
+    updateDOFCSRGraph= true;
+    updateGroupCSRGraph= true;
+  }
+
+//! @brief Returns the DOF connectivity graph in compressed (CSR) form.
+//!
+//! Same graph as getDOFGraph (one vertex for each equation number
+//! and an edge between each pair of equations that belong to the same
+//! FE_Element) but without the per vertex trees of the Graph class.
+//! It's used by the system of equations to determine its size.
+const XC::CSRGraph &XC::AnalysisModel::getDOFCSRGraph(void) const
+  {
+    if(updateDOFCSRGraph)
+      {
+        myDOFCSRGraph.clear();
+        DOF_GrpConstIter &theDOFs= getConstDOFs();
+        const DOF_Group *dofPtr= nullptr;
+        while((dofPtr= theDOFs()) != nullptr)
+          {
+            const ID &id= dofPtr->getID();
+            const int size= id.Size();
+            for(int i=0; i<size; i++)
+              if(id(i)>=0)
+                myDOFCSRGraph.addVertex(id(i));
+          }
+        FE_EleConstIter &theEles= getConstFEs();
+        const FE_Element *elePtr= nullptr;
+        while((elePtr= theEles()) != nullptr)
+          myDOFCSRGraph.addClique(elePtr->getID());
+        myDOFCSRGraph.build();
+        updateDOFCSRGraph= false;
+      }
+    return myDOFCSRGraph;
+  }
+
+//! @brief Returns the connectivity of the DOF_Group objects in
+//! compressed (CSR) form.
+//!
+//! Same graph as getDOFGroupGraph (one vertex for each DOF_Group
+//! and an edge between each pair of DOF_Groups connected by a
+//! FE_Element) but without the per vertex trees of the Graph class.
+//! It's used by the DOF_Numberer to assign equation numbers to the dofs.
+const XC::CSRGraph &XC::AnalysisModel::getDOFGroupCSRGraph(void) const
+  {
+    if(updateGroupCSRGraph)
+      {
+        myGroupCSRGraph.clear();
+        DOF_GrpConstIter &theDOFs= getConstDOFs();
+        const DOF_Group *dofPtr= nullptr;
+        while((dofPtr= theDOFs()) != nullptr)
+          myGroupCSRGraph.addVertex(dofPtr->getTag());
+        FE_EleConstIter &theEles= getConstFEs();
+        const FE_Element *elePtr= nullptr;
+        while((elePtr= theEles()) != nullptr)
+          myGroupCSRGraph.addClique(elePtr->getDOFtags());
+        myGroupCSRGraph.build();
+        updateGroupCSRGraph= false;
+      }
+    return myGroupCSRGraph;
+  }
+
 //! @brief Sets the values of the displacement, velocity and acceleration of
 //! the nodes.
 //! 
@@ -803,7 +915,9 @@ void XC::AnalysisModel::applyLoadDomain(double pseudoTime)
 
 //! @brief Method which invokes update() on the domain. If no Domain has
 //! been set nothing is done and an error message is printed. 
-int XC::AnalysisModel::updateDomain(void)
+//!
+//! @param pool: if not null, thread pool used to update the elements.
+int XC::AnalysisModel::updateDomain(ThreadPool *pool)
   {
     // check to see there is a XC::Domain linked to the Model
     int res= 0;
@@ -814,7 +928,7 @@ int XC::AnalysisModel::updateDomain(void)
     else
       {
         // invoke the method
-        res= dom->update();
+        res= (pool ? dom->update(*pool) : dom->update());
         if(res==0)
           res+= getHandlerPtr()->update();
       }
@@ -822,7 +936,11 @@ int XC::AnalysisModel::updateDomain(void)
   }
 
 
-int XC::AnalysisModel::updateDomain(double newTime, double dT)
+//! @brief Applies the loads for the new time and updates the
+//! state of the domain.
+//!
+//! @param pool: if not null, thread pool used to update the elements.
+int XC::AnalysisModel::updateDomain(double newTime, double dT, ThreadPool *pool)
   {
     // check to see there is a domain linked to the Model
     int res= 0;
@@ -836,7 +954,7 @@ int XC::AnalysisModel::updateDomain(double newTime, double dT)
         dom->applyLoad(newTime);
         res= getHandlerPtr()->applyLoad();
         if(res==0)
-          res= dom->update();
+          res= (pool ? dom->update(*pool) : dom->update());
         if(res==0)
           res= getHandlerPtr()->update();
       }
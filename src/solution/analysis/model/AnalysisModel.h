@@ -69,6 +69,7 @@
 #include "xc_utils/src/kernel/CommandEntity.h"
 #include "solution/graph/graph/DOF_Graph.h"
 #include "solution/graph/graph/DOF_GroupGraph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include "utility/tagged/storage/ArrayOfTaggedObjects.h"
 #include "solution/analysis/model/FE_EleIter.h"
 #include "solution/analysis/model/FE_EleConstIter.h"
@@ -97,6 +98,7 @@ class ConstraintHandler;
 class TransformationConstraintHandler;
 class RayleighDampingFactors;
 class ModelWrapper;
+class ThreadPool;
 
 //! @ingroup Solu
 //! 
@@ -147,7 +149,13 @@ class AnalysisModel: public MovableObject, public CommandEntity
     mutable DOF_Graph myDOFGraph;
     mutable DOF_GroupGraph myGroupGraph;
     mutable bool updateGraphs;
+    mutable CSRGraph myDOFCSRGraph; //!< compressed DOF graph.
+    mutable CSRGraph myGroupCSRGraph; //!< compressed DOF_Group graph.
+    mutable bool updateDOFCSRGraph; //!< true if myDOFCSRGraph must be rebuilt.
+    mutable bool updateGroupCSRGraph; //!< true if myGroupCSRGraph must be rebuilt.
+    bool privateStorage; //!< if true FE_Elements and DOF_Groups use their own tangent and residual storage.
 
+    void invalidateGraphs(void) const;
     ModelWrapper *getModelWrapper(void);
     const ModelWrapper *getModelWrapper(void) const;
   protected:
@@ -156,8 +164,8 @@ class AnalysisModel: public MovableObject, public CommandEntity
     friend class Integrator;
     friend class Analysis;
     virtual void applyLoadDomain(double newTime);
-    virtual int updateDomain(void);
-    virtual int updateDomain(double newTime, double dT);
+    virtual int updateDomain(ThreadPool *pool= nullptr);
+    virtual int updateDomain(double newTime, double dT, ThreadPool *pool= nullptr);
     virtual int newStepDomain(double dT =0.0);
     virtual int commitDomain(void);
     virtual int revertDomainToLastCommit(void);
@@ -204,6 +212,12 @@ class AnalysisModel: public MovableObject, public CommandEntity
     virtual DOF_GrpIter &getDOFGroups();
     virtual FE_EleConstIter &getConstFEs() const;
     virtual DOF_GrpConstIter &getConstDOFs() const;
+    bool isTangentConstant(void) const;
+    void setPrivateStorage(void);
+    //! @brief Return true if the FE_Elements and DOF_Groups use their own
+    //! tangent and residual storage (see setPrivateStorage).
+    inline bool hasPrivateStorage(void) const
+      { return privateStorage; }
 
     // method to access the connectivity for SysOfEqn to size itself
     virtual void setNumEqn(int) ;
@@ -212,6 +226,8 @@ class AnalysisModel: public MovableObject, public CommandEntity
     virtual Graph &getDOFGroupGraph(void);
     virtual const Graph &getDOFGraph(void) const;
     virtual const Graph &getDOFGroupGraph(void) const;
+    virtual const CSRGraph &getDOFCSRGraph(void) const;
+    virtual const CSRGraph &getDOFGroupCSRGraph(void) const;
 
     // methods to update the response quantities at the DOF_Groups,
     // which in turn set the new_ nodal trial response quantities.
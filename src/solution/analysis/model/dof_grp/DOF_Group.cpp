@@ -934,4 +934,7 @@ void XC::DOF_Group::addD_ForceSensitivity(const Vector &Udot, double fact)
 void XC::DOF_Group::resetNodePtr(void)
   { myNode= nullptr; }
 
-
+//! @brief Makes the object use its own tangent matrix and unbalance
+//! vector instead of the class wide ones (see FE_Element::setPrivateStorage).
+void XC::DOF_Group::setPrivateStorage(void)
+  { unbalAndTangent.setPrivateStorage(); }
@@ -190,6 +190,7 @@ class DOF_Group: public TaggedObject
 // AddingSensitivity:END //////////////////////////////////////
     virtual void  Print(std::ostream &, int = 0) {return;};
     virtual void resetNodePtr(void);
+    void setPrivateStorage(void);
   };
 } // end of XC namespace
 
@@ -1152,3 +1152,39 @@ int XC::FE_Element::updateElement(void)
     else
       return 0;
   }
+
+//! @brief Returns true if the tangent and residual of this object
+//! can be computed concurrently with those of other FE_Elements
+//! (see setPrivateStorage). For a subdomain this means that its
+//! condensation can run concurrently with that of the other
+//! subdomains (see Subdomain::isThreadSafe).
+bool XC::FE_Element::isThreadSafe(void) const
+  { return (myEle && myEle->isThreadSafe()); }
+
+//! @brief Returns true if the tangent of this object doesn't
+//! change between steps (see Element::isTangentConstant). The objects
+//! that represent constraints (no element attached) have constant
+//! tangent.
+bool XC::FE_Element::isTangentConstant(void) const
+  {
+    bool retval= true;
+    if(myEle)
+      retval= (!myEle->isSubdomain() && myEle->isTangentConstant());
+    return retval;
+  }
+
+//! @brief Makes the object use its own tangent matrix and residual
+//! vector instead of the class wide ones (which are shared with
+//! other FE_Elements with the same number of DOFs). Subdomains have
+//! their own matrix and vector, so the objects of the subdomain
+//! analysis are the ones that get private storage.
+void XC::FE_Element::setPrivateStorage(void)
+  {
+    if(myEle && myEle->isSubdomain())
+      {
+        Subdomain *theSub= dynamic_cast<Subdomain *>(myEle);
+        theSub->setPrivateStorage();
+      }
+    else
+      unbalAndTangent.setPrivateStorage();
+  }
@@ -168,6 +168,9 @@ class FE_Element: public TaggedObject
     virtual void  addD_Force(const Vector &vel, double fact = 1.0);    
 
     virtual int updateElement(void);
+    virtual bool isThreadSafe(void) const;
+    virtual bool isTangentConstant(void) const;
+    void setPrivateStorage(void);
 
     virtual Integrator *getLastIntegrator(void);
     virtual const Vector &getLastResponse(void);
@@ -197,6 +197,11 @@ int XC::TransformationFE::setID(void)
     return 0;
   }
 
+//! @brief The transformed tangent and residual use class wide
+//! storage so they can't be computed concurrently.
+bool XC::TransformationFE::isThreadSafe(void) const
+  { return false; }
+
 const XC::Matrix &XC::TransformationFE::getTangent(Integrator *theNewIntegrator)
   {
     const Matrix &theTangent = this->FE_Element::getTangent(theNewIntegrator);
@@ -161,7 +161,7 @@ XC::DOF_Numberer *XC::DOF_Numberer::getCopy(void) const
 //
 //! This base class performs the ordering by getting an ID containing the
 //! ordered DOF\_Group tags, obtained by invoking {\em
-//! number(theModel-\f$>\f$getDOFGroupGraph(), lastDOF\_Group)} on the
+//! number(theModel-\f$>\f$getDOFGroupCSRGraph(), lastDOF\_Group)} on the
 //! GraphNumberer, \p theGraphNumberer, passed in the constructor. The
 //! base class then makes two passes through the DOF\_Group objects in the
 //! AnalysisModel by looping through this ID; in the first pass assigning the
@@ -205,7 +205,7 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
       return 0;
 
     // we first number the dofs using the dof group graph
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOF_Group);
+    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupCSRGraph(), lastDOF_Group);
 
     // we now iterate through the DOFs first time setting -2 values  
     if(orderedRefs.Size() != am->getNumDOF_Groups())
@@ -344,7 +344,7 @@ int XC::DOF_Numberer::numberDOF(int lastDOF_Group)
 //! This method in the base class is almost identical to the one just
 //! described. The only difference is that the ID identifying the order of
 //! the DOF\_Groups is obtained by invoking {\em
-//! number(theModel-\f$>\f$getDOFGroupGraph(), lastDOF\_Groups)} on the
+//! number(theModel-\f$>\f$getDOFGroupCSRGraph(), lastDOF\_Groups)} on the
 //! GraphNumberer.
 int XC::DOF_Numberer::numberDOF(ID &lastDOFs) 
   {
@@ -374,7 +374,7 @@ int XC::DOF_Numberer::numberDOF(ID &lastDOFs)
 
     // we first number the dofs using the dof group graph
         
-    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupGraph(), lastDOFs);     
+    const ID &orderedRefs= theGraphNumberer->number(am->getDOFGroupCSRGraph(), lastDOFs);     
 
     // we now iterate through the DOFs first time setting -2 values
 
@@ -99,9 +99,7 @@ class DOF_Numberer: public MovableObject, public CommandEntity
     GraphNumberer *theGraphNumberer; //!< Graph (DOF) numberer.
   protected:
     AnalysisModel *getAnalysisModelPtr(void);
-    GraphNumberer *getGraphNumbererPtr(void);
     const AnalysisModel *getAnalysisModelPtr(void) const;
-    const GraphNumberer *getGraphNumbererPtr(void) const;
 
     int sendData(CommParameters &);
     int recvData(const CommParameters &);
@@ -123,6 +121,8 @@ class DOF_Numberer: public MovableObject, public CommandEntity
     virtual int numberDOF(ID &lastDOF_Groups);
 
     void useAlgorithm(const std::string &);
+    GraphNumberer *getGraphNumbererPtr(void);
+    const GraphNumberer *getGraphNumbererPtr(void) const;
 
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
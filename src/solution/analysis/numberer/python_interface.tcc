@@ -21,8 +21,10 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
+XC::GraphNumberer *(XC::DOF_Numberer::*getGraphNumbererPtr)(void)= &XC::DOF_Numberer::getGraphNumbererPtr;
 class_<XC::DOF_Numberer, bases<XC::MovableObject,CommandEntity>, boost::noncopyable >("DOFNumberer", "A DOF numberer is responsible for assigning the equation numbers to the individual DOFs in each of the DOF groups in the analysis model.",no_init)
     .def("useAlgorithm", &XC::DOF_Numberer::useAlgorithm,return_internal_reference<>(),"\n""useAlgorithm(nmb)""Set the algorithm to be used for numerating the graph \n" "Parameters: \n""nmb: name of the algorithm, 'rcm' for Reverse Cuthill-Macgee or 'simple' for simple algorithm.")
+  .add_property("graphNumberer", make_function(getGraphNumbererPtr, return_internal_reference<>()), "Return the algorithm used to number the graph.")
     ;
 
 // class_<XC::ParallelNumberer, bases<XC::DOF_Numberer>, boost::noncopyable >("ParallelNumberer", no_init);
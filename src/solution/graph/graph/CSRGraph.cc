@@ -0,0 +1,290 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRGraph.cc
+
+#include "CSRGraph.h"
+#include "Graph.h"
+#include "Vertex.h"
+#include "utility/matrix/ID.h"
+#include <algorithm>
+
+//! @brief Constructor.
+XC::CSRGraph::CSRGraph(void)
+  : offsets(1,0) {}
+
+//! @brief Remove all the vertices and edges.
+void XC::CSRGraph::clear(void)
+  {
+    std::vector<int>().swap(vertexTags);
+    offsets.assign(1,0);
+    std::vector<int>().swap(adjacency);
+    std::vector<int>().swap(cliqueOffsets);
+    std::vector<int>().swap(cliqueTags);
+  }
+
+//! @brief Add a vertex with the tag being passed as parameter
+//! (the vertices with repeated tags are ignored).
+void XC::CSRGraph::addVertex(const int &tag)
+  {
+    if(tag>=0)
+      vertexTags.push_back(tag);
+    else
+      std::cerr << "CSRGraph::" << __FUNCTION__
+	        << "; negative tag: " << tag
+		<< " ignored." << std::endl;
+  }
+
+//! @brief Add a clique (all the vertices in the clique are
+//! adjacent to each other), the negative tags are ignored.
+void XC::CSRGraph::addClique(const ID &tags)
+  {
+    if(cliqueOffsets.empty())
+      cliqueOffsets.push_back(0);
+    const int sz= tags.Size();
+    for(int i=0;i<sz;i++)
+      {
+        const int tag= tags(i);
+        if(tag>=0)
+          cliqueTags.push_back(tag);
+      }
+    cliqueOffsets.push_back(cliqueTags.size());
+  }
+
+//! @brief Compute the adjacency of the vertices from the cliques.
+//!
+//! The vertices are sorted by its tag. For each vertex the adjacent
+//! vertices are collected from the cliques the vertex belongs to,
+//! discarding the repeated ones by means of a marker array; then the
+//! adjacency of the vertex is sorted. The memory used to store the
+//! cliques is released.
+void XC::CSRGraph::build(void)
+  {
+    std::sort(vertexTags.begin(),vertexTags.end());
+    vertexTags.erase(std::unique(vertexTags.begin(),vertexTags.end()),vertexTags.end());
+    std::vector<int>(vertexTags).swap(vertexTags);
+    const int numVertex= vertexTags.size();
+
+    // Replace the tags in the cliques by the vertex indexes.
+    bool missing= false;
+    for(std::vector<int>::iterator i= cliqueTags.begin();i!=cliqueTags.end();i++)
+      {
+        *i= getVertexIndex(*i);
+        if(*i<0)
+          missing= true;
+      }
+    if(missing)
+      std::cerr << "CSRGraph::" << __FUNCTION__
+	        << "; WARNING - some of the vertices"
+		<< " of the cliques are not in the graph,"
+		<< " they will be ignored." << std::endl;
+
+    // Cliques of each vertex.
+    const int numCliques= (cliqueOffsets.empty() ? 0 : cliqueOffsets.size()-1);
+    std::vector<int> vertexCliqueOffsets(numVertex+1,0);
+    for(std::vector<int>::const_iterator i= cliqueTags.begin();i!=cliqueTags.end();i++)
+      if(*i>=0)
+        vertexCliqueOffsets[*i+1]++;
+    for(int i=0;i<numVertex;i++)
+      vertexCliqueOffsets[i+1]+= vertexCliqueOffsets[i];
+    std::vector<int> vertexCliques(vertexCliqueOffsets[numVertex]);
+    std::vector<int> pos(vertexCliqueOffsets.begin(),vertexCliqueOffsets.end()-1);
+    for(int c=0;c<numCliques;c++)
+      for(int j= cliqueOffsets[c];j<cliqueOffsets[c+1];j++)
+        {
+          const int v= cliqueTags[j];
+          if(v>=0)
+            vertexCliques[pos[v]++]= c;
+        }
+    std::vector<int>().swap(pos);
+
+    // Adjacency of each vertex.
+    offsets.assign(numVertex+1,0);
+    adjacency.clear();
+    std::vector<int> marker(numVertex,-1);
+    for(int v=0;v<numVertex;v++)
+      {
+        for(int k= vertexCliqueOffsets[v];k<vertexCliqueOffsets[v+1];k++)
+          {
+            const int c= vertexCliques[k];
+            for(int j= cliqueOffsets[c];j<cliqueOffsets[c+1];j++)
+              {
+                const int w= cliqueTags[j];
+                if((w>=0) && (w!=v) && (marker[w]!=v))
+                  {
+                    marker[w]= v;
+                    adjacency.push_back(w);
+                  }
+              }
+          }
+        std::sort(adjacency.begin()+offsets[v],adjacency.end());
+        offsets[v+1]= adjacency.size();
+      }
+    std::vector<int>(adjacency).swap(adjacency); //Release unused capacity.
+    std::vector<int>().swap(cliqueOffsets);
+    std::vector<int>().swap(cliqueTags);
+  }
+
+//! @brief Return the index of the vertex with the tag
+//! being passed as parameter (-1 if there is no such vertex).
+//!
+//! The tags are sorted so the index is found by binary search,
+//! or directly if the tags are consecutive.
+int XC::CSRGraph::getVertexIndex(const int &tag) const
+  {
+    int retval= -1;
+    if(hasConsecutiveTags())
+      {
+        if((tag>=0) && (tag<getNumVertex()))
+          retval= tag;
+      }
+    else
+      {
+        std::vector<int>::const_iterator i= std::lower_bound(vertexTags.begin(),vertexTags.end(),tag);
+        if((i!=vertexTags.end()) && (*i==tag))
+          retval= i-vertexTags.begin();
+      }
+    return retval;
+  }
+
+//! @brief Return true if the vertex tags are 0 through numVertex-1
+//! (i.e. the tag of each vertex is equal to its index).
+bool XC::CSRGraph::hasConsecutiveTags(void) const
+  { return (vertexTags.empty() || (vertexTags.back()==getNumVertex()-1)); }
+
+//! @brief Compute the number of subdiagonals and superdiagonals
+//! of the matrix which sparsity pattern corresponds to the graph.
+void XC::CSRGraph::getBand(int &numSubD,int &numSuperD) const
+  {
+    numSubD= 0;
+    numSuperD= 0;
+    const int numVertex= getNumVertex();
+    for(int v=0;v<numVertex;v++)
+      if(getDegree(v)>0)
+        {
+          const int vertexNum= vertexTags[v];
+          // adjacency is sorted.
+          const int first= vertexNum-vertexTags[*adjacencyBegin(v)];
+          const int last= vertexNum-vertexTags[*(adjacencyEnd(v)-1)];
+          numSuperD= std::max(numSuperD,first);
+          numSubD= std::min(numSubD,last);
+        }
+    numSubD*= -1;
+  }
+
+//! @brief Returns the maximum (positive) of the difference between
+//! vertices tags.
+int XC::CSRGraph::getVertexDiffMaxima(void) const
+  {
+    int numSubD= 0, numSuperD= 0;
+    getBand(numSubD,numSuperD);
+    return numSuperD;
+  }
+
+//! @brief Compute the compressed storage pattern (the same for rows
+//! and columns since the graph is symmetric) of the matrix which
+//! sparsity pattern corresponds to the graph. The vertex tags must be
+//! 0 through numVertex-1 (see hasConsecutiveTags).
+//!
+//! @param starts: position in indexes of the first entry of each
+//! row/column (numVertex+1 entries).
+//! @param indexes: column/row indexes sorted in ascending order.
+//! @param diagonal: if true include the diagonal entries.
+//! @return the number of entries in indexes or -1 if the vertex
+//! tags are not consecutive.
+int XC::CSRGraph::getCompressedPattern(ID &starts, ID &indexes, const bool &diagonal) const
+  {
+    if(!hasConsecutiveTags())
+      {
+        std::cerr << "CSRGraph::" << __FUNCTION__
+	          << "; WARNING - the vertex tags are not consecutive."
+		  << std::endl;
+        return -1;
+      }
+    const int numVertex= getNumVertex();
+    const int nnz= adjacency.size()+(diagonal ? numVertex : 0);
+    if(starts.Size()<numVertex+1)
+      starts.resize(numVertex+1);
+    if(indexes.Size()<nnz)
+      indexes.resize(nnz);
+    int lastLoc= 0;
+    starts(0)= 0;
+    for(int v=0;v<numVertex;v++)
+      {
+        const int *i= adjacencyBegin(v);
+        const int *end= adjacencyEnd(v);
+        if(diagonal)
+          {
+            for(;(i!=end) && (*i<v);i++)
+              indexes(lastLoc++)= *i;
+            indexes(lastLoc++)= v;
+          }
+        for(;i!=end;i++)
+          indexes(lastLoc++)= *i;
+        starts(v+1)= lastLoc;
+      }
+    return lastLoc;
+  }
+
+//! @brief Return the equivalent Graph (for the algorithms that
+//! have not been adapted to the CSR representation).
+XC::Graph XC::CSRGraph::getGraph(void) const
+  {
+    const int numVertex= getNumVertex();
+    Graph retval(numVertex);
+    for(int v=0;v<numVertex;v++)
+      {
+        const int tag= vertexTags[v];
+        retval.addVertex(Vertex(tag,tag),false);
+      }
+    for(int v=0;v<numVertex;v++)
+      for(const int *i= adjacencyBegin(v);i!=adjacencyEnd(v);i++)
+        if(*i>v)
+          retval.addEdge(vertexTags[v],vertexTags[*i]);
+    return retval;
+  }
+
+//! @brief Print stuff.
+void XC::CSRGraph::Print(std::ostream &os) const
+  {
+    const int numVertex= getNumVertex();
+    os << "CSRGraph numVertex: " << numVertex
+       << " numEdge: " << getNumEdge() << std::endl;
+    for(int v=0;v<numVertex;v++)
+      {
+        os << vertexTags[v] << ":";
+        for(const int *i= adjacencyBegin(v);i!=adjacencyEnd(v);i++)
+          os << " " << vertexTags[*i];
+        os << std::endl;
+      }
+  }
+
+//! @brief Inserts the graph into the stream.
+std::ostream &XC::operator<<(std::ostream &os, const CSRGraph &g)
+  {
+    g.Print(os);
+    return os;
+  }
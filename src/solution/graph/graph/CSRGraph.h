@@ -0,0 +1,113 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//CSRGraph.h
+                                                                        
+#ifndef CSRGraph_h
+#define CSRGraph_h
+
+#include <vector>
+#include <iostream>
+
+namespace XC {
+class ID;
+class Graph;
+
+//! @ingroup Graph
+//
+//! @brief Compressed sparse row (CSR) representation of a graph.
+//!
+//! The vertices are identified by its index (0 through numVertex-1)
+//! and sorted by its tag (the equation number in the DOF graph or
+//! the DOF_Group tag in the DOF_Group graph), so the index of a tag
+//! is found by binary search (the tags don't need to be consecutive
+//! and no memory is used in proportion to the largest one). The adjacency of the
+//! vertex i (vertex indexes sorted in ascending order) is stored in
+//! the positions offsets[i] through offsets[i+1]-1 of the adjacency
+//! array (the same layout that METIS calls xadj/adjncy).
+//!
+//! The graph is built from its cliques (i.e. the FE_Element
+//! connectivity): the vertices and the cliques are added first
+//! (addVertex, addClique) and then the adjacency is computed in one
+//! pass (build) using a marker array. This way the graph is
+//! represented by two arrays of integers instead of one std::set
+//! (and one TaggedObject) for each vertex as in the Graph class.
+class CSRGraph
+  {
+  private:
+    std::vector<int> vertexTags; //!< tag of each vertex.
+    std::vector<int> offsets; //!< beginning of the adjacency of each vertex.
+    std::vector<int> adjacency; //!< vertex indexes.
+    std::vector<int> cliqueOffsets; //!< beginning of each clique (only until build is called).
+    std::vector<int> cliqueTags; //!< vertex tags of the cliques (only until build is called).
+
+  public:
+    CSRGraph(void);
+
+    void clear(void);
+    void addVertex(const int &tag);
+    void addClique(const ID &tags);
+    void build(void);
+
+    //! @brief Return the number of vertices.
+    inline int getNumVertex(void) const
+      { return vertexTags.size(); }
+    //! @brief Return the number of edges.
+    inline int getNumEdge(void) const
+      { return adjacency.size()/2; }
+    //! @brief Return the tag of the i-th vertex.
+    inline int getVertexTag(const int &i) const
+      { return vertexTags[i]; }
+    int getVertexIndex(const int &tag) const;
+    //! @brief Return the degree of the i-th vertex.
+    inline int getDegree(const int &i) const
+      { return offsets[i+1]-offsets[i]; }
+    //! @brief Return a pointer to the first adjacent vertex of the i-th vertex.
+    inline const int *adjacencyBegin(const int &i) const
+      { return adjacency.data()+offsets[i]; }
+    //! @brief Return a pointer past the last adjacent vertex of the i-th vertex.
+    inline const int *adjacencyEnd(const int &i) const
+      { return adjacency.data()+offsets[i+1]; }
+    //! @brief Return the beginning of the adjacency of each vertex (METIS xadj).
+    inline const std::vector<int> &getOffsets(void) const
+      { return offsets; }
+    //! @brief Return the adjacency array (METIS adjncy).
+    inline const std::vector<int> &getAdjacency(void) const
+      { return adjacency; }
+
+    bool hasConsecutiveTags(void) const;
+    void getBand(int &,int &) const;
+    int getVertexDiffMaxima(void) const;
+    int getCompressedPattern(ID &, ID &, const bool &) const;
+    Graph getGraph(void) const;
+
+    void Print(std::ostream &os) const;
+  };
+
+std::ostream &operator<<(std::ostream &, const CSRGraph &);
+} // end of XC namespace
+
+#endif
@@ -44,6 +44,7 @@ class BaseNumberer: public GraphNumberer
     inline int getNumVertex(void) const
       { return theRefResult.Size(); }
     bool checkSize(const Graph &);
+    bool checkSize(const CSRGraph &);
   };
 } // end of XC namespace
 
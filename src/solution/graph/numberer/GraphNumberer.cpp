@@ -59,6 +59,8 @@
 
 
 #include "GraphNumberer.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 
 //! @brief Constructor.
 //!
@@ -68,6 +70,26 @@ XC::GraphNumberer::GraphNumberer(int classTag)
   :MovableObject(classTag)
   {}
 
+//! @brief Graph numbering (compressed graph).
+//!
+//! Returns the tags of the vertices in the order of the numbering
+//! (see number(Graph &,int)). The numberers that don't implement
+//! the algorithm on the compressed representation of the graph
+//! number the equivalent Graph object.
+const XC::ID &XC::GraphNumberer::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    Graph tmp= theGraph.getGraph();
+    return number(tmp,lastVertex);
+  }
 
-
-
+//! @brief Graph numbering (compressed graph).
+//!
+//! Returns the tags of the vertices in the order of the numbering
+//! (see number(Graph &,const ID &)). The numberers that don't
+//! implement the algorithm on the compressed representation of the
+//! graph number the equivalent Graph object.
+const XC::ID &XC::GraphNumberer::number(const CSRGraph &theGraph, const ID &lastVertices)
+  {
+    Graph tmp= theGraph.getGraph();
+    return number(tmp,lastVertices);
+  }
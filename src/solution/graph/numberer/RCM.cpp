@@ -61,6 +61,7 @@
 
 #include <solution/graph/numberer/RCM.h>
 #include <solution/graph/graph/Graph.h>
+#include <solution/graph/graph/CSRGraph.h>
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 #include <utility/matrix/ID.h>
@@ -474,11 +475,157 @@ const XC::ID &XC::RCM::number(Graph &theGraph, const ID &startVertices)
     return theRefResult;
   }
 
+//! @brief Reverse Cuthill-McKee ordering of the vertices of the
+//! compressed graph beginning with the vertex whose index is
+//! \p start.
+//!
+//! Same algorithm as number(Graph &,int) using the vertex indexes
+//! and an array of flags instead of the \p tmp variable of the
+//! vertices. On return theRefResult contains the vertex indexes (the
+//! starting vertex in the last position).
+//!
+//! @param theGraph: graph to number.
+//! @param start: index of the starting vertex.
+//! @param profile: sum of the differences between the positions of
+//! each vertex and the vertex from which it was reached.
+//! @return position of the first vertex of the last level set.
+int XC::RCM::cuthill_mckee(const CSRGraph &theGraph, const int &start, int &profile)
+  {
+    const int numVertex= getNumVertex();
+    std::vector<bool> added(numVertex,false);
+    int nextUnvisited= 0; // candidate to restart if the graph is disconnected.
+    int currentMark= numVertex-1;  // marks current vertex visiting.
+    int nextMark= currentMark -1;  // indicates where to put next index in ID.
+    int startLastLevelSet= nextMark;
+    profile= 0;
+    theRefResult(currentMark)= start;
+    added[start]= true;
 
+    // we continue till the ID is full
+    while(nextMark >= 0)
+      {
+        // go through the vertex adjacency and add vertices which
+        // have not yet been added to theRefResult
+        const int v= theRefResult(currentMark);
+        for(const int *i= theGraph.adjacencyBegin(v); i!=theGraph.adjacencyEnd(v); i++)
+          if(!added[*i])
+            {
+              added[*i]= true;
+              profile+= (currentMark - nextMark);
+              theRefResult(nextMark--)= *i;
+            }
 
+        // go to the next vertex
+        //  we decrement because we are doing reverse Cuthill-McKee
+        currentMark--;
 
+        if(startLastLevelSet == currentMark)
+          startLastLevelSet= nextMark;
 
+        // check to see if graph is disconneted
+        if((currentMark == nextMark) && (currentMark >= 0))
+          {
+            while(added[nextUnvisited])
+              nextUnvisited++;
+            nextMark--;
+            startLastLevelSet= nextMark;
+            added[nextUnvisited]= true;
+            theRefResult(currentMark)= nextUnvisited;
+          }
+      }
+    return startLastLevelSet;
+  }
 
+//! @brief Replace the vertex indexes in theRefResult with the vertex tags.
+void XC::RCM::set_vertex_tags(const CSRGraph &theGraph)
+  {
+    const int numVertex= getNumVertex();
+    for(int i=0; i<numVertex; i++)
+      theRefResult(i)= theGraph.getVertexTag(theRefResult(i));
+  }
 
+//! @brief Reverse Cuthill-McKee numbering of the compressed graph
+//! (see number(Graph &,int)). Returns the vertex tags in the order of
+//! the numbering.
+const XC::ID &XC::RCM::number(const CSRGraph &theGraph, int startVertexTag)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph)) 
+      return theRefResult;
 
+    int start= -1;
+    if(startVertexTag != -1)
+      {
+        start= theGraph.getVertexIndex(startVertexTag);
+        if(start<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING: no vertex with tag "
+                      << startVertexTag << " exists - using the first one.\n";
+          }
+      }
+    int profile= 0;
+    if(start<0)
+      {
+        start= 0;
+        // if GPS true use gibbs-poole-stodlmyer determine the last 
+        // level set assuming a starting vertex and then use one of the 
+        // nodes in this set to base the numbering on        
+        if(GPS)
+          {
+            const int startLastLevelSet= cuthill_mckee(theGraph,start,profile);
+            if(startLastLevelSet > 0)
+              {
+                ID lastLevelSet(startLastLevelSet);
+                for(int i=0; i<startLastLevelSet; i++)
+                  lastLevelSet(i)= theGraph.getVertexTag(theRefResult(i));
+                return this->number(theGraph,lastLevelSet);
+              }
+          }
+      }
+    cuthill_mckee(theGraph,start,profile);
+    set_vertex_tags(theGraph);
+    return theRefResult;
+  }
+
+//! @brief Determine the best starting vertex (compressed graph).
+//! 
+//! Performs a RCM numbering using each of the vertices whose tags
+//! are in \p startVertices as starting vertex and returns the
+//! numbering with the smallest profile (see number(Graph &,const ID &)).
+const XC::ID &XC::RCM::number(const CSRGraph &theGraph, const ID &startVertices)
+  {
+    // see if we can do quick return
+    if(!checkSize(theGraph)) 
+      return theRefResult;
+
+    // determine the one that gives the min profile            
+    int minStart= -1;
+    int minProfile= 0;
+    const int startVerticesSize= startVertices.Size();
+    for(int i=0; i<startVerticesSize; i++)
+      {
+        const int start= theGraph.getVertexIndex(startVertices(i));
+        if(start<0)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; WARNING: no vertex with tag "
+                      << startVertices(i) << " exists - ignored.\n";
+            continue;
+          }
+        int profile= 0;
+        cuthill_mckee(theGraph,start,profile);
+        if((minStart<0) || (minProfile > profile))
+          {
+            minStart= start;
+            minProfile= profile;
+          }
+      }
+    if(minStart<0)
+      minStart= 0;
 
+    // we number based on minStart
+    cuthill_mckee(theGraph,minStart,minProfile);
+    set_vertex_tags(theGraph);
+    return theRefResult;
+  }
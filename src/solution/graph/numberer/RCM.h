@@ -80,6 +80,8 @@ class RCM: public BaseNumberer
   {
   private:
     bool GPS; // flag for gibbs-poole-stodlymer
+    int cuthill_mckee(const CSRGraph &, const int &, int &);
+    void set_vertex_tags(const CSRGraph &);
   protected:
     friend class FEM_ObjectBroker;
     friend class DOF_Numberer;
@@ -89,6 +91,8 @@ class RCM: public BaseNumberer
 
     const ID &number(Graph &theGraph, int lastVertex = -1);
     const ID &number(Graph &theGraph, const ID &lastVertices);
+    const ID &number(const CSRGraph &theGraph, int lastVertex = -1);
+    const ID &number(const CSRGraph &theGraph, const ID &lastVertices);
 
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
@@ -87,6 +87,9 @@ class GraphPartitioner
     //! @breif Constructor.
     GraphPartitioner(void) {};
   public:
+    //! @brief Virtual destructor (partitioners are deleted through
+    //! pointers to this class).
+    virtual ~GraphPartitioner(void) {}
     //! @brief Method invoked to partition the graph.
     //!
     //! This is the method invoked to partition the graph into \p numPart
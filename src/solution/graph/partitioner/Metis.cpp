@@ -65,6 +65,7 @@
 
 #include <solution/graph/partitioner/Metis.h>
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
 
@@ -517,6 +518,102 @@ const XC::ID &XC::Metis::number(Graph &theGraph, int lastVertex)
 const XC::ID &XC::Metis::number(Graph &theGraph, const ID &lastVertices)
   { return this->number(theGraph); }
 
+//! @brief Call the METIS routines to partition the graph
+//! given by the xadj and adjncy arrays.
+//!
+//! @param numVertex: number of vertices.
+//! @param xadj: beginning of the adjacency of each vertex.
+//! @param adjncy: adjacency of the vertices.
+//! @param numPart: number of partitions.
+//! @param partition: partition of each vertex (0 through numPart-1).
+int XC::Metis::metis_partition(int numVertex, const int *xadj, const int *adjncy, int numPart, std::vector<int> &partition)
+  {
+    if(checkOptions() == false)
+      return -1;
+    std::vector<int> options(5,0);
+    if(defaultOptions == true) 
+      options[0]= 0;
+    else
+      {
+	options[0]= 1;
+	options[1]= myCoarsenTo;
+	options[2]= myMtype;
+	options[3]= myIPtype;
+	options[4]= myRtype;
+      }
+    partition.assign(numVertex+1,0);
+    int *vwgts= nullptr;
+    int *ewgts= nullptr;
+    int numbering= 0;
+    int weightflag= 0; // no weights on our graphs yet
+    int edgecut= 0;
+    // METIS doesn't modify the graph arrays.
+    int *x= const_cast<int *>(xadj);
+    int *a= const_cast<int *>(adjncy);
+    if(myPtype == 1) 
+      METIS_PartGraphRecursive(&numVertex, x, a, vwgts, ewgts, &weightflag, &numbering, &numPart, &options[0], &edgecut, &partition[0]);
+    else		
+      METIS_PartGraphKway(&numVertex, x, a, vwgts, ewgts, &weightflag, &numbering, &numPart, &options[0], &edgecut, &partition[0]);
+    return 0;
+  }
+
+//! @brief Virtual constructor.
+XC::GraphNumberer *XC::Metis::getCopy(void) const
+  { return new Metis(*this); }
+
+//! @brief Partition the compressed graph into \p numPart partitions.
+//!
+//! The offsets and adjacency arrays of the graph are passed
+//! directly to METIS (no copies are made). On return \p parts
+//! contains the partition (\f$1\f$ through \p numPart) of
+//! each vertex.
+int XC::Metis::partition(const CSRGraph &theGraph, int numPart, ID &parts)
+  {
+    const int numVertex= theGraph.getNumVertex();
+    std::vector<int> partition;
+    int retval= 0;
+    if(numVertex>0)
+      retval= metis_partition(numVertex, theGraph.getOffsets().data(), theGraph.getAdjacency().data(), numPart, partition);
+    if(retval==0)
+      {
+        parts.resize(numVertex);
+        for(int i=0; i<numVertex; i++)
+          parts(i)= partition[i]+1; // start colors at 1
+      }
+    return retval;
+  }
+
+//! @brief Number the vertices of the compressed graph so the vertices
+//! in partition i are assigned a number less than those in
+//! partition i+1. Returns the vertex tags in the order of the numbering.
+const XC::ID &XC::Metis::number(const CSRGraph &theGraph, int lastVertex)
+  {
+    const int numVertex= theGraph.getNumVertex();
+    theRefResult.resize(numVertex);
+    if(numVertex==0)
+      return theRefResult;
+    std::vector<int> partition;
+    if(metis_partition(numVertex, theGraph.getOffsets().data(), theGraph.getAdjacency().data(), numPartitions, partition) != 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "ERROR: chek options failed\n";
+        return theRefResult;
+      }
+    // counting sort by partition (the numbering within
+    // a partition follows the vertex tags).
+    std::vector<int> first(numPartitions+1,0);
+    for(int vert=0; vert<numVertex; vert++)
+      first[partition[vert]+1]++;
+    for(int i=0; i<numPartitions; i++)
+      first[i+1]+= first[i];
+    for(int vert=0; vert<numVertex; vert++)
+      theRefResult(first[partition[vert]]++)= theGraph.getVertexTag(vert);
+    return theRefResult;
+  }
+
+const XC::ID &XC::Metis::number(const CSRGraph &theGraph, const ID &lastVertices)
+  { return this->number(theGraph); }
+
 int XC::Metis::sendSelf(CommParameters &cp)
   { return 0; }
 
@@ -66,6 +66,7 @@
 
 #include "solution/graph/partitioner/GraphPartitioner.h"
 #include "solution/graph/numberer/GraphNumberer.h"
+#include <vector>
 
 namespace XC {
 //! @ingroup Graph
@@ -176,6 +177,9 @@ class Metis : public GraphPartitioner, public GraphNumberer
     int numPartitions; //!< needed if to be used as a numberer
     ID theRefResult;
 
+    int metis_partition(int, const int *, const int *, int, std::vector<int> &);
+
+    friend class PartitionedDomain;
     Metis(int numParts =1);
     Metis(int Ptype, 
 	  int Mtype, 
@@ -183,6 +187,7 @@ class Metis : public GraphPartitioner, public GraphNumberer
 	  int Rtype, 
 	  int IPtype,
 	  int numParts =1);
+    GraphNumberer *getCopy(void) const;
   public:
     bool setOptions(int Ptype, 
 		    int Mtype,
@@ -193,6 +198,8 @@ class Metis : public GraphPartitioner, public GraphNumberer
     
     int partitionHexMesh(int* elmnts, int* epart, int* npart, int ne, int nn, int nparts, bool whichToUse);
     int partition(Graph &theGraph, int numPart);
+    int partition(const CSRGraph &theGraph, int numPart, ID &);
+    static int nodeND(int, const int *, const int *, std::vector<int> &, std::vector<int> &);
     int partitionGraph(int *nvtxs, int *xadj, int *adjncy, int *vwgt, 
 		       int *adjwgt, int *wgtflag, int *numflag, int *nparts, 
 		       int *options, int *edgecut, int *part, bool whichToUse);
@@ -200,6 +207,8 @@ class Metis : public GraphPartitioner, public GraphNumberer
     // the follwing methods are if the object is to be used as a numberer
     const ID &number(Graph &theGraph, int lastVertex = -1);
     const ID &number(Graph &theGraph, const ID &lastVertices);
+    const ID &number(const CSRGraph &theGraph, int lastVertex = -1);
+    const ID &number(const CSRGraph &theGraph, const ID &lastVertices);
 
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
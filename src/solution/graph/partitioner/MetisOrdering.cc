@@ -0,0 +1,92 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MetisOrdering.cc
+
+// The declarations of the partitioning routines used in Metis.cpp
+// follow the METIS 4 API. The ordering routine takes its prototype
+// from metis.h so it works with both versions of the library.
+
+#include <solution/graph/partitioner/Metis.h>
+#include <iostream>
+extern "C" {
+#include <metis.h>
+}
+
+#if defined(METIS_VER_MAJOR) && (METIS_VER_MAJOR >= 5)
+typedef idx_t metis_int;
+#else
+typedef idxtype metis_int;
+#endif
+
+//! @brief Compute a fill reducing ordering of the graph given
+//! by the xadj and adjncy arrays using the nested dissection
+//! algorithm of METIS (METIS_NodeND).
+//!
+//! @param numVertex: number of vertices.
+//! @param xadj: beginning of the adjacency of each vertex.
+//! @param adjncy: adjacency of the vertices (without the vertex itself).
+//! @param perm: on return, vertex placed at each position of the
+//!              ordering (i.e. the row \f$i\f$ of the permuted matrix is
+//!              the row perm[i] of the original one).
+//! @param iperm: on return, position of each vertex in the ordering.
+int XC::Metis::nodeND(int numVertex, const int *xadj, const int *adjncy, std::vector<int> &perm, std::vector<int> &iperm)
+  {
+    perm.resize(numVertex);
+    iperm.resize(numVertex);
+    if(numVertex<1)
+      return 0;
+    std::vector<metis_int> x(xadj,xadj+numVertex+1);
+    std::vector<metis_int> a(adjncy,adjncy+xadj[numVertex]);
+    std::vector<metis_int> p(numVertex,0), ip(numVertex,0);
+    if(a.empty()) // METIS doesn't like empty arrays.
+      a.push_back(0);
+#if defined(METIS_VER_MAJOR) && (METIS_VER_MAJOR >= 5)
+    metis_int n= numVertex;
+    metis_int options[METIS_NOPTIONS];
+    METIS_SetDefaultOptions(options);
+    options[METIS_OPTION_NUMBERING]= 0;
+    const int status= METIS_NodeND(&n, &x[0], &a[0], nullptr, options, &p[0], &ip[0]);
+    if(status != METIS_OK)
+      {
+        std::cerr << "Metis::" << __FUNCTION__
+		  << "; ERROR: METIS_NodeND returned "
+		  << status << std::endl;
+        return -1;
+      }
+#else
+    int n= numVertex;
+    int numbering= 0;
+    int options[8]= {0,0,0,0,0,0,0,0}; // default options.
+    METIS_NodeND(&n, &x[0], &a[0], &numbering, options, &p[0], &ip[0]);
+#endif
+    for(int i= 0;i<numVertex;i++)
+      {
+        perm[i]= p[i];
+        iperm[i]= ip[i];
+      }
+    return 0;
+  }
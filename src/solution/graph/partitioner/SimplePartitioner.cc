@@ -0,0 +1,61 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SimplePartitioner.cc
+
+#include "solution/graph/partitioner/SimplePartitioner.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/Vertex.h"
+#include "solution/graph/graph/VertexIter.h"
+#include <iostream>
+
+//! @brief Constructor.
+XC::SimplePartitioner::SimplePartitioner(void)
+  : GraphPartitioner() {}
+
+//! @brief Colors the vertices of the graph with the colors
+//! 1 through \p numPart, assigning consecutive vertices to
+//! the same partition. Returns 0 if successful, -1 otherwise.
+int XC::SimplePartitioner::partition(Graph &theGraph, int numPart)
+  {
+    const int numVertex= theGraph.getNumVertex();
+    if((numPart<1) || (numPart>numVertex))
+      {
+        std::cerr << "SimplePartitioner::" << __FUNCTION__
+                  << "; can't split " << numVertex
+                  << " vertices in " << numPart << " partitions.\n";
+        return -1;
+      }
+    VertexIter &theVertices= theGraph.getVertices();
+    Vertex *vertexPtr= nullptr;
+    int count= 0;
+    while((vertexPtr= theVertices()) != nullptr)
+      {
+        vertexPtr->setColor(1+(count*numPart)/numVertex);
+        count++;
+      }
+    return 0;
+  }
@@ -0,0 +1,52 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SimplePartitioner.h
+
+#ifndef SimplePartitioner_h
+#define SimplePartitioner_h
+
+#include "solution/graph/partitioner/GraphPartitioner.h"
+
+namespace XC {
+//! @ingroup Graph
+//
+//! @brief Partitions the vertices of a graph in blocks.
+//!
+//! The vertices are colored in the order the graph VertexIter
+//! returns them: the first \f$n/numPart\f$ vertices get the color 1,
+//! the next ones the color 2 and so on. It doesn't need any external
+//! library so it's the partitioner used by default (see
+//! PartitionedDomain::partition).
+class SimplePartitioner: public GraphPartitioner
+  {
+  public:
+    SimplePartitioner(void);
+    int partition(Graph &theGraph, int numPart);
+  };
+} // end of XC namespace
+
+#endif
@@ -0,0 +1,54 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//python_interface.tcc
+
+class_<XC::Graph, bases<XC::MovableObject> >("Graph", "Collection of vertices and edges.")
+  .add_property("numVertex", &XC::Graph::getNumVertex, "Return the number of vertices.")
+  .add_property("numEdge", &XC::Graph::getNumEdge, "Return the number of edges.")
+  .def("getVertexDiffMaxima", &XC::Graph::getVertexDiffMaxima, "Return the maximum difference between the tags of two adjacent vertices (band of the graph).")
+  ;
+
+class_<XC::CSRGraph>("CSRGraph", "Graph stored in compressed sparse row format.")
+  .def("addVertex", &XC::CSRGraph::addVertex, "addVertex(tag): add a vertex to the graph.")
+  .def("addClique", &XC::CSRGraph::addClique, "addClique(tags): connect all the vertices in the list with each other.")
+  .def("build", &XC::CSRGraph::build, "Build the compressed adjacency arrays.")
+  .add_property("numVertex", &XC::CSRGraph::getNumVertex, "Return the number of vertices.")
+  .add_property("numEdge", &XC::CSRGraph::getNumEdge, "Return the number of edges.")
+  .def("getVertexTag", &XC::CSRGraph::getVertexTag, "getVertexTag(i): return the tag of the i-th vertex.")
+  .def("getVertexIndex", &XC::CSRGraph::getVertexIndex, "getVertexIndex(tag): return the index of the vertex with the tag argument.")
+  .def("getDegree", &XC::CSRGraph::getDegree, "getDegree(i): return the number of vertices adjacent to the i-th vertex.")
+  .def("getVertexDiffMaxima", &XC::CSRGraph::getVertexDiffMaxima, "Return the maximum difference between the tags of two adjacent vertices (band of the graph).")
+  .def("hasConsecutiveTags", &XC::CSRGraph::hasConsecutiveTags, "Return true if the vertex tags are 0,1,...,numVertex-1.")
+  .def("getGraph", &XC::CSRGraph::getGraph, "Return the equivalent Graph object.")
+  ;
+
+const XC::ID &(XC::GraphNumberer::*numberGraph)(XC::Graph &,int)= &XC::GraphNumberer::number;
+const XC::ID &(XC::GraphNumberer::*numberCSRGraph)(const XC::CSRGraph &,int)= &XC::GraphNumberer::number;
+class_<XC::GraphNumberer, bases<XC::MovableObject,CommandEntity>, boost::noncopyable >("GraphNumberer", "Base class for the graph numbering algorithms.", no_init)
+  .def("numberGraph", numberGraph, return_value_policy<copy_const_reference>(), "numberGraph(graph,lastVertex): number the vertices of the graph, return the vertex tags in the new order.")
+  .def("numberCSRGraph", numberCSRGraph, return_value_policy<copy_const_reference>(), "numberCSRGraph(graph,lastVertex): number the vertices of the compressed graph, return the vertex tags in the new order.")
+  ;
@@ -63,6 +63,7 @@
 #include <solution/analysis/model/AnalysisModel.h>
 #include "solution/AnalysisAggregation.h"
 #include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 
 //! @brief Constructor. The integer \p classTag is provided to
 //! the constructor for the base class MovableObject.
@@ -80,6 +81,17 @@ XC::AnalysisAggregation *XC::SystemOfEqn::getAnalysisAggregation(void)
 const XC::AnalysisAggregation *XC::SystemOfEqn::getAnalysisAggregation(void) const
   { return dynamic_cast<const AnalysisAggregation *>(Owner()); }
 
+//! @brief Returns a pointer to the thread pool of the solution method
+//! (nullptr if the computation is serial).
+XC::ThreadPool *XC::SystemOfEqn::getThreadPool(void)
+  {
+    ThreadPool *retval= nullptr;
+    AnalysisAggregation *aggregation= getAnalysisAggregation();
+    if(aggregation)
+      retval= aggregation->getThreadPool();
+    return retval;
+  }
+
 //! @brief Returns a const pointer to the analysis model.
 const XC::AnalysisModel *XC::SystemOfEqn::getAnalysisModelPtr(void) const
   {
@@ -106,3 +118,13 @@ int XC::SystemOfEqn::checkSize(Graph &theGraph) const
     return retval;
   }
 
+//! @brief Check number of DOFs in the graph.
+int XC::SystemOfEqn::checkSize(const CSRGraph &theGraph) const
+  {
+    const int retval= theGraph.getNumVertex();
+    if(retval==0)
+      std::cerr << "WARNING! " << getClassName() << "::" << __FUNCTION__
+	        << "; model has zero DOFs, add nodes or reduce constraints." << std::endl;
+    return retval;
+  }
+
@@ -70,9 +70,11 @@
 
 namespace XC {
 class Graph;
+class CSRGraph;
 class AnalysisModel;
 class FEM_ObjectBroker;
 class AnalysisAggregation;
+class ThreadPool;
 
 //!  @ingroup Solu
 //! 
@@ -101,6 +103,8 @@ class SystemOfEqn: public MovableObject, public CommandEntity
   public:
     inline virtual ~SystemOfEqn(void) {}
     int checkSize(Graph &theGraph) const;
+    int checkSize(const CSRGraph &theGraph) const;
+    ThreadPool *getThreadPool(void);
     //! @brief Invoked to cause the system of equation object to solve
     //! itself. To return 0 if successful, negative number if not.
     virtual int solve(void)= 0;
@@ -48,6 +48,7 @@
 #include <solution/system_of_eqn/eigenSOE/BandArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/BandArpackppSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymArpackSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SparseArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSolver.h>
 
@@ -123,6 +124,8 @@ XC::EigenSolver &XC::EigenSOE::newSolver(const std::string &type)
       setSolver(new FullGenEigenSolver());
     else if(type=="sym_arpack_solver")
       setSolver(new SymArpackSolver());
+    else if(type=="sparse_arpack_solver")
+      setSolver(new SparseArpackSolver());
     else
       std::cerr << "Solver of type: '"
                 << type << "' unknown." << std::endl;
@@ -265,6 +268,41 @@ XC::Vector XC::EigenSOE::getModalParticipationFactors(void) const
     return retval;
   }
 
+//! @brief Returns the modal participation factors for the influence
+//! vector being passed as parameter (i.e. the vector that has a one
+//! in the equations that correspond to the direction of the
+//! ground motion and zero elsewhere).
+//! @param r: influence vector (one component for each equation).
+XC::Vector XC::EigenSOE::getModalParticipationFactors(const Vector &r) const
+  {
+    const int nm= getNumModes();
+    Vector retval(nm);
+    const size_t sz= r.Size();
+    if((massMatrix.size1()!=sz) || (massMatrix.size2()!=sz))
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; ERROR the influence vector has dimension " << sz
+                  << " and the mass matrix " << massMatrix.size1()
+                  << "x" << massMatrix.size2() << ".\n";
+        return retval;
+      }
+    boost::numeric::ublas::vector<double> J(sz);
+    for(size_t i= 0;i<sz;i++)
+      J(i)= r(i);
+    const boost::numeric::ublas::vector<double> MJ= prod(massMatrix,J); // computed once for all the modes.
+    boost::numeric::ublas::vector<double> fi_mode(sz);
+    for(int m= 1;m<=nm;m++)
+      {
+        const Vector &ev= getEigenvector(m);
+        for(size_t i= 0;i<sz;i++)
+          fi_mode(i)= ev(i);
+        const double num= boost::numeric::ublas::inner_prod(fi_mode,MJ);
+        const double denom= boost::numeric::ublas::inner_prod(fi_mode,prod(massMatrix,fi_mode));
+        retval[m-1]= num/denom;
+      }
+    return retval;
+  }
+
 //! @brief Returns the distribution factors for the i-th mode.
 XC::Vector XC::EigenSOE::getDistributionFactor(int i) const
   { return getModalParticipationFactor(i)*getEigenvector(i); }
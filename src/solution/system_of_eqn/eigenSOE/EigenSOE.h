@@ -114,6 +114,7 @@ class EigenSOE : public SystemOfEqn
     //Modal participation factors.
     virtual double getModalParticipationFactor(int mode) const;
     Vector getModalParticipationFactors(void) const;
+    Vector getModalParticipationFactors(const Vector &) const;
 
     //Distribution factors.
     Vector getDistributionFactor(int mode) const;
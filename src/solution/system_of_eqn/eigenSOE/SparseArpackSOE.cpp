@@ -0,0 +1,258 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseArpackSOE.cpp
+
+#include <solution/system_of_eqn/eigenSOE/SparseArpackSOE.h>
+#include <solution/system_of_eqn/eigenSOE/SparseArpackSolver.h>
+#include <utility/matrix/Matrix.h>
+#include <solution/graph/graph/Graph.h>
+#include <solution/graph/graph/Vertex.h>
+#include <vector>
+#include <algorithm>
+
+//! @brief Constructor.
+XC::SparseArpackSOE::SparseArpackSOE(AnalysisAggregation *owr, double theShift)
+  :ArpackSOE(owr,EigenSOE_TAGS_SparseArpackSOE,theShift), nnz(0),
+   scatterMaps(SparseScatterMaps::COLUMN_COMPRESSED), massMatrixUpdated(false)
+  { scatterMaps.setActive(true); }
+
+//! @brief Set the solver.
+bool XC::SparseArpackSOE::setSolver(EigenSolver *newSolver)
+  {
+    bool retval= false;
+    SparseArpackSolver *tmp= dynamic_cast<SparseArpackSolver *>(newSolver);
+    if(tmp)
+      {
+        tmp->setEigenSOE(*this);
+        retval= ArpackSOE::setSolver(tmp);
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; incompatible solver." << std::endl;
+    return retval;
+  }
+
+//! @brief Compute the sparsity pattern of the matrices from
+//! the graph (each vertex corresponds to an equation).
+int XC::SparseArpackSOE::setSize(Graph &theGraph)
+  {
+    int result = 0;
+    size= checkSize(theGraph);
+
+    // count the non-zero coefficients.
+    nnz= 0;
+    for(int a= 0;a<size;a++)
+      {
+        const Vertex *theVertex= theGraph.getVertexPtr(a);
+        if(!theVertex)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING: vertex " << a
+		      << " not in graph! - size set to 0.\n";
+	    size= 0;
+	    return -1;
+          }
+        nnz+= theVertex->getAdjacency().size()+1; // the +1 is for the diag entry
+      }
+    scatterMaps.clear(); // sparsity pattern changed.
+    rowA.resize(nnz);
+    colStartA.resize(size+1);
+    A.resize(nnz);
+    A.Zero();
+    M.resize(nnz);
+    M.Zero();
+    factored= false;
+    massMatrixUpdated= false;
+
+    // fill in colStartA and rowA (row indexes sorted in each column).
+    int lastLoc= 0;
+    colStartA(0)= 0;
+    std::vector<int> rows;
+    for(int a= 0;a<size;a++)
+      {
+        const std::set<int> &theAdjacency= theGraph.getVertexPtr(a)->getAdjacency();
+        rows.assign(theAdjacency.begin(),theAdjacency.end());
+        rows.insert(std::lower_bound(rows.begin(),rows.end(),a),a);
+        for(std::vector<int>::const_iterator i= rows.begin();i!=rows.end();i++)
+          rowA(lastLoc++)= *i;
+        colStartA(a+1)= lastLoc;
+      }
+
+    // invoke setSize() on the solver
+    EigenSolver *theSolvr= this->getSolver();
+    const int solverOK= theSolvr->setSize();
+    if(solverOK < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING: solver failed setSize()\n";
+        return solverOK;
+      }
+    return result;
+  }
+
+//! @brief Assemble the matrix into the stiffness matrix.
+int XC::SparseArpackSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return
+    if(fact == 0.0)  return 0;
+    factored= false;
+    return scatterMaps.addA(A,colStartA,rowA,size,m,id,fact);
+  }
+
+//! @brief Assemble the matrix into the mass matrix.
+int XC::SparseArpackSOE::addM(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return
+    if(fact == 0.0)  return 0;
+    factored= false;
+    massMatrixUpdated= false;
+    return scatterMaps.addA(M,colStartA,rowA,size,m,id,fact);
+  }
+
+//! @brief Zeroes the stiffness matrix.
+void XC::SparseArpackSOE::zeroA(void)
+  {
+    A.Zero();
+    factored= false;
+  }
+
+//! @brief Zeroes the mass matrix.
+void XC::SparseArpackSOE::zeroM(void)
+  {
+    EigenSOE::zeroM();
+    M.Zero();
+    factored= false;
+    massMatrixUpdated= false;
+  }
+
+//! @brief Makes M the identity matrix (to find stiffness matrix eigenvalues).
+void XC::SparseArpackSOE::identityM(void)
+  {
+    M.Zero();
+    for(int col= 0;col<size;col++)
+      for(int k= colStartA(col);k<colStartA(col+1);k++)
+        if(rowA(k)==col)
+          {
+            M(k)= 1.0;
+            break;
+          }
+    factored= false;
+    massMatrixUpdated= false;
+  }
+
+//! @brief Copy the coefficients of M into the (boost) mass matrix
+//! used to compute the modal participation factors, effective
+//! masses,...
+void XC::SparseArpackSOE::update_mass_matrix(void)
+  {
+    if(!massMatrixUpdated)
+      {
+        massMatrix= sparse_matrix(size,size,nnz);
+        for(int col= 0;col<size;col++)
+          for(int k= colStartA(col);k<colStartA(col+1);k++)
+            if(M(k)!=0.0)
+              massMatrix(rowA(k),col)= M(k);
+        massMatrixUpdated= true;
+      }
+  }
+
+//! @brief Solve the eigenproblem for the number of modes being
+//! passed as parameter.
+int XC::SparseArpackSOE::solve(int numModes)
+  {
+    update_mass_matrix();
+    return ArpackSOE::solve(numModes);
+  }
+
+//! @brief Compute y= A*x.
+void XC::SparseArpackSOE::mulA(const double *x, double *y) const
+  {
+    std::fill(y,y+size,0.0);
+    for(int col= 0;col<size;col++)
+      {
+        const double xc= x[col];
+        if(xc!=0.0)
+          for(int k= colStartA(col);k<colStartA(col+1);k++)
+            y[rowA(k)]+= A(k)*xc;
+      }
+  }
+
+//! @brief Compute y= M*x.
+void XC::SparseArpackSOE::mulM(const double *x, double *y) const
+  {
+    std::fill(y,y+size,0.0);
+    for(int col= 0;col<size;col++)
+      {
+        const double xc= x[col];
+        if(xc!=0.0)
+          for(int k= colStartA(col);k<colStartA(col+1);k++)
+            y[rowA(k)]+= M(k)*xc;
+      }
+  }
+
+//! @brief Compute Y= C*X where C is one of the stored matrices and
+//! X has one vector on each column. Each coefficient of C is
+//! read only once for all the vectors.
+void XC::SparseArpackSOE::mul(const Vector &C, const Matrix &X, Matrix &Y) const
+  {
+    const int nv= X.noCols();
+    if(X.noRows()!=size)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the number of rows of the matrix ("
+		  << X.noRows() << ") doesn't match the number of equations ("
+		  << size << ").\n";
+        return;
+      }
+    if((Y.noRows()!=size) || (Y.noCols()!=nv))
+      Y.resize(size,nv);
+    Y.Zero();
+    const double *x= X.getDataPtr();
+    double *y= Y.getDataPtr();
+    for(int col= 0;col<size;col++)
+      for(int k= colStartA(col);k<colStartA(col+1);k++)
+        {
+          const double c= C(k);
+          const int row= rowA(k);
+          for(int v= 0;v<nv;v++)
+            y[v*size+row]+= c*x[v*size+col];
+        }
+  }
+
+//! @brief Compute Y= A*X for all the vectors (columns) of X.
+void XC::SparseArpackSOE::mulA(const Matrix &X, Matrix &Y) const
+  { mul(A,X,Y); }
+
+//! @brief Compute Y= M*X for all the vectors (columns) of X.
+void XC::SparseArpackSOE::mulM(const Matrix &X, Matrix &Y) const
+  { mul(M,X,Y); }
+
+int XC::SparseArpackSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::SparseArpackSOE::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,99 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseArpackSOE.h
+
+#ifndef SparseArpackSOE_h
+#define SparseArpackSOE_h
+
+#include <solution/system_of_eqn/eigenSOE/ArpackSOE.h>
+#include <solution/system_of_eqn/linearSOE/SparseScatterMaps.h>
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/ID.h"
+
+namespace XC {
+class SparseArpackSolver;
+
+//! @ingroup EigenSOE
+//
+//! @brief Sparse system of equations for eigenproblems.
+//!
+//! The stiffness matrix K and the mass matrix M are stored in
+//! compressed column format sharing the same sparsity pattern
+//! (obtained from the DOF graph), so the memory needed grows
+//! with the number of non-zero coefficients instead of with
+//! the bandwidth or the profile of the matrix.
+class SparseArpackSOE: public ArpackSOE
+  {
+  private:
+    int nnz; //!< number of non-zero coefficients.
+    Vector A; //!< stiffness matrix coefficients.
+    Vector M; //!< mass matrix coefficients.
+    ID rowA; //!< row index of each coefficient.
+    ID colStartA; //!< start of each column in A and M.
+    SparseScatterMaps scatterMaps; //!< positions of the element coefficients.
+    bool massMatrixUpdated; //!< true if massMatrix matches M.
+
+    void update_mass_matrix(void);
+    void mul(const Vector &, const Matrix &, Matrix &) const;
+  protected:
+    bool setSolver(EigenSolver *);
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    SparseArpackSOE(AnalysisAggregation *, double shift = 0.0);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    virtual int setSize(Graph &theGraph);
+    
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+    virtual int addM(const Matrix &, const ID &, double fact = 1.0);
+   
+    virtual void zeroA(void);
+    virtual void zeroM(void);
+    virtual void identityM(void);
+
+    virtual int solve(int numModes);
+
+    //! @brief Return the number of non-zero coefficients.
+    inline const int &getNNZ(void) const
+      { return nnz; }
+    void mulA(const double *, double *) const;
+    void mulM(const double *, double *) const;
+    void mulA(const Matrix &, Matrix &) const;
+    void mulM(const Matrix &, Matrix &) const;
+    
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+
+    friend class SparseArpackSolver;
+  };
+inline SystemOfEqn *SparseArpackSOE::getCopy(void) const
+  { return new SparseArpackSOE(*this); }
+} // end of XC namespace
+
+
+#endif
@@ -0,0 +1,473 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseArpackSolver.cpp
+
+#include <solution/system_of_eqn/eigenSOE/SparseArpackSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SparseArpackSOE.h>
+#include <utility/matrix/Matrix.h>
+#include <cmath>
+#include <algorithm>
+#include "xc_basic/src/util/mchne_eps.h"
+
+extern "C" int dsaupd_(int *ido, char* bmat, int *n, char *which, int *nev,
+                       double *tol, double *resid, int *ncv, double *v, int *ldv,
+                       int *iparam, int *ipntr, double *workd, double *workl,
+                       int *lworkl, int *info);
+
+extern "C" int dseupd_(bool *rvec, char *howmny, long int *select, double *d, double *z,
+                       int *ldz, double *sigma, char *bmat, int *n, char *which,
+                       int *nev, double *tol, double *resid, int *ncv, double *v,
+                       int *ldv, int *iparam, int *ipntr, double *workd,
+                       double *workl, int *lworkl, int *info);
+
+//! @brief Constructor.
+XC::SparseArpackSolver::SparseArpackSolver(int numE)
+  :EigenSolver(EigenSOLVER_TAGS_SparseArpackSolver,numE), theSOE(nullptr),
+   tol(mchne_eps_dbl), maxitr(1000)
+  {
+    set_default_options(&options);
+    // K - shift*M is symmetric: minimum degree ordering on A'+A
+    // and preference for the diagonal pivots.
+    options.ColPerm= MMD_AT_PLUS_A;
+    options.SymmetricMode= YES;
+    options.DiagPivotThresh= 0.001;
+    options.PrintStat= NO;
+    AS.ncol= 0;
+    AC.ncol= 0;
+    L.ncol= 0;
+    U.ncol= 0;
+  }
+
+//! @brief Copy constructor (the factorization is not copied).
+XC::SparseArpackSolver::SparseArpackSolver(const SparseArpackSolver &other)
+  :EigenSolver(other), theSOE(nullptr), tol(other.tol),
+   maxitr(other.maxitr), options(other.options)
+  {
+    AS.ncol= 0;
+    AC.ncol= 0;
+    L.ncol= 0;
+    U.ncol= 0;
+  }
+
+XC::SparseArpackSolver &XC::SparseArpackSolver::operator=(const SparseArpackSolver &other)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+	      << "; ERROR assignment operator not implemented."
+              << std::endl;
+    return *this;
+  }
+
+//! @brief Virtual constructor.
+XC::EigenSolver *XC::SparseArpackSolver::getCopy(void) const
+   { return new SparseArpackSolver(*this); }
+
+//! @brief Destructor.
+XC::SparseArpackSolver::~SparseArpackSolver(void)
+  { free_matrices(); }
+
+//! @brief Release the memory used by SuperLU.
+void XC::SparseArpackSolver::free_matrices(void)
+  {
+    if(L.ncol!=0)
+      {
+        Destroy_SuperNode_Matrix(&L);
+        L.ncol= 0;
+      }
+    if(U.ncol!=0)
+      {
+        Destroy_CompCol_Matrix(&U);
+        U.ncol= 0;
+      }
+    if(AC.ncol!=0)
+      {
+        Destroy_CompCol_Permuted(&AC);
+        AC.ncol= 0;
+      }
+    if(AS.ncol!=0)
+      {
+        Destroy_SuperMatrix_Store(&AS);
+        AS.ncol= 0;
+      }
+  }
+
+//! @brief Factorize the matrix (K - shift*M).
+int XC::SparseArpackSolver::factorize(void)
+  {
+    free_matrices();
+    int n= theSOE->size;
+    int nnz= theSOE->nnz;
+    const double sigma= theSOE->shift;
+    Ashift= theSOE->A;
+    if(sigma!=0.0)
+      Ashift.addVector(1.0,theSOE->M,-sigma);
+
+    dCreate_CompCol_Matrix(&AS, n, n, nnz, Ashift.getDataPtr(), theSOE->rowA.getDataPtr(), theSOE->colStartA.getDataPtr(), SLU_NC, SLU_D, SLU_GE);
+    get_perm_c(options.ColPerm, &AS, perm_c.getDataPtr());
+    sp_preorder(&options, &AS, perm_c.getDataPtr(), etree.getDataPtr(), &AC);
+
+    int info= 0;
+    SuperLUStat_t slu_stat;
+    GlobalLU_t global_lu_t;
+    StatInit(&slu_stat);
+    const int panelSize= sp_ienv(1);
+    const int relax= sp_ienv(2);
+    dgstrf(&options, &AC, relax, panelSize, etree.getDataPtr(), nullptr, 0, perm_c.getDataPtr(), perm_r.getDataPtr(), &L, &U, &global_lu_t, &slu_stat, &info);
+    StatFree(&slu_stat);
+    if(info != 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - error " << info
+		  << " returned in factorization dgstrf()"
+	          << " (is the shift an eigenvalue?)\n";
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Overwrite x with the solution of (K - shift*M) y= x.
+int XC::SparseArpackSolver::back_substitution(double *x)
+  {
+    const int n= theSOE->size;
+    SuperMatrix B;
+    dCreate_Dense_Matrix(&B, n, 1, x, n, SLU_DN, SLU_D, SLU_GE);
+    int info= 0;
+    SuperLUStat_t slu_stat;
+    StatInit(&slu_stat);
+    dgstrs(NOTRANS, &L, &U, perm_c.getDataPtr(), perm_r.getDataPtr(), &B, &slu_stat, &info);
+    StatFree(&slu_stat);
+    Destroy_SuperMatrix_Store(&B);
+    if(info != 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - error " << info
+		  << " returned in substitution dgstrs()\n";
+        return -1;
+      }
+    return 0;
+  }
+
+//! @brief Compute the relative residuals of the eigenpairs. The
+//! products K*V and M*V are computed for blocks of eigenvectors
+//! so each coefficient of the matrices is read once per block.
+void XC::SparseArpackSolver::compute_residuals(void)
+  {
+    const int n= theSOE->size;
+    const int nev= value.Size();
+    const int blockSize= 16;
+    residuals.resize(nev);
+    Matrix V, KV, MV;
+    for(int first= 0;first<nev;first+= blockSize)
+      {
+        const int nv= std::min(blockSize,nev-first);
+        V.resize(n,nv);
+        std::copy(eigenvector.getDataPtr()+first*n,eigenvector.getDataPtr()+(first+nv)*n,V.getDataPtr());
+        theSOE->mulA(V,KV);
+        theSOE->mulM(V,MV);
+        for(int j= 0;j<nv;j++)
+          {
+            const double lambda= value(first+j);
+            double num= 0.0, denom= 0.0;
+            for(int i= 0;i<n;i++)
+              {
+                const double kv= KV(i,j);
+                const double r= kv-lambda*MV(i,j);
+                num+= r*r;
+                denom+= kv*kv;
+              }
+            residuals(first+j)= (denom>0.0 ? sqrt(num/denom) : sqrt(num));
+          }
+      }
+  }
+
+void XC::SparseArpackSolver::print_err_info(int info)
+  {
+     switch(info)
+       {
+       case -1:
+         std::cerr << "N must be positive.\n";
+         break;
+       case -2:
+         std::cerr << "NEV must be positive.\n";
+         break;
+       case -3:
+         std::cerr << "NCV must be greater than NEV and less than or equal to N.\n";
+         break;
+       case -4:
+         std::cerr << "The maximum number of Arnoldi update iterations allowed";
+         break;
+       case -5:
+         std::cerr << "WHICH must be one of 'LM', 'SM', 'LA', 'SA' or 'BE'.\n";
+         break;
+       case -6:
+         std::cerr << "BMAT must be one of 'I' or 'G'.\n";
+         break;
+       case -7:
+         std::cerr << "Length of private work array WORKL is not sufficient.\n";
+         break;
+       case -8:
+         std::cerr << "Error return from trid. eigenvalue calculation";
+         std::cerr << "Informatinal error from LAPACK routine dsteqr.\n";
+         break;
+       case -9:
+         std::cerr << "Starting vector is zero.\n";
+         break;
+       case -10:
+         std::cerr << "IPARAM(7) must be 1,2,3,4,5.\n";
+         break;
+       case -11:
+         std::cerr << "IPARAM(7) = 1 and BMAT = 'G' are incompatable.\n";
+         break;
+       case -12:
+         std::cerr << "IPARAM(1) must be equal to 0 or 1.\n";
+         break;
+       case -13:
+         std::cerr << "NEV and WHICH = 'BE' are incompatable.\n";
+         break;
+       case -14:
+         std::cerr << "DSAUPD did not find any eigenvalues to sufficient accuracy.\n";
+         break;
+       case -9999:
+         std::cerr << "Could not build an Arnoldi factorization.";
+         std::cerr << " IPARAM(5) returns the size of the current Arnoldi\n";
+         std::cerr << "factorization. The user is advised to check that";
+         std::cerr << "enough workspace and array storage has been allocated.\n";
+         break;
+       default:
+         std::cerr << "unrecognised return value\n";
+       }
+  }
+
+//! @brief Compute the eigenvalues nearest to the shift using
+//! the shift-invert mode of ARPACK (mode 3).
+int XC::SparseArpackSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING no EigenSOE object has been set\n";
+        return -1;
+      }
+
+    int n= theSOE->size;
+    if(perm_r.Size() < n)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; WARNING permutation vectors not large enough"
+		  << " - has setSize() been called?\n";
+        return -1;
+      }
+    if(numModes>=n)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; number of modes to obtain ("
+                  << numModes << ") must be lesser than N= "
+                  << n << ".\n" << std::endl;
+        return -1;
+      }
+
+    if(factorize()!=0)
+      return -1;
+
+    int nev= numModes;
+    int ncv= getNCV(n, nev);
+    int ldv= n;
+    int lworkl= ncv*ncv + 8*ncv;
+    std::vector<double> v(ldv * ncv);
+    std::vector<double> workl(lworkl + 1);
+    std::vector<double> workd(3 * n + 1);
+    Vector d(nev);
+    Vector z(n * nev);
+    std::vector<double> resid(n);
+    int iparam[11];
+    int ipntr[11];
+    std::fill(iparam,iparam+11,0);
+    std::fill(ipntr,ipntr+11,0);
+    std::vector<long int> select(ncv);
+
+    char which[]= "LM";
+    char bmat= 'G';
+    char howmy= 'A';
+
+    iparam[0]= 1; // exact shifts.
+    iparam[2]= maxitr;
+    iparam[6]= 3; // shift-invert mode.
+
+    int ido= 0;
+    int info= 0;
+    while(1)
+      {
+        dsaupd_(&ido, &bmat, &n, which, &nev, &tol, &resid[0], &ncv, &v[0], &ldv, iparam, ipntr, &workd[0], &workl[0], &lworkl, &info);
+        if(ido == -1) // y= inv(K-shift*M)*M*x
+          {
+            theSOE->mulM(&workd[ipntr[0]-1], &workd[ipntr[1]-1]);
+            if(back_substitution(&workd[ipntr[1]-1])!=0)
+              return -1;
+          }
+        else if(ido == 1) // y= inv(K-shift*M)*(M*x) (M*x is given).
+          {
+            std::copy(&workd[ipntr[2]-1],&workd[ipntr[2]-1]+n,&workd[ipntr[1]-1]);
+            if(back_substitution(&workd[ipntr[1]-1])!=0)
+              return -1;
+          }
+        else if(ido == 2) // y= M*x
+          theSOE->mulM(&workd[ipntr[0]-1], &workd[ipntr[1]-1]);
+        else
+          break;
+      }
+    if(info < 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; error with _saupd info = " << info << std::endl;
+        print_err_info(info);
+        return info;
+      }
+    else if(info == 1)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; maximum number of iterations reached." << std::endl;
+    else if(info == 3)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; no shifts could be applied during implicit,"
+		<< " Arnoldi update, try increasing NCV." << std::endl;
+
+    double sigma= theSOE->shift;
+    bool rvec= true;
+    dseupd_(&rvec, &howmy, &select[0], d.getDataPtr(), z.getDataPtr(), &ldv, &sigma, &bmat, &n, which, &nev, &tol, &resid[0], &ncv, &v[0], &ldv, iparam, ipntr, &workd[0], &workl[0], &lworkl, &info);
+    if(info != 0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; error with dseupd_ info = " << info << std::endl;
+        print_err_info(info);
+        return info;
+      }
+    value= d;
+    eigenvector= z;
+    compute_residuals();
+    theSOE->factored= true;
+    return 0;
+  }
+
+//! @brief Compute the first nModes eigenvalues.
+int XC::SparseArpackSolver::solve(int nModes)
+  {
+    numModes= nModes;
+    return solve();
+  }
+
+int XC::SparseArpackSolver::getNCV(int n, int nev)
+  { return std::min(std::min(2*nev,nev+8),n); }
+
+//! @brief Set the system of equations.
+bool XC::SparseArpackSolver::setEigenSOE(EigenSOE *soe)
+  {
+    bool retval= false;
+    SparseArpackSOE *tmp= dynamic_cast<SparseArpackSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; not a suitable system of equations." << std::endl;
+    return retval;
+  }
+
+//! @brief Set the system of equations.
+bool XC::SparseArpackSolver::setEigenSOE(SparseArpackSOE &theSparseSOE)
+  { return setEigenSOE(&theSparseSOE); }
+
+//! @brief Return the eigenvector that corresponds to the mode
+//! being passed as parameter.
+const XC::Vector &XC::SparseArpackSolver::getEigenvector(int mode) const
+  {
+    if(mode <= 0 || mode > numModes)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; mode is out of range (1 - nev).\n";
+        eigenV.Zero();
+        return eigenV;
+      }
+    const int size= theSOE->size;
+    if(!eigenvector.isEmpty())
+      {
+        int index= (mode - 1) * size;
+        for(int i=0; i<size; i++)
+          eigenV(i)= eigenvector(index++);
+      }
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; eigenvectors not yet determined.\n";
+        eigenV.Zero();
+      }
+    return eigenV;
+  }
+
+//! @brief Return the eigenvalue that corresponds to the mode
+//! being passed as parameter.
+const double &XC::SparseArpackSolver::getEigenvalue(int mode) const
+  {
+    static double retval= 0.0;
+    if(mode <= 0 || mode > numModes)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; mode is out of range (1 - nev).\n";
+        retval= -1.0;
+        return retval;
+      }
+    if(!value.isEmpty())
+      return value[mode-1];
+    else
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; eigenvalues not yet determined.\n";
+        retval= -2.0;
+      }
+    return retval;
+  }
+
+//! @brief Allocate the permutation vectors.
+int XC::SparseArpackSolver::setSize(void)
+  {
+    const int size= theSOE->size;
+    free_matrices();
+    perm_r.resize(size);
+    perm_c.resize(size);
+    etree.resize(size);
+    if(eigenV.Size() != size)
+      eigenV.resize(size);
+    return 0;
+  }
+
+const int &XC::SparseArpackSolver::getSize(void) const
+  { return theSOE->size; }
+
+int XC::SparseArpackSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::SparseArpackSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,102 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseArpackSolver.h
+
+#ifndef SparseArpackSolver_h
+#define SparseArpackSolver_h
+
+#include <solution/system_of_eqn/eigenSOE/EigenSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SparseArpackSOE.h>
+#include "superlu/slu_ddefs.h"
+#include "superlu/supermatrix.h"
+
+namespace XC {
+//! @ingroup EigenSolver
+//
+//! @brief Shift-invert Lanczos solver (ARPACK) for sparse eigenproblems.
+//!
+//! The matrix (K - shift*M) is factorized once using SuperLU
+//! (minimum degree ordering of A'+A and symmetric mode) and
+//! the factors are reused in each Lanczos iteration, so the
+//! eigenvalues nearest to the shift are obtained without
+//! storing any band or profile matrix.
+class SparseArpackSolver : public EigenSolver
+  {
+  private:
+    SparseArpackSOE *theSOE;
+    Vector value; //!< eigenvalues.
+    Vector eigenvector; //!< eigenvectors (by columns).
+    Vector residuals; //!< relative residuals of the eigenpairs.
+    double tol; //!< Tolerance for the computed eigenvalues.
+    int maxitr; //!< Maximum number of iterations.
+    mutable Vector eigenV;
+
+    Vector Ashift; //!< coefficients of (K - shift*M).
+    SuperMatrix AS,AC;
+    SuperMatrix L,U;
+    ID perm_r;
+    ID perm_c;
+    ID etree;
+    superlu_options_t options;
+
+    void free_matrices(void);
+    int factorize(void);
+    int back_substitution(double *);
+    void compute_residuals(void);
+    int getNCV(int n, int nev);
+    void print_err_info(int);
+
+    SparseArpackSolver(const SparseArpackSolver &);
+    SparseArpackSolver &operator=(const SparseArpackSolver &);
+  protected:
+    friend class EigenSOE;
+    SparseArpackSolver(int numE = 0);
+    virtual EigenSolver *getCopy(void) const;
+    bool setEigenSOE(EigenSOE *theSOE);
+  public:
+    ~SparseArpackSolver(void);
+
+    virtual int solve(void);
+    virtual int solve(int nModes);
+    virtual int setSize(void);
+    const int &getSize(void) const;
+    virtual bool setEigenSOE(SparseArpackSOE &theSOE);
+    
+    virtual const Vector &getEigenvector(int mode) const;
+    virtual const double &getEigenvalue(int mode) const;
+    //! @brief Return the relative residuals |K*v-lambda*M*v|/|K*v|
+    //! of the computed eigenpairs.
+    inline const Vector &getResiduals(void) const
+      { return residuals; }
+    
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -22,7 +22,7 @@
 //python_interface.tcc
 
 class_<XC::EigenSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("EigenSOE", "Base class for eigenproblem systems of equations.", no_init)
-.def("newSolver", &XC::EigenSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_arpack_solver', 'band_arpackpp_solver', 'sym_band_eigen_solver', 'full_gen_eigen_solver', 'sym_arpack_solver'")
+.def("newSolver", &XC::EigenSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_arpack_solver', 'band_arpackpp_solver', 'sym_band_eigen_solver', 'full_gen_eigen_solver', 'sym_arpack_solver', 'sparse_arpack_solver'")
   ;
 
 class_<XC::ArpackSOE, bases<XC::EigenSOE>, boost::noncopyable >("ArpackSOE", no_init)
@@ -38,6 +38,10 @@ class_<XC::BandArpackppSOE, bases<XC::ArpackSOE>, boost::noncopyable >("BandArpa
 class_<XC::SymArpackSOE, bases<XC::ArpackSOE>, boost::noncopyable >("SymArpackSOE", no_init)
   ;
 
+class_<XC::SparseArpackSOE, bases<XC::ArpackSOE>, boost::noncopyable >("SparseArpackSOE", no_init)
+  .add_property("nnz", make_function(&XC::SparseArpackSOE::getNNZ, return_value_policy<copy_const_reference>() ),"Number of non-zero coefficients of the matrices.")
+  ;
+
 class_<XC::FullGenEigenSOE, bases<XC::EigenSOE>, boost::noncopyable >("FullGenEigenSOE", no_init)
   ;
 
@@ -55,6 +59,10 @@ class_<XC::SymArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("SymArp
 class_<XC::BandArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("BandArpackSolver", no_init)
   ;
 
+class_<XC::SparseArpackSolver, bases<XC::EigenSolver>, boost::noncopyable >("SparseArpackSolver", no_init)
+  .add_property("residuals", make_function(&XC::SparseArpackSolver::getResiduals, return_internal_reference<>() ),"Relative residuals |K*v-lambda*M*v|/|K*v| of the computed eigenpairs.")
+  ;
+
 class_<XC::FullGenEigenSolver, bases<XC::EigenSolver>, boost::noncopyable >("FullGenEigenSolver", no_init)
   ;
 
@@ -84,10 +84,10 @@
 
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectBlockSolver.h>
-//#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSkypackSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h>
-//#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h>
+#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h>
 
 #include <solution/system_of_eqn/linearSOE/sparseGEN/DistributedSparseGenRowLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSolver.h>
@@ -95,8 +95,11 @@
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SuperLU.h>
 
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/MultifrontalSPDLinSolver.h>
 
 #include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "solution/analysis/model/AnalysisModel.h"
 
 //#include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSolver.h>
 
@@ -186,14 +189,16 @@ XC::LinearSOESolver &XC::LinearSOE::newSolver(const std::string &type)
       setSolver(new ProfileSPDLinDirectBlockSolver());
     else if(type=="profile_spd_lin_direct_skypack_solver")
      setSolver(new ProfileSPDLinDirectSkypackSolver());
-//     else if(type=="profile_spd_lin_direct_thread_solver")
-//       setSolver(new ProfileSPDLinDirectThreadSolver());
-//     else if(type=="profile_spd_lin_substr_solver")
-//       setSolver(new ProfileSPDLinSubstrSolver());
+    else if(type=="profile_spd_lin_direct_thread_solver")
+      setSolver(new ProfileSPDLinDirectThreadSolver());
+    else if(type=="profile_spd_lin_substr_solver")
+      setSolver(new ProfileSPDLinSubstrSolver());
     else if(type=="super_lu_solver")
       setSolver(new SuperLU());
     else if(type=="sym_sparse_lin_solver")
       setSolver(new SymSparseLinSolver());
+    else if(type=="multifrontal_spd_lin_solver")
+      setSolver(new MultifrontalSPDLinSolver());
 //     else if(type=="umfpack_gen_lin_solver")
 //       setSolver(new UmfpackGenLinSolver());
     else
@@ -217,6 +222,46 @@ XC::LinearSOE::~LinearSOE(void)
 int XC::LinearSOE::solve(void)
   { return (getSolver()->solve()); }
 
+//! @brief Computes the solutions of the system for the right hand
+//! sides in the columns of \p B.
+//!
+//! The solution for the j-th column of \p B is returned in the j-th column
+//! of \p X. This implementation sets each column as the vector \f$b\f$
+//! and solves the system once for each of them, so factored systems compute
+//! the factorization only for the first one. Subclasses may override this
+//! method to solve all the right hand sides in a single call to the solver.
+//! Returns \f$0\f$ if successful, a negative number if not. On return
+//! the vectors \f$b\f$ and \f$x\f$ hold the values of the last column.
+int XC::LinearSOE::solve(const Matrix &B,Matrix &X)
+  {
+    const int n= getNumEqn();
+    if(B.noRows()!=n)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the number of rows of the right hand side matrix ("
+		  << B.noRows() << ") doesn't match the number of equations ("
+		  << n << ").\n";
+        return -1;
+      }
+    const int nrhs= B.noCols();
+    X.resize(n,nrhs);
+    Vector b(n);
+    int retval= 0;
+    for(int j= 0;j<nrhs;j++)
+      {
+        for(int i= 0;i<n;i++)
+          b(i)= B(i,j);
+        setB(b);
+        retval= solve();
+        if(retval<0)
+          break;
+        const Vector &x= getX();
+        for(int i= 0;i<n;i++)
+          X(i,j)= x(i);
+      }
+    return retval;
+  }
+
 //! @brief Returns the determinant of the system matrix.
 double XC::LinearSOE::getDeterminant(void)
   { return getSolver()->getDeterminant(); }
@@ -226,6 +271,26 @@ double XC::LinearSOE::getDeterminant(void)
 XC::LinearSOESolver *XC::LinearSOE::getSolver(void)
   { return theSolver; }
 
+//! @brief Determines and sets the size of the system from the
+//! compressed (CSR) DOF graph.
+//!
+//! The vertices of \p theGraph are the equation numbers and its
+//! edges join the equations coupled by some element. This default
+//! implementation uses the DOF Graph of the analysis model instead
+//! (systems of equations that have not been adapted to the
+//! compressed representation).
+int XC::LinearSOE::setSize(const CSRGraph &theGraph)
+  {
+    int retval= -1;
+    AnalysisModel *am= getAnalysisModelPtr();
+    if(am)
+      retval= setSize(am->getDOFGraph());
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; analysis model not set.\n";
+    return retval;
+  }
+
 //! @brief invoke setSize() on the Solver
 int XC::LinearSOE::setSolverSize(void)
   {
@@ -104,6 +104,7 @@ class LinearSOE : public SystemOfEqn
     virtual ~LinearSOE(void);
 
     virtual int solve(void);    
+    virtual int solve(const Matrix &B,Matrix &X);
 
     //! @brief Determines and sets the size of the system.
     //!
@@ -113,6 +114,7 @@ class LinearSOE : public SystemOfEqn
     //! the connectivity between the vertices in the Graph object \p theGraph.
     //! To return $0$ if sucessfull, a negative number if not.
     virtual int setSize(Graph &theGraph) =0;
+    virtual int setSize(const CSRGraph &theGraph);
     //! @brief Returns the number of equations in the system.
     virtual int getNumEqn(void) const =0;
     
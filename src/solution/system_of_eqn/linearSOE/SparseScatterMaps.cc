@@ -0,0 +1,137 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseScatterMaps.cc
+
+#include <solution/system_of_eqn/linearSOE/SparseScatterMaps.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/Vector.h>
+
+//! @brief Constructor.
+//!
+//! @param s: storage scheme of the sparse matrix.
+XC::SparseScatterMaps::SparseScatterMaps(const StorageScheme &s)
+  : active(false), scheme(s) {}
+
+//! @brief Activates (or deactivates) the use of the scatter maps.
+void XC::SparseScatterMaps::setActive(const bool &b)
+  {
+    active= b;
+    if(!active)
+      clear();
+  }
+
+//! @brief Removes all the scatter maps (must be called each time
+//! the sparsity pattern of the matrix changes).
+void XC::SparseScatterMaps::clear(void)
+  { maps.clear(); }
+
+//! @brief Computes the scatter map for the equation numbers being passed
+//! as parameter.
+//!
+//! The position in the 1d array of non-zeros of the coefficient (r,c)
+//! of the element matrix is stored at pos[c*n+r] so it matches the
+//! column-major storage of the Matrix class.
+//! 
+//! @param id: equation numbers of the element.
+//! @param start: location of the start of each column (row) in the non-zeros array.
+//! @param index: row (column) of each non-zero coefficient.
+//! @param size: number of equations in the system.
+const XC::SparseScatterMaps::ScatterMap &XC::SparseScatterMaps::build(const ID &id, const ID &start, const ID &index,const int &size)
+  {
+    ScatterMap &retval= maps[&id];
+    retval.dofs= id;
+    const int n= id.Size();
+    retval.pos.assign(n*n,-1);
+    for(int c= 0;c<n;c++)
+      {
+        const int col= id(c);
+        if(col<0 || col>=size)
+          continue;
+        for(int r= 0;r<n;r++)
+          {
+            const int row= id(r);
+            if(row<0 || row>=size)
+              continue;
+            const int outer= (scheme==COLUMN_COMPRESSED ? col : row);
+            const int inner= (scheme==COLUMN_COMPRESSED ? row : col);
+            const int endLoc= start(outer+1);
+	    for(int k= start(outer);k<endLoc;k++)
+	      if(index(k) == inner)
+                {
+                  retval.pos[c*n+r]= k;
+                  break;
+	        }
+          }
+      }
+    return retval;
+  }
+
+//! @brief Assembles fact*m into the non-zeros array A using the scatter map
+//! corresponding to id (the map is computed if it doesn't exists yet or if
+//! the equation numbers have changed).
+//!
+//! @param A: 1d array of non-zeros.
+//! @param start: location of the start of each column (row) in A.
+//! @param index: row (column) of each non-zero coefficient.
+//! @param size: number of equations in the system.
+//! @param m: matrix to assemble.
+//! @param id: equation numbers of the matrix rows and columns.
+//! @param fact: factor that multiplies m.
+int XC::SparseScatterMaps::addA(Vector &A, const ID &start, const ID &index, const int &size, const Matrix &m, const ID &id, const double &fact)
+  {
+    const int n= id.Size();
+    if((m.noRows()!=n) || (m.noCols()!=n))
+      {
+	std::cerr << "SparseScatterMaps::" << __FUNCTION__
+		  << "; matrix and ID not of similar sizes.\n";
+	return -1;
+      }
+    map_scatter_maps::const_iterator i= maps.find(&id);
+    const ScatterMap *mapPtr= nullptr;
+    if((i!=maps.end()) && (i->second.dofs == id))
+      mapPtr= &(i->second);
+    else
+      mapPtr= &build(id,start,index,size);
+
+    const int *pos= mapPtr->pos.data();
+    const double *mData= m.getDataPtr();
+    double *aData= A.getDataPtr();
+    const int sz= n*n;
+    if(fact == 1.0) // do not need to multiply
+      {
+        for(int k= 0;k<sz;k++)
+          if(pos[k]>=0)
+            aData[pos[k]]+= mData[k];
+      }
+    else
+      {
+        for(int k= 0;k<sz;k++)
+          if(pos[k]>=0)
+            aData[pos[k]]+= fact*mData[k];
+      }
+    return 0;
+  }
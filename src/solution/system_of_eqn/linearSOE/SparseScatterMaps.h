@@ -0,0 +1,89 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//SparseScatterMaps.h
+                                                                        
+                                                                        
+#ifndef SparseScatterMaps_h
+#define SparseScatterMaps_h
+
+#include <map>
+#include <vector>
+#include "utility/matrix/ID.h"
+
+namespace XC {
+class Matrix;
+class Vector;
+
+//! @ingroup LinearSOE
+//
+//! @brief Scatter maps for the assembly of element contributions
+//! into a compressed (column or row) sparse matrix.
+//!
+//! For each equation number vector (the ID returned by
+//! FE_Element::getID or DOF_Group::getID) stores, once, the position
+//! in the 1d array of non-zeros of each of the coefficients of the
+//! element matrix. Subsequent assemblies of that element become a
+//! straight indexed gather-add (no search in the row/column index
+//! arrays). The maps are keyed by the address of the ID object and
+//! validated against its contents, so a renumbering of the
+//! DOFs is detected. Anyway the maps must be cleared each time
+//! the system is resized (see setSize).
+class SparseScatterMaps
+  {
+  public:
+    //! @brief Storage scheme of the sparse matrix.
+    enum StorageScheme {COLUMN_COMPRESSED, ROW_COMPRESSED};
+  private:
+    //! @brief Scatter map for one element.
+    struct ScatterMap
+      {
+        ID dofs; //!< equation numbers when the map was built.
+	std::vector<int> pos; //!< position of each coefficient in A (-1 if not assembled).
+      };
+    typedef std::map<const ID *, ScatterMap> map_scatter_maps;
+    map_scatter_maps maps; //!< scatter maps.
+    bool active; //!< if true use the scatter maps in the assembly.
+    StorageScheme scheme; //!< storage scheme of the matrix.
+
+    const ScatterMap &build(const ID &, const ID &, const ID &,const int &);
+  public:
+    SparseScatterMaps(const StorageScheme &);
+
+    //! @brief Return true if the scatter maps are in use.
+    inline bool isActive(void) const
+      { return active; }
+    void setActive(const bool &);
+    //! @brief Return the number of scatter maps stored.
+    inline size_t getNumMaps(void) const
+      { return maps.size(); }
+    void clear(void);
+
+    int addA(Vector &, const ID &, const ID &, const int &, const Matrix &, const ID &, const double &);
+  };
+} // end of XC namespace
+
+#endif
@@ -61,6 +61,7 @@
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 
 //! @brief Constructor.
 //!
@@ -148,14 +149,30 @@ bool XC::BandGenLinSOE::setSolver(LinearSOESolver *newSolver)
 //! invoking setSize() on the associated Solver object is returned.
 int XC::BandGenLinSOE::setSize(Graph &theGraph)
   {
-    int result = 0;
     size= checkSize(theGraph);
 
     /*
      * determine the number of superdiagonals and subdiagonals
      */
     theGraph.getBand(numSubD,numSuperD);
+    return resize_storage();
+  }
 
+//! @brief Determines and sets the size of the system from the
+//! compressed DOF graph (see setSize(Graph &)).
+int XC::BandGenLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    size= checkSize(theGraph);
+    theGraph.getBand(numSubD,numSuperD);
+    return resize_storage();
+  }
+
+//! @brief Allocates the storage for the size and the number of
+//! superdiagonals and subdiagonals already computed and invokes
+//! setSize() on the solver.
+int XC::BandGenLinSOE::resize_storage(void)
+  {
+    int result = 0;
     int newSize = size * (2*numSubD + numSuperD +1);
     if(newSize > A.Size())
       { // we have to get another space for A
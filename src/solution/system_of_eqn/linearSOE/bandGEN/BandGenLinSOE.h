@@ -113,6 +113,7 @@ class BandGenLinSOE : public FactoredSOEBase
     Vector A;
   protected:
     virtual bool setSolver(LinearSOESolver *);
+    int resize_storage(void);
 
     friend class AnalysisAggregation;
     friend class FEM_ObjectBroker;
@@ -122,6 +123,7 @@ class BandGenLinSOE : public FactoredSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
     
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
 
@@ -75,6 +75,11 @@ void XC::DistributedBandGenLinSOE::calcBand(Graph &theGraph)
     theGraph.getBand(numSubD,numSuperD);
   }
 
+//! @brief The distributed system is sized from the processes
+//! graphs, so the DOF Graph of the analysis model is used.
+int XC::DistributedBandGenLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedBandGenLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
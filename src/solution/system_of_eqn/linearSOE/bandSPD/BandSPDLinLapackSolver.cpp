@@ -61,6 +61,7 @@
 
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinLapackSolver.h>
 #include <solution/system_of_eqn/linearSOE/bandSPD/BandSPDLinSOE.h>
+#include <utility/matrix/Matrix.h>
 
 //! @brief Constructor.
 XC::BandSPDLinLapackSolver::BandSPDLinLapackSolver(void)
@@ -132,6 +133,62 @@ int XC::BandSPDLinLapackSolver::solve(void)
 
     return 0;
   }
+
+//! @brief Computes the solutions for the right hand sides in the
+//! columns of \p B.
+//!
+//! Copies \p B into \p X and then calls dpbsv() (if the system is not
+//! factored yet) or dpbtrs() with all the right hand sides at once, so
+//! the matrix is factored at most one time.
+int XC::BandSPDLinLapackSolver::solve(const Matrix &B,Matrix &X)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
+	return -1;
+      }
+
+    int n = theSOE->size;
+    if(B.noRows()!=n)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the number of rows of the right hand side matrix ("
+		  << B.noRows() << ") doesn't match the number of equations ("
+		  << n << ").\n";
+	return -1;
+      }
+    int kd = theSOE->half_band -1;
+    int ldA = kd +1;
+    int nrhs = B.noCols();
+    int ldB = n;
+    int info= 0;
+    double *Aptr = theSOE->A.getDataPtr();
+
+    X= B; // first copy B into X (column major storage).
+    if((n==0) || (nrhs==0))
+      return 0;
+    double *Xptr= X.getDataPtr();
+
+    char strU[]= "U";
+    // now solve AX = Y
+    { if (theSOE->factored == false)          
+	dpbsv_(strU,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+      else
+	dpbtrs_(strU,&n,&kd,&nrhs,Aptr,&ldA,Xptr,&ldB,&info);
+    }
+
+    // check if successfull
+    if(info != 0)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - the LAPACK"
+		  << " routines returned " << info << std::endl;
+	return -info;
+      }
+    theSOE->factored = true;
+    return 0;
+  }
     
 
 //! @brief Does nothing but return \f$0\f$.
@@ -85,6 +85,7 @@ class BandSPDLinLapackSolver : public BandSPDLinSolver
   public:
 
     int solve(void);
+    int solve(const Matrix &B,Matrix &X);
     int setSize(void);
     
     int sendSelf(CommParameters &);
@@ -65,6 +65,7 @@
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 
 void XC::BandSPDLinSOE::inicA(const size_t &hsz)
   {
@@ -142,6 +143,23 @@ bool XC::BandSPDLinSOE::setSolver(LinearSOESolver *newSolver)
     return retval;
   }
 
+//! @brief Computes the solutions of the system for the right hand
+//! sides in the columns of \p B (see LinearSOE::solve(B,X)).
+//!
+//! Delegates on the solver, which can solve all the right hand sides
+//! in a single call.
+int XC::BandSPDLinSOE::solve(const Matrix &B,Matrix &X)
+  {
+    BandSPDLinSolver *solver= dynamic_cast<BandSPDLinSolver *>(getSolver());
+    if(!solver)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; solver not set." << std::endl;
+        return -1;
+      }
+    return solver->solve(B,X);
+  }
+
 //! @brief Sets the size of the system from the number of vertices in the graph.
 //!
 //! The size of the system is determined by looking at the adjacency ID of
@@ -163,11 +181,25 @@ bool XC::BandSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 //! returned. 
 int XC::BandSPDLinSOE::setSize(Graph &theGraph)
   {
-    int result = 0;
     size= checkSize(theGraph);
     half_band= theGraph.getVertexDiffMaxima();
+    return resize_storage();
+  }
 
+//! @brief Determines and sets the size of the system from the
+//! compressed DOF graph (see setSize(Graph &)).
+int XC::BandSPDLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    size= checkSize(theGraph);
+    half_band= theGraph.getVertexDiffMaxima();
+    return resize_storage();
+  }
 
+//! @brief Allocates the storage for the size and the half band
+//! already computed and invokes setSize() on the solver.
+int XC::BandSPDLinSOE::resize_storage(void)
+  {
+    int result = 0;
     half_band+= 1; // include the diagonal
 
 
@@ -116,6 +116,7 @@ class BandSPDLinSOE: public FactoredSOEBase
 
     void inicA(const size_t &);
     bool setSolver(LinearSOESolver *);
+    int resize_storage(void);
 
     friend class AnalysisAggregation;
     friend class FEM_ObjectBroker;
@@ -125,10 +126,14 @@ class BandSPDLinSOE: public FactoredSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
 
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     
     virtual void zeroA(void);
+
+    using LinearSOE::solve;
+    virtual int solve(const Matrix &B,Matrix &X);
     
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
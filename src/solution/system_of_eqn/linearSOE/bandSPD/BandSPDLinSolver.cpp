@@ -91,4 +91,17 @@ bool XC::BandSPDLinSolver::setLinearSOE(LinearSOE *soe)
 bool XC::BandSPDLinSolver::setLinearSOE(BandSPDLinSOE &theBandSPDSOE)
   { return setLinearSOE(&theBandSPDSOE); }
 
+//! @brief Computes the solutions for the right hand sides in the
+//! columns of \p B (one column at a time, see LinearSOE::solve(B,X)).
+int XC::BandSPDLinSolver::solve(const Matrix &B,Matrix &X)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
+	return -1;
+      }
+    return theSOE->LinearSOE::solve(B,X);
+  }
+
 
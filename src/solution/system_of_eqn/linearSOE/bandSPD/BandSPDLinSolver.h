@@ -69,6 +69,7 @@
 #include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
 namespace XC {
 class BandSPDLinSOE;
+class Matrix;
 
 //! @ingroup Solver
 //
@@ -86,6 +87,7 @@ class BandSPDLinSolver : public LinearSOESolver
     virtual bool setLinearSOE(LinearSOE *theSOE);
   public:
     virtual int solve(void) = 0;
+    virtual int solve(const Matrix &B,Matrix &X);
     virtual bool setLinearSOE(BandSPDLinSOE &theSOE);
     
   };
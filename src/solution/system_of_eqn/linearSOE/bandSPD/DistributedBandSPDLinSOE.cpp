@@ -79,6 +79,11 @@ void XC::DistributedBandSPDLinSOE::calcBand(Graph &theGraph)
     half_band += 1; // include the diagonal
   }
 
+//! @brief The distributed system is sized from the processes
+//! graphs, so the DOF Graph of the analysis model is used.
+int XC::DistributedBandSPDLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedBandSPDLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
@@ -68,6 +68,11 @@ XC::DistributedProfileSPDLinSOE::DistributedProfileSPDLinSOE(AnalysisAggregation
    DistributedBandLinSOE() {}
 
 
+//! @brief The distributed system is sized from the processes
+//! graphs, so the DOF Graph of the analysis model is used.
+int XC::DistributedProfileSPDLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedProfileSPDLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
@@ -83,6 +83,7 @@ class DistributedProfileSPDLinSOE: public ProfileSPDLinSOE, public DistributedBa
     int addB(const Vector &, const ID &,const double &fact= 1.0);    
     int setB(const Vector &, const double &fact= 1.0);            
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int solve(void);
     const Vector &getB(void) const;
 
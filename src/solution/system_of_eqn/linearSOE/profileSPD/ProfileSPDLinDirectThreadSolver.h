@@ -79,32 +79,43 @@ class ProfileSPDLinSOE;
 //! solve a ProfileSPDLinSOE object. It does this in parallel using
 //! threads by direct means, using the \f$LDL^t\f$ variation of the cholesky
 //! factorization. The matrx \f$A\f$ is factored one row block at a time using
-//! a left-looking approach. Within a row block the factorization is
-//! performed by \f$NP\f$ threads. No BLAS or LAPACK routines are called 
-//! for the factorization or subsequent substitution.
+//! a left-looking approach. The diagonal block is factored by the calling
+//! thread and then the columns to the right of the block are updated
+//! in parallel by the threads of the solution method thread pool (see
+//! AnalysisAggregation::setNumThreads). No BLAS or LAPACK routines
+//! are called for the factorization or subsequent substitution.
 class ProfileSPDLinDirectThreadSolver : public ProfileSPDLinDirectBase
   {
   protected:
-    int NP;
-    int running;
-    
-    int blockSize;
-    int maxColHeight;
+    int blockSize; //!< number of rows of each block.
+    int maxColHeight; //!< maximum column height of the profile.
 
-    ProfileSPDLinDirectThreadSolver();      
-    ProfileSPDLinDirectThreadSolver(int numProcessors, int blockSize, double tol);    
+    void updateColumn(const int &, const int &, const int &);
+    int factorDiagonalBlock(const int &, const int &);
+    int factor(void);
+
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    ProfileSPDLinDirectThreadSolver(double tol= 1.0e-12, int blockSize= 64);
     virtual LinearSOESolver *getCopy(void) const;
   public:
 
     virtual int solve(void);        
     virtual int setSize(void);    
 
+    inline int getBlockSize(void) const
+      { return blockSize; }
+    void setBlockSize(const int &);
+
     virtual int setProfileSOE(ProfileSPDLinSOE &theSOE);
 
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
   };
 
+//! @brief Virtual constructor.
+inline LinearSOESolver *ProfileSPDLinDirectThreadSolver::getCopy(void) const
+   { return new ProfileSPDLinDirectThreadSolver(*this); }
 } // end of XC namespace
 
 
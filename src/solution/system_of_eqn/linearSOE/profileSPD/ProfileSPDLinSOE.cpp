@@ -60,6 +60,7 @@
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 
@@ -160,7 +161,6 @@ bool XC::ProfileSPDLinSOE::setSolver(LinearSOESolver *newSolver)
 //! returned. 
 int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
   {
-    int result = 0;
     size= checkSize(theGraph);
 
     // check we have enough space in iDiagLoc and iLastCol
@@ -198,7 +198,37 @@ int XC::ProfileSPDLinSOE::setSize(Graph &theGraph)
               } 
           }
       }
+    return resize_storage();
+  }
+
+//! @brief Determines and sets the size of the system from the
+//! compressed DOF graph (see setSize(Graph &)).
+int XC::ProfileSPDLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    size= checkSize(theGraph);
+    if(size > B.Size())
+       { iDiagLoc.resize(size); }
+    iDiagLoc.Zero();
+
+    // the height of each column is given by its first
+    // adjacent vertex (the adjacency is sorted).
+    for(int v=0; v<size; v++)
+      if(theGraph.getDegree(v)>0)
+        {
+          const int vertexNum= theGraph.getVertexTag(v);
+          const int diff= vertexNum-theGraph.getVertexTag(*theGraph.adjacencyBegin(v));
+          if(diff > 0)
+            iDiagLoc(vertexNum)= diff;
+        }
+    return resize_storage();
+  }
 
+//! @brief Computes the location of the diagonal entries from the
+//! heights of the columns (already stored in iDiagLoc), allocates the
+//! storage and invokes setSize() on the solver.
+int XC::ProfileSPDLinSOE::resize_storage(void)
+  {
+    int result = 0;
 
     // now go through iDiagLoc, adding 1 for the diagonal element
     // and then adding previous entry to give current location.
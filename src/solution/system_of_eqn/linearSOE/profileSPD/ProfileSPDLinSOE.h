@@ -125,6 +125,7 @@ class ProfileSPDLinSOE: public FactoredSOEBase
     int numInt;
   protected:
     virtual bool setSolver(LinearSOESolver *);
+    int resize_storage(void);
 
     friend class AnalysisAggregation;
     friend class FEM_ObjectBroker;
@@ -134,6 +135,7 @@ class ProfileSPDLinSOE: public FactoredSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
     
     virtual void zeroA(void);
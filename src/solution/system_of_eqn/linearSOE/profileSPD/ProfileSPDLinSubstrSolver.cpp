@@ -126,7 +126,7 @@ int XC::ProfileSPDLinSubstrSolver::condenseA(int numInt)
 	return 0;
       }
 
-    if(dSize != size)
+    if(dSize != numInt)
       {
         DU= Vector(numInt);
 	dSize= numInt;
@@ -139,7 +139,9 @@ int XC::ProfileSPDLinSubstrSolver::condenseA(int numInt)
     //
 
 
-    this->factor(numInt);
+    const int ok= this->factor(numInt);
+    if(ok < 0)
+      return ok;
 
     /*
      *  form M, leave in A12
@@ -240,9 +242,6 @@ int XC::ProfileSPDLinSubstrSolver::condenseA(int numInt)
 
     theSOE->isAcondensed= true;
     theSOE->numInt= numInt;
-    std::cerr << getClassName() << "::" << __FUNCTION__
-              << " numDOF: " << size << "  numInt: " << numInt
-	      << " numExt: " << size-numInt << std::endl;
     return 0;
   }
 
@@ -87,6 +87,7 @@ class ProfileSPDLinSubstrSolver : public ProfileSPDLinDirectSolver,
     Vector Yext;
 
   protected:
+    friend class LinearSOE;
     friend class FEM_ObjectBroker;
     ProfileSPDLinSubstrSolver(double tol=1.0e-12);
     virtual LinearSOESolver *getCopy(void) const;
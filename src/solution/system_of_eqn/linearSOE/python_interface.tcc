@@ -22,7 +22,7 @@
 //python_interface.tcc
 
 class_<XC::LinearSOE, bases<XC::SystemOfEqn>, boost::noncopyable >("LinearSOE", no_init)
-.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'super_lu_solver', 'sym_sparse_lin_solver'" )
+.def("newSolver", &XC::LinearSOE::newSolver,return_internal_reference<>()," \n""newSolver(type)""Define the solver to be used.""Parameters: \n""type: type of solver. Available types: 'band_gen_lin_lapack_solver', 'band_spd_lin_lapack_solver', 'diagonal_direct_solver', 'distributed_diagonal_solver', 'full_gen_lin_lapack_solver', 'profile_spd_lin_direct_solver', 'profile_spd_lin_direct_block_solver', 'profile_spd_lin_direct_thread_solver', 'super_lu_solver', 'sym_sparse_lin_solver', 'multifrontal_spd_lin_solver'" )
   ;
 
 class_<XC::LinearSOEData, bases<XC::LinearSOE>, boost::noncopyable >("LinearSOEData", no_init);
@@ -59,6 +59,7 @@ class_<XC::SparseSOEBase, bases<XC::FactoredSOEBase>, boost::noncopyable >("Spar
     ;
 
 class_<XC::SparseGenSOEBase, bases<XC::SparseSOEBase>, boost::noncopyable >("SparseGenSOEBase", no_init)
+  .add_property("useScatterMaps", &XC::SparseGenSOEBase::getUseScatterMaps, &XC::SparseGenSOEBase::setUseScatterMaps,"If true, the positions of the element coefficients in the sparse matrix are computed once (after each renumbering) and reused in the following assemblies.")
     ;
 
 
@@ -98,6 +99,9 @@ class_<XC::SparseGenRowLinSOE, bases<XC::SparseGenSOEBase>, boost::noncopyable >
 class_<XC::SymSparseLinSOE, bases<XC::SparseSOEBase>, boost::noncopyable >("SymSparseLinSOE", no_init)
     ;
 
+class_<XC::MultifrontalSPDLinSOE, bases<XC::SparseGenSOEBase>, boost::noncopyable >("MultifrontalSPDLinSOE", no_init)
+    ;
+
 // class_<XC::UmfpackGenLinSOE, bases<XC::FactoredSOEBase>, boost::noncopyable >("UmfpackGenLinSOE", no_init)
 //     ;
 
@@ -135,7 +139,9 @@ class_<XC::ProfileSPDLinDirectBlockSolver, bases<XC::ProfileSPDLinDirectBase>, b
 
 class_<XC::ProfileSPDLinDirectSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectSolver", no_init);
 
-// class_<XC::ProfileSPDLinDirectThreadSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectThreadSolver", no_init);
+class_<XC::ProfileSPDLinDirectThreadSolver, bases<XC::ProfileSPDLinDirectBase>, boost::noncopyable >("ProfileSPDLinDirectThreadSolver", no_init)
+  .add_property("blockSize", &XC::ProfileSPDLinDirectThreadSolver::getBlockSize, &XC::ProfileSPDLinDirectThreadSolver::setBlockSize,"Number of rows of each block (the columns to the right of each block are updated in parallel).")
+  ;
 
 class_<XC::ProfileSPDLinSubstrSolver, bases<XC::ProfileSPDLinDirectBase,XC::DomainSolver>, boost::noncopyable >("ProfileSPDLinSubstrSolver", no_init);
 
@@ -143,7 +149,11 @@ class_<XC::ProfileSPDLinSubstrSolver, bases<XC::ProfileSPDLinDirectBase,XC::Doma
 
 class_<XC::SparseGenColLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SparseGenColLinSolver", no_init);
 
-class_<XC::SuperLU, bases<XC::SparseGenColLinSolver>, boost::noncopyable >("SuperLU", no_init);
+class_<XC::SuperLU, bases<XC::SparseGenColLinSolver>, boost::noncopyable >("SuperLU", no_init)
+  .add_property("numSymbolicFactorizations", &XC::SuperLU::getNumSymbolicFactorizations,"Number of computations of the column ordering and the elimination tree (once for each sparsity pattern).")
+  .add_property("numNumericFactorizations", &XC::SuperLU::getNumNumericFactorizations,"Number of numeric factorizations.")
+  .def("resetCounters", &XC::SuperLU::resetCounters,"Reset the factorization counters.")
+  ;
 
 // class_<XC::ThreadSuperLU, bases<XC::SparseGenColLinSolver>, boost::noncopyable >("ThreadSuperLU", no_init);
 
@@ -151,6 +161,14 @@ class_<XC::SparseGenRowLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable
 
 class_<XC::SymSparseLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("SymSparseLinSolver", no_init);
 
+class_<XC::MultifrontalSPDLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("MultifrontalSPDLinSolver", no_init)
+  .add_property("numSupernodes", &XC::MultifrontalSPDLinSolver::getNumSupernodes,"Number of supernodes of the factor.")
+  .add_property("factorSize", &XC::MultifrontalSPDLinSolver::getFactorSize,"Number of coefficients stored for the factor L.")
+  .add_property("numSymbolicFactorizations", &XC::MultifrontalSPDLinSolver::getNumSymbolicFactorizations,"Number of orderings and symbolic analysis (once for each sparsity pattern).")
+  .add_property("numNumericFactorizations", &XC::MultifrontalSPDLinSolver::getNumNumericFactorizations,"Number of numeric factorizations.")
+  .def("resetCounters", &XC::MultifrontalSPDLinSolver::resetCounters,"Reset the factorization counters.")
+  ;
+
 // class_<XC::UmfpackGenLinSolver, bases<XC::LinearSOESolver>, boost::noncopyable >("UmfpackGenLinSolver", no_init);
 
 
@@ -83,6 +83,11 @@ void XC::DistributedSparseGenColLinSOE::calcNonZeros(Graph &theGraph)
       }
   }
 
+//! @brief The distributed system is sized from the processes
+//! graphs, so the DOF Graph of the analysis model is used.
+int XC::DistributedSparseGenColLinSOE::setSize(const CSRGraph &theGraph)
+  { return LinearSOE::setSize(theGraph); }
+
 int XC::DistributedSparseGenColLinSOE::setSize(Graph &theGraph)
   {
     int result = 0;
@@ -81,6 +81,7 @@ class DistributedSparseGenColLinSOE : public SparseGenColLinSOE, public Distribu
   public:
     // these methods need to be rewritten
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &, const double &fact= 1.0);    
     int setB(const Vector &,const double &fact= 1.0);            
@@ -62,6 +62,7 @@
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 //! @brief Constructor.
@@ -97,6 +98,23 @@ bool XC::SparseGenColLinSOE::setSolver(LinearSOESolver *newSolver)
     return retval;
   }
 
+//! @brief Computes the solutions of the system for the right hand
+//! sides in the columns of \p B (see LinearSOE::solve(B,X)).
+//!
+//! Delegates on the solver, which can solve all the right hand sides
+//! in a single call.
+int XC::SparseGenColLinSOE::solve(const Matrix &B,Matrix &X)
+  {
+    SparseGenColLinSolver *solver= dynamic_cast<SparseGenColLinSolver *>(getSolver());
+    if(!solver)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; solver not set." << std::endl;
+        return -1;
+      }
+    return solver->solve(B,X);
+  }
+
 //! @brief Sets the size of the system from the number of vertices in the graph.
 //!
 //! The size of the system is determined from the Graph object {\em
@@ -134,6 +152,7 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
 	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
       }
     nnz = newNNZ;
+    scatterMaps.clear(); // sparsity pattern changed.
 
     if(newNNZ > A.Size())
       { // we have to get more space for A and rowA
@@ -210,6 +229,39 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
     return result;
   }
 
+//! @brief Determines and sets the size of the system from the
+//! compressed DOF graph.
+//!
+//! Same as setSize(Graph &) but, as the adjacency of each vertex is
+//! already sorted, \f$rowA\f$ is filled by just inserting the
+//! diagonal entry in its place.
+int XC::SparseGenColLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    size= checkSize(theGraph);
+    nnz= theGraph.getAdjacency().size()+size; // +size for the diag entries
+    scatterMaps.clear(); // sparsity pattern changed.
+
+    if(nnz > A.Size())
+      A.resize(nnz);
+    A.Zero();
+    factored = false;
+    if(size > B.Size())
+      inic(size);
+
+    // fill in colStartA and rowA
+    if(theGraph.getCompressedPattern(colStartA,rowA,true)<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING : the vertices of the graph"
+		  << " are not the equation numbers - size set to 0.\n";
+        size= 0;
+        return -1;
+      }
+    // invoke setSize() on the Solver    
+    const int solverOK= setSolverSize();
+    return (solverOK<0 ? solverOK : 0);
+  }
+
 //! @brief Assemblies the product fact*m into the system matrix.
 //!
 //! First tests that \p loc and \p M are of compatable sizes; if not
@@ -220,7 +272,9 @@ int XC::SparseGenColLinSOE::setSize(Graph &theGraph)
 //! fact * M(i,j)\f$. If the location specified is outside the range,
 //! i.e. \f$(-1,-1)\f$ the corrseponding entry in \p M is not added to
 //! \f$A\f$. If \p fact is equal to \f$0.0\f$ or \f$1.0\f$, more efficient steps
-//! are performed. Returns \f$0\f$.
+//! are performed. If the scatter maps are active (see setUseScatterMaps)
+//! the positions of the coefficients in \f$A\f$ are computed only the first
+//! time the element is assembled after each call to setSize. Returns \f$0\f$.
 int XC::SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
   {
     // check for a quick return 
@@ -235,6 +289,9 @@ int XC::SparseGenColLinSOE::addA(const Matrix &m, const ID &id, double fact)
 		  << "; Matrix and ID not of similar sizes\n";
 	return -1;
     }
+
+    if(scatterMaps.isActive()) // use precomputed positions.
+      return scatterMaps.addA(A,colStartA,rowA,size,m,id,fact);
     
     if (fact == 1.0) { // do not need to multiply 
       for (int i=0; i<idSize; i++) {
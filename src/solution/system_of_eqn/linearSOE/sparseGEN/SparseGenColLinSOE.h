@@ -145,7 +145,11 @@ class SparseGenColLinSOE : public SparseGenSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
     virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+
+    using LinearSOE::solve;
+    virtual int solve(const Matrix &B,Matrix &X);
     
     virtual int sendSelf(CommParameters &);
     virtual int recvSelf(const CommParameters &);
@@ -90,11 +90,15 @@ bool XC::SparseGenColLinSolver::setLinearSOE(LinearSOE *soe)
 bool XC::SparseGenColLinSolver::setLinearSOE(SparseGenColLinSOE &theSparseGenColSOE)
   { return setLinearSOE(&theSparseGenColSOE); }
 
-
-
-
-
-
-
-
-
+//! @brief Computes the solutions for the right hand sides in the
+//! columns of \p B (one column at a time, see LinearSOE::solve(B,X)).
+int XC::SparseGenColLinSolver::solve(const Matrix &B,Matrix &X)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+	          << "; no LinearSOE object has been set\n";
+	return -1;
+      }
+    return theSOE->LinearSOE::solve(B,X);
+  }
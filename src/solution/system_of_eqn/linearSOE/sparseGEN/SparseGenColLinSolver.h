@@ -69,6 +69,7 @@
 #include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
 namespace XC {
 class SparseGenColLinSOE;
+class Matrix;
 
 //! @ingroup LinearSolver
 //
@@ -82,6 +83,8 @@ class SparseGenColLinSolver: public LinearSOESolver
     virtual bool setLinearSOE(LinearSOE *theSOE);
   public:
     virtual bool setLinearSOE(SparseGenColLinSOE &theSOE);
+    using LinearSOESolver::solve;
+    virtual int solve(const Matrix &B,Matrix &X);
   };
 } // end of XC namespace
 
@@ -60,13 +60,14 @@
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 //! @brief Constructor.
 //!
 //! @param owr: analysis aggregation that owns this object.
 XC::SparseGenRowLinSOE::SparseGenRowLinSOE(AnalysisAggregation *owr)
-  : SparseGenSOEBase(owr,LinSOE_TAGS_SparseGenRowLinSOE) {}
+  : SparseGenSOEBase(owr,LinSOE_TAGS_SparseGenRowLinSOE,0,0,SparseScatterMaps::ROW_COMPRESSED) {}
 
 bool XC::SparseGenRowLinSOE::setSolver(LinearSOESolver *newSolver)
   {
@@ -95,6 +96,7 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
 	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
       }
     nnz = newNNZ;
+    scatterMaps.clear(); // sparsity pattern changed.
 
     if(newNNZ > A.Size())
       { // we have to get more space for A and colA
@@ -169,6 +171,34 @@ int XC::SparseGenRowLinSOE::setSize(Graph &theGraph)
     return result;
 }
 
+//! @brief Sets the size of the system from the compressed DOF graph.
+int XC::SparseGenRowLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    size= checkSize(theGraph);
+    nnz= theGraph.getAdjacency().size()+size; // +size for the diag entries
+    scatterMaps.clear(); // sparsity pattern changed.
+
+    if(nnz > A.Size())
+      A.resize(nnz);
+    A.Zero();
+    factored = false;
+    if(size > B.Size())
+      inic(size);
+
+    // fill in rowStartA and colA
+    if(theGraph.getCompressedPattern(rowStartA,colA,true)<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING : the vertices of the graph"
+		  << " are not the equation numbers - size set to 0.\n";
+        size= 0;
+        return -1;
+      }
+    // invoke setSize() on the Solver    
+    const int solverOK= setSolverSize();
+    return (solverOK<0 ? solverOK : 0);
+  }
+
 int 
 XC::SparseGenRowLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fact)
 {
@@ -184,6 +214,9 @@ XC::SparseGenRowLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fact)
 	std::cerr << " - Matrix and XC::ID not of similar sizes\n";
 	return -1;
     }
+
+    if(scatterMaps.isActive())
+      return scatterMaps.addA(A,rowStartA,colA,size,m,id,fact);
     
     if (fact == 1.0) { // do not need to multiply 
 	for (int i=0; i<idSize; i++) {
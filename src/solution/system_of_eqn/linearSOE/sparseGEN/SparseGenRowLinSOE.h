@@ -83,6 +83,7 @@ class SparseGenRowLinSOE : public SparseGenSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     
     int sendSelf(CommParameters &);
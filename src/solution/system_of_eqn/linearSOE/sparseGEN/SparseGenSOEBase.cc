@@ -34,8 +34,9 @@
 //! @param classTag: class identifier.
 //! @param N: system size.
 //! @param NNZ: number of non-zeros.
-XC::SparseGenSOEBase::SparseGenSOEBase(AnalysisAggregation *owr,int classTag,int N, int NNZ)
-  :SparseSOEBase(owr,classTag,N,NNZ) {}
+//! @param s: storage scheme (column or row compressed).
+XC::SparseGenSOEBase::SparseGenSOEBase(AnalysisAggregation *owr,int classTag,int N, int NNZ, const SparseScatterMaps::StorageScheme &s)
+  :SparseSOEBase(owr,classTag,N,NNZ), scatterMaps(s) {}
 
 //! @brief Zeros the entries in the 1d array for \f$A\f$ and marks the system
 //! as not having been factored.
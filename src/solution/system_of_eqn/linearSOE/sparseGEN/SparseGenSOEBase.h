@@ -32,6 +32,7 @@
 
 #include <solution/system_of_eqn/linearSOE/SparseSOEBase.h>
 #include "utility/matrix/Vector.h"
+#include "solution/system_of_eqn/linearSOE/SparseScatterMaps.h"
 
 namespace XC {
 
@@ -42,10 +43,19 @@ class SparseGenSOEBase: public SparseSOEBase
   {
   protected:
     Vector A; //! 1d array containing coefficient of A
-    SparseGenSOEBase(AnalysisAggregation *,int classTag,int N= 0, int NNZ= 0);
+    SparseScatterMaps scatterMaps; //!< element to A positions maps.
+    SparseGenSOEBase(AnalysisAggregation *,int classTag,int N= 0, int NNZ= 0, const SparseScatterMaps::StorageScheme &s= SparseScatterMaps::COLUMN_COMPRESSED);
 
   public:
     virtual void zeroA(void);
+
+    //! @brief Return true if the assembly uses precomputed scatter maps.
+    inline bool getUseScatterMaps(void) const
+      { return scatterMaps.isActive(); }
+    //! @brief Activate/deactivate the use of precomputed scatter maps
+    //! in the assembly of the matrix.
+    inline void setUseScatterMaps(const bool &b)
+      { scatterMaps.setActive(b); }
   };
 } // end of XC namespace
 
@@ -60,6 +60,7 @@
 
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SuperLU.h>
 #include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenColLinSOE.h>
+#include <utility/matrix/Matrix.h>
 #include <cmath>
 
 
@@ -147,6 +148,7 @@ void XC::SuperLU::alloc_matrices(const size_t &n)
     get_perm_c(permSpec, &A, perm_c.getDataPtr());
 
     sp_preorder(&options, &A, perm_c.getDataPtr(), etree.getDataPtr(), &AC);
+    numSymbolicFactorizations++;
 
     // create the rhs SuperMatrix B 
     dCreate_Dense_Matrix(&B, n, 1, theSOE->getPtrX(), n, SLU_DN, SLU_D, SLU_GE);
@@ -202,7 +204,7 @@ XC::LinearSOESolver *XC::SuperLU::getCopy(void) const
 //! panel in the elimination. For more information on these values see the
 //! SuperLU manual.
 XC::SuperLU::SuperLU(int perm, double drop_tolerance, int panel, int relx, char symm)
-  :SparseGenColLinSolver(SOLVER_TAGS_SuperLU), relax(relx), permSpec(perm), panelSize(panel), drop_tol(drop_tolerance), symmetric(symm)
+  :SparseGenColLinSolver(SOLVER_TAGS_SuperLU), relax(relx), permSpec(perm), panelSize(panel), drop_tol(drop_tolerance), symmetric(symm), luReady(false), numSymbolicFactorizations(0), numNumericFactorizations(0)
   {
     // set_default_options(&options);
     options.Fact = DOFACT;
@@ -231,41 +233,70 @@ XC::SuperLU::~SuperLU(void)
   { free_mem(); }
 
 //! @brief Compute the LU factorization of A.
+//!
+//! The column permutation and the elimination tree are computed
+//! only when the sparsity pattern changes (see setSize). The first
+//! factorization with a new pattern computes the row permutation
+//! (partial pivoting); the following ones reuse it together with
+//! the memory of the L and U factors (SamePattern_SameRowPerm),
+//! SuperLU falls back to partial pivoting in the columns whose
+//! previous pivot doesn't meet the pivoting threshold.
 int XC::SuperLU::factorize(void)
   {
     int retval= 0;
     if(theSOE->factored == false)
       {
         // factor the matrix
-        free_matricesLU();
+        void *oldLStore= nullptr, *oldUStore= nullptr;
+        if(luReady)
+          {
+            options.Fact= SamePattern_SameRowPerm;
+            oldLStore= L.Store;
+            oldUStore= U.Store;
+          }
+        else
+          {
+            options.Fact= DOFACT;
+            free_matricesLU();
+          }
         int info= 0;
         SuperLUStat_t slu_stat;
-	GlobalLU_t global_lu_t; //Ubuntu 18 
         StatInit(&slu_stat);
 
 
         //Prior to Ubuntu 16: dgstrf(&options, &AC, drop_tol, relax, &panelSize,etree.getDataPtr(), 0, perm_c.getDataPtr(), perm_r.getDataPtr(), &L, &U, &slu_stat, &info);
 	//it seems that argument 'drop_tol' is deprecated (or it was an error?)
         //Prior to Ubuntu 18: dgstrf(&options, &AC, relax, panelSize,etree.getDataPtr(), nullptr, 0, perm_c.getDataPtr(), perm_r.getDataPtr(), &L, &U, &slu_stat, &info);
-        dgstrf(&options, &AC, relax, panelSize,etree.getDataPtr(), nullptr, 0, perm_c.getDataPtr(), perm_r.getDataPtr(), &L, &U, &global_lu_t, &slu_stat, &info);	
+        dgstrf(&options, &AC, relax, panelSize,etree.getDataPtr(), nullptr, 0, perm_c.getDataPtr(), perm_r.getDataPtr(), &L, &U, &glu, &slu_stat, &info);	
+        numNumericFactorizations++;
+        // dgstrf creates new headers for the (reused) factors.
+        if(oldLStore && (oldLStore!=L.Store))
+          SUPERLU_FREE(oldLStore);
+        if(oldUStore && (oldUStore!=U.Store))
+          SUPERLU_FREE(oldUStore);
         if(info != 0)
           {        
              std::cerr << getClassName() << "::" << __FUNCTION__
 		       << "; WARNING - error " << info
 		       << " returned in factorization dgstrf()\n";
              retval= -info;
+             luReady= false; // next time start from scratch.
           }
-        StatFree(&slu_stat);
-
-        if(symmetric == 'Y')
-          options.Fact= SamePattern_SameRowPerm;
         else
-          options.Fact = SamePattern;
+          luReady= true;
+        StatFree(&slu_stat);
         theSOE->factored = true;
       }
     return retval;
   }
 
+//! @brief Reset the factorization counters.
+void XC::SuperLU::resetCounters(void)
+  {
+    numSymbolicFactorizations= 0;
+    numNumericFactorizations= 0;
+  }
+
 //! @brief Solve the system.
 //!
 //! First copies \f$B\f$ into \f$X\f$ and then solves the FullGenLinSOE system 
@@ -337,6 +368,64 @@ int XC::SuperLU::solve(void)
   }
 
 
+//! @brief Computes the solutions for the right hand sides in the
+//! columns of \p B.
+//!
+//! Copies \p B into \p X, factors the matrix if the system is marked
+//! as not having been factored and then calls dgstrs() with all the right
+//! hand sides at once.
+int XC::SuperLU::solve(const Matrix &Bm,Matrix &X)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - no LinearSOE object has been set\n";
+        return -1;
+      }
+    const int n= theSOE->size;
+    if(Bm.noRows()!=n)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the number of rows of the right hand side matrix ("
+		  << Bm.noRows() << ") doesn't match the number of equations ("
+		  << n << ").\n";
+        return -1;
+      }
+    const int nrhs= Bm.noCols();
+    X= Bm; // first copy B into X (column major storage).
+    if((n==0) || (nrhs==0))
+      return 0;
+    if(perm_r.Size() != n)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING - size for row and col permutations"
+		  << " are 0 - has setSize() been called?\n";
+	return -1;
+      }
+    int retval= factorize();
+    if(retval==0)
+      {
+        SuperMatrix BX;
+        dCreate_Dense_Matrix(&BX, n, nrhs, X.getDataPtr(), n, SLU_DN, SLU_D, SLU_GE);
+        // do forward and backward substitution
+        trans_t trans= NOTRANS;
+        int info= 0;
+        SuperLUStat_t slu_stat;
+        StatInit(&slu_stat);
+        dgstrs(trans, &L, &U, perm_c.getDataPtr(), perm_r.getDataPtr(), &BX, &slu_stat, &info);    
+        StatFree(&slu_stat);
+        Destroy_SuperMatrix_Store(&BX);
+        if(info != 0)
+          {        
+            std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING - "
+		      << " error " << info << " returned in substitution dgstrs()\n";
+            retval= -info;
+          }
+      }
+    return retval;
+  }
+
 //! @brief Set the system size.
 //! 
 //! Obtains the size of the system from it's associaed SparseGenColLinSOE
@@ -362,6 +451,7 @@ int XC::SuperLU::setSize(void)
 		    << "SuperLU, sometimes, fails when dimension"
 	            << " of the system is changed." << std::endl;
         alloc(n);
+        luReady= false; // new pattern: compute the row permutation again.
         
         // set the refact variable to 'N' after first factorization with new_ size 
         // can set to 'Y'.
@@ -102,6 +102,10 @@ class SuperLU : public SparseGenColLinSolver
     double drop_tol;
     char symmetric;
     superlu_options_t options;
+    GlobalLU_t glu; //!< Memory of the L and U factors (reused by the refactorizations).
+    bool luReady; //!< True if L and U hold a valid factorization of the current pattern.
+    size_t numSymbolicFactorizations; //!< Number of column orderings and symbolic analysis.
+    size_t numNumericFactorizations; //!< Number of numeric factorizations.
     void free_matricesLU(void);
     void free_matricesABAC(void);
     void free_matrices(void);
@@ -121,8 +125,18 @@ class SuperLU : public SparseGenColLinSolver
     ~SuperLU(void);
 
     int solve(void);
+    int solve(const Matrix &B,Matrix &X);
     int setSize(void);
 
+    //! @brief Return the number of column orderings and symbolic
+    //! analysis (once each time the sparsity pattern changes).
+    inline size_t getNumSymbolicFactorizations(void) const
+      { return numSymbolicFactorizations; }
+    //! @brief Return the number of numeric factorizations.
+    inline size_t getNumNumericFactorizations(void) const
+      { return numNumericFactorizations; }
+    void resetCounters(void);
+
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
 
@@ -0,0 +1,204 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MultifrontalSPDLinSOE.cc
+
+#include <solution/system_of_eqn/linearSOE/sparseSYM/MultifrontalSPDLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/MultifrontalSPDLinSolver.h>
+#include <utility/matrix/Matrix.h>
+#include <utility/matrix/Vector.h>
+#include "solution/graph/graph/Graph.h"
+#include <solution/graph/graph/Vertex.h>
+#include "solution/graph/graph/CSRGraph.h"
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param owr: analysis aggregation that owns this object.
+XC::MultifrontalSPDLinSOE::MultifrontalSPDLinSOE(AnalysisAggregation *owr)
+  :SparseGenSOEBase(owr,LinSOE_TAGS_MultifrontalSPDLinSOE) {}
+
+//! @brief Set the solver to use.
+bool XC::MultifrontalSPDLinSOE::setSolver(LinearSOESolver *newSolver)
+  {
+    bool retval= false;
+    MultifrontalSPDLinSolver *tmp= dynamic_cast<MultifrontalSPDLinSolver *>(newSolver);
+    if(tmp)
+      retval= SparseGenSOEBase::setSolver(tmp);
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; solver type incompatible with this system of equations."
+		<< std::endl;
+    return retval;
+  }
+
+//! @brief Sets the size of the system from the graph.
+//!
+//! The graph must contain \p size vertices labelled \f$0\f$ through
+//! \f$size-1\f$. For each vertex the diagonal and the adjacent
+//! vertices with a greater label are stored in rowA (the adjacency
+//! sets are already sorted).
+int XC::MultifrontalSPDLinSOE::setSize(Graph &theGraph)
+  {
+    size= checkSize(theGraph);
+    scatterMaps.clear(); // sparsity pattern changed.
+    factored= false;
+    if(size > B.Size())
+      inic(size);
+    colStartA.resize(size+1);
+    colStartA(0)= 0;
+    int lastLoc= 0;
+    std::vector<int> rows;
+    for(int a= 0;a<size;a++)
+      {
+        const Vertex *theVertex= theGraph.getVertexPtr(a);
+        if(!theVertex)
+          {
+	    std::cerr << getClassName() << "::" << __FUNCTION__
+		      << "; WARNING : vertex " << a
+		      << " not in graph! - size set to 0.\n";
+	    size= 0; nnz= 0;
+	    return -1;
+	  }
+        rows.push_back(a); // diagonal first.
+	const std::set<int> &theAdjacency= theVertex->getAdjacency();
+        for(std::set<int>::const_iterator i= theAdjacency.upper_bound(a); i!=theAdjacency.end(); i++)
+          rows.push_back(*i);
+        lastLoc= rows.size();
+        colStartA(a+1)= lastLoc;
+      }
+    nnz= lastLoc;
+    rowA.resize(nnz);
+    for(int k= 0;k<nnz;k++)
+      rowA(k)= rows[k];
+    if(nnz > A.Size())
+      A.resize(nnz);
+    A.Zero();
+    // invoke setSize() on the Solver    
+    const int solverOK= setSolverSize();
+    return (solverOK<0 ? solverOK : 0);
+  }
+
+//! @brief Sets the size of the system from the compressed DOF graph.
+//!
+//! Same as setSize(Graph &) but reading the (sorted) adjacency
+//! of each vertex from the compressed graph.
+int XC::MultifrontalSPDLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    size= checkSize(theGraph);
+    scatterMaps.clear(); // sparsity pattern changed.
+    factored= false;
+    if(!theGraph.hasConsecutiveTags())
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING : the vertices of the graph"
+		  << " are not the equation numbers - size set to 0.\n";
+        size= 0; nnz= 0;
+        return -1;
+      }
+    if(size > B.Size())
+      inic(size);
+    rowA.resize(theGraph.getAdjacency().size()+size); // +size for the diagonal.
+    colStartA.resize(size+1);
+    int lastLoc= 0;
+    colStartA(0)= 0;
+    for(int v= 0;v<size;v++)
+      {
+        rowA(lastLoc++)= v; // diagonal first.
+        const int *end= theGraph.adjacencyEnd(v);
+        for(const int *i= std::upper_bound(theGraph.adjacencyBegin(v),end,v);i!=end;i++)
+          rowA(lastLoc++)= *i;
+        colStartA(v+1)= lastLoc;
+      }
+    nnz= lastLoc;
+    if(nnz > A.Size())
+      A.resize(nnz);
+    A.Zero();
+    // invoke setSize() on the Solver    
+    const int solverOK= setSolverSize();
+    return (solverOK<0 ? solverOK : 0);
+  }
+
+//! @brief Return the position in A of the coefficient (row,col)
+//! (row must not be less than col) or -1 if it's not stored.
+int XC::MultifrontalSPDLinSOE::find(const int &row, const int &col) const
+  {
+    const int *begin= rowA.getDataPtr()+colStartA(col);
+    const int *end= rowA.getDataPtr()+colStartA(col+1);
+    const int *i= std::lower_bound(begin,end,row);
+    return ((i!=end) && (*i==row)) ? (i-rowA.getDataPtr()) : -1;
+  }
+
+//! @brief Assemblies the product fact*m into the system matrix.
+//!
+//! Only the coefficients of \p m that fall in the lower triangle
+//! of \f$A\f$ are assembled (\p m is supposed to be symmetric).
+//! If the scatter maps are active (see setUseScatterMaps) the
+//! positions of the coefficients in \f$A\f$ are computed only the first
+//! time the element is assembled after each call to setSize.
+int XC::MultifrontalSPDLinSOE::addA(const Matrix &m, const ID &id, double fact)
+  {
+    // check for a quick return 
+    if(fact == 0.0)  
+      return 0;
+
+    const int idSize= id.Size();
+    // check that m and id are of similar size
+    if(idSize != m.noRows() && idSize != m.noCols())
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; Matrix and ID not of similar sizes\n";
+	return -1;
+      }
+
+    if(scatterMaps.isActive()) // use precomputed positions.
+      return scatterMaps.addA(A,colStartA,rowA,size,m,id,fact);
+
+    for(int i= 0;i<idSize;i++)
+      {
+	const int col= id(i);
+	if(col < size && col >= 0)
+          {
+	    for(int j= 0;j<idSize;j++)
+              {
+	        const int row= id(j);
+	        if(row < size && row >= col)
+                  {
+                    const int k= find(row,col);
+                    if(k>=0)
+                      A[k]+= fact*m(j,i);
+                  }
+	      }
+	  }
+      }
+    return 0;
+  }
+
+int XC::MultifrontalSPDLinSOE::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::MultifrontalSPDLinSOE::recvSelf(const CommParameters &cp)  
+  { return 0; }
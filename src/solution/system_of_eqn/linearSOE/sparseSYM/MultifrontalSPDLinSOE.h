@@ -0,0 +1,79 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MultifrontalSPDLinSOE.h
+
+#ifndef MultifrontalSPDLinSOE_h
+#define MultifrontalSPDLinSOE_h
+
+#include <solution/system_of_eqn/linearSOE/sparseGEN/SparseGenSOEBase.h>
+#include "utility/matrix/ID.h"
+
+namespace XC {
+class MultifrontalSPDLinSolver;
+
+//! @ingroup SOE
+//
+//! @brief Sparse symmetric positive definite system of equations
+//! solved by a multifrontal method.
+//!
+//! Only the lower triangle of the matrix \f$A\f$ is stored, in
+//! column compressed form: the coefficients of the column \f$j\f$
+//! (diagonal first, then the rows \f$i > j\f$ in ascending order) are
+//! stored in the positions colStartA(j) through colStartA(j+1)-1
+//! of A, rowA storing the row of each coefficient. The equations
+//! are not renumbered here: the fill reducing ordering and the
+//! symbolic factorization are computed by the solver (see
+//! MultifrontalSPDLinSolver) each time the size of the system is set.
+class MultifrontalSPDLinSOE : public SparseGenSOEBase
+  {
+  protected:
+    ID rowA; //!< row of each coefficient.
+    ID colStartA; //!< beginning of each column in A.
+
+    int find(const int &, const int &) const;
+    virtual bool setSolver(LinearSOESolver *);
+
+    friend class AnalysisAggregation;
+    friend class FEM_ObjectBroker;
+    MultifrontalSPDLinSOE(AnalysisAggregation *);
+    SystemOfEqn *getCopy(void) const;
+  public:
+    virtual int setSize(Graph &theGraph);
+    virtual int setSize(const CSRGraph &theGraph);
+    virtual int addA(const Matrix &, const ID &, double fact = 1.0);
+
+    virtual int sendSelf(CommParameters &);
+    virtual int recvSelf(const CommParameters &);
+
+    friend class MultifrontalSPDLinSolver;
+  };
+inline SystemOfEqn *MultifrontalSPDLinSOE::getCopy(void) const
+  { return new MultifrontalSPDLinSOE(*this); }
+} // end of XC namespace
+
+
+#endif
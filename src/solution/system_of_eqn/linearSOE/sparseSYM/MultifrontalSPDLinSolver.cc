@@ -0,0 +1,605 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MultifrontalSPDLinSolver.cc
+
+#include <solution/system_of_eqn/linearSOE/sparseSYM/MultifrontalSPDLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/MultifrontalSPDLinSOE.h>
+#include "solution/graph/partitioner/Metis.h"
+#include "utility/ThreadPool.h"
+#include <algorithm>
+#include <cmath>
+
+//! @brief Constructor.
+//!
+//! @param tol: minimum absolute value allowed for the pivots.
+XC::MultifrontalSPDLinSolver::MultifrontalSPDLinSolver(double tol)
+  :LinearSOESolver(SOLVER_TAGS_MultifrontalSPDLinSolver), theSOE(nullptr),
+   minDiagTol(tol), size(0), numSymbolicFactorizations(0),
+   numNumericFactorizations(0) {}
+
+//! @brief Sets the system of equations to solve.
+bool XC::MultifrontalSPDLinSolver::setLinearSOE(LinearSOE *soe)
+  {
+    bool retval= false;
+    MultifrontalSPDLinSOE *tmp= dynamic_cast<MultifrontalSPDLinSOE *>(soe);
+    if(tmp)
+      {
+        theSOE= tmp;
+        retval= true;
+      }
+    else
+      std::cerr << getClassName() << "::" << __FUNCTION__
+		<< "; not a suitable system of equations" << std::endl;
+    return retval;
+  }
+
+//! @brief Reset the factorization counters.
+void XC::MultifrontalSPDLinSolver::resetCounters(void)
+  {
+    numSymbolicFactorizations= 0;
+    numNumericFactorizations= 0;
+  }
+
+//! @brief Compute the ordering, the elimination tree and the
+//! structure of the supernodes (see class description).
+int XC::MultifrontalSPDLinSolver::symbolic(void)
+  {
+    size= theSOE->size;
+    const int n= size;
+    superFirst.clear(); childStart.clear(); children.clear();
+    rowStart.clear(); rowIdx.clear(); relPos.clear(); valueStart.clear();
+    assemblyStart.clear(); assemblySrc.clear(); assemblyPos.clear();
+    levelStart.clear(); levels.clear(); Lx.clear(); D.clear();
+    updates.clear();
+    if(n==0)
+      return 0;
+    const int *colStart= theSOE->colStartA.getDataPtr();
+    const int *rowA= theSOE->rowA.getDataPtr();
+    const int nnz= colStart[n];
+
+    // adjacency graph of the matrix (both triangles, no diagonal).
+    std::vector<int> xadj(n+1,0);
+    for(int j= 0;j<n;j++)
+      for(int k= colStart[j];k<colStart[j+1];k++)
+        {
+          const int i= rowA[k];
+          if(i!=j)
+            { xadj[i+1]++; xadj[j+1]++; }
+        }
+    for(int j= 0;j<n;j++)
+      xadj[j+1]+= xadj[j];
+    std::vector<int> adjncy(xadj[n]);
+    std::vector<int> next(xadj.begin(),xadj.end()-1);
+    for(int j= 0;j<n;j++)
+      for(int k= colStart[j];k<colStart[j+1];k++)
+        {
+          const int i= rowA[k];
+          if(i!=j)
+            {
+              adjncy[next[i]++]= j;
+              adjncy[next[j]++]= i;
+            }
+        }
+
+    // fill reducing ordering.
+    if(Metis::nodeND(n,xadj.data(),adjncy.data(),perm,iperm)<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING nested dissection failed,"
+		  << " using the original ordering." << std::endl;
+        for(int i= 0;i<n;i++)
+          { perm[i]= i; iperm[i]= i; }
+      }
+
+    // elimination tree of the reordered matrix.
+    std::vector<int> parent(n,-1), ancestor(n,-1);
+    for(int k= 0;k<n;k++)
+      {
+        const int v= perm[k];
+        for(int p= xadj[v];p<xadj[v+1];p++)
+          {
+            int i= iperm[adjncy[p]];
+            while((i!=-1) && (i<k))
+              {
+                const int inext= ancestor[i];
+                ancestor[i]= k;
+                if(inext==-1)
+                  parent[i]= k;
+                i= inext;
+              }
+          }
+      }
+
+    // postorder the tree so the columns of each subtree are consecutive.
+    std::vector<int> head(n,-1), sibling(n,-1), post(n), stack;
+    for(int j= n-1;j>=0;j--)
+      if(parent[j]!=-1)
+        {
+          sibling[j]= head[parent[j]];
+          head[parent[j]]= j;
+        }
+    int k= 0;
+    for(int j= 0;j<n;j++)
+      if(parent[j]==-1)
+        {
+          stack.push_back(j);
+          while(!stack.empty())
+            {
+              const int p= stack.back();
+              const int c= head[p];
+              if(c==-1)
+                {
+                  stack.pop_back();
+                  post[k++]= p;
+                }
+              else
+                {
+                  head[p]= sibling[c];
+                  stack.push_back(c);
+                }
+            }
+        }
+    std::vector<int> ipost(n), oldPerm(perm);
+    for(int i= 0;i<n;i++)
+      ipost[post[i]]= i;
+    for(int i= 0;i<n;i++)
+      {
+        perm[i]= oldPerm[post[i]];
+        iperm[perm[i]]= i;
+        head[i]= parent[post[i]]; // head used as temporary.
+      }
+    for(int i= 0;i<n;i++)
+      parent[i]= (head[i]==-1 ? -1 : ipost[head[i]]);
+
+    // number of non-zeros of each column of L (row subtrees).
+    std::vector<int> colCount(n,1), mark(n,-1), numChildren(n,0);
+    for(int i= 0;i<n;i++)
+      {
+        mark[i]= i;
+        const int v= perm[i];
+        for(int p= xadj[v];p<xadj[v+1];p++)
+          {
+            int j= iperm[adjncy[p]];
+            if(j<i)
+              while(mark[j]!=i)
+                {
+                  colCount[j]++;
+                  mark[j]= i;
+                  j= parent[j];
+                }
+          }
+        if(parent[i]!=-1)
+          numChildren[parent[i]]++;
+      }
+
+    // fundamental supernodes.
+    superFirst.push_back(0);
+    for(int j= 1;j<n;j++)
+      if((parent[j-1]!=j) || (colCount[j-1]!=colCount[j]+1) || (numChildren[j]!=1))
+        superFirst.push_back(j);
+    superFirst.push_back(n);
+    const int ns= superFirst.size()-1;
+    std::vector<int> col2super(n);
+    for(int s= 0;s<ns;s++)
+      for(int j= superFirst[s];j<superFirst[s+1];j++)
+        col2super[j]= s;
+    std::vector<int> superParent(ns,-1);
+    childStart.assign(ns+1,0);
+    for(int s= 0;s<ns;s++)
+      {
+        const int p= parent[superFirst[s+1]-1];
+        if(p!=-1)
+          {
+            superParent[s]= col2super[p];
+            childStart[superParent[s]+1]++;
+          }
+      }
+    for(int s= 0;s<ns;s++)
+      childStart[s+1]+= childStart[s];
+    children.resize(childStart[ns]);
+    next.assign(childStart.begin(),childStart.end()-1);
+    for(int s= 0;s<ns;s++)
+      if(superParent[s]!=-1)
+        children[next[superParent[s]]++]= s;
+
+    // rows of each supernode: its columns followed by the rows of
+    // the original matrix and of the update matrices of its children.
+    rowStart.assign(ns+1,0);
+    mark.assign(n,-1);
+    std::vector<int> tmp;
+    for(int s= 0;s<ns;s++)
+      {
+        const int f= superFirst[s];
+        const int l= superFirst[s+1];
+        rowStart[s]= rowIdx.size();
+        for(int c= f;c<l;c++)
+          {
+            rowIdx.push_back(c);
+            mark[c]= s;
+          }
+        tmp.clear();
+        for(int c= f;c<l;c++)
+          {
+            const int v= perm[c];
+            for(int p= xadj[v];p<xadj[v+1];p++)
+              {
+                const int r= iperm[adjncy[p]];
+                if((r>=l) && (mark[r]!=s))
+                  { mark[r]= s; tmp.push_back(r); }
+              }
+          }
+        for(int ic= childStart[s];ic<childStart[s+1];ic++)
+          {
+            const int ch= children[ic];
+            const int begin= rowStart[ch]+superFirst[ch+1]-superFirst[ch];
+            for(int q= begin;q<rowStart[ch+1];q++)
+              {
+                const int r= rowIdx[q];
+                if((r>=l) && (mark[r]!=s))
+                  { mark[r]= s; tmp.push_back(r); }
+              }
+          }
+        std::sort(tmp.begin(),tmp.end());
+        rowIdx.insert(rowIdx.end(),tmp.begin(),tmp.end());
+        rowStart[s+1]= rowIdx.size();
+      }
+
+    // position of the update rows of each supernode in the front of its parent.
+    relPos.assign(rowIdx.size(),-1);
+    std::vector<int> &loc= mark; // position of each row in the current front.
+    for(int s= 0;s<ns;s++)
+      {
+        for(int q= rowStart[s];q<rowStart[s+1];q++)
+          loc[rowIdx[q]]= q-rowStart[s];
+        for(int ic= childStart[s];ic<childStart[s+1];ic++)
+          {
+            const int ch= children[ic];
+            const int begin= rowStart[ch]+superFirst[ch+1]-superFirst[ch];
+            for(int q= begin;q<rowStart[ch+1];q++)
+              relPos[q]= loc[rowIdx[q]];
+          }
+      }
+
+    // position in the fronts of the coefficients of A.
+    std::vector<int> colOf(nnz);
+    assemblyStart.assign(ns+1,0);
+    for(int j= 0;j<n;j++)
+      for(int k= colStart[j];k<colStart[j+1];k++)
+        {
+          colOf[k]= j;
+          const int lo= std::min(iperm[j],iperm[rowA[k]]);
+          assemblyStart[col2super[lo]+1]++;
+        }
+    for(int s= 0;s<ns;s++)
+      assemblyStart[s+1]+= assemblyStart[s];
+    assemblySrc.resize(nnz);
+    assemblyPos.resize(nnz);
+    next.assign(assemblyStart.begin(),assemblyStart.end()-1);
+    for(int k= 0;k<nnz;k++)
+      {
+        const int lo= std::min(iperm[colOf[k]],iperm[rowA[k]]);
+        assemblySrc[next[col2super[lo]]++]= k;
+      }
+    for(int s= 0;s<ns;s++)
+      {
+        const int m= rowStart[s+1]-rowStart[s];
+        for(int q= rowStart[s];q<rowStart[s+1];q++)
+          loc[rowIdx[q]]= q-rowStart[s];
+        for(int a= assemblyStart[s];a<assemblyStart[s+1];a++)
+          {
+            const int k= assemblySrc[a];
+            const int i= iperm[rowA[k]];
+            const int j= iperm[colOf[k]];
+            const int lo= std::min(i,j);
+            const int hi= std::max(i,j);
+            assemblyPos[a]= (lo-superFirst[s])*m+loc[hi];
+          }
+      }
+
+    // storage of the factor.
+    valueStart.assign(ns+1,0);
+    for(int s= 0;s<ns;s++)
+      {
+        const size_t m= rowStart[s+1]-rowStart[s];
+        const size_t nc= superFirst[s+1]-superFirst[s];
+        valueStart[s+1]= valueStart[s]+m*nc;
+      }
+    Lx.assign(valueStart[ns],0.0);
+    D.assign(n,0.0);
+    updates.resize(ns);
+
+    // levels of the supernodal tree (the children
+    // of a supernode are in the previous levels).
+    std::vector<int> height(ns,0);
+    int numLevels= 0;
+    for(int s= 0;s<ns;s++)
+      {
+        if(superParent[s]!=-1)
+          height[superParent[s]]= std::max(height[superParent[s]],height[s]+1);
+        numLevels= std::max(numLevels,height[s]+1);
+      }
+    levelStart.assign(numLevels+1,0);
+    for(int s= 0;s<ns;s++)
+      levelStart[height[s]+1]++;
+    for(int lv= 0;lv<numLevels;lv++)
+      levelStart[lv+1]+= levelStart[lv];
+    levels.resize(ns);
+    next.assign(levelStart.begin(),levelStart.end()-1);
+    for(int s= 0;s<ns;s++)
+      levels[next[height[s]]++]= s;
+    numSymbolicFactorizations++;
+    return 0;
+  }
+
+//! @brief Assemble the coefficients of A and the update matrices
+//! of the children into the front of the supernode \p s.
+//!
+//! @param s: index of the supernode.
+//! @param U: update matrix of the supernode (lower triangle, column major).
+void XC::MultifrontalSPDLinSolver::assembleFront(const int &s, std::vector<double> &U)
+  {
+    const int nc= superFirst[s+1]-superFirst[s];
+    const int m= rowStart[s+1]-rowStart[s];
+    const int nu= m-nc;
+    double *F= Lx.data()+valueStart[s];
+    std::fill(F,F+size_t(m)*nc,0.0);
+    U.assign(size_t(nu)*nu,0.0);
+    const double *A= theSOE->A.getDataPtr();
+    for(int a= assemblyStart[s];a<assemblyStart[s+1];a++)
+      F[assemblyPos[a]]+= A[assemblySrc[a]];
+    for(int ic= childStart[s];ic<childStart[s+1];ic++)
+      {
+        const int ch= children[ic];
+        const int cnc= superFirst[ch+1]-superFirst[ch];
+        const int cnu= rowStart[ch+1]-rowStart[ch]-cnc;
+        const int *rp= relPos.data()+rowStart[ch]+cnc;
+        const double *Uc= updates[ch].data();
+        for(int jj= 0;jj<cnu;jj++)
+          {
+            const int pj= rp[jj];
+            const double *ucol= Uc+size_t(jj)*cnu;
+            if(pj<nc) // pivot column.
+              {
+                double *fcol= F+size_t(pj)*m;
+                for(int ii= jj;ii<cnu;ii++)
+                  fcol[rp[ii]]+= ucol[ii];
+              }
+            else
+              {
+                double *fcol= U.data()+size_t(pj-nc)*nu;
+                for(int ii= jj;ii<cnu;ii++)
+                  fcol[rp[ii]-nc]+= ucol[ii];
+              }
+          }
+        std::vector<double>().swap(updates[ch]); // not needed anymore.
+      }
+  }
+
+//! @brief Factor the front of the supernode \p s.
+//!
+//! The pivot columns are factored and divided by its pivot (which
+//! is stored in D) and then the update matrix
+//! \f$U= F_{22} - L_{21} D L_{21}^t\f$ is computed. If \p pool
+//! is not null, its threads compute the columns of \f$U\f$.
+int XC::MultifrontalSPDLinSolver::factorFront(const int &s, ThreadPool *pool)
+  {
+    std::vector<double> &U= updates[s];
+    assembleFront(s,U);
+    const int f= superFirst[s];
+    const int nc= superFirst[s+1]-f;
+    const int m= rowStart[s+1]-rowStart[s];
+    const int nu= m-nc;
+    double *F= Lx.data()+valueStart[s];
+    const double *d= D.data()+f;
+
+    // pivot columns (left-looking inside the front).
+    for(int j= 0;j<nc;j++)
+      {
+        double *Fj= F+size_t(j)*m;
+        for(int k= 0;k<j;k++)
+          {
+            const double *Fk= F+size_t(k)*m;
+            const double w= Fk[j]*d[k];
+            if(w!=0.0)
+              for(int i= j;i<m;i++)
+                Fj[i]-= Fk[i]*w;
+          }
+        const double djj= Fj[j];
+        if(std::abs(djj)<=minDiagTol)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; pivot too small (equation, pivot): ("
+                      << perm[f+j] << ", " << djj << ")\n"; 
+            return -2;
+          }
+        D[f+j]= djj;
+        Fj[j]= 1.0;
+        const double inv= 1.0/djj;
+        for(int i= j+1;i<m;i++)
+          Fj[i]*= inv;
+      }
+
+    // update matrix.
+    if(nu>0)
+      {
+        ThreadPool::loop_body body= [F,d,m,nc,nu,&U](const size_t &j, const size_t &)
+          {
+            double *Uj= U.data()+j*nu;
+            for(int k= 0;k<nc;k++)
+              {
+                const double *Lk= F+size_t(k)*m+nc;
+                const double w= Lk[j]*d[k];
+                if(w!=0.0)
+                  for(int i= j;i<nu;i++)
+                    Uj[i]-= Lk[i]*w;
+              }
+          };
+        if(pool && (nu>1))
+          pool->parallel_for(nu,body);
+        else
+          for(int j= 0;j<nu;j++)
+            body(j,0);
+      }
+    return 0;
+  }
+
+//! @brief Compute the numerical factorization \f$P A P^t= L D L^t\f$.
+//!
+//! The levels of the supernodal tree are processed from the
+//! leaves to the root. The fronts of a level are factored in parallel
+//! if there is more than one; otherwise the threads are used inside
+//! the front.
+int XC::MultifrontalSPDLinSolver::factor(void)
+  {
+    ThreadPool *pool= theSOE->getThreadPool();
+    int retval= 0;
+    const int numLevels= levelStart.size()-1;
+    for(int lv= 0;(lv<numLevels) && (retval==0);lv++)
+      {
+        const int l0= levelStart[lv];
+        const size_t numFronts= levelStart[lv+1]-l0;
+        if(pool && (numFronts>1))
+          {
+            std::vector<int> status(numFronts,0);
+            ThreadPool::loop_body body= [this,l0,&status](const size_t &i, const size_t &)
+              { status[i]= factorFront(levels[l0+i],nullptr); };
+            pool->parallel_for(numFronts,body,1);
+            for(size_t i= 0;i<numFronts;i++)
+              if(status[i]<0)
+                retval= status[i];
+          }
+        else
+          for(size_t i= 0;(i<numFronts) && (retval==0);i++)
+            retval= factorFront(levels[l0+i],pool);
+      }
+    const int ns= getNumSupernodes();
+    for(int s= 0;s<ns;s++)
+      std::vector<double>().swap(updates[s]);
+    numNumericFactorizations++;
+    return retval;
+  }
+
+//! @brief Computes the solution.
+//!
+//! If the matrix is not already factored, factors it. Then computes
+//! \f$x= P^t L^{-t} D^{-1} L^{-1} P b\f$.
+int XC::MultifrontalSPDLinSolver::solve(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been assigned\n";
+	return -1;
+      }
+    const int n= theSOE->size;
+    if(n == 0)
+      return 0;
+    if(n != size)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; the size of the system has changed"
+	          << " and setSize has not been called.\n";
+	return -1;
+      }
+    if(theSOE->factored == false)
+      {
+        const int res= factor();
+        if(res<0)
+          return res;
+        theSOE->factored= true;
+      }
+
+    const double *B= theSOE->getPtrB();
+    double *X= theSOE->getPtrX();
+    work.resize(n);
+    double *y= work.data();
+    for(int i= 0;i<n;i++)
+      y[i]= B[perm[i]];
+
+    const int ns= getNumSupernodes();
+    // forward substitution.
+    for(int s= 0;s<ns;s++)
+      {
+        const int f= superFirst[s];
+        const int nc= superFirst[s+1]-f;
+        const int m= rowStart[s+1]-rowStart[s];
+        const int *rows= rowIdx.data()+rowStart[s];
+        const double *F= Lx.data()+valueStart[s];
+        for(int j= 0;j<nc;j++)
+          {
+            const double yj= y[f+j];
+            if(yj!=0.0)
+              {
+                const double *Lj= F+size_t(j)*m;
+                for(int i= j+1;i<m;i++)
+                  y[rows[i]]-= Lj[i]*yj;
+              }
+          }
+      }
+    // divide by the pivots.
+    for(int i= 0;i<n;i++)
+      y[i]/= D[i];
+    // back substitution.
+    for(int s= ns-1;s>=0;s--)
+      {
+        const int f= superFirst[s];
+        const int nc= superFirst[s+1]-f;
+        const int m= rowStart[s+1]-rowStart[s];
+        const int *rows= rowIdx.data()+rowStart[s];
+        const double *F= Lx.data()+valueStart[s];
+        for(int j= nc-1;j>=0;j--)
+          {
+            const double *Lj= F+size_t(j)*m;
+            double tmp= 0.0;
+            for(int i= j+1;i<m;i++)
+              tmp+= Lj[i]*y[rows[i]];
+            y[f+j]-= tmp;
+          }
+      }
+    for(int i= 0;i<n;i++)
+      X[perm[i]]= y[i];
+    return 0;
+  }
+
+//! @brief Compute the ordering and the symbolic factorization
+//! of the matrix (called each time the sparsity pattern changes).
+int XC::MultifrontalSPDLinSolver::setSize(void)
+  {
+    if(!theSOE)
+      {
+	std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; no system of equations has been set.\n";
+	return -1;
+      }
+    return symbolic();
+  }
+
+int XC::MultifrontalSPDLinSolver::sendSelf(CommParameters &cp)
+  { return 0; }
+
+int XC::MultifrontalSPDLinSolver::recvSelf(const CommParameters &cp)
+  { return 0; }
@@ -0,0 +1,134 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MultifrontalSPDLinSolver.h
+
+#ifndef MultifrontalSPDLinSolver_h
+#define MultifrontalSPDLinSolver_h
+
+#include <solution/system_of_eqn/linearSOE/LinearSOESolver.h>
+#include <vector>
+
+namespace XC {
+class MultifrontalSPDLinSOE;
+class ThreadPool;
+
+//! @ingroup LinearSolver
+//
+//! @brief Supernodal multifrontal \f$LDL^t\f$ solver for
+//! MultifrontalSPDLinSOE objects.
+//!
+//! Each time the sparsity pattern changes (setSize) the solver:
+//! - computes a fill reducing ordering of the equations by nested
+//!   dissection (METIS_NodeND, see Metis::nodeND).
+//! - computes and postorders the elimination tree of the reordered
+//!   matrix, counts the non-zeros of each column of \f$L\f$ and
+//!   groups the columns into fundamental supernodes (consecutive
+//!   columns sharing the same structure below the diagonal).
+//! - computes the rows of each supernode, the position of its update
+//!   rows in the front of its parent and where each coefficient of
+//!   \f$A\f$ goes in the fronts.
+//!
+//! The numerical factorization processes the supernodes from the leaves
+//! to the root of the tree. For each supernode a dense frontal matrix
+//! is assembled from the coefficients of \f$A\f$ and the update
+//! matrices of its children; its pivot columns are factored and the
+//! Schur complement (the update matrix) is passed to the parent. The
+//! supernodes of the same level of the tree are independent, so
+//! they are factored in parallel by the threads of the solution method
+//! pool (see AnalysisAggregation::setNumThreads); when a level has a
+//! single front (the top separators) the threads share the computation
+//! of its update matrix instead.
+//!
+//! No pivoting is done, so the matrix must be symmetric positive
+//! definite (or at least all the pivots \f$d_{ii}\f$ must be far from zero).
+class MultifrontalSPDLinSolver : public LinearSOESolver
+  {
+  private:
+    MultifrontalSPDLinSOE *theSOE; //!< system of equations to solve.
+    double minDiagTol; //!< minimum absolute value allowed for the pivots.
+    int size; //!< number of equations.
+    std::vector<int> perm; //!< equation placed at each position of the ordering.
+    std::vector<int> iperm; //!< position of each equation in the ordering.
+    std::vector<int> superFirst; //!< first column of each supernode.
+    std::vector<int> childStart; //!< beginning of the children of each supernode.
+    std::vector<int> children; //!< children of the supernodes.
+    std::vector<int> rowStart; //!< beginning of the rows of each supernode.
+    std::vector<int> rowIdx; //!< rows of the supernodes (pivot rows first).
+    std::vector<int> relPos; //!< position of each update row in the front of the parent.
+    std::vector<size_t> valueStart; //!< beginning of the columns of each supernode in Lx.
+    std::vector<int> assemblyStart; //!< beginning of the coefficients of A assembled in each front.
+    std::vector<int> assemblySrc; //!< position in A of the coefficient.
+    std::vector<int> assemblyPos; //!< position in the front of the coefficient.
+    std::vector<int> levelStart; //!< beginning of each level of the supernodal tree.
+    std::vector<int> levels; //!< supernodes sorted by level.
+    std::vector<double> Lx; //!< columns of L (one dense block for each supernode).
+    std::vector<double> D; //!< diagonal of D.
+    std::vector<std::vector<double> > updates; //!< update matrices pending to be assembled in its parent.
+    std::vector<double> work; //!< work array for the substitutions.
+    size_t numSymbolicFactorizations; //!< number of orderings and symbolic analysis.
+    size_t numNumericFactorizations; //!< number of numeric factorizations.
+
+    int symbolic(void);
+    void assembleFront(const int &, std::vector<double> &);
+    int factorFront(const int &, ThreadPool *);
+    int factor(void);
+  protected:
+    bool setLinearSOE(LinearSOE *theSOE);
+
+    friend class LinearSOE;
+    friend class FEM_ObjectBroker;
+    MultifrontalSPDLinSolver(double tol= 1.0e-18);
+    virtual LinearSOESolver *getCopy(void) const;
+  public:
+    int solve(void);
+    int setSize(void);
+
+    //! @brief Return the number of supernodes.
+    inline int getNumSupernodes(void) const
+      { return (superFirst.empty() ? 0 : superFirst.size()-1); }
+    //! @brief Return the number of coefficients stored for the factor L
+    //! (dense blocks of the supernodes).
+    inline size_t getFactorSize(void) const
+      { return Lx.size(); }
+    //! @brief Return the number of orderings and symbolic analysis (once
+    //! each time the sparsity pattern changes).
+    inline size_t getNumSymbolicFactorizations(void) const
+      { return numSymbolicFactorizations; }
+    //! @brief Return the number of numeric factorizations.
+    inline size_t getNumNumericFactorizations(void) const
+      { return numNumericFactorizations; }
+    void resetCounters(void);
+
+    int sendSelf(CommParameters &);
+    int recvSelf(const CommParameters &);
+  };
+
+inline LinearSOESolver *MultifrontalSPDLinSolver::getCopy(void) const
+  { return new MultifrontalSPDLinSolver(*this); }
+} // end of XC namespace
+
+#endif
@@ -51,6 +51,7 @@
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 
@@ -215,6 +216,34 @@ int XC::SymSparseLinSOE::setSize(Graph &theGraph)
     return result;
 }
 
+//! @brief Sets the size of the system from the compressed DOF graph
+//! (the adjacency rows are already sorted).
+int XC::SymSparseLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    int result = 0;
+    size= checkSize(theGraph);
+    nnz= theGraph.getAdjacency().size();
+    colA= ID(nnz);
+    factored = false;
+    if(size > B.Size())
+      inic(size);
+
+    // fill in rowStartA and colA
+    if(theGraph.getCompressedPattern(rowStartA,colA,false)<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING : the vertices of the graph"
+		  << " are not the equation numbers - size set to 0.\n";
+        size= 0; nnz= 0;
+        return -1;
+      }
+
+    // call "C" function to form elimination tree and to do the symbolic factorization.
+    nblks = symFactorization(rowStartA.getDataPtr(), colA.getDataPtr(), size, this->LSPARSE,
+			     &xblk, &invp, &rowblks, &begblk, &first, &penv, &diag);
+    return result;
+  }
+
 
 /* Perform the element stiffness assembly here.
  */
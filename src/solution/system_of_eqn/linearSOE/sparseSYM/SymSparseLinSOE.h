@@ -79,6 +79,7 @@ class SymSparseLinSOE : public SparseSOEBase
     ~SymSparseLinSOE(void);
 
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     int addB(const Vector &, const ID &,const double &fact= 1.0);    
     
@@ -68,11 +68,13 @@
 #include "solution/graph/graph/Graph.h"
 #include <solution/graph/graph/Vertex.h>
 #include <solution/graph/graph/VertexIter.h>
+#include "solution/graph/graph/CSRGraph.h"
 #include <cmath>
 
 
 XC::UmfpackGenLinSOE::UmfpackGenLinSOE(AnalysisAggregation *owr)
-  :FactoredSOEBase(owr,LinSOE_TAGS_UmfpackGenLinSOE), nnz(0)
+  :FactoredSOEBase(owr,LinSOE_TAGS_UmfpackGenLinSOE), nnz(0),
+   scatterMaps(SparseScatterMaps::ROW_COMPRESSED)
   {}
 
 
@@ -105,6 +107,7 @@ int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
 	newNNZ += theAdjacency.size() +1; // the +1 is for the diag entry
       }
     nnz = newNNZ;
+    scatterMaps.clear(); // sparsity pattern changed.
     lValue = 20*nnz; // 20 because 3 (10 also) was not working for some instances
 
     std::cerr << "XC::UmfpackGenLinSOE::setSize - n " << size << " nnz " << nnz << " lVal " << lValue << std::endl;
@@ -171,8 +174,44 @@ int XC::UmfpackGenLinSOE::setSize(Graph &theGraph)
 	startLoc = lastLoc;
       }
     }
-    
+    return set_index();
+  }
+
+//! @brief Sets the size of the system from the compressed DOF graph.
+int XC::UmfpackGenLinSOE::setSize(const CSRGraph &theGraph)
+  {
+    size= checkSize(theGraph);
+    nnz= theGraph.getAdjacency().size()+size; // +size for the diag entries
+    scatterMaps.clear(); // sparsity pattern changed.
+    lValue = 20*nnz; // 20 because 3 (10 also) was not working for some instances
 
+    if(lValue > A.Size())
+      {
+        A= Vector(lValue);
+        index= ID(2*nnz);
+      }
+    A.Zero();
+    factored = false;
+    if(size > B.Size())
+      inic(size);
+
+    // fill in rowStartA and colA
+    if(theGraph.getCompressedPattern(rowStartA,colA,true)<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+		  << "; WARNING : the vertices of the graph"
+		  << " are not the equation numbers - size set to 0.\n";
+        size= 0;
+        return -1;
+      }
+    return set_index();
+  }
+
+//! @brief Fills the row and column indexes (FORTRAN style) of
+//! the matrix entries and invokes setSize() on the solver.
+int XC::UmfpackGenLinSOE::set_index(void)
+  {
+    int result= 0;
     // fill out index
     int *indexRowPtr = &index[0];
     int *indexColPtr = &index[nnz];
@@ -212,6 +251,9 @@ int XC::UmfpackGenLinSOE::addA(const XC::Matrix &m, const XC::ID &id, double fac
 	std::cerr << " - Matrix and XC::ID not of similar sizes\n";
 	return -1;
     }
+
+    if(scatterMaps.isActive())
+      return scatterMaps.addA(A,rowStartA,colA,size,m,id,fact);
     
     if(fact == 1.0) { // do not need to multiply 
 	for (int i=0; i<idSize; i++) {
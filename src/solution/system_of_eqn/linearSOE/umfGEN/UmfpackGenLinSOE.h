@@ -67,6 +67,7 @@
 
 #include <solution/system_of_eqn/linearSOE/FactoredSOEBase.h>
 #include "utility/matrix/Vector.h"
+#include "solution/system_of_eqn/linearSOE/SparseScatterMaps.h"
 
 namespace XC {
 class UmfpackGenLinSolver;
@@ -83,6 +84,9 @@ class UmfpackGenLinSOE : public FactoredSOEBase
     ID rowStartA; // int arrays containing info about coeff's in A
     int lValue;
     ID index;   // keep only for UMFpack
+    SparseScatterMaps scatterMaps; //!< element to A positions maps.
+
+    int set_index(void);
   protected:
     bool setSolver(LinearSOESolver *);
 
@@ -91,10 +95,19 @@ class UmfpackGenLinSOE : public FactoredSOEBase
     SystemOfEqn *getCopy(void) const;
   public:
     int setSize(Graph &theGraph);
+    int setSize(const CSRGraph &theGraph);
     int addA(const Matrix &, const ID &, double fact = 1.0);
     
     void zeroA(void);
 
+    //! @brief Return true if the assembly uses precomputed scatter maps.
+    inline bool getUseScatterMaps(void) const
+      { return scatterMaps.isActive(); }
+    //! @brief Activate/deactivate the use of precomputed scatter maps
+    //! in the assembly of the matrix.
+    inline void setUseScatterMaps(const bool &b)
+      { scatterMaps.setActive(b); }
+
     int sendSelf(CommParameters &);
     int recvSelf(const CommParameters &);
 
@@ -70,7 +70,8 @@ extern "C" int umd21i_(int *keep, double *cntl, int *icntl);
 
 XC::UmfpackGenLinSolver::UmfpackGenLinSolver()
 :LinearSOESolver(SOLVER_TAGS_UmfpackGenLinSolver),
- copyIndex(0), lIndex(0), work(0), theSOE(nullptr)
+ copyIndex(0), lIndex(0), work(0), analyzed(false),
+ numSymbolicFactorizations(0), numNumericFactorizations(0), theSOE(nullptr)
   {
     // perform the initialisation needed in UMFpack
     umd21i_(keep, cntl, icntl);
@@ -88,6 +89,66 @@ extern "C" int umd2so_(int *n, int *job, logical *transa,
 		       double *w, double *cntl, int *icntl,
 		       int *info, double *rinfo);
 
+extern "C" int umd2rf_(int *n, int *ne, int *job, logical *transa,
+		       int *lvalue, int *lindex, double *value,
+		       int *index, int *keep, double *cntl, int *icntl,
+		       int *info, double *rinfo);
+
+//! @brief Copy the row and column indices of the matrix entries
+//! at the beginning of copyIndex (UMD2FA and UMD2RF overwrite them).
+void XC::UmfpackGenLinSolver::copy_index(void)
+  {
+    const int ne= theSOE->nnz;
+    for(int i=0; i<2*ne; i++)
+      { copyIndex[i] = theSOE->index[i]; }
+  }
+
+//! @brief Compute the pivot sequence and the pattern of the LU
+//! factors (symbolic analysis) and factorize the matrix.
+int XC::UmfpackGenLinSolver::analyze_and_factorize(void)
+  {
+    int n = theSOE->size;
+    int ne = theSOE->nnz;
+    int lValue = theSOE->lValue;
+    int job =0; // set to 1 if wish to do iterative refinment
+    logical trans = FALSE_;
+    copy_index();
+    umd2fa_(&n, &ne, &job, &trans, &lValue, &lIndex, theSOE->A.getDataPtr(),
+	    copyIndex.getDataPtr(), keep, cntl, icntl, info, rinfo);
+    numSymbolicFactorizations++;
+    numNumericFactorizations++;
+    analyzed= (info[0] == 0);
+    return info[0];
+  }
+
+//! @brief Factorize the matrix using the pivot sequence and the
+//! pattern of the LU factors computed by the last call to
+//! analyze_and_factorize (numeric factorization only).
+int XC::UmfpackGenLinSolver::refactorize(void)
+  {
+    int n = theSOE->size;
+    int ne = theSOE->nnz;
+    int lValue = theSOE->lValue;
+    int job =0;
+    logical trans = FALSE_;
+    copy_index();
+    umd2rf_(&n, &ne, &job, &trans, &lValue, &lIndex, theSOE->A.getDataPtr(),
+	    copyIndex.getDataPtr(), keep, cntl, icntl, info, rinfo);
+    numNumericFactorizations++;
+    return info[0];
+  }
+
+//! @brief Reset the factorization counters.
+void XC::UmfpackGenLinSolver::resetCounters(void)
+  {
+    numSymbolicFactorizations= 0;
+    numNumericFactorizations= 0;
+  }
+
+//! @brief Solve the system. The sparsity pattern is analyzed only
+//! the first time the matrix is factorized after a call to setSize;
+//! the following factorizations reuse the pivot sequence (UMD2RF)
+//! unless it fails.
 int XC::UmfpackGenLinSolver::solve(void)
   {
     if(theSOE == 0)
@@ -98,7 +159,6 @@ int XC::UmfpackGenLinSolver::solve(void)
       }
     
     int n = theSOE->size;
-    int ne = theSOE->nnz;
     int lValue = theSOE->lValue;
 
     // check for quick return
@@ -115,18 +175,21 @@ int XC::UmfpackGenLinSolver::solve(void)
 
     if(theSOE->factored == false)
       {
-        // make a copy of index
-        for(int i=0; i<2*ne; i++)
-          { copyIndex[i] = theSOE->index[i]; }
-
-      // factor the matrix
-      umd2fa_(&n, &ne, &job, &trans, &lValue, &lIndex, Aptr,
-	      copyIndex.getDataPtr(), keep, cntl, icntl, info, rinfo);
+        // factor the matrix
+        int res= -1;
+        if(analyzed)
+          {
+            res= refactorize();
+            if(res != 0) // pivot sequence no longer valid.
+              analyzed= false;
+          }
+        if(!analyzed)
+          res= analyze_and_factorize();
       
-      if (info[0] != 0) {	
+      if (res != 0) {	
 	std::cerr << "WARNING UmfpackGenLinSolver::solve(void)- ";
-	std::cerr << info[0] << " returned in factorization UMD2FA()\n";
-	return -info[0];
+	std::cerr << res << " returned in factorization UMD2FA()/UMD2RF()\n";
+	return -res;
       }
       theSOE->factored = true;
     }	
@@ -156,6 +219,7 @@ int XC::UmfpackGenLinSolver::setSize()
         lIndex = 37*n + 4*ne + 10;
         copyIndex= ID(lIndex);
       }	
+    analyzed= false; // new pattern.
     return 0;
   }
 
@@ -84,6 +84,13 @@ class UmfpackGenLinSolver : public LinearSOESolver
     ID copyIndex;
     int lIndex;
     Vector work;
+    bool analyzed; //!< True if copyIndex holds the pattern of the LU factors of the current matrix pattern.
+    size_t numSymbolicFactorizations; //!< Number of analysis (and factorization) calls.
+    size_t numNumericFactorizations; //!< Number of numeric factorizations.
+
+    void copy_index(void);
+    int analyze_and_factorize(void);
+    int refactorize(void);
   protected:    
     UmfpackGenLinSOE *theSOE;
 
@@ -95,6 +102,15 @@ class UmfpackGenLinSolver : public LinearSOESolver
     int solve(void);
     int setSize(void);
 
+    //! @brief Return the number of analysis of the sparsity pattern
+    //! (once each time the pattern changes or a refactorization fails).
+    inline size_t getNumSymbolicFactorizations(void) const
+      { return numSymbolicFactorizations; }
+    //! @brief Return the number of numeric factorizations.
+    inline size_t getNumNumericFactorizations(void) const
+      { return numNumericFactorizations; }
+    void resetCounters(void);
+
     bool setLinearSOE(UmfpackGenLinSOE &theSOE);
     
     int sendSelf(CommParameters &);
@@ -55,7 +55,7 @@
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectBlockSolver.h>
 #include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h>
-//#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
+#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectThreadSolver.h>
 //#include <solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSkypackSolver.h>
 #include "solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinDirectSolver.h"
 #include "solution/system_of_eqn/linearSOE/profileSPD/ProfileSPDLinSubstrSolver.h"
@@ -74,12 +74,14 @@
 #include <solution/system_of_eqn/eigenSOE/BandArpackSOE.h>
 #include <solution/system_of_eqn/eigenSOE/BandArpackppSOE.h>
 #include <solution/system_of_eqn/eigenSOE/SymArpackSOE.h>
+#include <solution/system_of_eqn/eigenSOE/SparseArpackSOE.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSOE.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSOE.h>
 
 #include <solution/system_of_eqn/eigenSOE/EigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/BandArpackppSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymArpackSolver.h>
+#include <solution/system_of_eqn/eigenSOE/SparseArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/BandArpackSolver.h>
 #include <solution/system_of_eqn/eigenSOE/FullGenEigenSolver.h>
 #include <solution/system_of_eqn/eigenSOE/SymBandEigenSolver.h>
@@ -108,6 +110,8 @@
 #endif
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSOE.h>
 #include <solution/system_of_eqn/linearSOE/sparseSYM/SymSparseLinSolver.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/MultifrontalSPDLinSOE.h>
+#include <solution/system_of_eqn/linearSOE/sparseSYM/MultifrontalSPDLinSolver.h>
 
 //#include <solution/system_of_eqn/linearSOE/umfGEN/UmfpackGenLinSOE.h>
 #ifdef _PARALLEL_PROCESSING
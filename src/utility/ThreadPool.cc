@@ -0,0 +1,209 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadPool.cc
+
+#include "ThreadPool.h"
+#include <algorithm>
+
+namespace
+  {
+    //! @brief Pool whose loop is being run by this thread (if any).
+    thread_local const XC::ThreadPool *currentPool= nullptr;
+    //! @brief Index of this thread in currentPool.
+    thread_local size_t currentThreadIdx= 0;
+
+    //! @brief Sets the current pool and thread index of this thread
+    //! and restores the previous ones when it goes out of scope.
+    struct CurrentPoolGuard
+      {
+        const XC::ThreadPool *prevPool;
+        size_t prevThreadIdx;
+        CurrentPoolGuard(const XC::ThreadPool *pool, const size_t &threadIdx)
+          : prevPool(currentPool), prevThreadIdx(currentThreadIdx)
+          {
+            currentPool= pool;
+            currentThreadIdx= threadIdx;
+          }
+        ~CurrentPoolGuard(void)
+          {
+            currentPool= prevPool;
+            currentThreadIdx= prevThreadIdx;
+          }
+      };
+  }
+
+//! @brief Constructor.
+//!
+//! @param n: number of threads (calling thread included).
+XC::ThreadPool::ThreadPool(const size_t &n)
+  : body(nullptr), numIterations(0), grain(1), nextIteration(0),
+    generation(0), numBusy(0), stop(false)
+  {
+    const size_t nw= (n>1 ? n-1 : 0);
+    workers.reserve(nw);
+    for(size_t i= 0;i<nw;i++)
+      workers.push_back(std::thread(&ThreadPool::work,this,i+1));
+  }
+
+//! @brief Destructor (joins the worker threads).
+XC::ThreadPool::~ThreadPool(void)
+  {
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      stop= true;
+    }
+    cvStart.notify_all();
+    for(std::vector<std::thread>::iterator i= workers.begin();i!=workers.end();i++)
+      i->join();
+  }
+
+//! @brief Return the number of concurrent threads supported
+//! by the hardware (at least one).
+size_t XC::ThreadPool::getHardwareConcurrency(void)
+  {
+    const size_t retval= std::thread::hardware_concurrency();
+    return (retval>0 ? retval : 1);
+  }
+
+//! @brief Runs chunks of iterations of the current loop until
+//! there are no more left. If an iteration throws, the exception
+//! is stored and the remaining iterations are skipped.
+//!
+//! @param threadIdx: index of the thread.
+void XC::ThreadPool::run_chunks(const size_t &threadIdx)
+  {
+    try
+      {
+        while(true)
+          {
+            const size_t first= nextIteration.fetch_add(grain);
+            if(first>=numIterations)
+              break;
+            const size_t last= std::min(first+grain,numIterations);
+            for(size_t i= first;i<last;i++)
+              (*body)(i,threadIdx);
+          }
+      }
+    catch(...)
+      {
+        std::unique_lock<std::mutex> lock(mtx);
+        if(!error)
+          error= std::current_exception();
+        nextIteration= numIterations; // skip the rest.
+      }
+  }
+
+//! @brief Executes f(i,threadIdx) for i in [0,n) in the calling thread.
+void XC::ThreadPool::run_serial(const size_t &n, const loop_body &f, const size_t &threadIdx) const
+  {
+    for(size_t i= 0;i<n;i++)
+      f(i,threadIdx);
+  }
+
+//! @brief Worker thread main loop.
+//!
+//! @param threadIdx: index of the thread.
+void XC::ThreadPool::work(const size_t &threadIdx)
+  {
+    CurrentPoolGuard guard(this,threadIdx);
+    size_t lastGeneration= 0;
+    while(true)
+      {
+        {
+          std::unique_lock<std::mutex> lock(mtx);
+          while(!stop && (generation==lastGeneration))
+            cvStart.wait(lock);
+          if(stop)
+            return;
+          lastGeneration= generation;
+        }
+        run_chunks(threadIdx);
+        {
+          std::unique_lock<std::mutex> lock(mtx);
+          numBusy--;
+          if(numBusy==0)
+            cvDone.notify_one();
+        }
+      }
+  }
+
+//! @brief Executes f(i,threadIdx) for i in [0,n) distributing the
+//! iterations between the threads of the pool. Returns when all the
+//! iterations are done.
+//!
+//! When called from the body of a loop of this pool the iterations
+//! run serially and receive the index of the calling thread. When
+//! called from another thread while a loop is running, waits until
+//! the pool is free. The first exception thrown by an iteration is
+//! rethrown once all the threads have stopped.
+//!
+//! @param n: number of iterations.
+//! @param f: loop body.
+//! @param grainSize: number of iterations that each thread takes at
+//!                   once (if zero it's computed from n and the number
+//!                   of threads).
+void XC::ThreadPool::parallel_for(const size_t &n, const loop_body &f, const size_t &grainSize)
+  {
+    if(n==0)
+      return;
+    if(currentPool==this) // nested loop: keep the caller's index.
+      {
+        run_serial(n,f,currentThreadIdx);
+        return;
+      }
+    std::lock_guard<std::mutex> loopLock(loopMtx);
+    CurrentPoolGuard guard(this,0);
+    if(workers.empty() || (n==1))
+      {
+        run_serial(n,f,0);
+        return;
+      }
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      body= &f;
+      numIterations= n;
+      grain= grainSize;
+      if(grain==0) // Roughly eight chunks per thread.
+        grain= std::max<size_t>(1,n/(8*size()));
+      nextIteration= 0;
+      numBusy= workers.size();
+      error= nullptr;
+      generation++;
+    }
+    cvStart.notify_all();
+    run_chunks(0); // the calling thread works too.
+    std::exception_ptr e;
+    {
+      std::unique_lock<std::mutex> lock(mtx);
+      while(numBusy>0)
+        cvDone.wait(lock);
+      body= nullptr;
+      std::swap(e,error);
+    }
+    if(e)
+      std::rethrow_exception(e);
+  }
@@ -0,0 +1,96 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//ThreadPool.h
+
+#ifndef ThreadPool_h
+#define ThreadPool_h
+
+#include <cstddef>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <functional>
+#include <exception>
+
+namespace XC {
+
+//! @ingroup Utils
+//
+//! @brief Fixed size pool of worker threads.
+//!
+//! The pool executes loops whose iterations are independent. The
+//! calling thread takes part in the work, so a pool of size \f$n\f$
+//! launches \f$n-1\f$ worker threads. Each iteration receives, as second
+//! argument, the index (\f$0 \le t < n\f$) of the thread that runs it,
+//! so the caller can use per-thread buffers without locks.
+//! A loop launched from the body of another loop of the same pool
+//! is executed serially by the calling thread, whose index is passed
+//! down to the nested iterations. A loop launched from a thread
+//! outside the pool while another one is running waits until the
+//! pool is free. If an iteration throws, the remaining iterations
+//! are skipped and the first exception is rethrown by parallel_for.
+class ThreadPool
+  {
+  public:
+    typedef std::function<void(const size_t &,const size_t &)> loop_body;
+  private:
+    std::vector<std::thread> workers; //!< worker threads.
+    std::mutex mtx;
+    std::mutex loopMtx; //!< held by the thread that owns the running loop.
+    std::condition_variable cvStart; //!< signals a new loop.
+    std::condition_variable cvDone; //!< signals the end of a loop.
+    const loop_body *body; //!< body of the current loop.
+    size_t numIterations; //!< number of iterations of the current loop.
+    size_t grain; //!< number of iterations grabbed at once.
+    std::atomic<size_t> nextIteration; //!< next iteration to run.
+    size_t generation; //!< counter of launched loops.
+    size_t numBusy; //!< number of workers still running the current loop.
+    bool stop; //!< true when the pool is being destroyed.
+    std::exception_ptr error; //!< first exception thrown by the current loop.
+
+    ThreadPool(const ThreadPool &);
+    ThreadPool &operator=(const ThreadPool &);
+    void work(const size_t &);
+    void run_chunks(const size_t &);
+    void run_serial(const size_t &, const loop_body &, const size_t &) const;
+  public:
+    ThreadPool(const size_t &);
+    ~ThreadPool(void);
+
+    //! @brief Return the number of threads (calling thread included).
+    inline size_t size(void) const
+      { return workers.size()+1; }
+    void parallel_for(const size_t &, const loop_body &, const size_t &grainSize= 0);
+
+    static size_t getHardwareConcurrency(void);
+  };
+
+} // end of XC namespace
+
+#endif
@@ -1461,6 +1461,9 @@ XC::EigenSOE *XC::FEM_ObjectBroker::getNewEigenSOE(int classTagSOE)
         case EigenSOE_TAGS_SymArpackSOE:
           theSOE = new SymArpackSOE(nullptr);
           break;
+        case EigenSOE_TAGS_SparseArpackSOE:
+          theSOE = new SparseArpackSOE(nullptr);
+          break;
         case EigenSOE_TAGS_SymBandEigenSOE:
           theSOE = new SymBandEigenSOE(nullptr);
           break;
@@ -11,6 +11,8 @@
 
 // graph numbering schemes
 #include "solution/graph/graph/Vertex.h"
+#include "solution/graph/graph/Graph.h"
+#include "solution/graph/graph/CSRGraph.h"
 #include "solution/graph/numberer/RCM.h"
 #include "solution/graph/numberer/MyRCM.h"
 #include "solution/graph/numberer/SimpleNumberer.h"
@@ -248,6 +250,7 @@
 #include "utility/recorder/NodeRecorder.h"
 #include "utility/recorder/ElementRecorder.h"
 #include "utility/recorder/PropRecorder.h"
+#include "utility/recorder/PropRecorderAction.h"
 #include "utility/recorder/NodePropRecorder.h"
 #include "utility/recorder/ElementPropRecorder.h"
 #include "utility/recorder/EnvelopeNodeRecorder.h"
@@ -310,10 +313,13 @@
 #include "utility/matrix/nDarray/BJtensor.h"
 #include "utility/matrix/nDarray/Cosseratstraint.h"
 #include "utility/matrix/nDarray/Cosseratstresst.h"
+#include "utility/matrix/nDarray/stresst.h"
+#include "utility/matrix/nDarray/FixedTensor.h"
 
 
 // subdomain header files
 #include "domain/domain/subdomain/Subdomain.h"
+#include "domain/domain/partitioned/PartitionedDomain.h"
 
 // constraint handler header files
 #include "solution/analysis/handler/ConstraintHandler.h"
@@ -429,5 +435,15 @@
 #include "utility/database/NEESData.h"
 #include "utility/database/MySqlDatastore.h"
 #include "utility/database/FileDatastore.h"
+#include "utility/database/MemoryDatastore.h"
+#include "domain/domain/DomainSnapshots.h"
+
+// reliability
+#include "reliability/analysis/randomNumber/CounterRandGenerator.h"
+#include "reliability/domain/components/ReliabilityDomain.h"
+#include "reliability/analysis/gFunction/PythonGFunEvaluator.h"
+#include "reliability/analysis/sensitivity/FiniteDifferenceGradGEvaluator.h"
+#include "reliability/analysis/transformation/NatafProbabilityTransformation.h"
+#include "reliability/analysis/analysis/SamplingAnalysis.h"
 
 #endif
@@ -0,0 +1,180 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.cc
+
+#include "MemoryDatastore.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include "utility/matrix/ID.h"
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param preprocessor: preprocessor used to build the finite element model.
+//! @param theObjectBroker: deals with object serialization.
+XC::MemoryDatastore::MemoryDatastore(Preprocessor &preprocessor, FEM_ObjectBroker &theObjectBroker)
+  :FE_Datastore(preprocessor, theObjectBroker) {}
+
+//! @brief Copy the data in the container (the memory is reused if
+//! the object was already stored with the same size).
+template <class T>
+void XC::MemoryDatastore::write(std::map<data_key,std::vector<T> > &container,const int &dbTag,const int &commitTag,const T *data,const size_t &sz)
+  { container[data_key(dbTag,commitTag)].assign(data,data+sz); }
+
+//! @brief Copy the stored data in the buffer being passed as parameter.
+template <class T>
+int XC::MemoryDatastore::read(const std::map<data_key,std::vector<T> > &container,const int &dbTag,const int &commitTag,T *data,const size_t &sz,const std::string &what) const
+  {
+    int retval= -1;
+    typename std::map<data_key,std::vector<T> >::const_iterator i= container.find(data_key(dbTag,commitTag));
+    if(i==container.end())
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; " << what << " with dbTag= " << dbTag
+                << " and commitTag= " << commitTag
+                << " not found." << std::endl;
+    else if(i->second.size()!=sz)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; " << what << " with dbTag= " << dbTag
+                << " and commitTag= " << commitTag
+                << " has size " << i->second.size()
+                << " instead of " << sz << std::endl;
+    else
+      {
+        std::copy(i->second.begin(),i->second.end(),data);
+        retval= 0;
+      }
+    return retval;
+  }
+
+//! @brief Remove the data corresponding to the commit tag.
+template <class T>
+void XC::MemoryDatastore::erase(std::map<data_key,std::vector<T> > &container,const int &commitTag)
+  {
+    typename std::map<data_key,std::vector<T> >::iterator i= container.begin();
+    while(i!=container.end())
+      {
+        if(i->first.second==commitTag)
+          container.erase(i++);
+        else
+          ++i;
+      }
+  }
+
+int XC::MemoryDatastore::sendMsg(int dataTag, int commitTag,const XC::Message &,ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented\n";
+    return -1;
+  }
+
+int XC::MemoryDatastore::recvMsg(int dataTag, int commitTag, Message &, ChannelAddress *theAddress)
+  {
+    std::cerr << getClassName() << "::" << __FUNCTION__
+              << "; not yet implemented\n";
+    return -1;
+  }
+
+int XC::MemoryDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag already used." << std::endl;
+    write(matrices,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize());
+    return 0;
+  }
+
+int XC::MemoryDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag already used." << std::endl;
+    return read(matrices,dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),"matrix");
+  }
+
+int XC::MemoryDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag already used." << std::endl;
+    write(vectors,dbTag,commitTag,theVector.getDataPtr(),theVector.Size());
+    return 0;
+  }
+
+int XC::MemoryDatastore::recvVector(int dbTag, int commitTag, Vector &theVector,ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag already used." << std::endl;
+    return read(vectors,dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),"vector");
+  }
+
+int XC::MemoryDatastore::sendID(int dbTag, int commitTag, const ID &theID, ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag already used." << std::endl;
+    write(ids,dbTag,commitTag,theID.getDataPtr(),theID.Size());
+    return 0;
+  }
+
+int XC::MemoryDatastore::recvID(int dbTag, int commitTag,ID &theID,ChannelAddress *theAddress)
+  {
+    if(!checkDbTag(dbTag))
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; dbTag already used." << std::endl;
+    return read(ids,dbTag,commitTag,theID.getDataPtr(),theID.Size(),"ID");
+  }
+
+//! @brief Remove the data stored with the commit tag being passed
+//! as parameter.
+void XC::MemoryDatastore::removeState(const int &commitTag)
+  {
+    erase(matrices,commitTag);
+    erase(vectors,commitTag);
+    erase(ids,commitTag);
+  }
+
+//! @brief Remove all the stored data.
+void XC::MemoryDatastore::clear(void)
+  {
+    matrices.clear();
+    vectors.clear();
+    ids.clear();
+  }
+
+//! @brief Return the number of bytes occupied by the stored data.
+size_t XC::MemoryDatastore::getNumberOfBytes(void) const
+  {
+    size_t retval= 0;
+    for(double_data::const_iterator i= matrices.begin();i!=matrices.end();i++)
+      retval+= i->second.size()*sizeof(double);
+    for(double_data::const_iterator i= vectors.begin();i!=vectors.end();i++)
+      retval+= i->second.size()*sizeof(double);
+    for(int_data::const_iterator i= ids.begin();i!=ids.end();i++)
+      retval+= i->second.size()*sizeof(int);
+    return retval;
+  }
@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//MemoryDatastore.h
+
+#ifndef MemoryDatastore_h
+#define MemoryDatastore_h
+
+#include "FE_Datastore.h"
+#include <map>
+#include <vector>
+
+namespace XC {
+//! @ingroup Database
+//
+//! @brief In-memory database.
+//!
+//! The data (matrices, vectors and ID's) are kept in the process memory
+//! indexed by (dbTag, commitTag). When an object is sent again with the
+//! same keys, the memory already reserved for it is reused, so saving
+//! repeatedly the same state doesn't allocate memory.
+class MemoryDatastore: public FE_Datastore
+  {
+  public:
+    //! @brief Key of the stored objects (dbTag, commitTag).
+    typedef std::pair<int,int> data_key;
+    typedef std::map<data_key,std::vector<double> > double_data;
+    typedef std::map<data_key,std::vector<int> > int_data;
+  private:
+    double_data matrices; //!< matrices data.
+    double_data vectors; //!< vectors data.
+    int_data ids; //!< ID's data.
+
+    template <class T>
+    static void write(std::map<data_key,std::vector<T> > &,const int &,const int &,const T *,const size_t &);
+    template <class T>
+    int read(const std::map<data_key,std::vector<T> > &,const int &,const int &,T *,const size_t &,const std::string &) const;
+    template <class T>
+    static void erase(std::map<data_key,std::vector<T> > &,const int &);
+  public:
+    MemoryDatastore(Preprocessor &, FEM_ObjectBroker &);    
+
+    // methods for sending and recieving matrices, vectors and id's
+    int sendMsg(int , int , const Message &, ChannelAddress *a= nullptr);    
+    int recvMsg(int , int , Message &, ChannelAddress *a= nullptr);        
+
+    int sendMatrix(int , int , const Matrix &,ChannelAddress *a= nullptr);
+    int recvMatrix(int , int , Matrix &, ChannelAddress *a= nullptr);
+
+    int sendVector(int , int , const Vector &,ChannelAddress *a= nullptr);
+    int recvVector(int , int , Vector &,ChannelAddress *a= nullptr);
+    
+    int sendID(int , int ,const ID &,ChannelAddress *a= nullptr);
+    int recvID(int , int ,ID &,ChannelAddress *a= nullptr);    
+
+    void removeState(const int &commitTag);
+    void clear(void);
+    size_t getNumberOfBytes(void) const;
+  };
+} // end of XC namespace
+
+#endif
@@ -27,19 +27,101 @@
 // SQLiteDatastore.cpp
 
 #include <utility/database/SQLiteDatastore.h>
-#include "xc_utils/src/sqlite/SqLiteQuery.h"
+#include <sqlite3.h>
 #include <utility/matrix/Vector.h>
 #include <utility/matrix/Matrix.h>
 #include <utility/matrix/ID.h>
-#include "boost/lexical_cast.hpp"
+#include <cstring>
+
+//! @brief Tables that store the data as BLOBs.
+static const char *blob_tables[]= {"Matrices","Vectors","IDs"};
+static const size_t num_blob_tables= 3;
 
 XC::SQLiteDatastore::SQLiteDatastore(const std::string &projectName, Preprocessor &preprocessor, FEM_ObjectBroker &theObjectBroker, int run)
-  :DBDatastore(preprocessor, theObjectBroker), connection(false), db(projectName)
+  :DBDatastore(preprocessor, theObjectBroker), db(nullptr), cachedCommitTag(-1), inTransaction(false)
   {
-    if(this->createOpenSeesDatabase(projectName) == 0)
-      connection= true;
-    else
-      std::cerr << "SQLiteDatastore::SQLiteDatastore() - could not open the database\n";
+    if(sqlite3_open(projectName.c_str(),&db)!=SQLITE_OK)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; could not open the database: " << sqlite3_errmsg(db) << std::endl;
+        sqlite3_close(db);
+        db= nullptr;
+      }
+    else if(this->createOpenSeesDatabase(projectName) != 0)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; could not create the database tables.\n";
+  }
+
+//! @brief Destructor.
+XC::SQLiteDatastore::~SQLiteDatastore(void)
+  {
+    if(inTransaction)
+      endTransaction(false);
+    finalizeStatements();
+    if(db)
+      sqlite3_close(db);
+  }
+
+//! @brief Return the prepared statement for the table (it is prepared
+//! the first time that it's requested).
+//! @param statements: container of prepared statements.
+//! @param key: key of the statement in the container.
+//! @param sql: SQL text of the statement.
+sqlite3_stmt *XC::SQLiteDatastore::getStatement(std::map<std::string,sqlite3_stmt *> &statements,const std::string &key,const std::string &sql)
+  {
+    sqlite3_stmt *retval= nullptr;
+    std::map<std::string,sqlite3_stmt *>::iterator i= statements.find(key);
+    if(i!=statements.end())
+      retval= i->second;
+    else if(db)
+      {
+        if(sqlite3_prepare_v2(db,sql.c_str(),-1,&retval,nullptr)!=SQLITE_OK)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; could not prepare statement: " << sql
+                      << std::endl << sqlite3_errmsg(db) << std::endl;
+            sqlite3_finalize(retval);
+            retval= nullptr;
+          }
+        else
+          statements[key]= retval;
+      }
+    return retval;
+  }
+
+//! @brief Release the prepared statements.
+void XC::SQLiteDatastore::finalizeStatements(void)
+  {
+    for(std::map<std::string,sqlite3_stmt *>::iterator i= writeStatements.begin();i!=writeStatements.end();i++)
+      sqlite3_finalize(i->second);
+    writeStatements.clear();
+    for(std::map<std::string,sqlite3_stmt *>::iterator i= readStatements.begin();i!=readStatements.end();i++)
+      sqlite3_finalize(i->second);
+    readStatements.clear();
+  }
+
+//! @brief Begin a transaction.
+int XC::SQLiteDatastore::beginTransaction(void)
+  {
+    int retval= 0;
+    if(!inTransaction)
+      {
+        retval= execute("BEGIN TRANSACTION");
+        inTransaction= (retval==0);
+      }
+    return retval;
+  }
+
+//! @brief End the transaction (COMMIT if ok is true, ROLLBACK otherwise).
+int XC::SQLiteDatastore::endTransaction(const bool &ok)
+  {
+    int retval= 0;
+    if(inTransaction)
+      {
+        retval= execute(ok ? "COMMIT TRANSACTION" : "ROLLBACK TRANSACTION");
+        inTransaction= false;
+      }
+    return retval;
   }
 
 int XC::SQLiteDatastore::sendMsg(int dataTag, int commitTag,const XC::Message &,ChannelAddress *theAddress)
@@ -54,80 +136,121 @@ int XC::SQLiteDatastore::recvMsg(int dataTag, int commitTag, Message &, ChannelA
     return -1;
   }
 
-//! @brief Inserts data on a BLOB field.
-bool XC::SQLiteDatastore::insertData(const std::string &tbName,const int &dbTag,const int &commitTag,const void *blobData,const int &sz,const int &typeSize)
+//! @brief Writes data on a BLOB field (the row is replaced if it
+//! already exists).
+bool XC::SQLiteDatastore::writeData(const std::string &tbName,const int &dbTag,const int &commitTag,const void *blobData,const int &sz,const int &typeSize)
   {
-    const int numBytes= sz*typeSize;
-    query= "INSERT INTO " + tbName + " VALUES (" + boost::lexical_cast<std::string>(dbTag) + ",";
-    query+= boost::lexical_cast<std::string>(commitTag) + ",";
-    query+= boost::lexical_cast<std::string>(sz) + ",?)";
-    return db.getDefaultQuery()->insert_blob1(query,blobData,numBytes);
+    sqlite3_stmt *stmt= getStatement(writeStatements,tbName,"INSERT OR REPLACE INTO " + tbName + " VALUES (?1,?2,?3,?4)");
+    if(!stmt)
+      return false;
+    sqlite3_bind_int(stmt,1,dbTag);
+    sqlite3_bind_int(stmt,2,commitTag);
+    sqlite3_bind_int(stmt,3,sz);
+    sqlite3_bind_blob(stmt,4,blobData,sz*typeSize,SQLITE_STATIC);
+    const bool retval= (sqlite3_step(stmt)==SQLITE_DONE);
+    if(!retval)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; failed to write in table= " << tbName
+                << " the object with dbTag= " << dbTag
+                << " and commitTag= " << commitTag
+                << std::endl << sqlite3_errmsg(db) << std::endl;
+    sqlite3_reset(stmt);
+    sqlite3_clear_bindings(stmt);
+    if(cachedCommitTag==commitTag) //Keep the cache up to date.
+      {
+        const char *bytes= reinterpret_cast<const char *>(blobData);
+        cache[tbName][row_key(dbTag,sz)].assign(bytes,bytes+sz*typeSize);
+      }
+    return retval;
   }
 
-//! @brief Updates data o a BLOB field.
-bool XC::SQLiteDatastore::updateData(const std::string &tbName,const int &dbTag,const int &commitTag,const void *blobData,const int &sz,const int &typeSize)
+//! @brief Reads the data of a BLOB field.
+bool XC::SQLiteDatastore::readData(const std::string &tbName,const int &dbTag,const int &commitTag,void *data,const int &sz,const int &typeSize)
   {
-    const int numBytes= sz*typeSize;
-    query= "UPDATE " + tbName + " SET data= ? WHERE dbTag= " + boost::lexical_cast<std::string>(dbTag);
-    query+= " AND commitTag= " + boost::lexical_cast<std::string>(commitTag) + " AND size= ";
-    query+= boost::lexical_cast<std::string>(sz);
-    return db.getDefaultQuery()->insert_blob1(query,blobData,numBytes);
+    const size_t numBytes= sz*typeSize;
+    if(cachedCommitTag==commitTag)
+      {
+        const row_cache &rows= cache[tbName];
+        row_cache::const_iterator i= rows.find(row_key(dbTag,sz));
+        if((i!=rows.end()) && (i->second.size()==numBytes))
+          {
+            if(numBytes>0)
+              memcpy(data,&(i->second[0]),numBytes);
+            return true;
+          }
+      }
+    bool retval= false;
+    sqlite3_stmt *stmt= getStatement(readStatements,tbName,"SELECT data FROM " + tbName + " WHERE dbTag= ?1 AND commitTag= ?2 AND size= ?3");
+    if(stmt)
+      {
+        sqlite3_bind_int(stmt,1,dbTag);
+        sqlite3_bind_int(stmt,2,commitTag);
+        sqlite3_bind_int(stmt,3,sz);
+        if(sqlite3_step(stmt)==SQLITE_ROW)
+          {
+            const void *blob= sqlite3_column_blob(stmt,0);
+            if(size_t(sqlite3_column_bytes(stmt,0))==numBytes)
+              {
+                if(numBytes>0)
+                  memcpy(data,blob,numBytes);
+                retval= true;
+              }
+          }
+        sqlite3_reset(stmt);
+      }
+    if(!retval)
+      std::cerr << getClassName() << "::" << __FUNCTION__
+                << "; no data in table= " << tbName
+                << " for object with dbTag= " << dbTag
+                << " commitTag= " << commitTag
+                << " and size= " << sz << std::endl;
+    return retval;
   }
 
-const void *XC::SQLiteDatastore::retrieveData(const std::string &tbName,const int &dbTag,const int &commitTag,const int &sz)
+//! @brief Reads all the rows of the commitTag (one SELECT for each table).
+int XC::SQLiteDatastore::loadCache(const int &commitTag)
   {
-    const void *retval= nullptr;
-    // check that we have a connection
-    if(connection)
+    clearCache();
+    int retval= 0;
+    for(size_t k= 0;k<num_blob_tables;k++)
       {
-        // to receive the data the database we do the following:
-        // 1. use SELECT to receive the data from the database
-        // 2. fetch the results from the server and copy to the Matrices data area
-        // 3. clean up the SQLITE_RES datastructure
-
-        // form the SELECT query
-        query= "SELECT data FROM " + tbName + " WHERE dbTag= " + boost::lexical_cast<std::string>(dbTag) + " AND commitTag= " + boost::lexical_cast<std::string>(commitTag) + " AND size= " + boost::lexical_cast<std::string>(sz);
-
-        sqlite3_stmt *result= db.getDefaultQuery()->get_result(query);
-
-        // fetch the results from the database
-        if(!result)
+        const std::string tbName= blob_tables[k];
+        sqlite3_stmt *stmt= getStatement(readStatements,tbName+"_commitTag","SELECT dbTag, size, data FROM " + tbName + " WHERE commitTag= ?1");
+        if(!stmt)
           {
-            // no data stored in db with these keys
-            std::cerr << "SQLiteDatastore::retrieveData - no data in table= " << tbName << " for object with dbTag= "
-                      << dbTag << " commitTag= " << commitTag << " and size= " << sz << " query= " << query << std::endl;
+            retval= -1;
+            continue;
           }
-        else
+        row_cache &rows= cache[tbName];
+        sqlite3_bind_int(stmt,1,commitTag);
+        while(sqlite3_step(stmt)==SQLITE_ROW)
           {
-            db.getDefaultQuery()->fetch_row();
-            retval= db.getDefaultQuery()->getBlob("data");
-            if(!retval)
-              {
-                // no vector stored in db with these keys
-                std::cerr << "SQLiteDatastore::retrieveData - no data in table= " << tbName << " for object with dbTag= "
-                      << dbTag << " and commitTag= " << commitTag << " and size= " << sz << " query= " << query << std::endl;
-                db.getDefaultQuery()->free_result();
-              }
+            const char *blob= reinterpret_cast<const char *>(sqlite3_column_blob(stmt,2));
+            const int numBytes= sqlite3_column_bytes(stmt,2);
+            std::vector<char> &bytes= rows[row_key(sqlite3_column_int(stmt,0),sqlite3_column_int(stmt,1))];
+            bytes.assign(blob,blob+numBytes);
           }
+        sqlite3_reset(stmt);
       }
+    cachedCommitTag= commitTag;
     return retval;
   }
 
+//! @brief Remove the rows read by loadCache.
+void XC::SQLiteDatastore::clearCache(void)
+  {
+    cache.clear();
+    cachedCommitTag= -1;
+  }
+
 int XC::SQLiteDatastore::sendMatrix(int dbTag, int commitTag, const Matrix &theMatrix, ChannelAddress *theAddress)
   {
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::sendMatrix." << std::endl;
     int retval= -1;
-    if(connection)
+    if(db)
       {
-        // to send the data the database we do the following:
-        // 1. try to INSERT the data into the database
-        // 2. if INSERT fails we have to reformulate the query to UPDATE the existing data,
-        //    as the row given by dbTag, commitTag and vectorSize may already already exist.
-        bool ok= insertData("Matrices",dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
-        if(!ok)
-          ok= updateData("Matrices",dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double));
-        if(ok)
+        if(writeData("Matrices",dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double)))
           retval= 0;
       }
     return retval;
@@ -138,41 +261,22 @@ int XC::SQLiteDatastore::recvMatrix(int dbTag, int commitTag, Matrix &theMatrix,
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::recvMatrix." << std::endl;
     int retval= -1;
-    if(connection)
+    if(db)
       {
-        const void *blob= retrieveData("Matrices",dbTag,commitTag,theMatrix.getDataSize());
-	if(blob)
-          {
-            // place the results into the vectors double array
-            const double *blobData = reinterpret_cast<const double *>(blob);
-            double *matrixData= theMatrix.getDataPtr();
-            for(int i=0; i<theMatrix.getDataSize(); i++)
-              matrixData[i] = blobData[i];
-            // free the SQLITE_RES structure
-            db.getDefaultQuery()->free_result();
-            retval= 0;
-          }
+        if(readData("Matrices",dbTag,commitTag,theMatrix.getDataPtr(),theMatrix.getDataSize(),sizeof(double)))
+          retval= 0;
       }
     return retval;
   }
 
-
-
 int XC::SQLiteDatastore::sendVector(int dbTag, int commitTag, const Vector &theVector, ChannelAddress *theAddress)
   {
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::sendVector." << std::endl;
     int retval= -1;
-    if(connection)
+    if(db)
       {
-        // to send the data the database we do the following:
-        // 1. try to INSERT the data into the database
-        // 2. if INSERT fails we have to reformulate the query to UPDATE the existing data,
-        //    as the row given by dbTag, commitTag and vectorSize may already already exist.
-        bool ok= (insertData("Vectors",dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double))!= SQLITE_OK);
-        if(!ok)
-          ok= updateData("Vectors",dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double));
-        if(ok)
+        if(writeData("Vectors",dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double)))
           retval= 0;
       }
     return retval;
@@ -183,19 +287,10 @@ int XC::SQLiteDatastore::recvVector(int dbTag, int commitTag, Vector &theVector,
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::recvVector." << std::endl;
     int retval= -1;
-    if(connection)
+    if(db)
       {
-        const void *blob= retrieveData("Vectors",dbTag,commitTag,theVector.Size());
-	if(blob)
-          {
-            // place the results into the vectors double array
-            const double *blobData = reinterpret_cast<const double *>(blob);
-            for(int i=0; i<theVector.Size(); i++)
-              theVector[i] = blobData[i];
-            // free the SQLITE_RES structure
-            db.getDefaultQuery()->free_result();
-            retval= 0;
-          }
+        if(readData("Vectors",dbTag,commitTag,theVector.getDataPtr(),theVector.Size(),sizeof(double)))
+          retval= 0;
       }
     return retval;
   }
@@ -206,16 +301,9 @@ int XC::SQLiteDatastore::sendID(int dbTag, int commitTag, const ID &theID, Chann
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::sendID." << std::endl;
     int retval= -1;
-    if(connection)
+    if(db)
       {
-        // to send the data the database we do the following:
-        // 1. try to INSERT the data into the database
-        // 2. if INSERT fails we have to reformulate the query to UPDATE the existing data,
-        //    as the row given by dbTag, commitTag and vectorSize may already already exist.
-        bool ok= insertData("IDs",dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
-        if(!ok)
-          ok= updateData("IDs",dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int));
-        if(ok)
+        if(writeData("IDs",dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int)))
           retval= 0;
       }
     return retval;
@@ -226,20 +314,42 @@ int XC::SQLiteDatastore::recvID(int dbTag, int commitTag,ID &theID,ChannelAddres
     if(!checkDbTag(dbTag))
       std::cerr << "Error en SQLiteDatastore::recvID." << std::endl;
     int retval= -1;
-    if(connection)
+    if(db)
       {
-        const void *blob= retrieveData("IDs",dbTag,commitTag,theID.Size());
-	if(blob)
-          {
-            // place the results into the vectors double array
-            const int *blobData = reinterpret_cast<const int *>(blob);
-            for(int i=0; i<theID.Size(); i++)
-              theID[i] = blobData[i];
-            // free the SQLITE_RES structure
-            db.getDefaultQuery()->free_result();
-            retval= 0;
-          }
+        if(readData("IDs",dbTag,commitTag,theID.getDataPtr(),theID.Size(),sizeof(int)))
+          retval= 0;
+      }
+    return retval;
+  }
+
+//! @brief Save the state of the model; all the writes are executed
+//! in a single transaction (rolled back on failure).
+int XC::SQLiteDatastore::commitState(int commitTag)
+  {
+    const bool ownTransaction= !inTransaction;
+    if(ownTransaction)
+      beginTransaction();
+    const int retval= DBDatastore::commitState(commitTag);
+    if(ownTransaction)
+      endTransaction(retval>=0);
+    return retval;
+  }
+
+//! @brief Restore the state of the model; the rows of the commitTag
+//! are read at once before the objects ask for them.
+int XC::SQLiteDatastore::restoreState(int commitTag)
+  {
+    if(isSaved(commitTag))
+      {
+        const bool ownTransaction= !inTransaction;
+        if(ownTransaction)
+          beginTransaction();
+        loadCache(commitTag);
+        if(ownTransaction)
+          endTransaction(true);
       }
+    const int retval= DBDatastore::restoreState(commitTag);
+    clearCache();
     return retval;
   }
 
@@ -247,15 +357,14 @@ int XC::SQLiteDatastore::createTable(const std::string &tableName, const std::ve
   {
     const int numColumns= columns.size();
     // check that we have a connection
-    if(connection)
+    if(db)
       {
         // create the sql query
-        query= "CREATE TABLE " + tableName + " (dbTag INT NOT nullptr, commitTag INT NOT nullptr, ";
+        query= "CREATE TABLE IF NOT EXISTS " + tableName + " (dbTag INT NOT NULL, commitTag INT NOT NULL, ";
         for(int j=0; j<numColumns; j++)
-          query+= columns[j] + " DOUBLE NOT nullptr, ";
+          query+= columns[j] + " DOUBLE NOT NULL, ";
         query+= "PRIMARY KEY (dbTag, commitTag) )";
-        db.getDefaultQuery()->execute(query);
-        return 0;
+        return execute(query);
       }
     else
       return -1;
@@ -264,36 +373,30 @@ int XC::SQLiteDatastore::createTable(const std::string &tableName, const std::ve
 int XC::SQLiteDatastore::insertData(const std::string &tableName,const std::vector<std::string> &columns, int commitTag, const Vector &data)
   {
     // check that we have a connection
-    if(connection)
+    if(db)
       {
-        // check that query string is big enough to hold the data, if not enlarge
-        //const int sizeData = 128 + strlen(tableName);
-
         // form the insert query
-        query= "INSERT INTO " + tableName + "VALUES (" + boost::lexical_cast<std::string>(dbTAG) + "," + boost::lexical_cast<std::string>(commitTag);
+        query= "INSERT OR REPLACE INTO " + tableName + " VALUES (?,?";
         for(int i=0; i<data.Size(); i++)
-          query+= boost::lexical_cast<std::string>(data(i));
+          query+= ",?";
         query+= ")";
-
-        // execute the query
-        if(db.getDefaultQuery()->execute(query) != SQLITE_OK)
+        sqlite3_stmt *stmt= nullptr;
+        int rc= sqlite3_prepare_v2(db,query.c_str(),-1,&stmt,nullptr);
+        if(rc==SQLITE_OK)
           {
-          
-            // if INSERT fails we reformulate query and try an UPDATE
-            // formulate the query
-            query= "UPDATE " + tableName + " SET " + columns[0] + "= " + boost::lexical_cast<std::string>(data(0));
-            for(int i=1; i<data.Size(); i++)
-              query+= columns[i] + "= " + boost::lexical_cast<std::string>(data(i));
-            query+= " WHERE dbTag= " + boost::lexical_cast<std::string>(dbTAG) + " AND commitTag= " + boost::lexical_cast<std::string>(commitTag);
-
-            // invoke the query on the database
-            if(db.getDefaultQuery()->execute(query) != SQLITE_OK)
-              {
-                std::cerr << "SQLiteDatastore::insertData() - failed to send the data to SQLite database";
-                std::cerr << query;
-                std::cerr << std::endl << db.getDefaultQuery()->getError() << std::endl;
-                return -3;
-              }
+            sqlite3_bind_int(stmt,1,dbTAG);
+            sqlite3_bind_int(stmt,2,commitTag);
+            for(int i=0; i<data.Size(); i++)
+              sqlite3_bind_double(stmt,i+3,data(i));
+            rc= sqlite3_step(stmt);
+          }
+        sqlite3_finalize(stmt);
+        if(rc!=SQLITE_DONE)
+          {
+            std::cerr << "SQLiteDatastore::insertData() - failed to send the data to SQLite database";
+            std::cerr << query;
+            std::cerr << std::endl << sqlite3_errmsg(db) << std::endl;
+            return -3;
           }
         return 0;
       }
@@ -304,36 +407,29 @@ int XC::SQLiteDatastore::insertData(const std::string &tableName,const std::vect
 int XC::SQLiteDatastore::getData(const std::string &tableName,const std::vector<std::string> &columns, int commitTag, Vector &data)
   {
     // check that we have a connection
-    if(!connection)
+    if(db)
       {
-
-        // check that query string is big enough to hold the data, if not enlarge
-        //const int sizeData = 128 + strlen(tableName);
-
-
-        // to receive the data the database we do the following:
-        // 1. use SELECT to receive the data from the database
-        // 2. fetch the results from the server and copy to the Vectors data area
-        // 3. clean up the SQLITE_RES datastructure
-        //
-        // form the SELECT query
-        query= "Select * FROM " + tableName + " WHERE dbTag= " + boost::lexical_cast<std::string>(dbTAG) + " AND commitTag= " + boost::lexical_cast<std::string>(commitTag);
-
-        sqlite3_stmt *result= db.getDefaultQuery()->get_result(query);
-
-        // fetch the results from the database
-        if(!result)
+        query= "SELECT * FROM " + tableName + " WHERE dbTag= ?1 AND commitTag= ?2";
+        sqlite3_stmt *stmt= nullptr;
+        int rc= sqlite3_prepare_v2(db,query.c_str(),-1,&stmt,nullptr);
+        if(rc==SQLITE_OK)
           {
-            // no data stored in db with these keys
-            std::cerr << "SQLiteDatastore::getData - no data in database for object with dbTag, cTag: ";
-            std::cerr << dbTAG << ", " << commitTag << std::endl;
+            sqlite3_bind_int(stmt,1,dbTAG);
+            sqlite3_bind_int(stmt,2,commitTag);
+            rc= sqlite3_step(stmt);
           }
-        else
+        if(rc==SQLITE_ROW)
           {
             for(int i=0; i<data.Size(); i++)
-              data[i] = db.getDefaultQuery()->getDouble(i);
+              data[i] = sqlite3_column_double(stmt,i+2);
           }
-        db.getDefaultQuery()->free_result();
+        else
+          {
+            // no data stored in db with these keys
+            std::cerr << "SQLiteDatastore::getData - no data in database for object with dbTag, cTag: ";
+            std::cerr << dbTAG << ", " << commitTag << std::endl;
+          }
+        sqlite3_finalize(stmt);
         return 0;
       }
     else
@@ -343,37 +439,49 @@ int XC::SQLiteDatastore::getData(const std::string &tableName,const std::vector<
 
 int XC::SQLiteDatastore::createOpenSeesDatabase(const std::string &projectName)
   {
-
-    const std::string campos= "(dbTag INTEGER NOT nullptr,commitTag INTEGER NOT nullptr, size INTEGER NOT nullptr, data BLOB, PRIMARY KEY (dbTag, commitTag, size) )";
+    int retval= 0;
+    const std::string campos= "(dbTag INTEGER NOT NULL,commitTag INTEGER NOT NULL, size INTEGER NOT NULL, data BLOB, PRIMARY KEY (dbTag, commitTag, size) )";
     // now create the tables in the database
 
-    query= "CREATE TABLE Messages " + campos;
-    if(execute(query) != 0)
-      std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Messagess table\n";
-    query= "CREATE TABLE Matrices " + campos;
+    query= "CREATE TABLE IF NOT EXISTS Messages " + campos;
     if(execute(query) != 0)
-      std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Matricess table\n";
-
-    query= "CREATE TABLE Vectors " + campos;
-    if(execute(query) != 0)
-      std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Vectors table\n";
-
-    query= "CREATE TABLE IDs " + campos;
-    if(execute(query) != 0)
-       std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the ID's table\n";
-    return 0;
+      {
+        std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the Messagess table\n";
+        retval= -1;
+      }
+    for(size_t k= 0;k<num_blob_tables;k++)
+      {
+        query= "CREATE TABLE IF NOT EXISTS " + std::string(blob_tables[k]) + " " + campos;
+        if(execute(query) != 0)
+          {
+            std::cerr << "SQLiteDatastore::createOpenSeesDatabase() - could not create the "
+                      << blob_tables[k] << " table\n";
+            retval= -1;
+          }
+      }
+    //Index to read all the rows of a commitTag at once.
+    for(size_t k= 0;k<num_blob_tables;k++)
+      {
+        const std::string tbName(blob_tables[k]);
+        query= "CREATE INDEX IF NOT EXISTS " + tbName + "_commitTag ON " + tbName + " (commitTag)";
+        if(execute(query) != 0)
+          retval= -1;
+      }
+    return retval;
   }
 
 int XC::SQLiteDatastore::execute(const std::string &query)
   {
-    bool tmp= db.getDefaultQuery()->execute(query);
-    if(!tmp)
+    if(!db)
+      return -1;
+    char *errMsg= nullptr;
+    if(sqlite3_exec(db,query.c_str(),nullptr,nullptr,&errMsg)!=SQLITE_OK)
       {
         std::cerr << "SQLiteDatastore::execute() - could not execute command: " << query;
-        std::cerr << std::endl << db.getDefaultQuery()->getError() << std::endl;
+        std::cerr << std::endl << (errMsg ? errMsg : "") << std::endl;
+        sqlite3_free(errMsg);
         return -1;
       }
     else
       return 0;
   }
-
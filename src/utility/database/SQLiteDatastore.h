@@ -30,7 +30,11 @@
 #define SQLiteDatastore_h
 
 #include "DBDatastore.h"
-#include "xc_utils/src/sqlite/SqLiteDatabase.h"
+#include <map>
+#include <vector>
+
+struct sqlite3;
+struct sqlite3_stmt;
 
 namespace XC {
 //! @ingroup Utils
@@ -39,20 +43,44 @@ namespace XC {
 //
 //! @ingroup Database
 //
+//! @brief SQLite database.
+//!
+//! The data (matrices, vectors and ID's) are stored as BLOBs in rows
+//! identified by (dbTag, commitTag, size). The writes use cached
+//! prepared statements (INSERT OR REPLACE) and each commitState is
+//! executed in a single transaction. When restoring a state, the rows
+//! of the commitTag are read at once (one SELECT for each table) and
+//! served from memory.
 class SQLiteDatastore: public DBDatastore
   {
+  public:
+    //! @brief Key of a row in a table (dbTag, size).
+    typedef std::pair<int,int> row_key;
+    //! @brief Rows of a table read when restoring a state.
+    typedef std::map<row_key,std::vector<char> > row_cache;
   private:
-    bool connection;
-    SqLiteDatabase db; //!< database SqLite.
+    sqlite3 *db; //!< database connection.
+    std::map<std::string,sqlite3_stmt *> writeStatements; //!< INSERT OR REPLACE statement for each table.
+    std::map<std::string,sqlite3_stmt *> readStatements; //!< SELECT statement for each table.
+    std::map<std::string,row_cache> cache; //!< rows read for the state being restored.
+    int cachedCommitTag; //!< commit tag of the cached rows (-1 if none).
+    bool inTransaction; //!< true if a transaction is open.
     std::string query;
-    bool insertData(const std::string &,const int &,const int &,const void *,const int &,const int &);
-    bool updateData(const std::string &,const int &,const int &,const void *,const int &,const int &);
-    const void *retrieveData(const std::string &tbName,const int &dbTag,const int &commitTag,const int &sz);
+
+    sqlite3_stmt *getStatement(std::map<std::string,sqlite3_stmt *> &,const std::string &,const std::string &);
+    void finalizeStatements(void);
+    bool writeData(const std::string &,const int &,const int &,const void *,const int &,const int &);
+    bool readData(const std::string &,const int &,const int &,void *,const int &,const int &);
+    int loadCache(const int &);
+    void clearCache(void);
   protected:
     int createOpenSeesDatabase(const std::string &projectName);
     int execute(const std::string &query);
+    int beginTransaction(void);
+    int endTransaction(const bool &);
   public:
     SQLiteDatastore(const std::string &,Preprocessor &, FEM_ObjectBroker &,int dbRun = 0);    
+    ~SQLiteDatastore(void);
 
     // methods for sending and recieving matrices, vectors and id's
     int sendMsg(int , int , const Message &, ChannelAddress *a= nullptr);    
@@ -67,6 +95,9 @@ class SQLiteDatastore: public DBDatastore
     int sendID(int , int ,const ID &,ChannelAddress *a= nullptr);
     int recvID(int , int ,ID &,ChannelAddress *a= nullptr);    
 
+    int commitState(int commitTag);
+    int restoreState(int commitTag);
+
     int createTable(const std::string &,const std::vector<std::string> &);
     int insertData(const std::string &,const std::vector<std::string> &, int , const Vector &);
     int getData(const std::string &,const std::vector<std::string> &, int , Vector &);
@@ -47,3 +47,9 @@ class_<XC::NEESData, bases<XC::FE_Datastore>, boost::noncopyable  >("NEESData",
 
 class_<XC::FileDatastore, bases<XC::FE_Datastore>, boost::noncopyable  >("FileDatastore", no_init)
   ;
+
+class_<XC::MemoryDatastore, bases<XC::FE_Datastore>, boost::noncopyable  >("MemoryDatastore", no_init)
+  .def("removeState",&XC::MemoryDatastore::removeState,"removeState(commitTag): remove the data stored with the commit tag.")
+  .def("clear",&XC::MemoryDatastore::clear,"Remove all the stored data.")
+  .add_property("numberOfBytes",&XC::MemoryDatastore::getNumberOfBytes,"Return the number of bytes occupied by the stored data.")
+  ;
@@ -112,7 +112,7 @@ XC::BJmatrix::BJmatrix(const std::string &flag, int dimension ): // create an id
 
 // in the case of nDarray_rank=0 add one to get right thing from the
 // operator new
-     set_dim_pointer( new int[rank()] );  // array for dimensions
+     pc_nDarray_rep->alloc_dim(rank());  // array for dimensions
      long int number = dimension*dimension;
      total_number(number);
      for( int idim = 1 ; idim <= rank() ; idim++ )
@@ -121,7 +121,7 @@ XC::BJmatrix::BJmatrix(const std::string &flag, int dimension ): // create an id
        }
 
 // allocate memory for the actual XC::nDarray as XC::nDarray
-     set_data_pointer( new double [ (size_t) total_number() ]);
+     pc_nDarray_rep->alloc_data(total_number());
        if (!data())
          {
            ::printf("\a\nInsufficient memory for array\n");
@@ -193,7 +193,7 @@ XC::BJmatrix::BJmatrix(const std::string &initfile):
   pc_nDarray_rep = new nDarray_rep; // this 'new' is overloaded
   rank(2);  // rank_of_nDarray here XC::BJmatrix = 2
 
-  set_dim_pointer( (new int[ rank() ]) );// array for dimensions
+  pc_nDarray_rep->alloc_dim(rank());// array for dimensions
   long int number = rows*columns;
   total_number(number);
 
@@ -201,7 +201,7 @@ XC::BJmatrix::BJmatrix(const std::string &initfile):
   dim()[1] = columns;
 
 // allocate memory for the actual XC::nDarray as XC::nDarray
-  set_data_pointer( new double [ (size_t) total_number() ] );
+  pc_nDarray_rep->alloc_data(total_number());
     if (!data())
       {
         ::printf("\a\nInsufficient memory for array\n");
@@ -252,7 +252,7 @@ XC::BJmatrix::BJmatrix(const std::string &initfile,const std::string &outfile):
   pc_nDarray_rep = new nDarray_rep; // this 'new' is overloaded
   rank(2);  // rank_of_nDarray here XC::BJmatrix = 2
 
-  set_dim_pointer( (new int[ rank() ]) );// array for dimensions
+  pc_nDarray_rep->alloc_dim(rank());// array for dimensions
   long int number = rows*columns;
   total_number(number);
 
@@ -260,7 +260,7 @@ XC::BJmatrix::BJmatrix(const std::string &initfile,const std::string &outfile):
   dim()[1] = columns;
 
 // allocate memory for the actual XC::nDarray as XC::nDarray
-  set_data_pointer( new double [ (size_t) total_number() ] );
+  pc_nDarray_rep->alloc_data(total_number());
     if (!data())
       {
         ::printf("\a\nInsufficient memory for array\n");
@@ -355,8 +355,8 @@ XC::BJmatrix &XC::BJmatrix::operator=( const XC::BJmatrix & rval)
  // clean up current value;
     if( reference_count(-1) == 0)  // if nobody else is referencing us.
       {
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
         delete pc_nDarray_rep;
       }
  // connect to new value
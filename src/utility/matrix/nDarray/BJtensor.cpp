@@ -151,14 +151,14 @@ XC::BJtensor::BJtensor(const XC::BJtensor & x)
 
    int one_or0 = 0;
    if(!x.pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-   pc_nDarray_rep->dim = new int[pc_nDarray_rep->nDarray_rank+one_or0];
+   pc_nDarray_rep->alloc_dim(pc_nDarray_rep->nDarray_rank+one_or0);
                                                                 
    pc_nDarray_rep->total_numb = x.pc_nDarray_rep->total_numb;
 
    for( int idim = 0 ; idim < pc_nDarray_rep->nDarray_rank ; idim++ )
        pc_nDarray_rep->dim[idim] = x.pc_nDarray_rep->dim[idim];
 
-   pc_nDarray_rep->pd_nDdata = new double [x.pc_nDarray_rep->total_numb];
+   pc_nDarray_rep->alloc_data(x.pc_nDarray_rep->total_numb);
      if (!pc_nDarray_rep->pd_nDdata)
        {
          std::cerr << "\a\nInsufficient memory for array\n";
@@ -220,8 +220,8 @@ XC::BJtensor& XC::BJtensor::operator=(const XC::BJtensor & rval)
 // clean up current value;
     if( reference_count(-1) == 0)  // if nobody else is referencing us.
       {
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
         delete pc_nDarray_rep;
       }
 // connect to new value
@@ -829,12 +829,12 @@ XC::BJtensor XC::BJtensor::operator*(const BJtensor &arg) const
     //DEBUGprint          arg.rank());
 
     // space for CONTRACTED indices
-    int *this_contr = new int[MAX_TENS_ORD];
-    int *arg_contr  = new int[MAX_TENS_ORD];
+    int this_contr[MAX_TENS_ORD];
+    int arg_contr[MAX_TENS_ORD];
 
     // space for UN-CONTRACTED indices
-    int *this_uncontr = new int[MAX_TENS_ORD];
-    int *arg_uncontr  = new int[MAX_TENS_ORD];
+    int this_uncontr[MAX_TENS_ORD];
+    int arg_uncontr[MAX_TENS_ORD];
 
     for(int this_ic=0 ; this_ic<MAX_TENS_ORD ; this_ic++ )
       {
@@ -1016,7 +1016,7 @@ XC::BJtensor XC::BJtensor::operator*(const BJtensor &arg) const
 /////#*%
 //#*%
 
-   int *inerr_dims = new int[MAX_TENS_ORD];
+   int inerr_dims[MAX_TENS_ORD];
    for( t=0 ; t<contr_counter ; t++ )
      {
        inerr_dims[t] = this->dim()[this_contr[t]-1];
@@ -1029,24 +1029,24 @@ XC::BJtensor XC::BJtensor::operator*(const BJtensor &arg) const
      }
 
 
-   int *lid = new int[MAX_TENS_ORD];
+   int lid[MAX_TENS_ORD];
    for( t=0 ; t<MAX_TENS_ORD ; t++ )
      {
        lid[t] = 1;
 //DEBUGprint       ::printf("    lid[%d] = %d\n",t,lid[t]);
      }
 
-   int *rid = new int[MAX_TENS_ORD];
+   int rid[MAX_TENS_ORD];
    for( t=0 ;  t<MAX_TENS_ORD ; t++ )
      {
        rid[t] = 1;
 //DEBUGprint       ::printf("    rid[%d] = %d\n",t,rid[t]);
      }
 
-   int *cd = new int[MAX_TENS_ORD];
-   int *rd = new int[MAX_TENS_ORD];
+   int cd[MAX_TENS_ORD];
+   int rd[MAX_TENS_ORD];
 
-   int *resd = new int[MAX_TENS_ORD];
+   int resd[MAX_TENS_ORD];
    for( t=0 ;  t<MAX_TENS_ORD ; t++ )
      {
        resd[t] = 1;
@@ -1173,24 +1173,6 @@ XC::BJtensor XC::BJtensor::operator*(const BJtensor &arg) const
 
           }
 
-// deleting dinamically allocated arrays
-                             
-    delete  [] this_contr;   
-    delete  [] arg_contr;    
-                             
-    delete  [] this_uncontr; 
-    delete  [] arg_uncontr ; 
-                             
-    delete  [] inerr_dims;   
-                             
-    delete  [] lid;          
-    delete  [] rid;          
-                             
-    delete  [] cd;           
-    delete  [] rd;           
-                             
-    delete  [] resd;         
-
 // nullptrification of indices
 
     null_indices();
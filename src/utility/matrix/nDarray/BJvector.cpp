@@ -144,8 +144,8 @@ XC::BJvector &XC::BJvector::operator=(const XC::BJvector & rval)
 // clean up current value;
     if( reference_count(-1) == 0)  // if nobody else is referencing us.
       {
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
         delete pc_nDarray_rep;
       }
  // connect to new value
@@ -145,8 +145,8 @@ XC::Cosseratstraintensor XC::Cosseratstraintensor::operator=(const Cosseratstrai
 // nema potrebe za brojem clanova koji se brisu## see ELLIS & STROUSTRUP $18.3
 //                                                and note on the p.65($5.3.4)
 //        delete  pc_nDarray_rep->pd_nDdata;
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
 // ovo ne smem da brisem jer nije dinamicki alocirano
 //        delete pc_tensor_rep->indices;
         delete pc_nDarray_rep;
@@ -187,8 +187,8 @@ XC::Cosseratstraintensor XC::Cosseratstraintensor::operator=( const XC::BJtensor
 // nema potrebe za brojem clanova koji se brisu## see ELLIS & STROUSTRUP $18.3
 //                                                and note on the p.65($5.3.4)
 //        delete  pc_nDarray_rep->pd_nDdata;
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
 // ovo ne smem da brisem jer nije dinamicki alocirano
 //        delete pc_tensor_rep->indices;
         delete pc_nDarray_rep;
@@ -220,8 +220,8 @@ XC::Cosseratstraintensor XC::Cosseratstraintensor::operator=( const XC::nDarray
 
     if( reference_count(-1) == 0)  // if nobody else is referencing us.
       {
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
         delete pc_nDarray_rep;
       }
 
@@ -0,0 +1,638 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//FixedTensor.h
+
+#ifndef FIXEDTENSOR_H
+#define FIXEDTENSOR_H
+
+#include "utility/matrix/nDarray/nDarray.h"
+#include "utility/matrix/nDarray/BJtensor.h"
+#include "utility/matrix/Vector.h"
+#include <cmath>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+
+namespace XC {
+
+//! @ingroup Matrix
+//
+//! @brief Base class of the fixed size tensor expressions.
+//!
+//! Tensors whose dimensions are known at compile time keep its
+//! components on the stack (no memory allocation), so the loops
+//! can be unrolled and vectorized by the compiler. The linear
+//! combinations of tensors (sums, differences and products by
+//! scalars) are not evaluated until they are assigned or contracted,
+//! so they don't create temporaries (expression templates).
+//! The components are stored by rows (the last index varies
+//! fastest) as in nDarray, and the indexes begin at zero.
+template <class E, int SZ>
+class FixedTensorExpr
+  {
+  public:
+    static const int size= SZ; //!< number of components.
+    inline const E &self(void) const
+      { return static_cast<const E &>(*this); }
+    //! @brief Return the i-th component.
+    inline double operator[](const int &i) const
+      { return self()[i]; }
+  };
+
+//! @brief How the operands are stored in the expression objects: the
+//! expressions (cheap temporaries) are copied and the tensors are
+//! referenced.
+template <class E>
+struct FixedTensorOperand
+  { typedef const E type; };
+
+//! @brief Sum of two tensor expressions.
+template <class L, class R, int SZ>
+class FixedTensorSum: public FixedTensorExpr<FixedTensorSum<L,R,SZ>,SZ>
+  {
+    typename FixedTensorOperand<L>::type l;
+    typename FixedTensorOperand<R>::type r;
+  public:
+    FixedTensorSum(const L &a,const R &b)
+      : l(a), r(b) {}
+    inline double operator[](const int &i) const
+      { return l[i]+r[i]; }
+  };
+
+//! @brief Difference of two tensor expressions.
+template <class L, class R, int SZ>
+class FixedTensorDiff: public FixedTensorExpr<FixedTensorDiff<L,R,SZ>,SZ>
+  {
+    typename FixedTensorOperand<L>::type l;
+    typename FixedTensorOperand<R>::type r;
+  public:
+    FixedTensorDiff(const L &a,const R &b)
+      : l(a), r(b) {}
+    inline double operator[](const int &i) const
+      { return l[i]-r[i]; }
+  };
+
+//! @brief Product of a tensor expression by a scalar.
+template <class E, int SZ>
+class FixedTensorScaled: public FixedTensorExpr<FixedTensorScaled<E,SZ>,SZ>
+  {
+    typename FixedTensorOperand<E>::type e;
+    double factor;
+  public:
+    FixedTensorScaled(const E &a,const double &f)
+      : e(a), factor(f) {}
+    inline double operator[](const int &i) const
+      { return factor*e[i]; }
+  };
+
+template <class L, class R, int SZ>
+inline FixedTensorSum<L,R,SZ> operator+(const FixedTensorExpr<L,SZ> &a,const FixedTensorExpr<R,SZ> &b)
+  { return FixedTensorSum<L,R,SZ>(a.self(),b.self()); }
+
+template <class L, class R, int SZ>
+inline FixedTensorDiff<L,R,SZ> operator-(const FixedTensorExpr<L,SZ> &a,const FixedTensorExpr<R,SZ> &b)
+  { return FixedTensorDiff<L,R,SZ>(a.self(),b.self()); }
+
+template <class E, int SZ>
+inline FixedTensorScaled<E,SZ> operator*(const FixedTensorExpr<E,SZ> &a,const double &f)
+  { return FixedTensorScaled<E,SZ>(a.self(),f); }
+
+template <class E, int SZ>
+inline FixedTensorScaled<E,SZ> operator*(const double &f,const FixedTensorExpr<E,SZ> &a)
+  { return FixedTensorScaled<E,SZ>(a.self(),f); }
+
+template <class E, int SZ>
+inline FixedTensorScaled<E,SZ> operator/(const FixedTensorExpr<E,SZ> &a,const double &f)
+  { return FixedTensorScaled<E,SZ>(a.self(),1.0/f); }
+
+template <class E, int SZ>
+inline FixedTensorScaled<E,SZ> operator-(const FixedTensorExpr<E,SZ> &a)
+  { return FixedTensorScaled<E,SZ>(a.self(),-1.0); }
+
+//! @brief Full contraction of two expressions with the same
+//! dimensions (a_ij b_ij or A_ijkl B_ijkl). For symmetric tensors
+//! in Voigt notation use SymTensor2::ddot.
+template <class L, class R, int SZ>
+inline double inner(const FixedTensorExpr<L,SZ> &a,const FixedTensorExpr<R,SZ> &b)
+  {
+    double retval= 0.0;
+    for(int i= 0;i<SZ;i++)
+      retval+= a[i]*b[i];
+    return retval;
+  }
+
+//! @brief Components of a fixed size tensor.
+template <class Derived, int SZ>
+class FixedTensorStorage: public FixedTensorExpr<Derived,SZ>
+  {
+  protected:
+    double v[SZ]; //!< components.
+
+    //! @brief Copy the components of the expression.
+    template <class E>
+    inline void assign(const FixedTensorExpr<E,SZ> &e)
+      {
+        for(int i= 0;i<SZ;i++)
+          v[i]= e[i];
+      }
+    //! @brief Throw std::invalid_argument if the number of components
+    //! being passed as parameter is not SZ.
+    static void check_size(const int &sz,const char *function)
+      {
+        if(sz!=SZ)
+          {
+            std::ostringstream msg;
+            msg << "FixedTensor::" << function
+                << "; the argument has " << sz
+                << " components, " << SZ << " expected.";
+            throw std::invalid_argument(msg.str());
+          }
+      }
+    //! @brief Copy the components of the nDarray (it must have the same
+    //! number of components, otherwise std::invalid_argument is thrown).
+    void assign(const nDarray &t)
+      {
+        check_size(t.getNumberOfComponents(),__FUNCTION__);
+        const double *c= t.getComponents();
+        for(int i= 0;i<SZ;i++)
+          v[i]= c[i];
+      }
+    //! @brief Copy the components of the vector (it must have the same
+    //! number of components, otherwise std::invalid_argument is thrown).
+    void assign(const Vector &vct)
+      {
+        check_size(vct.Size(),__FUNCTION__);
+        for(int i= 0;i<SZ;i++)
+          v[i]= vct(i);
+      }
+    //! @brief Return the components in a vector.
+    Vector get_vector(void) const
+      {
+        Vector retval(SZ);
+        for(int i= 0;i<SZ;i++)
+          retval(i)= v[i];
+        return retval;
+      }
+  public:
+    //! @brief Constructor (all the components are set to the value).
+    explicit FixedTensorStorage(const double &value= 0.0)
+      {
+        for(int i= 0;i<SZ;i++)
+          v[i]= value;
+      }
+    inline double operator[](const int &i) const
+      { return v[i]; }
+    inline double &operator[](const int &i)
+      { return v[i]; }
+    inline const double *getComponents(void) const
+      { return v; }
+    inline double *getComponents(void)
+      { return v; }
+    //! @brief Set all the components to zero.
+    void Zero(void)
+      {
+        for(int i= 0;i<SZ;i++)
+          v[i]= 0.0;
+      }
+    template <class E>
+    Derived &operator+=(const FixedTensorExpr<E,SZ> &e)
+      {
+        for(int i= 0;i<SZ;i++)
+          v[i]+= e[i];
+        return static_cast<Derived &>(*this);
+      }
+    template <class E>
+    Derived &operator-=(const FixedTensorExpr<E,SZ> &e)
+      {
+        for(int i= 0;i<SZ;i++)
+          v[i]-= e[i];
+        return static_cast<Derived &>(*this);
+      }
+    Derived &operator*=(const double &f)
+      {
+        for(int i= 0;i<SZ;i++)
+          v[i]*= f;
+        return static_cast<Derived &>(*this);
+      }
+    //! @brief Return the Frobenius norm.
+    double Norm(void) const
+      { return sqrt(inner(*this,*this)); }
+    //! @brief Copy the components into the nDarray (it must have the same
+    //! number of components, otherwise std::invalid_argument is
+    //! thrown). The components of the nDarray objects are
+    //! shared by its copies, so don't use it with arrays that
+    //! can be referenced from elsewhere.
+    void copyTo(nDarray &t) const
+      {
+        check_size(t.getNumberOfComponents(),__FUNCTION__);
+        double *c= t.getComponents();
+        for(int i= 0;i<SZ;i++)
+          c[i]= v[i];
+      }
+  };
+
+//! @ingroup Matrix
+//
+//! @brief Second order tensor of dimension N (full storage).
+template <int N>
+class Tensor2: public FixedTensorStorage<Tensor2<N>,N*N>
+  {
+    typedef FixedTensorStorage<Tensor2<N>,N*N> storage;
+    using storage::v;
+  public:
+    static const int dimension= N;
+    explicit Tensor2(const double &value= 0.0)
+      : storage(value) {}
+    template <class E>
+    Tensor2(const FixedTensorExpr<E,N*N> &e)
+      : storage() { this->assign(e); }
+    //! @brief Constructor from a second order nDarray (BJtensor, stresstensor,...).
+    explicit Tensor2(const nDarray &t)
+      : storage() { storage::assign(t); }
+    //! @brief Constructor from a vector with the components stored by rows.
+    explicit Tensor2(const Vector &vct)
+      : storage() { storage::assign(vct); }
+    template <class E>
+    Tensor2 &operator=(const FixedTensorExpr<E,N*N> &e)
+      { this->assign(e); return *this; }
+
+    //! @brief Return the (i,j) component (indexes begin at zero).
+    inline double operator()(const int &i,const int &j) const
+      { return v[i*N+j]; }
+    //! @brief Return the (i,j) component (indexes begin at zero).
+    inline double &operator()(const int &i,const int &j)
+      { return v[i*N+j]; }
+
+    //! @brief Return the identity tensor (Kronecker delta).
+    static Tensor2 identity(void)
+      {
+        Tensor2 retval;
+        for(int i= 0;i<N;i++)
+          retval(i,i)= 1.0;
+        return retval;
+      }
+    double trace(void) const
+      {
+        double retval= 0.0;
+        for(int i= 0;i<N;i++)
+          retval+= v[i*N+i];
+        return retval;
+      }
+    Tensor2 transpose(void) const
+      {
+        Tensor2 retval;
+        for(int i= 0;i<N;i++)
+          for(int j= 0;j<N;j++)
+            retval(i,j)= (*this)(j,i);
+        return retval;
+      }
+    //! @brief Return the deviatoric part of the tensor.
+    Tensor2 deviator(void) const
+      {
+        Tensor2 retval(*this);
+        const double p= trace()/N;
+        for(int i= 0;i<N;i++)
+          retval(i,i)-= p;
+        return retval;
+      }
+    //! @brief Return the second invariant of the deviatoric part.
+    double J2(void) const
+      {
+        const Tensor2 s= deviator();
+        return 0.5*inner(s,s);
+      }
+    //! @brief Return the components stored by rows in a vector.
+    inline Vector getVector(void) const
+      { return this->get_vector(); }
+    //! @brief Return the second order tensor stored in a BJtensor.
+    BJtensor getBJtensor(void) const
+      {
+        const int dims[2]= {N,N};
+        BJtensor retval(2,dims,0.0);
+        this->copyTo(retval);
+        return retval;
+      }
+  };
+
+template <int N>
+struct FixedTensorOperand<Tensor2<N> >
+  { typedef const Tensor2<N> &type; };
+
+//! @brief Single contraction of two second order tensors (a_ik b_kj).
+template <int N>
+Tensor2<N> dot(const Tensor2<N> &a,const Tensor2<N> &b)
+  {
+    Tensor2<N> retval;
+    for(int i= 0;i<N;i++)
+      for(int k= 0;k<N;k++)
+        {
+          const double aik= a(i,k);
+          for(int j= 0;j<N;j++)
+            retval(i,j)+= aik*b(k,j);
+        }
+    return retval;
+  }
+
+//! @brief Determinant of a second order 3D tensor.
+inline double determinant(const Tensor2<3> &a)
+  {
+    return a(0,0)*(a(1,1)*a(2,2)-a(1,2)*a(2,1))
+          -a(0,1)*(a(1,0)*a(2,2)-a(1,2)*a(2,0))
+          +a(0,2)*(a(1,0)*a(2,1)-a(1,1)*a(2,0));
+  }
+
+//! @ingroup Matrix
+//
+//! @brief Fourth order tensor of dimension N (full storage).
+template <int N>
+class Tensor4: public FixedTensorStorage<Tensor4<N>,N*N*N*N>
+  {
+    typedef FixedTensorStorage<Tensor4<N>,N*N*N*N> storage;
+    using storage::v;
+  public:
+    static const int dimension= N;
+    explicit Tensor4(const double &value= 0.0)
+      : storage(value) {}
+    template <class E>
+    Tensor4(const FixedTensorExpr<E,N*N*N*N> &e)
+      : storage() { this->assign(e); }
+    //! @brief Constructor from a fourth order nDarray (BJtensor,...).
+    explicit Tensor4(const nDarray &t)
+      : storage() { storage::assign(t); }
+    //! @brief Constructor from a vector with the components stored by rows.
+    explicit Tensor4(const Vector &vct)
+      : storage() { storage::assign(vct); }
+    template <class E>
+    Tensor4 &operator=(const FixedTensorExpr<E,N*N*N*N> &e)
+      { this->assign(e); return *this; }
+
+    //! @brief Return the (i,j,k,l) component (indexes begin at zero).
+    inline double operator()(const int &i,const int &j,const int &k,const int &l) const
+      { return v[((i*N+j)*N+k)*N+l]; }
+    //! @brief Return the (i,j,k,l) component (indexes begin at zero).
+    inline double &operator()(const int &i,const int &j,const int &k,const int &l)
+      { return v[((i*N+j)*N+k)*N+l]; }
+
+    //! @brief Return the isotropic tensor delta_ij delta_kl.
+    static Tensor4 I_ijkl(void)
+      {
+        Tensor4 retval;
+        for(int i= 0;i<N;i++)
+          for(int k= 0;k<N;k++)
+            retval(i,i,k,k)= 1.0;
+        return retval;
+      }
+    //! @brief Return the isotropic tensor delta_ik delta_jl.
+    static Tensor4 I_ikjl(void)
+      {
+        Tensor4 retval;
+        for(int i= 0;i<N;i++)
+          for(int j= 0;j<N;j++)
+            retval(i,j,i,j)= 1.0;
+        return retval;
+      }
+    //! @brief Return the isotropic tensor delta_il delta_jk.
+    static Tensor4 I_iljk(void)
+      {
+        Tensor4 retval;
+        for(int i= 0;i<N;i++)
+          for(int j= 0;j<N;j++)
+            retval(i,j,j,i)= 1.0;
+        return retval;
+      }
+    //! @brief Return the isotropic tensor:
+    //! a*delta_ij*delta_kl + b*(delta_ik*delta_jl+delta_il*delta_jk)/2
+    //! (i.e. the elastic stiffness with a= lambda and b= 2*mu).
+    static Tensor4 isotropic(const double &a,const double &b)
+      {
+        Tensor4 retval;
+        for(int i= 0;i<N;i++)
+          for(int j= 0;j<N;j++)
+            for(int k= 0;k<N;k++)
+              for(int l= 0;l<N;l++)
+                {
+                  const double I_ijkl= ((i==j) && (k==l)) ? 1.0 : 0.0;
+                  const double I_ikjl= ((i==k) && (j==l)) ? 1.0 : 0.0;
+                  const double I_iljk= ((i==l) && (j==k)) ? 1.0 : 0.0;
+                  retval(i,j,k,l)= I_ijkl*a + ((I_ikjl+I_iljk)*0.5)*b;
+                }
+        return retval;
+      }
+    //! @brief Return the components stored by rows in a vector.
+    inline Vector getVector(void) const
+      { return this->get_vector(); }
+    //! @brief Return the fourth order tensor stored in a BJtensor.
+    BJtensor getBJtensor(void) const
+      {
+        const int dims[4]= {N,N,N,N};
+        BJtensor retval(4,dims,0.0);
+        this->copyTo(retval);
+        return retval;
+      }
+  };
+
+template <int N>
+struct FixedTensorOperand<Tensor4<N> >
+  { typedef const Tensor4<N> &type; };
+
+//! @brief Double contraction C_ijkl e_kl.
+template <int N, class E>
+Tensor2<N> ddot(const Tensor4<N> &C,const FixedTensorExpr<E,N*N> &e)
+  {
+    const Tensor2<N> ee(e); // evaluate the expression only once.
+    Tensor2<N> retval;
+    const double *c= C.getComponents();
+    for(int ij= 0;ij<N*N;ij++)
+      {
+        double s= 0.0;
+        for(int kl= 0;kl<N*N;kl++)
+          s+= c[ij*N*N+kl]*ee[kl];
+        retval[ij]= s;
+      }
+    return retval;
+  }
+
+//! @brief Double contraction e_ij C_ijkl.
+template <int N, class E>
+Tensor2<N> ddot(const FixedTensorExpr<E,N*N> &e,const Tensor4<N> &C)
+  {
+    const Tensor2<N> ee(e); // evaluate the expression only once.
+    Tensor2<N> retval;
+    const double *c= C.getComponents();
+    for(int ij= 0;ij<N*N;ij++)
+      {
+        const double eij= ee[ij];
+        for(int kl= 0;kl<N*N;kl++)
+          retval[kl]+= eij*c[ij*N*N+kl];
+      }
+    return retval;
+  }
+
+//! @brief Double contraction A_ijmn B_mnkl.
+template <int N>
+Tensor4<N> ddot(const Tensor4<N> &A,const Tensor4<N> &B)
+  {
+    Tensor4<N> retval;
+    const int N2= N*N;
+    const double *a= A.getComponents();
+    const double *b= B.getComponents();
+    double *r= retval.getComponents();
+    for(int ij= 0;ij<N2;ij++)
+      for(int mn= 0;mn<N2;mn++)
+        {
+          const double aijmn= a[ij*N2+mn];
+          for(int kl= 0;kl<N2;kl++)
+            r[ij*N2+kl]+= aijmn*b[mn*N2+kl];
+        }
+    return retval;
+  }
+
+//! @brief Dyadic product a_ij b_kl.
+template <int N>
+Tensor4<N> dyad(const Tensor2<N> &aa,const Tensor2<N> &bb)
+  {
+    Tensor4<N> retval;
+    const int N2= N*N;
+    double *r= retval.getComponents();
+    for(int ij= 0;ij<N2;ij++)
+      for(int kl= 0;kl<N2;kl++)
+        r[ij*N2+kl]= aa[ij]*bb[kl];
+    return retval;
+  }
+
+//! @ingroup Matrix
+//
+//! @brief Symmetric second order 3D tensor stored in Voigt notation
+//! (components xx, yy, zz, xy, yz, zx as in the 3D nDMaterials).
+//!
+//! The shear components are the tensor ones (not the engineering
+//! strains), the conversion is made when the components are read from
+//! or written to a Vector.
+class SymTensor2: public FixedTensorStorage<SymTensor2,6>
+  {
+    typedef FixedTensorStorage<SymTensor2,6> storage;
+  public:
+    //! @brief Voigt index of the (i,j) component.
+    static inline int voigt(const int &i,const int &j)
+      {
+        static const int idx[3][3]= {{0,3,5},{3,1,4},{5,4,2}};
+        return idx[i][j];
+      }
+    explicit SymTensor2(const double &value= 0.0)
+      : storage(value) {}
+    template <class E>
+    SymTensor2(const FixedTensorExpr<E,6> &e)
+      : storage() { this->assign(e); }
+    //! @brief Constructor from a full tensor (it takes the symmetric part).
+    explicit SymTensor2(const Tensor2<3> &t)
+      : storage()
+      {
+        for(int i= 0;i<3;i++)
+          for(int j= i;j<3;j++)
+            v[voigt(i,j)]= 0.5*(t(i,j)+t(j,i));
+      }
+    //! @brief Constructor from a vector in Voigt notation.
+    //! @param engineeringShear: if true the shear components of the
+    //! vector are engineering strains (twice the tensor ones).
+    SymTensor2(const Vector &vct,const bool &engineeringShear)
+      : storage()
+      {
+        const double f= (engineeringShear ? 0.5 : 1.0);
+        for(int i= 0;i<3;i++)
+          {
+            v[i]= vct(i);
+            v[i+3]= f*vct(i+3);
+          }
+      }
+    template <class E>
+    SymTensor2 &operator=(const FixedTensorExpr<E,6> &e)
+      { this->assign(e); return *this; }
+
+    //! @brief Return the (i,j) component (indexes begin at zero).
+    inline double operator()(const int &i,const int &j) const
+      { return v[voigt(i,j)]; }
+    //! @brief Return the (i,j) component (indexes begin at zero).
+    inline double &operator()(const int &i,const int &j)
+      { return v[voigt(i,j)]; }
+
+    double trace(void) const
+      { return v[0]+v[1]+v[2]; }
+    //! @brief Return the deviatoric part of the tensor.
+    SymTensor2 deviator(void) const
+      {
+        SymTensor2 retval(*this);
+        const double p= trace()/3.0;
+        for(int i= 0;i<3;i++)
+          retval.v[i]-= p;
+        return retval;
+      }
+    //! @brief Return the full contraction with other symmetric tensor.
+    double ddot(const SymTensor2 &b) const
+      {
+        double retval= 0.0;
+        for(int i= 0;i<3;i++)
+          retval+= v[i]*b.v[i]+2.0*v[i+3]*b.v[i+3];
+        return retval;
+      }
+    //! @brief Return the second invariant of the deviatoric part.
+    double J2(void) const
+      {
+        const SymTensor2 s= deviator();
+        return 0.5*s.ddot(s);
+      }
+    //! @brief Return the tensor with full storage.
+    Tensor2<3> getTensor2(void) const
+      {
+        Tensor2<3> retval;
+        for(int i= 0;i<3;i++)
+          for(int j= 0;j<3;j++)
+            retval(i,j)= (*this)(i,j);
+        return retval;
+      }
+    //! @brief Return the components in a vector (Voigt notation).
+    //! @param engineeringShear: if true the shear components of the
+    //! vector are engineering strains (twice the tensor ones).
+    Vector getVector(const bool &engineeringShear) const
+      {
+        Vector retval(6);
+        const double f= (engineeringShear ? 2.0 : 1.0);
+        for(int i= 0;i<3;i++)
+          {
+            retval(i)= v[i];
+            retval(i+3)= f*v[i+3];
+          }
+        return retval;
+      }
+  };
+
+template <>
+struct FixedTensorOperand<SymTensor2>
+  { typedef const SymTensor2 &type; };
+
+} // end of XC namespace
+
+#endif
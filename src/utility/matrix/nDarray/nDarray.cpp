@@ -129,7 +129,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, double initval)
 // operator new
    int one_or0 = 0;
    if(!pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-   pc_nDarray_rep->dim = new int[pc_nDarray_rep->nDarray_rank+one_or0];// array for
+   pc_nDarray_rep->alloc_dim(pc_nDarray_rep->nDarray_rank+one_or0);// array for
                                                                        // dimensions
    const int default_dim  = 1;
    pc_nDarray_rep->total_numb = 1;
@@ -140,7 +140,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, double initval)
      }
 
 // allocate memory for the actual XC::nDarray as XC::nDarray
-   pc_nDarray_rep->pd_nDdata = new double [(size_t) pc_nDarray_rep->total_numb];
+   pc_nDarray_rep->alloc_data(pc_nDarray_rep->total_numb);
      if (!pc_nDarray_rep->pd_nDdata)
        {
          ::fprintf(stderr,"\a\nInsufficient memory for array\n");
@@ -165,7 +165,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, const int *pdim, double *values)
 // operator new
    int one_or0 = 0;
    if(!pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-   pc_nDarray_rep->dim = new int[pc_nDarray_rep->nDarray_rank+one_or0];// array for
+   pc_nDarray_rep->alloc_dim(pc_nDarray_rep->nDarray_rank+one_or0);// array for
                                                                  // dimensions
 
    pc_nDarray_rep->total_numb = 1;
@@ -177,7 +177,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, const int *pdim, double *values)
 
 
 // allocate memory for the actual XC::nDarray as XC::nDarray
-   pc_nDarray_rep->pd_nDdata = new double [(size_t)pc_nDarray_rep->total_numb];
+   pc_nDarray_rep->alloc_data(pc_nDarray_rep->total_numb);
      if (!pc_nDarray_rep->pd_nDdata)
        {
          ::fprintf(stderr,"\a\nInsufficient memory for array\n");
@@ -203,7 +203,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, const int *pdim, double initvalue)
 // operator new
    int one_or0 = 0;
    if(!pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-   pc_nDarray_rep->dim = new int[pc_nDarray_rep->nDarray_rank+one_or0];// array for
+   pc_nDarray_rep->alloc_dim(pc_nDarray_rep->nDarray_rank+one_or0);// array for
                                                                  // dimensions
 
    pc_nDarray_rep->total_numb = 1;
@@ -214,7 +214,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, const int *pdim, double initvalue)
      }
 
 // allocate memory for the actual XC::nDarray as XC::nDarray
-   pc_nDarray_rep->pd_nDdata = new double [(size_t)pc_nDarray_rep->total_numb];
+   pc_nDarray_rep->alloc_data(pc_nDarray_rep->total_numb);
      if (!pc_nDarray_rep->pd_nDdata)
        {
          ::fprintf(stderr,"\a\nInsufficient memory for array\n");
@@ -242,7 +242,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, int rows, int cols, double *values)
 // operator new
   int one_or0 = 0;
   if(!pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-  pc_nDarray_rep->dim = new int[pc_nDarray_rep->nDarray_rank+one_or0];// array for
+  pc_nDarray_rep->alloc_dim(pc_nDarray_rep->nDarray_rank+one_or0);// array for
                                                                 // dimensions
 
   pc_nDarray_rep->total_numb = 1;
@@ -252,7 +252,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, int rows, int cols, double *values)
   pc_nDarray_rep->total_numb = rows*cols;
 
 // allocate memory for the actual XC::nDarray as XC::nDarray
-  pc_nDarray_rep->pd_nDdata = new double [(size_t)pc_nDarray_rep->total_numb];
+  pc_nDarray_rep->alloc_data(pc_nDarray_rep->total_numb);
     if (!pc_nDarray_rep->pd_nDdata)
       {
         ::fprintf(stderr,"\a\nInsufficient memory for array\n");
@@ -277,7 +277,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, int rows, int cols, double values)
 // operator new
   int one_or0 = 0;
   if(!pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-  pc_nDarray_rep->dim = new int[pc_nDarray_rep->nDarray_rank+one_or0];// array for
+  pc_nDarray_rep->alloc_dim(pc_nDarray_rep->nDarray_rank+one_or0);// array for
                                                                 // dimensions
 
   pc_nDarray_rep->total_numb = 1;
@@ -287,7 +287,7 @@ XC::nDarray::nDarray(int rank_of_nDarray, int rows, int cols, double values)
   pc_nDarray_rep->total_numb = rows*cols;
 
 // allocate memory for the actual XC::nDarray as XC::nDarray
-  pc_nDarray_rep->pd_nDdata = new double [(size_t)pc_nDarray_rep->total_numb];
+  pc_nDarray_rep->alloc_data(pc_nDarray_rep->total_numb);
     if (!pc_nDarray_rep->pd_nDdata)
       {
         ::fprintf(stderr,"\a\nInsufficient memory for array\n");
@@ -361,7 +361,7 @@ XC::nDarray::nDarray(const std::string &flag, int rank_of_nDarray, const int *pd
 // operator new
    int one_or0 = 0;
    if(!pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-   pc_nDarray_rep->dim = new int[pc_nDarray_rep->nDarray_rank+one_or0];// array for
+   pc_nDarray_rep->alloc_dim(pc_nDarray_rep->nDarray_rank+one_or0);// array for
                                                                  // dimensions
 
    pc_nDarray_rep->total_numb = 1;
@@ -372,7 +372,7 @@ XC::nDarray::nDarray(const std::string &flag, int rank_of_nDarray, const int *pd
      }
 
 // allocate memory for the actual XC::nDarray as XC::nDarray
-   pc_nDarray_rep->pd_nDdata = new double [(size_t)pc_nDarray_rep->total_numb];
+   pc_nDarray_rep->alloc_data(pc_nDarray_rep->total_numb);
      if (!pc_nDarray_rep->pd_nDdata)
        {
          ::fprintf(stderr,"\a\nInsufficient memory for array\n");
@@ -469,8 +469,8 @@ XC::nDarray::~nDarray()
 //  see ELLIS & STROUSTRUP $18.3
 //  and note on the p.65($5.3.4)
 //  and the page 276 ($12.4)
-    delete [] pc_nDarray_rep->pd_nDdata;
-    delete [] pc_nDarray_rep->dim;
+    pc_nDarray_rep->free_data();
+    pc_nDarray_rep->free_dim();
     delete pc_nDarray_rep;
   }
 }
@@ -507,8 +507,8 @@ void XC::nDarray::Initialize_all( const XC::nDarray & from )
 // operator new
    int one_or0 = 0;
    if(!this->pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-   delete  [] this->pc_nDarray_rep->dim; // get rid of old allocated memory
-   this->pc_nDarray_rep->dim = new int[pc_nDarray_rep->nDarray_rank+one_or0];// array for
+   this->pc_nDarray_rep->free_dim(); // get rid of old allocated memory
+   this->pc_nDarray_rep->alloc_dim(pc_nDarray_rep->nDarray_rank+one_or0);// array for
                                                                  // dimensions
    this->pc_nDarray_rep->total_numb = 1;
    for( int idim = 0 ; idim < this->pc_nDarray_rep->nDarray_rank ; idim++ )
@@ -516,9 +516,9 @@ void XC::nDarray::Initialize_all( const XC::nDarray & from )
        this->pc_nDarray_rep->dim[idim] = from.dim()[idim]; // fill dims from from!!
        this->pc_nDarray_rep->total_numb *= pc_nDarray_rep->dim[idim]; // find total number
      }
-   delete [] this->pc_nDarray_rep->pd_nDdata; // get rid of old allocated memory
+   this->pc_nDarray_rep->free_data(); // get rid of old allocated memory
 // allocate memory for the actual XC::nDarray as XC::nDarray
-   this->pc_nDarray_rep->pd_nDdata = new double [(size_t)pc_nDarray_rep->total_numb];
+   this->pc_nDarray_rep->alloc_data(pc_nDarray_rep->total_numb);
      if (!this->pc_nDarray_rep->pd_nDdata)
        {
          ::fprintf(stderr,"\a\nInsufficient memory for array in Initialize_all \n");
@@ -541,8 +541,8 @@ XC::nDarray XC::nDarray::deep_copy()
 // operator new
    int one_or0 = 0;
    if(!temp.pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-   delete [] temp.pc_nDarray_rep->dim; //delete default value
-   temp.pc_nDarray_rep->dim = new int[temp.pc_nDarray_rep->nDarray_rank+one_or0];// array for
+   temp.pc_nDarray_rep->free_dim(); //delete default value
+   temp.pc_nDarray_rep->alloc_dim(temp.pc_nDarray_rep->nDarray_rank+one_or0);// array for
                                                                  // dimensions
 
    for( int idim = 0 ; idim < temp.pc_nDarray_rep->nDarray_rank ; idim++ )
@@ -551,8 +551,8 @@ XC::nDarray XC::nDarray::deep_copy()
      }
        temp.pc_nDarray_rep->total_numb = this->pc_nDarray_rep->total_numb;
 
-   delete [] temp.pc_nDarray_rep->pd_nDdata;//delete default value
-   temp.pc_nDarray_rep->pd_nDdata = new double [temp.pc_nDarray_rep->total_numb];
+   temp.pc_nDarray_rep->free_data();//delete default value
+   temp.pc_nDarray_rep->alloc_data(temp.pc_nDarray_rep->total_numb);
      if (!temp.pc_nDarray_rep->pd_nDdata)
        {
          ::fprintf(stderr,"\a\nInsufficient memory for array in deep_copy\n");
@@ -585,8 +585,8 @@ XC::nDarray& XC::nDarray::operator=(const XC::nDarray & rval)
 //      delete [pc_nDarray_rep->pc_nDarray_rep->total_numb] pc_nDarray_rep->pd_nDdata;
 //  see ELLIS & STROUSTRUP $18.3
 //  and note on the p.65($5.3.4)
-        delete [] pc_nDarray_rep->pd_nDdata;
-        delete [] pc_nDarray_rep->dim;
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
         delete pc_nDarray_rep;
       }
 
@@ -1099,7 +1099,7 @@ i,rval.pc_nDarray_rep->dim[i]);
 // operator new
         int one_or0 = 0;
         if(!New_pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-        New_pc_nDarray_rep->dim = new int[New_pc_nDarray_rep->nDarray_rank+one_or0];
+        New_pc_nDarray_rep->alloc_dim(New_pc_nDarray_rep->nDarray_rank+one_or0);
                                   // array for dimensions
         New_pc_nDarray_rep->total_numb = 1;
         for( int idim = 0 ; idim < New_pc_nDarray_rep->nDarray_rank ; idim++ )
@@ -1108,7 +1108,7 @@ i,rval.pc_nDarray_rep->dim[i]);
             New_pc_nDarray_rep->total_numb *= New_pc_nDarray_rep->dim[idim];
           }
 // allocate memory for the actual XC::nDarray as XC::nDarray
-        New_pc_nDarray_rep->pd_nDdata = new double [(size_t)New_pc_nDarray_rep->total_numb];
+        New_pc_nDarray_rep->alloc_data(New_pc_nDarray_rep->total_numb);
           if (!New_pc_nDarray_rep->pd_nDdata)
             {
               ::fprintf(stderr,"\a\nInsufficient memory for array\n");
@@ -1261,7 +1261,7 @@ i,rval.pc_nDarray_rep->dim[i]);
 // operator new
         int one_or0 = 0;
         if(!New_pc_nDarray_rep->nDarray_rank) one_or0 = 1;
-        New_pc_nDarray_rep->dim = new int[New_pc_nDarray_rep->nDarray_rank+one_or0];
+        New_pc_nDarray_rep->alloc_dim(New_pc_nDarray_rep->nDarray_rank+one_or0);
                                   // array for dimensions
         New_pc_nDarray_rep->total_numb = 1;
         for( int idim = 0 ; idim < New_pc_nDarray_rep->nDarray_rank ; idim++ )
@@ -1270,7 +1270,7 @@ i,rval.pc_nDarray_rep->dim[i]);
             New_pc_nDarray_rep->total_numb *= New_pc_nDarray_rep->dim[idim];
           }
 // allocate memory for the actual XC::nDarray as XC::nDarray
-        New_pc_nDarray_rep->pd_nDdata = new double [(size_t)New_pc_nDarray_rep->total_numb];
+        New_pc_nDarray_rep->alloc_data(New_pc_nDarray_rep->total_numb);
           if (!New_pc_nDarray_rep->pd_nDdata)
             {
               ::fprintf(stderr,"\a\nInsufficient memory for array\n");
@@ -2457,15 +2457,161 @@ void XC::nDarray::eigsrt(double * d, double ** v, int n)
     }
 
 
+//##############################################################################
+//! @brief Return the number of components of the array.
+long int XC::nDarray::getNumberOfComponents(void) const
+  { return pc_nDarray_rep->total_numb; }
+
+//! @brief Return a pointer to the components of the array
+//! (stored by rows: the last index varies fastest).
+const double *XC::nDarray::getComponents(void) const
+  { return pc_nDarray_rep->pd_nDdata; }
+
+//! @brief Return a pointer to the components of the array
+//! (stored by rows: the last index varies fastest).
+double *XC::nDarray::getComponents(void)
+  { return pc_nDarray_rep->pd_nDdata; }
+
 //tempOUT//##############################################################################
 // TENSOR_REP_CC
 // #######################
 // memory manager part
+
+//! @brief Set the array for the dimensions (stored inline if
+//! its size is small enough).
+int *XC::nDarray_rep::alloc_dim(int sz)
+  {
+    if(sz<=inline_rank)
+      dim= inline_dim;
+    else
+      dim= new int[sz];
+    return dim;
+  }
+
+namespace
+  {
+    struct RepFreeBlock
+      { RepFreeBlock *next; };
+
+    //! @brief Free list of memory blocks (one for each thread).
+    //!
+    //! The temporaries created while evaluating tensor expressions
+    //! reuse the blocks released by the previous ones, so the
+    //! material routines don't call malloc/free once the list is
+    //! filled. The lists are trivially destructible; the blocks
+    //! are returned to the system by FreeListsOwner when the
+    //! thread ends.
+    struct RepFreeList
+      {
+        RepFreeBlock *head; //!< first block of the list.
+        size_t size; //!< number of blocks in the list.
+      };
+    const size_t maxFreeReps= 256; //!< maximum number of blocks kept by each thread.
+    thread_local RepFreeList freeReps= {nullptr,0}; //!< nDarray_rep blocks.
+    thread_local RepFreeList freeData= {nullptr,0}; //!< component blocks of the fourth order tensors in 3D.
+    thread_local bool freeListsReleased= false; //!< true once the thread has released its lists.
+
+    //! @brief Releases the free lists of the thread when it ends.
+    //! The blocks released after that (i.e. by static tensors) are
+    //! returned to the system directly.
+    struct FreeListsOwner
+      {
+        static void clear(RepFreeList &l)
+          {
+            while(l.head)
+              {
+                RepFreeBlock *next= l.head->next;
+                ::operator delete(l.head);
+                l.head= next;
+              }
+            l.size= 0;
+          }
+        ~FreeListsOwner(void)
+          {
+            clear(freeReps);
+            clear(freeData);
+            freeListsReleased= true;
+          }
+      };
+
+    //! @brief Return a block from the list (null if the list is empty).
+    void *pop_block(RepFreeList &l)
+      {
+        RepFreeBlock *retval= l.head;
+        if(retval)
+          {
+            l.head= retval->next;
+            l.size--;
+          }
+        return retval;
+      }
+
+    //! @brief Put the block in the list; return false if the
+    //! list is full or already released (the caller must free it).
+    bool push_block(RepFreeList &l, void *p)
+      {
+        if(freeListsReleased || (l.size>=maxFreeReps))
+          return false;
+        thread_local FreeListsOwner owner; // created with the first block.
+        (void) owner;
+        RepFreeBlock *block= static_cast<RepFreeBlock *>(p);
+        block->next= l.head;
+        l.head= block;
+        l.size++;
+        return true;
+      }
+  }
+
+//! @brief Set the array for the components (stored inline if
+//! its size is small enough, recycled if it has the size of a
+//! fourth order tensor in 3D).
+double *XC::nDarray_rep::alloc_data(long int sz)
+  {
+    pooled_data= false;
+    if(sz<=inline_size)
+      pd_nDdata= inline_data;
+    else if(sz==pooled_size)
+      {
+        pooled_data= true;
+        pd_nDdata= static_cast<double *>(pop_block(freeData));
+        if(!pd_nDdata)
+          pd_nDdata= static_cast<double *>(::operator new(pooled_size*sizeof(double)));
+      }
+    else
+      pd_nDdata= new double[(size_t) sz];
+    return pd_nDdata;
+  }
+
+//! @brief Free the array for the dimensions.
+void XC::nDarray_rep::free_dim(void)
+  {
+    if(dim!=inline_dim)
+      delete [] dim;
+    dim= nullptr;
+  }
+
+//! @brief Free the array for the components.
+void XC::nDarray_rep::free_data(void)
+  {
+    if(pooled_data)
+      {
+        if(!push_block(freeData,pd_nDdata))
+          ::operator delete(pd_nDdata);
+      }
+    else if(pd_nDdata!=inline_data)
+      delete [] pd_nDdata;
+    pd_nDdata= nullptr;
+    pooled_data= false;
+  }
+
 // overloading operator new in XC::nDarray::nDarray_rep class  ##################
 void * XC::nDarray_rep::operator new(size_t s)
   {                                       // see C++ reference manual by
-    void *void_pointer;                   // ELLIS and STROUSTRUP page 283.
-    void_pointer = ::operator new(s);     // and ECKEL page 529.
+    void *void_pointer= nullptr;          // ELLIS and STROUSTRUP page 283.
+    if(s==sizeof(nDarray_rep))
+      void_pointer= pop_block(freeReps);  // reuse a released block.
+    if(!void_pointer)
+      void_pointer = ::operator new(s);     // and ECKEL page 529.
 //    ::printf("\nnew pointer %p of size %d\n",void_pointer,s);
     if (!void_pointer)
       {
@@ -2481,7 +2627,10 @@ void XC::nDarray_rep::operator delete(void *p)
                                           // ELLIS and STROUSTRUP page 283.
                                           // and ECKEL page 529.
 //    ::printf("deleted pointer %p\n",p);
-    ::operator delete(p);
+    if(!p)
+      return;
+    if(!push_block(freeReps,p))
+      ::operator delete(p);
   }
 
 
@@ -146,7 +146,24 @@ class nDarray_rep
                        //      dim[1] = dimension in direction 2
                        //      dim[2] = dimension in direction 3  */
     int n;             // reference count
+
+    // Small arrays (up to second order tensors in 3D) are stored
+    // inside the representation itself, so no memory is allocated
+    // for them (the representations are recycled by operator new).
+    // The components of the fourth order tensors in 3D are recycled
+    // through a separate free list (see alloc_data).
+    static const int inline_rank= 4; //!< maximum rank stored inline.
+    static const long int inline_size= 9; //!< maximum number of components stored inline.
+    static const long int pooled_size= 81; //!< number of components of the recycled blocks.
+    int inline_dim[inline_rank];
+    double inline_data[inline_size];
+    bool pooled_data; //!< true if pd_nDdata comes from the free list of blocks.
   public:
+    int *alloc_dim(int sz);
+    double *alloc_data(long int sz);
+    void free_dim(void);
+    void free_data(void);
+
 // overloading operator new and delete in nDarray_rep class  ########
     void * operator new(size_t s); // see C++ reference manual by
     void operator delete(void *);  // by ELLIS and STROUSTRUP page 283.
@@ -326,6 +343,9 @@ class nDarray
   public:
     int rank(void) const;
     int dim(int which) const;
+    long int getNumberOfComponents(void) const;
+    const double *getComponents(void) const;
+    double *getComponents(void);
 
 // from Numerical recipes in C
   private:
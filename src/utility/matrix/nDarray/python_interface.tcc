@@ -25,7 +25,7 @@ class_<XC::nDarray, boost::noncopyable >("nDarray", no_init);
 
 class_<XC::BJmatrix , bases<XC::nDarray>, boost::noncopyable >("BJmatrix", no_init);
 
-class_<XC::BJtensor, bases<XC::nDarray>, boost::noncopyable >("BJtensor", no_init);
+class_<XC::BJtensor, bases<XC::nDarray> >("BJtensor", no_init);
 
 class_<XC::Cosseratstraintensor , bases<XC::BJtensor>, boost::noncopyable >("Cosseratstraintensor", no_init);
 
@@ -33,5 +33,57 @@ class_<XC::Cosseratstresstensor , bases<XC::BJtensor>, boost::noncopyable >("Cos
 
 class_<XC::straintensor , bases<XC::BJtensor>, boost::noncopyable >("straintensor", no_init);
 
-class_<XC::stresstensor , bases<XC::BJtensor>, boost::noncopyable >("stresstensor", no_init);
+class_<XC::stresstensor , bases<XC::BJtensor> >("stresstensor", init<const XC::BJtensor &>())
+  .def("Jinvariant2",&XC::stresstensor::Jinvariant2,"Return the second invariant of the deviatoric stress.")
+  .def("theta",&XC::stresstensor::theta,"Return the Lode angle.")
+  .def("q_deviatoric",&XC::stresstensor::q_deviatoric,"Return the deviatoric stress q.")
+  .def("dqoverds",&XC::stresstensor::dqoverds,"Return the derivative of q with respect to the stress.")
+  .def("dthetaoverds",&XC::stresstensor::dthetaoverds,"Return the derivative of the Lode angle with respect to the stress.")
+  .def("d2qoverds2",&XC::stresstensor::d2qoverds2,"Return the second derivative of q with respect to the stress.")
+  .def("d2thetaoverds2",&XC::stresstensor::d2thetaoverds2,"Return the second derivative of the Lode angle with respect to the stress.")
+  ;
 
+// Fixed size tensors (3D).
+typedef XC::Tensor2<3> Tensor2_3d;
+typedef XC::Tensor4<3> Tensor4_3d;
+typedef XC::FixedTensorExpr<Tensor2_3d,9> Tensor2_3d_expr;
+typedef XC::FixedTensorExpr<Tensor4_3d,81> Tensor4_3d_expr;
+Tensor2_3d (*dotTensor2_3d)(const Tensor2_3d &,const Tensor2_3d &)= &XC::dot<3>;
+Tensor4_3d (*dyadTensor2_3d)(const Tensor2_3d &,const Tensor2_3d &)= &XC::dyad<3>;
+Tensor2_3d (*ddotTensor4_2_3d)(const Tensor4_3d &,const Tensor2_3d_expr &)= &XC::ddot<3,Tensor2_3d>;
+Tensor2_3d (*ddotTensor2_4_3d)(const Tensor2_3d_expr &,const Tensor4_3d &)= &XC::ddot<3,Tensor2_3d>;
+Tensor4_3d (*ddotTensor4_4_3d)(const Tensor4_3d &,const Tensor4_3d &)= &XC::ddot<3>;
+class_<Tensor2_3d_expr>("Tensor2_3d_expr", no_init);
+class_<XC::FixedTensorStorage<Tensor2_3d,9>, bases<Tensor2_3d_expr> >("Tensor2_3d_storage", no_init)
+  .def("Norm",&XC::FixedTensorStorage<Tensor2_3d,9>::Norm,"Return the Frobenius norm.")
+  ;
+class_<Tensor2_3d, bases<XC::FixedTensorStorage<Tensor2_3d,9> > >("Tensor2_3d", "Second order 3D tensor (fixed size).", init<double>())
+  .def(init<const XC::Vector &>())
+  .def(init<const XC::nDarray &>())
+  .def("getVector",&Tensor2_3d::getVector,"Return the components (stored by rows).")
+  .def("getBJtensor",&Tensor2_3d::getBJtensor,"Return the tensor as a BJtensor.")
+  .def("trace",&Tensor2_3d::trace,"Return the trace of the tensor.")
+  .def("transpose",&Tensor2_3d::transpose,"Return the transposed tensor.")
+  .def("deviator",&Tensor2_3d::deviator,"Return the deviatoric part of the tensor.")
+  .def("J2",&Tensor2_3d::J2,"Return the second invariant of the deviatoric part.")
+  .def("identity",&Tensor2_3d::identity,"Return the identity tensor.").staticmethod("identity")
+  .def("dot",dotTensor2_3d,"a.dot(b): return a_ik b_kj.")
+  .def("dyad",dyadTensor2_3d,"a.dyad(b): return a_ij b_kl.")
+  .def("ddot",ddotTensor2_4_3d,"e.ddot(C): return e_ij C_ijkl.")
+  ;
+class_<Tensor4_3d_expr>("Tensor4_3d_expr", no_init);
+class_<XC::FixedTensorStorage<Tensor4_3d,81>, bases<Tensor4_3d_expr> >("Tensor4_3d_storage", no_init)
+  .def("Norm",&XC::FixedTensorStorage<Tensor4_3d,81>::Norm,"Return the Frobenius norm.")
+  ;
+class_<Tensor4_3d, bases<XC::FixedTensorStorage<Tensor4_3d,81> > >("Tensor4_3d", "Fourth order 3D tensor (fixed size).", init<double>())
+  .def(init<const XC::Vector &>())
+  .def(init<const XC::nDarray &>())
+  .def("getVector",&Tensor4_3d::getVector,"Return the components (stored by rows).")
+  .def("getBJtensor",&Tensor4_3d::getBJtensor,"Return the tensor as a BJtensor.")
+  .def("I_ijkl",&Tensor4_3d::I_ijkl,"Return the isotropic tensor delta_ij delta_kl.").staticmethod("I_ijkl")
+  .def("I_ikjl",&Tensor4_3d::I_ikjl,"Return the isotropic tensor delta_ik delta_jl.").staticmethod("I_ikjl")
+  .def("I_iljk",&Tensor4_3d::I_iljk,"Return the isotropic tensor delta_il delta_jk.").staticmethod("I_iljk")
+  .def("isotropic",&Tensor4_3d::isotropic,"isotropic(a,b): return the tensor a*delta_ij*delta_kl + b*(delta_ik*delta_jl+delta_il*delta_jk)/2.").staticmethod("isotropic")
+  .def("ddot",ddotTensor4_2_3d,"C.ddot(e): return C_ijkl e_kl.")
+  .def("ddot",ddotTensor4_4_3d,"A.ddot(B): return A_ijmn B_mnkl.")
+  ;
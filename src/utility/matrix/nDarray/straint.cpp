@@ -57,6 +57,7 @@
 #define STRAINTENSOR_CC
 
 #include "straint.h"
+#include "FixedTensor.h"
 
 //! @brief Constructor.
 XC::straintensor::straintensor(int rank_of_tensor, double initval)
@@ -144,8 +145,8 @@ XC::straintensor XC::straintensor::operator=( const straintensor & rval)
 // nema potrebe za brojem clanova koji se brisu## see ELLIS & STROUSTRUP $18.3
 //                                                and note on the p.65($5.3.4)
 //        delete  pc_nDarray_rep->pd_nDdata;
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
 // ovo ne smem da brisem jer nije dinamicki alocirano
 //        delete pc_tensor_rep->indices;
         delete pc_nDarray_rep;
@@ -186,8 +187,8 @@ XC::straintensor XC::straintensor::operator=( const XC::BJtensor & rval)
 // nema potrebe za brojem clanova koji se brisu## see ELLIS & STROUSTRUP $18.3
 //                                                and note on the p.65($5.3.4)
 //        delete  pc_nDarray_rep->pd_nDdata;
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
 // ovo ne smem da brisem jer nije dinamicki alocirano
 //        delete pc_tensor_rep->indices;
         delete pc_nDarray_rep;
@@ -219,8 +220,8 @@ XC::straintensor XC::straintensor::operator=( const XC::nDarray & rval)
 
     if( reference_count(-1) == 0)  // if nobody else is referencing us.
       {
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
         delete pc_nDarray_rep;
       }
 
@@ -414,10 +415,11 @@ XC::straintensor XC::straintensor::principal() const
 //##############################################################################
 XC::straintensor XC::straintensor::deviator() const
   {
-    BJtensor I2("I", 2, def_dim_2);
-    straintensor st_vol = I2 * (trace()*(1./3.));
-    straintensor st_dev = (*this) - st_vol;
-    return st_dev;
+    Tensor2<3> st_dev(*this);
+    const double st_vol= st_dev.trace()*(1./3.);
+    for(int i= 0;i<3;i++)
+      st_dev(i,i)-= st_vol;
+    return straintensor(st_dev.getComponents());
   }
 
 
@@ -107,9 +107,24 @@
 #define STRESSTENSOR_CPP
 
 #include "stresst.h"
+#include "FixedTensor.h"
 
 #include <iomanip>
 
+namespace
+  {
+    //! @brief Return the deviatoric part of the stress tensor
+    //! (computed on the stack).
+    XC::Tensor2<3> stress_deviator(const XC::stresstensor &st)
+      {
+        XC::Tensor2<3> retval(st);
+        const double p= retval.trace()*(0.333333333);
+        for(int i= 0;i<3;i++)
+          retval(i,i)-= p;
+        return retval;
+      }
+  }
+
 // just send appropriate arguments to the base constructor
 //##############################################################################
 XC::stresstensor::stresstensor (int rank_of_tensor, double initval):
@@ -183,8 +198,8 @@ XC::stresstensor XC::stresstensor::operator=( const stresstensor & rval)
     if( reference_count(-1) == 0)  // if nobody else is referencing us.
       {
 // DEallocate memory of the actual XC::BJtensor
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
         delete pc_nDarray_rep;
       }
  // connect to new value
@@ -221,8 +236,8 @@ XC::stresstensor XC::stresstensor::operator=( const XC::BJtensor & rval)
 // nema potrebe za brojem clanova koji se brisu## see ELLIS & STROUSTRUP $18.3
 //                                                and note on the p.65($5.3.4)
 //        delete  pc_nDarray_rep->pd_nDdata;
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
 // ovo ne smem da brisem jer nije dinamicki alocirano
 //        delete pc_tensor_rep->indices;
         delete pc_nDarray_rep;
@@ -255,8 +270,8 @@ XC::stresstensor XC::stresstensor::operator=( const XC::nDarray & rval)
 
     if( reference_count(-1) == 0)  // if nobody else is referencing us.
       {
-        delete [] data();
-        delete [] dim();
+        pc_nDarray_rep->free_data();
+        pc_nDarray_rep->free_dim();
         delete pc_nDarray_rep;
       }
 
@@ -437,11 +452,8 @@ XC::stresstensor XC::stresstensor::principal()  const
 //##############################################################################
 XC::stresstensor XC::stresstensor::deviator() const
   {
-    BJtensor I2("I", 2, def_dim_2); // Kronecker delta  \delta_{ij}
-    stresstensor st_vol = I2 * (this->trace()*(0.333333333));
-    stresstensor st_dev = (*this) - st_vol;
-
-    return st_dev;
+    Tensor2<3> s= stress_deviator(*this);
+    return stresstensor(s.getComponents());
   }
 
 
@@ -603,78 +615,37 @@ double XC::stresstensor::thetaPI()  const
 //#############################################################################
 XC::BJtensor XC::stresstensor::dpoverds( void ) const
   {
-    BJtensor ret(2, def_dim_2, 0.0);
-    BJtensor I2("I", 2, def_dim_2);
-    ret = I2*(-1.0/3.0);
-    ret.null_indices();
-    return ret;
+    const Tensor2<3> ret= Tensor2<3>::identity()*(-1.0/3.0);
+    return ret.getBJtensor();
   }
 
 //#############################################################################
 XC::BJtensor XC::stresstensor::dqoverds( void ) const
   {
-    
-//    stresstensor stress = EPS->getStress();
-    
-    BJtensor ret(2, def_dim_2, 0.0);
-    double q = this->q_deviatoric();
-    stresstensor s( 0.0);
-//...    double J2D = stress.Jinvariant2();
-//...    double temp1 = sqrt(J2D);
-//...    double temp2 = sqrt(3.0)/(2.0*temp1);
-    double temp2 = (3.0/2.0)*(1/q);
-    s = this->deviator();
-    ret = s*temp2;
-    ret.null_indices();
-    return ret;
+    const double q = this->q_deviatoric();
+    const double temp2 = (3.0/2.0)*(1/q);
+    const Tensor2<3> ret= stress_deviator(*this)*temp2;
+    return ret.getBJtensor();
   }
 
 //#############################################################################
 XC::BJtensor XC::stresstensor::dthetaoverds( void ) const
   {
-//    stresstensor stress = EPS->getStress();
+    const double J2D   = this->Jinvariant2();
+    const double q     = this->q_deviatoric();
+    const double theta = this->theta();
 
-    BJtensor ret(2, def_dim_2, 0.0);
-    stresstensor s( 0.0);
-    stresstensor t( 0.0);
-    BJtensor I2("I", 2, def_dim_2);
+    const double c3t = cos(3.0*theta);
+    const double s3t = sin(3.0*theta);
 
-//    double EPS = pow(d_macheps(),(1./3.));
-    double J2D   = this->Jinvariant2();
-    double q     = this->q_deviatoric();
-    double theta = this->theta();
-
-//out    while ( theta >= 2.0*PI )
-//out      theta = theta - 2.0*PI; // if bigger than full cycle
-//out    while ( theta >= 4.0*PI/3.0 )
-//out      theta = theta - 4.0*PI/3.0; // if bigger than four thirds of half cycle
-//out    while ( theta >= 2.0*PI/3.0 )
-//out      theta = theta - 2.0*PI/3.0; // if bigger than two third of half cycle
-//out    while ( theta >= PI/3.0 )
-//out      theta = 2.0*PI/3.0 - theta; // if bigger than one third of half cycle
-//out
-//out    if ( theta < 0.0001 )
-//out      {
-//out        ::printf("theta = %.10e in XC::CAMPotentialSurface::dthetaoverds(stress)\n",
-//out                           theta);
-//out//>><<>><<>><<        return ret;
-//out      }
-
-    double c3t = cos(3.0*theta);
-    double s3t = sin(3.0*theta);
-
-    double tempS = (3.0/2.0)*(c3t/(q*q*s3t));
-    double tempT = (9.0/2.0)*(1.0/(q*q*q*s3t));
-
-    s = this->deviator();
-    t = s("qk")*s("kp") - I2*(J2D*(2.0/3.0));
-
-    s.null_indices();
-    t.null_indices();
-
-    ret = s*tempS - t*tempT;
-    ret.null_indices();
-    return ret;
+    const double tempS = (3.0/2.0)*(c3t/(q*q*s3t));
+    const double tempT = (9.0/2.0)*(1.0/(q*q*q*s3t));
+
+    const Tensor2<3> s= stress_deviator(*this);
+    const Tensor2<3> t= dot(s,s) - Tensor2<3>::identity()*(J2D*(2.0/3.0));
+
+    const Tensor2<3> ret= s*tempS - t*tempT;
+    return ret.getBJtensor();
   }
 
 //#############################################################################
@@ -695,202 +666,73 @@ XC::BJtensor XC::stresstensor::d2poverds2( void ) const
 //#############################################################################
 XC::BJtensor XC::stresstensor::d2qoverds2( void ) const
   {
-//    stresstensor stress = EPS->getStress();
-
-
-    //first the return XC::BJtensor in order not to fragment the memory
-    BJtensor ret( 4, def_dim_4, 0.0); //  second derivative of q over
-                                    //  d sigma_pq  d sigma_mn
-    //setting up some constants
-
-    BJtensor I2("I", 2, def_dim_2);      // To check out this three fourth-order
-    BJtensor I_pqmn("I", 4, def_dim_4);  // isotropic XC::BJtensor please see
-    I_pqmn = I2("pq")*I2("mn");        // W.Michael Lai, David Rubin,
-    I_pqmn.null_indices();
-    BJtensor I_pmqn("I", 4, def_dim_4);  // Erhard Krempl
-    I_pmqn = I_pqmn.transpose0110();   // " Introduction to Continuum Mechanics"
-                                       // QA808.2  ;   ISBN 0-08-022699-X
-
-    double q_dev   = this->q_deviatoric();
+    const double q_dev   = this->q_deviatoric();
+    const Tensor2<3> s= stress_deviator(*this);
 
-    stresstensor s = this->deviator();
-    s.null_indices();
+    const double tempiso1  = (3.0/2.0)*(1/q_dev);
+    const double tempss    = (9.0/4.0)*(1.0/( q_dev * q_dev * q_dev ));
 
-    BJtensor iso1( 4, def_dim_4, 0.0); //this will be d_pm*d_nq-d_pq*d_nm*(1/3)
-    iso1 = I_pmqn  - I_pqmn*(1.0/3.0);
-
-    double tempiso1  = (3.0/2.0)*(1/q_dev);
-    double tempss    = (9.0/4.0)*(1.0/( q_dev * q_dev * q_dev ));
-
-    ret = iso1*tempiso1 - (s("pq")*s("mn"))*tempss;
-    ret.null_indices();
-    return ret;
+    //  second derivative of q over d sigma_pq  d sigma_mn
+    //  iso1 = d_pm*d_nq-d_pq*d_nm*(1/3) (see W.Michael Lai, David Rubin,
+    //  Erhard Krempl " Introduction to Continuum Mechanics"
+    //  QA808.2  ;   ISBN 0-08-022699-X)
+    const Tensor4<3> ret= (Tensor4<3>::I_ikjl() - Tensor4<3>::I_ijkl()*(1.0/3.0))*tempiso1 - dyad(s,s)*tempss;
+    return ret.getBJtensor();
   }
 
 
 //#############################################################################
 XC::BJtensor XC::stresstensor::d2thetaoverds2( void ) const
   {
-    BJtensor ret( 4, def_dim_4, 0.0);
-
-    BJtensor I2("I", 2, def_dim_2);
-    BJtensor I_pqmn("I", 4, def_dim_4);  // To check out this three fourth-order
-    I_pqmn = I2("pq")*I2("mn");        // isotropic XC::BJtensor please see
-    I_pqmn.null_indices();
-    BJtensor I_pmqn("I", 4, def_dim_4);  // W.Michael Lai, David Rubin,
-    I_pmqn = I_pqmn.transpose0110();   // Erhard Krempl
-//no    BJtensor I_pnqm("I", 4, def_dim_4);  // " Introduction to Continuum Mechanics"
-//no    I_pnqm = I_pqmn.transpose0111();   // QA808.2  ;   ISBN 0-08-022699-X
-
-    double J2D = this->Jinvariant2();
-
-//    double EPS = pow(d_macheps(),(1./3.));
-
-    BJtensor s( 2, def_dim_2, 0.0);
-    BJtensor t( 2, def_dim_2, 0.0);
-    s = this->deviator();
-    t = s("qk")*s("kp") - I2*(J2D*(2.0/3.0));
-//s.print("s"," \n\n XC::BJtensor s \n\n");
-//t.print("t"," \n\n XC::BJtensor t \n\n");
-    s.null_indices();
-    t.null_indices();
-
-    BJtensor p( 4, def_dim_4, 0.0); //this will be d_mp*d_nq - d_pq*d_nm*(1/3)
-    BJtensor w( 4, def_dim_4, 0.0);
-
-    double theta = this->theta();
-//out    while ( theta >= 2.0*PI )
-//out      theta = theta - 2.0*PI; // if bigger than full cycle
-//out    while ( theta >= 4.0*PI/3.0 )
-//out      theta = theta - 4.0*PI/3.0; // if bigger than four thirds of half cycle
-//out    while ( theta >= 2.0*PI/3.0 )
-//out      theta = theta - 2.0*PI/3.0; // if bigger than two third of half cycle
-//out    while ( theta >= PI/3.0 )
-//out      theta = 2.0*PI/3.0 - theta; // if bigger than one third of half cycle
-//out
-//out    if ( theta < 0.0001 )
-//out      {
-//out        ::printf("\n\ntheta = %.10e in XC::CAMPotentialSurface::d2thetaoverds2(stress)\n",
-//out                           theta);
-//out//>><<>><<>><<        return ret;
-//out      }
-//out
-
-    double q_dev = this->q_deviatoric();
+    const double J2D = this->Jinvariant2();
+    const double theta = this->theta();
+    const double q_dev = this->q_deviatoric();
 
   //setting up some constants
-//......    double sqrt3 = sqrt(3.0);
-    double c3t    = cos(3*theta);
-    double s3t    = sin(3*theta);
-    double s3t3   = s3t*s3t*s3t;
-    double q3     = q_dev * q_dev * q_dev;
-    double q4     = q_dev * q_dev * q_dev * q_dev;
-    double q5     = q_dev * q_dev * q_dev * q_dev * q_dev;
-    double q6     = q_dev * q_dev * q_dev * q_dev * q_dev * q_dev;
-
-
-    double tempss = - (9.0/2.0)*(c3t)/(q4*s3t) - (27.0/4.0)*(c3t/(s3t3*q4));
-
-    double tempst = (81.0/4.0)*(1.0)/(s3t3*q5);
-
-    double tempts = (81.0/4.0)*(1.0/(s3t*q5)) + (81.0/4.0)*(c3t*c3t)/(s3t3*q5);
-
-    double temptt = - (243.0/4.0)*(c3t/(s3t3*q6));
-
-    double tempp  = +(3.0/2.0)*(c3t/(s3t*q_dev*q_dev));
-
-    double tempw  = -(9.0/2.0)*(1.0/(s3t*q3));
-
-
-//))))))))
-//))))))))    double tempss = 0.0;
-//))))))))
-//))))))))    double tempst = 0.0;
-//))))))))
-//))))))))    double tempts = 0.0;
-//))))))))
-//))))))))    double temptt = 0.0;
-//))))))))
-//))))))))    double tempp  = 0.0;
-//))))))))
-//))))))))    double tempw  = 0.0;
-//))))))))
-
+    const double c3t    = cos(3*theta);
+    const double s3t    = sin(3*theta);
+    const double s3t3   = s3t*s3t*s3t;
+    const double q3     = q_dev * q_dev * q_dev;
+    const double q4     = q_dev * q_dev * q_dev * q_dev;
+    const double q5     = q_dev * q_dev * q_dev * q_dev * q_dev;
+    const double q6     = q_dev * q_dev * q_dev * q_dev * q_dev * q_dev;
+
+    const double tempss = - (9.0/2.0)*(c3t)/(q4*s3t) - (27.0/4.0)*(c3t/(s3t3*q4));
+    const double tempst = (81.0/4.0)*(1.0)/(s3t3*q5);
+    const double tempts = (81.0/4.0)*(1.0/(s3t*q5)) + (81.0/4.0)*(c3t*c3t)/(s3t3*q5);
+    const double temptt = - (243.0/4.0)*(c3t/(s3t3*q6));
+    const double tempp  = +(3.0/2.0)*(c3t/(s3t*q_dev*q_dev));
+    const double tempw  = -(9.0/2.0)*(1.0/(s3t*q3));
+
+    const Tensor2<3> s= stress_deviator(*this);
+    const Tensor2<3> t= dot(s,s) - Tensor2<3>::identity()*(J2D*(2.0/3.0));
 
 // fourth order tensors in the final equation for second derivative
-// of theta over ( d \sigma_{pq} d \sigma_{mn} )
-// BE CAREFULL order is   PQ MN
-
-    BJtensor s_pq_d_mn( 4, def_dim_4, 0.0);
-    BJtensor s_pn_d_mq( 4, def_dim_4, 0.0);
-//...    BJtensor s_pm_d_nq( 4, def_dim_4, 0.0);
-
-    BJtensor d_pq_s_mn( 4, def_dim_4, 0.0);
-    BJtensor d_pn_s_mq( 4, def_dim_4, 0.0);
-//...    BJtensor d_pm_s_nq( 4, def_dim_4, 0.0);
-
-    p = I_pmqn  - I_pqmn*(1.0/3.0);
-
-// privremena stampa
-//..........................................................................
-//.......p.print("p"," BJtensor p = I_pmqn  - I_pqmn*(1.0/3.0)");
-
-
-    s_pq_d_mn = s("pq")*I2("mn");
-    s_pq_d_mn.null_indices();
-    s_pn_d_mq = s_pq_d_mn.transpose0101();
-//...    s_pm_d_nq = s_pn_d_mq.transpose0110();
-
-    d_pq_s_mn = I2("pq")*s("mn");
-    d_pq_s_mn.null_indices();
-    d_pn_s_mq = d_pq_s_mn.transpose0101();
-//...    d_pm_s_nq = d_pn_s_mq.transpose0110();
-
-//// privremena stampa
-////..........................................................................
-//s_pq_d_mn.print("sd"," BJtensor s_pq_d_mn = s(\"pq\")*I2(\"mn\") ");
-//s_pn_d_mq.print("sd"," BJtensor s_pn_d_mq = s_pq_d_mn.transpose0101()");
-////s_pm_d_nq.print("sd"," BJtensor s_pm_d_nq = s_pn_d_mq.transpose0110()");
-//d_pq_s_mn.print("ds"," BJtensor d_pq_s_mn = I2(\"pq\")*s(\"mn\") ");
-//d_pn_s_mq.print("ds"," BJtensor d_pn_s_mq = d_pq_s_mn.transpose0101()");
-////d_pm_s_nq.print("ds"," BJtensor d_pm_s_nq = d_pn_s_mq.transpose0110()");
-////..........................................................................
-
-    w =  s_pn_d_mq + d_pn_s_mq - s_pq_d_mn*(2.0/3.0) - d_pq_s_mn*(2.0/3.0);
-
-//.....// symmetric w
-//.....    w = ( s_pn_d_mq + s_pm_d_nq ) * 0.5 +
-//.....        ( d_pn_s_mq + d_pm_s_nq ) * 0.5
-//.....        - s_pq_d_mn*(2.0/3.0) - d_pq_s_mn*(2.0/3.0);
-//.....
-
-//// privremena stampa
-////..........................................................................
-//w.print("w","w=s_pn_d_mq+d_pn_s_mq-s_pq_d_mn*(2.0/3.0)-d_pq_s_mn*(2.0/3.0)");
-////..........................................................................
-
-////...// privremena stampa
-////...//..........................................................................
-//BJtensor ss = s("pq")*s("mn");
-//BJtensor st = s("pq")*t("mn");
-//BJtensor ts = t("pq")*s("mn");
-//BJtensor tt = t("pq")*t("mn");
-//ss.print("ss","\n XC::BJtensor ss ");
-//st.print("st","\n XC::BJtensor st ");
-//ts.print("ts","\n XC::BJtensor ts ");
-//tt.print("tt","\n XC::BJtensor tt ");
-////...
-
-// finally
-    ret = (   s("pq")*s("mn") * tempss
-            + s("pq")*t("mn") * tempst
-            + t("pq")*s("mn") * tempts
-            + t("pq")*t("mn") * temptt
-            + p               * tempp
-            + w               * tempw );
-	        
-    ret.null_indices();
-    return ret;
+// of theta over ( d \sigma_{pq} d \sigma_{mn} ) (order is PQ MN):
+//   p = d_pm*d_qn - d_pq*d_mn*(1/3)
+//   w = s_pn*d_mq + d_pn*s_mq - s_pq*d_mn*(2/3) - d_pq*s_mn*(2/3)
+    Tensor4<3> ret;
+    for(int i= 0;i<3;i++)
+      for(int j= 0;j<3;j++)
+        for(int k= 0;k<3;k++)
+          for(int l= 0;l<3;l++)
+            {
+              const double d_ij= (i==j ? 1.0 : 0.0);
+              const double d_kl= (k==l ? 1.0 : 0.0);
+              const double d_ik= (i==k ? 1.0 : 0.0);
+              const double d_jl= (j==l ? 1.0 : 0.0);
+              const double d_kj= (k==j ? 1.0 : 0.0);
+              const double d_il= (i==l ? 1.0 : 0.0);
+              const double p= d_ik*d_jl - d_ij*d_kl*(1.0/3.0);
+              const double w= s(i,l)*d_kj + d_il*s(k,j) - s(i,j)*d_kl*(2.0/3.0) - d_ij*s(k,l)*(2.0/3.0);
+              ret(i,j,k,l)= s(i,j)*s(k,l) * tempss
+                          + s(i,j)*t(k,l) * tempst
+                          + t(i,j)*s(k,l) * tempts
+                          + t(i,j)*t(k,l) * temptt
+                          + p             * tempp
+                          + w             * tempw;
+            }
+    return ret.getBJtensor();
   }
 
 
@@ -21,12 +21,14 @@
 //----------------------------------------------------------------------------
 //python_interface.tcc
 
+boost::python::dict (*idArrayInterface)(const XC::ID &)= &XC::array_interface;
 class_<XC::ID, bases<CommandEntity> >("ID")
   .def(vector_indexing_suite<XC::ID>() )  
   .def(init<boost::python::list>())
   .def(init<std::set<int> >())
   .def(init<std::vector<int> >())
   .def(self_ns::str(self_ns::self))
+  .add_property("__array_interface__",idArrayInterface,"NumPy array interface (numpy.asarray(id) doesn't copy the data).")
   // .def(self + self)
   // .def(self - self)
   // .def(self += self)
@@ -40,6 +42,7 @@ implicitly_convertible<boost::python::list,XC::ID>();
 def("id_to_py_list",XC::xc_id_to_py_list);
 
 double &(XC::Vector::*getItemVector)(const size_t &)= &XC::Vector::at;
+boost::python::dict (*vectorArrayInterface)(const XC::Vector &)= &XC::array_interface;
 class_<XC::Vector, bases<CommandEntity> >("Vector")
   .def(init<boost::python::list>())
   .def("__getitem__",getItemVector, return_value_policy<return_by_value>())
@@ -65,6 +68,7 @@ class_<XC::Vector, bases<CommandEntity> >("Vector")
   .def("putComponents",&XC::Vector::putComponents,"Assigns the specified values to the specified set of vector components")
   .def("addComponents",&XC::Vector::addComponents,"Sums the specified values to the specified set of vector components")
   .def("Normalized",&XC::Vector::Normalized,"Returns normalizxed vector.")
+  .add_property("__array_interface__",vectorArrayInterface,"NumPy array interface (numpy.asarray(v) doesn't copy the data).")
   ;
 
 
@@ -72,6 +76,7 @@ implicitly_convertible<XC::Vector,boost::python::list>();
 implicitly_convertible<boost::python::list,XC::Vector>();
 
 double &(XC::Matrix::*at)(int,int)= &XC::Matrix::operator();
+boost::python::dict (*matrixArrayInterface)(const XC::Matrix &)= &XC::array_interface;
 class_<XC::Matrix, bases<CommandEntity> >("Matrix")
   .def(init<boost::python::list>())
   .def("__call__",at, return_value_policy<return_by_value>())
@@ -98,6 +103,7 @@ class_<XC::Matrix, bases<CommandEntity> >("Matrix")
   .def("OneNorm",&XC::Matrix::OneNorm,"Return the value of the one norm.")
   .def("RCond",&XC::Matrix::RCond,".Return an estimation of the reciprocal of the condition number using the 1-norm.")
   .def("getInverse",&XC::Matrix::getInverse,"Return the inverse of the matrix-")
+  .add_property("__array_interface__",matrixArrayInterface,"NumPy array interface (numpy.asarray(m) doesn't copy the data; the array is in Fortran order).")
    ;
 
 
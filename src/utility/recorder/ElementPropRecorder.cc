@@ -31,12 +31,28 @@
 #include <domain/mesh/node/Node.h>
 #include <domain/mesh/element/Element.h>
 #include "xc_utils/src/kernel/python_utils.h"
+#include "utility/recorder/response/Response.h"
+#include "domain/mesh/element/utils/Information.h"
 
 
 //! @brief Constructor.
 XC::ElementPropRecorder::ElementPropRecorder(Domain *ptr_dom)
   :PropRecorder(RECORDER_TAGS_ElementPropRecorder,ptr_dom) {}
 
+//! @brief Destructor.
+XC::ElementPropRecorder::~ElementPropRecorder(void)
+  { free_responses(); }
+
+//! @brief Deletes the response objects.
+void XC::ElementPropRecorder::free_responses(void)
+  {
+    for(std::vector<std::vector<Response *> >::iterator i= responses.begin();i!=responses.end();i++)
+      for(std::vector<Response *>::iterator j= i->begin();j!=i->end();j++)
+        if(*j)
+          delete *j;
+    responses.clear();
+  }
+
 //! @brief Asigns elements to recorder.
 void XC::ElementPropRecorder::setElements(const ID &iElements)
   {
@@ -45,12 +61,59 @@ void XC::ElementPropRecorder::setElements(const ID &iElements)
       {
         for(int i= 0;i<sz;i++)
           elements.push_back(theDomain->getElement(iElements(i)));
+        actionsReady= false;
       }
     else
       std::cerr << "Error; " << getClassName() << "::" << __FUNCTION__
                 << " element list is empty." << std::endl;
   }
 
+//! @brief Return the number of recorded elements.
+size_t XC::ElementPropRecorder::getNumRecordedObjects(void) const
+  { return elements.size(); }
+
+//! @brief Asks the elements for the response objects needed by the
+//! actions (see Element::setResponse).
+void XC::ElementPropRecorder::setupResponses(void)
+  {
+    free_responses();
+    const size_t nActions= actions.size();
+    const size_t nElements= elements.size();
+    responses.resize(nActions);
+    for(size_t j= 0;j<nActions;j++)
+      {
+        const std::vector<std::string> &args= actions[j].getResponseArgs();
+        std::vector<Response *> &r= responses[j];
+        r.resize(nElements,nullptr);
+        if(!args.empty())
+          for(size_t i= 0;i<nElements;i++)
+            {
+              Element *elem= elements[i];
+              if(elem)
+                {
+                  Information eleInfo(1.0);
+                  r[i]= elem->setResponse(args,eleInfo);
+                  if(!r[i])
+                    std::cerr << getClassName() << "::" << __FUNCTION__
+                              << "; element: " << elem->getTag()
+                              << " has no response: '" << args[0]
+                              << "'." << std::endl;
+                }
+            }
+      }
+  }
+
+//! @brief Return the response of the iElem-th element needed by the
+//! iAction-th action.
+const XC::Vector *XC::ElementPropRecorder::getObjectResponse(const size_t &iElem,const size_t &iAction)
+  {
+    const Vector *retval= nullptr;
+    Response *r= responses[iAction][iElem];
+    if(r && (r->getResponse()>=0))
+      retval= &(r->getInformation().getData());
+    return retval;
+  }
+
 //! @brief Records object properties when commit is achieved.
 int XC::ElementPropRecorder::record(int commitTag, double timeStamp)
   {
@@ -31,9 +31,11 @@
 
 #include <utility/recorder/PropRecorder.h>
 #include <deque>
+#include <vector>
 
 namespace XC {
 class Element;
+class Response;
 
 //! @ingroup Recorder
 //
@@ -44,8 +46,15 @@ class ElementPropRecorder: public PropRecorder
     typedef std::deque<Element *> dq_elements; //!< Pointes to elements.
   private:
     dq_elements elements; //!< Element's wich data will be recorded.
+    std::vector<std::vector<Response *> > responses; //!< Element responses for each action.
+    void free_responses(void);
+  protected:
+    virtual size_t getNumRecordedObjects(void) const;
+    virtual void setupResponses(void);
+    virtual const Vector *getObjectResponse(const size_t &,const size_t &);
   public:
     ElementPropRecorder(Domain *ptr_dom= nullptr);
+    ~ElementPropRecorder(void);
 
     void setElements(const ID &);
 
@@ -45,6 +45,7 @@ void XC::NodePropRecorder::setNodes(const ID &iNodes)
       {
         for(int i= 0;i<sz;i++)
           nodes.push_back(theDomain->getNode(iNodes(i)));
+        actionsReady= false;
       }
     else
       std::cerr << "Error; " << getClassName() << "::" << __FUNCTION__
@@ -52,6 +53,64 @@ void XC::NodePropRecorder::setNodes(const ID &iNodes)
   }
 
 
+//! @brief Return the number of recorded nodes.
+size_t XC::NodePropRecorder::getNumRecordedObjects(void) const
+  { return nodes.size(); }
+
+//! @brief Translates the response names of the actions
+//! ("disp", "vel", "accel" or "reaction") into identifiers.
+void XC::NodePropRecorder::setupResponses(void)
+  {
+    const size_t nActions= actions.size();
+    responseCodes.resize(nActions);
+    for(size_t j= 0;j<nActions;j++)
+      {
+        const std::vector<std::string> &args= actions[j].getResponseArgs();
+        const std::string name= (args.empty() ? "" : args[0]);
+        int code= -1;
+        if((name=="disp") || (name=="displacement"))
+          code= 0;
+        else if((name=="vel") || (name=="velocity"))
+          code= 1;
+        else if((name=="accel") || (name=="acceleration"))
+          code= 2;
+        else if(name=="reaction")
+          code= 3;
+        else
+          std::cerr << getClassName() << "::" << __FUNCTION__
+                    << "; unknown node response: '" << name
+                    << "'." << std::endl;
+        responseCodes[j]= code;
+      }
+  }
+
+//! @brief Return the response of the iNode-th node needed by the
+//! iAction-th action.
+const XC::Vector *XC::NodePropRecorder::getObjectResponse(const size_t &iNode,const size_t &iAction)
+  {
+    const Vector *retval= nullptr;
+    const Node *n= nodes[iNode];
+    if(n)
+      switch(responseCodes[iAction])
+        {
+        case 0:
+          retval= &n->getDisp();
+          break;
+        case 1:
+          retval= &n->getVel();
+          break;
+        case 2:
+          retval= &n->getAccel();
+          break;
+        case 3:
+          retval= &n->getReaction();
+          break;
+        default:
+          break;
+        }
+    return retval;
+  }
+
 //! @brief Records object properties when commit is triggered.
 int XC::NodePropRecorder::record(int commitTag, double timeStamp)
   {
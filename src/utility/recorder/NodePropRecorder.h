@@ -31,6 +31,7 @@
 
 #include <utility/recorder/PropRecorder.h>
 #include <deque>
+#include <vector>
 
 namespace XC {
 class Node;
@@ -43,6 +44,11 @@ class NodePropRecorder: public PropRecorder
     typedef std::deque<Node *> dq_nodes; //!< Pointer to nodes.
   private:
     dq_nodes nodes; //!< Nodes which properties are recorded.
+    std::vector<int> responseCodes; //!< Response identifiers for each action.
+  protected:
+    virtual size_t getNumRecordedObjects(void) const;
+    virtual void setupResponses(void);
+    virtual const Vector *getObjectResponse(const size_t &,const size_t &);
   public:
     NodePropRecorder(Domain *ptr_dom= nullptr);
 
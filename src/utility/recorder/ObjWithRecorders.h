@@ -78,6 +78,9 @@ class ObjWithRecorders: public CommandEntity
     virtual int removeRecorders(void);
     void setLinks(Domain *dom);
     void SetOutputHandlers(DataOutputHandler::map_output_handlers *oh);
+    //! @brief Return the output handlers.
+    inline DataOutputHandler::map_output_handlers *getOutputHandlers(void) const
+      { return output_handlers; }
   };
 } // end of XC namespace
 
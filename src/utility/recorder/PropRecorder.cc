@@ -31,11 +31,12 @@
 
 
 #include "xc_basic/src/text/text_string.h"
+#include "utility/matrix/Vector.h"
 
 //! @brief Constructor.
 XC::PropRecorder::PropRecorder(int classTag,Domain *ptr_dom)
   : DomainRecorderBase(classTag,ptr_dom), CallbackRecord(), CallbackRestart(),
-  lastCommitTag(-1),lastTimeStamp(-1.0) {}
+    actionsReady(false), lastCommitTag(-1),lastTimeStamp(-1.0) {}
 
 double XC::PropRecorder::getCurrentTime(void) const
   { return theDomain->getTimeTracker().getCurrentTime(); }
@@ -53,27 +54,197 @@ std::string XC::PropRecorder::getCurrentCombinationName(void) const
     return retval;
   }
 
+//! @brief Compiles the Python code being passed as parameter and
+//! returns the resulting code object (None if the string is empty
+//! or the compilation fails).
+boost::python::object XC::PropRecorder::compile_callback(const std::string &code,const std::string &name)
+  {
+    boost::python::object retval;
+    if(!code.empty())
+      {
+        try
+          {
+            boost::python::object builtins= boost::python::import("__main__").attr("__builtins__");
+            retval= builtins.attr("compile")(code,name,"exec");
+          }
+        catch(boost::python::error_already_set &)
+          {
+            std::cerr << "PropRecorder::" << __FUNCTION__
+                      << "; can't compile: '" << code << "'." << std::endl;
+            PyErr_Print();
+            retval= boost::python::object();
+          }
+      }
+    return retval;
+  }
+
+//! @brief Executes the compiled code in the main namespace with
+//! the object being passed as parameter as "self".
+void XC::PropRecorder::exec_callback(const boost::python::object &code,const boost::python::object &self)
+  {
+    try
+      {
+        if(pyEval.is_none())
+          {
+            boost::python::object mainModule= boost::python::import("__main__");
+            pyNamespace= mainModule.attr("__dict__");
+            pyEval= mainModule.attr("__builtins__").attr("eval");
+          }
+        pyNamespace["self"]= self;
+        pyEval(code,pyNamespace);
+      }
+    catch(boost::python::error_already_set &)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; error executing callback." << std::endl;
+        PyErr_Print();
+      }
+  }
+
 //! @brief Runs setup callback.
 void XC::PropRecorder::callSetupCallback(const int &commitTag,const double &timeStamp)
   {
     this->lastCommitTag= commitTag;
     this->lastTimeStamp= timeStamp;
-    boost::python::object pyObj(boost::ref(*this));
-    if(!CallbackSetup.empty())
-      CommandEntity_exec(pyObj,CallbackSetup);
+    if(!compiledSetup.is_none())
+      {
+        boost::python::object pyObj(boost::ref(*this));
+        exec_callback(compiledSetup,pyObj);
+      }
   }
 
+//! @brief Return the number of objects whose properties are recorded.
+size_t XC::PropRecorder::getNumRecordedObjects(void) const
+  { return 0; }
+
+//! @brief Prepares the responses needed by the actions (to redefine
+//! in derived classes if needed).
+void XC::PropRecorder::setupResponses(void)
+  {}
+
+//! @brief Return the response of the iObj-th object needed by the
+//! iAction-th action (nullptr if not available).
+const XC::Vector *XC::PropRecorder::getObjectResponse(const size_t &,const size_t &)
+  { return nullptr; }
+
+//! @brief Runs the built-in actions and calls the batch callback.
+void XC::PropRecorder::runActions(void)
+  {
+    const size_t nActions= actions.size();
+    if(nActions>0)
+      {
+        const size_t nObjects= getNumRecordedObjects();
+        if(!actionsReady)
+          {
+            for(size_t j= 0;j<nActions;j++)
+              actions[j].setup(nObjects);
+            setupResponses();
+            actionsReady= true;
+          }
+        if((stepValues.noRows()!=int(nObjects)) || (stepValues.noCols()!=int(nActions)))
+          stepValues.resize(nObjects,nActions);
+        stepValues.Zero();
+        for(size_t j= 0;j<nActions;j++)
+          {
+            PropRecorderAction &action= actions[j];
+            const int k= action.getComponent();
+            for(size_t i= 0;i<nObjects;i++)
+              {
+                const Vector *r= getObjectResponse(i,j);
+                if(r && (k>=0) && (k<r->Size()))
+                  {
+                    const double v= (*r)(k);
+                    action.update(i,v);
+                    stepValues(i,j)= v;
+                  }
+              }
+            action.commitStep();
+          }
+      }
+    if(!callbackBatch.is_none())
+      {
+        try
+          {
+            boost::python::object pyObj(boost::ref(*this));
+            callbackBatch(pyObj,stepValues);
+          }
+        catch(boost::python::error_already_set &)
+          {
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; error executing batch callback." << std::endl;
+            PyErr_Print();
+          }
+      }
+  }
+
+//! @brief Appends a built-in action to the recorder.
+//!
+//! @param actionType: "max", "min", "abs_max", "sum" or "store".
+//! @param responseName: name of the response (i.e. "disp", "reaction"
+//!                      for nodes or the argument of setResponse
+//!                      for elements).
+//! @param component: index of the response component.
+//! @return index of the new action (-1 if the component is not valid).
+int XC::PropRecorder::addAction(const std::string &actionType,const std::string &responseName,const int &component)
+  {
+    if(component<0)
+      {
+        std::cerr << getClassName() << "::" << __FUNCTION__
+                  << "; component index must be non-negative; "
+                  << component << " received." << std::endl;
+        return -1;
+      }
+    actions.push_back(PropRecorderAction(PropRecorderAction::getActionType(actionType),responseName,component));
+    actionsReady= false;
+    return actions.size()-1;
+  }
+
+//! @brief Removes all the built-in actions.
+void XC::PropRecorder::clearActions(void)
+  {
+    actions.clear();
+    actionsReady= false;
+    setupResponses();
+  }
+
+//! @brief Return the i-th action.
+const XC::PropRecorderAction &XC::PropRecorder::getAction(const size_t &i) const
+  { return actions.at(i); }
+
+//! @brief Return the values of the i-th action (one for each object).
+XC::Vector XC::PropRecorder::getActionValues(const size_t &i) const
+  { return getAction(i).getValues(); }
+
+//! @brief Return the values stored by the i-th action (a row
+//! for each step and a column for each object).
+XC::Matrix XC::PropRecorder::getActionHistory(const size_t &i) const
+  { return getAction(i).getHistory(); }
 
 void XC::PropRecorder::setCallbackRecord(const std::string &str)
-  { CallbackRecord= str; }
+  {
+    CallbackRecord= str;
+    compiledRecord= compile_callback(str,"<callbackRecord>");
+  }
 std::string XC::PropRecorder::getCallbackRecord(void)
   { return CallbackRecord; }
 void XC::PropRecorder::setCallbackSetup(const std::string &str)
-  { CallbackSetup= str; }
+  {
+    CallbackSetup= str;
+    compiledSetup= compile_callback(str,"<callbackSetup>");
+  }
 std::string XC::PropRecorder::getCallbackSetup(void)
   { return CallbackSetup; }
 void XC::PropRecorder::setCallbackRestart(const std::string &str)
-  { CallbackRestart= str; }
+  {
+    CallbackRestart= str;
+    compiledRestart= compile_callback(str,"<callbackRestart>");
+  }
 std::string XC::PropRecorder::getCallbackRestart(void)
   { return CallbackRestart; }
+//! @brief Assigns the callable to call once on each record call
+//! with the recorder and the matrix of step values as arguments.
+void XC::PropRecorder::setCallbackBatch(const boost::python::object &f)
+  { callbackBatch= f; }
+boost::python::object XC::PropRecorder::getCallbackBatch(void)
+  { return callbackBatch; }
 
@@ -30,26 +30,53 @@
 #define PropRecorder_h
 
 #include <utility/recorder/DomainRecorderBase.h>
+#include <utility/recorder/PropRecorderAction.h>
+#include "utility/matrix/Matrix.h"
 #include "xc_utils/src/kernel/python_utils.h"
+#include <deque>
 
 namespace XC {
 
 //! @ingroup Recorder
 //
+//! @brief Recorder that executes code on each of the objects
+//! at each commit.
+//!
+//! The Python callbacks are compiled once (when assigned) and the
+//! code objects are reused on each call. The built-in actions
+//! (envelopes, accumulation, storage) are executed in C++ without
+//! calling the interpreter and the batch callback (if any) receives
+//! the values of the whole step in one call.
 class PropRecorder: public DomainRecorderBase
   {
   protected:
     std::string CallbackSetup; //!< Python script to execute before any record calls.
     std::string CallbackRecord; //!< Python script to execute on each record call.
     std::string CallbackRestart; //!< Python script to execute on each restart call.
+    boost::python::object compiledSetup; //!< Compiled CallbackSetup.
+    boost::python::object compiledRecord; //!< Compiled CallbackRecord.
+    boost::python::object compiledRestart; //!< Compiled CallbackRestart.
+    boost::python::object callbackBatch; //!< Python callable to call once on each record call.
+    boost::python::object pyNamespace; //!< Namespace for the execution of the callbacks.
+    boost::python::object pyEval; //!< Python eval built-in function.
+    std::deque<PropRecorderAction> actions; //!< Built-in actions.
+    Matrix stepValues; //!< Values of the last step (a row for each object, a column for each action).
+    bool actionsReady; //!< True if the actions are ready to run.
     int lastCommitTag; //!< CommitTag of the last record call.
     double lastTimeStamp; //!< TimeStamp of the last record call.
 
+    static boost::python::object compile_callback(const std::string &,const std::string &);
+    void exec_callback(const boost::python::object &,const boost::python::object &);
     void callSetupCallback(const int &,const double &);
     template <class Container>
     void callRecordCallback(Container &c,const int &,const double &);
     template <class Container>
     void callRestartCallback(Container &c);
+
+    virtual size_t getNumRecordedObjects(void) const;
+    virtual void setupResponses(void);
+    virtual const Vector *getObjectResponse(const size_t &,const size_t &);
+    void runActions(void);
   public:
     PropRecorder(int classTag, Domain *ptr_dom= nullptr);
 
@@ -69,7 +96,18 @@ class PropRecorder: public DomainRecorderBase
     std::string getCallbackRecord(void);
     void setCallbackRestart(const std::string &);
     std::string getCallbackRestart(void);
+    void setCallbackBatch(const boost::python::object &);
+    boost::python::object getCallbackBatch(void);
 
+    int addAction(const std::string &,const std::string &,const int &);
+    void clearActions(void);
+    inline size_t getNumActions(void) const
+      { return actions.size(); }
+    const PropRecorderAction &getAction(const size_t &) const;
+    Vector getActionValues(const size_t &) const;
+    Matrix getActionHistory(const size_t &) const;
+    inline const Matrix &getStepValues(void) const
+      { return stepValues; }
   };
 
 //! @brief Calls record callback on each container element.
@@ -77,36 +115,41 @@ template <class Container>
 void XC::PropRecorder::callRecordCallback(Container &c,const int &commitTag,const double &timeStamp)
   {
     this->callSetupCallback(commitTag,timeStamp);
-    for(typename Container::iterator i= c.begin();i!=c.end();i++)
-      {
-	typename Container::value_type tmp= *i;
-        if(tmp)
-          {
-            boost::python::object pyObj(boost::ref(*tmp));
-            CommandEntity_exec(pyObj,CallbackRecord);
-          }
-        else
-	  std::cerr << getClassName() << "::" << __FUNCTION__
-	            << "; pointer is null." << std::endl;
-      }
+    if(!compiledRecord.is_none())
+      for(typename Container::iterator i= c.begin();i!=c.end();i++)
+        {
+          typename Container::value_type tmp= *i;
+          if(tmp)
+            {
+              boost::python::object pyObj(boost::ref(*tmp));
+              exec_callback(compiledRecord,pyObj);
+            }
+          else
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; pointer is null." << std::endl;
+        }
+    this->runActions();
   }
 
 //! @brief Calls restart callback on each container element.
 template <class Container>
 void PropRecorder::callRestartCallback(Container &c)
   {
-    for(typename Container::iterator i= c.begin();i!=c.end();i++)
-      {
-	typename Container::value_type tmp= *i;
-        if(tmp)
-          {
-            boost::python::object pyObj(boost::ref(*tmp));
-            CommandEntity_exec(pyObj,this->CallbackRestart);
-          }
-        else
-	  std::cerr << getClassName() << "::" << __FUNCTION__
-	            << "; pointer is null." << std::endl;
-      }
+    if(!compiledRestart.is_none())
+      for(typename Container::iterator i= c.begin();i!=c.end();i++)
+        {
+          typename Container::value_type tmp= *i;
+          if(tmp)
+            {
+              boost::python::object pyObj(boost::ref(*tmp));
+              exec_callback(compiledRestart,pyObj);
+            }
+          else
+            std::cerr << getClassName() << "::" << __FUNCTION__
+                      << "; pointer is null." << std::endl;
+        }
+    for(std::deque<PropRecorderAction>::iterator i= actions.begin();i!=actions.end();i++)
+      i->reset();
   }
  
 } // end of XC namespace
@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PropRecorderAction.cc
+
+#include "utility/recorder/PropRecorderAction.h"
+#include "utility/matrix/Vector.h"
+#include "utility/matrix/Matrix.h"
+#include <boost/algorithm/string.hpp>
+#include <iostream>
+#include <limits>
+#include <cmath>
+#include <algorithm>
+
+//! @brief Constructor.
+//!
+//! @param tp: type of the action.
+//! @param responseName: name (and arguments separated by blanks)
+//!                      of the response to record.
+//! @param comp: index of the response component.
+XC::PropRecorderAction::PropRecorderAction(const ActionType &tp, const std::string &responseName, const int &comp)
+  : actionType(tp), responseArgs(), component(comp), values(), history(), numSteps(0)
+  {
+    const std::string tmp= boost::algorithm::trim_copy(responseName);
+    boost::algorithm::split(responseArgs,tmp,boost::algorithm::is_space(),boost::algorithm::token_compress_on);
+  }
+
+//! @brief Return the action type from its name ("max", "min", "abs_max",
+//! "sum" or "store").
+XC::PropRecorderAction::ActionType XC::PropRecorderAction::getActionType(const std::string &str)
+  {
+    ActionType retval= MAX;
+    if(str=="max")
+      retval= MAX;
+    else if(str=="min")
+      retval= MIN;
+    else if((str=="abs_max") || (str=="absMax"))
+      retval= ABS_MAX;
+    else if((str=="sum") || (str=="accumulate"))
+      retval= SUM;
+    else if(str=="store")
+      retval= STORE;
+    else
+      std::cerr << "PropRecorderAction::" << __FUNCTION__
+                << "; unknown action: '" << str
+                << "' using 'max'." << std::endl;
+    return retval;
+  }
+
+//! @brief Prepares the action for the number of objects being passed
+//! as parameter (the values computed so far are discarded).
+void XC::PropRecorderAction::setup(const size_t &numObjects)
+  {
+    values.resize(numObjects);
+    reset();
+  }
+
+//! @brief Initializes the values.
+void XC::PropRecorderAction::reset(void)
+  {
+    double v0= 0.0;
+    if(actionType==MAX)
+      v0= -std::numeric_limits<double>::max();
+    else if(actionType==MIN)
+      v0= std::numeric_limits<double>::max();
+    std::fill(values.begin(),values.end(),v0);
+    history.clear();
+    numSteps= 0;
+  }
+
+//! @brief Updates the value that corresponds to the i-th object.
+void XC::PropRecorderAction::update(const size_t &i, const double &v)
+  {
+    double &value= values[i];
+    switch(actionType)
+      {
+      case MAX:
+        value= std::max(value,v);
+        break;
+      case MIN:
+        value= std::min(value,v);
+        break;
+      case ABS_MAX:
+        value= std::max(value,std::abs(v));
+        break;
+      case SUM:
+        value+= v;
+        break;
+      case STORE:
+        value= v;
+        break;
+      }
+  }
+
+//! @brief Ends the current step (stores the values if needed).
+void XC::PropRecorderAction::commitStep(void)
+  {
+    if(actionType==STORE)
+      history.insert(history.end(),values.begin(),values.end());
+    numSteps++;
+  }
+
+//! @brief Return the values (one for each object).
+XC::Vector XC::PropRecorderAction::getValues(void) const
+  {
+    const size_t sz= values.size();
+    Vector retval(sz);
+    for(size_t i= 0;i<sz;i++)
+      retval(i)= values[i];
+    return retval;
+  }
+
+//! @brief Return the stored values (a row for each step and a column
+//! for each object).
+XC::Matrix XC::PropRecorderAction::getHistory(void) const
+  {
+    const size_t nCols= values.size();
+    const size_t nRows= (nCols>0 ? history.size()/nCols : 0);
+    Matrix retval(nRows,nCols);
+    std::vector<double>::const_iterator k= history.begin();
+    for(size_t i= 0;i<nRows;i++)
+      for(size_t j= 0;j<nCols;j++,k++)
+        retval(i,j)= *k;
+    return retval;
+  }
@@ -0,0 +1,84 @@
+//----------------------------------------------------------------------------
+//  XC program; finite element analysis code
+//  for structural analysis and design.
+//
+//  Copyright (C)  Luis Claudio Pérez Tato
+//
+//  This program derives from OpenSees <http://opensees.berkeley.edu>
+//  developed by the  «Pacific earthquake engineering research center».
+//
+//  Except for the restrictions that may arise from the copyright
+//  of the original program (see copyright_opensees.txt)
+//  XC is free software: you can redistribute it and/or modify
+//  it under the terms of the GNU General Public License as published by
+//  the Free Software Foundation, either version 3 of the License, or 
+//  (at your option) any later version.
+//
+//  This software is distributed in the hope that it will be useful, but 
+//  WITHOUT ANY WARRANTY; without even the implied warranty of
+//  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+//  GNU General Public License for more details. 
+//
+//
+// You should have received a copy of the GNU General Public License 
+// along with this program.
+// If not, see <http://www.gnu.org/licenses/>.
+//----------------------------------------------------------------------------
+//PropRecorderAction.h
+                                                                        
+#ifndef PropRecorderAction_h
+#define PropRecorderAction_h
+
+#include <string>
+#include <vector>
+
+namespace XC {
+class Vector;
+class Matrix;
+
+//! @ingroup Recorder
+//
+//! @brief Built-in (compiled) action of a property recorder.
+//!
+//! Each action extracts one component of a named response (i.e.
+//! "disp", "reaction", "axialForce",...) from each recorded object
+//! and updates its values: envelopes (maximum, minimum, maximum
+//! absolute value), accumulation or storage of the whole history.
+class PropRecorderAction
+  {
+  public:
+    enum ActionType {MAX, MIN, ABS_MAX, SUM, STORE};
+  private:
+    ActionType actionType; //!< type of the action.
+    std::vector<std::string> responseArgs; //!< response name and arguments.
+    int component; //!< index of the response component.
+    std::vector<double> values; //!< one value for each object.
+    std::vector<double> history; //!< stored values (step by step).
+    size_t numSteps; //!< number of recorded steps.
+  public:
+    PropRecorderAction(const ActionType &, const std::string &, const int &);
+    static ActionType getActionType(const std::string &);
+
+    inline const ActionType &getType(void) const
+      { return actionType; }
+    inline const std::vector<std::string> &getResponseArgs(void) const
+      { return responseArgs; }
+    inline const int &getComponent(void) const
+      { return component; }
+    inline size_t getNumObjects(void) const
+      { return values.size(); }
+    inline size_t getNumSteps(void) const
+      { return numSteps; }
+
+    void setup(const size_t &);
+    void update(const size_t &, const double &);
+    void commitStep(void);
+    void reset(void);
+
+    Vector getValues(void) const;
+    Matrix getHistory(void) const;
+  };
+
+} // end of XC namespace
+
+#endif
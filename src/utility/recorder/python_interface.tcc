@@ -34,10 +34,25 @@ class_<XC::DomainRecorderBase, bases<XC::Recorder>, boost::noncopyable >("Domain
 
 //class_<XC::FilePlotter , bases<XC::Recorder>, boost::noncopyable >("FilePlotter", no_init);
 
+class_<XC::PropRecorderAction>("PropRecorderAction", no_init)
+  .add_property("component", make_function(&XC::PropRecorderAction::getComponent, return_value_policy<copy_const_reference>()),"Index of the response component.")
+  .add_property("numSteps", &XC::PropRecorderAction::getNumSteps,"Number of recorded steps.")
+  .def("getValues", &XC::PropRecorderAction::getValues,"Return the values of the action (one for each object).")
+  .def("getHistory", &XC::PropRecorderAction::getHistory,"Return the stored values (a row for each step and a column for each object).")
+  ;
+
 class_<XC::PropRecorder, bases<XC::Recorder>, boost::noncopyable >("PropRecorder", no_init)
   .add_property("callbackSetup",&XC::PropRecorder::getCallbackSetup,&XC::PropRecorder::setCallbackSetup,"Assigns code to execute to setup recording.")
   .add_property("callbackRecord",&XC::PropRecorder::getCallbackRecord,&XC::PropRecorder::setCallbackRecord,"Assigns code to execute while recording.")
   .add_property("callbackRestart",&XC::PropRecorder::getCallbackRestart,&XC::PropRecorder::setCallbackRestart,"Assigns code to execute while restartingg.")
+  .add_property("callbackBatch",&XC::PropRecorder::getCallbackBatch,&XC::PropRecorder::setCallbackBatch,"Assigns a callable f(recorder, stepValues) to call once on each record call.")
+  .def("addAction",&XC::PropRecorder::addAction,"addAction(actionType, responseName, component) appends a built-in action (actionType: 'max', 'min', 'abs_max', 'sum' or 'store'); returns the action index.")
+  .def("clearActions",&XC::PropRecorder::clearActions,"Removes all the built-in actions.")
+  .add_property("numActions",&XC::PropRecorder::getNumActions,"Number of built-in actions.")
+  .def("getAction",&XC::PropRecorder::getAction,return_internal_reference<>(),"Return the i-th built-in action.")
+  .def("getActionValues",&XC::PropRecorder::getActionValues,"getActionValues(i): return the values of the i-th action (one for each object).")
+  .def("getActionHistory",&XC::PropRecorder::getActionHistory,"getActionHistory(i): return the values stored by the i-th action (a row for each step and a column for each object).")
+  .add_property("getStepValues",make_function(&XC::PropRecorder::getStepValues, return_internal_reference<>()),"Return the values of the last step (a row for each object and a column for each action).")
   .add_property("getLastCommitTag",&XC::PropRecorder::getLastCommitTag)
   .add_property("getLastTimeStamp",&XC::PropRecorder::getLastTimeStamp)
   .add_property("getCurrentTime",&XC::PropRecorder::getCurrentTime)
@@ -32,6 +32,8 @@
 #include "utility/matrix/Vector.h"
 #include "utility/matrix/Matrix.h"
 #include "xc_utils/src/kernel/python_utils.h"
+#include <boost/python/tuple.hpp>
+#include <sstream>
 
 
 boost::python::list XC::xc_id_to_py_list(const XC::ID &id)
@@ -117,3 +119,54 @@ m_double XC::m_double_from_py_object(const boost::python::object &o)
       }
     return retval;
   }
+
+namespace {
+//! @brief Return the type string of the NumPy array interface
+//! for the type T (i.e. "<f8" for double in little endian machines).
+template <class T>
+std::string array_typestr(const char &kind)
+  {
+    const int one= 1;
+    const bool little= (*reinterpret_cast<const char *>(&one)==1);
+    std::ostringstream retval;
+    retval << (little ? '<' : '>') << kind << sizeof(T);
+    return retval.str();
+  }
+
+//! @brief Return the NumPy array interface (version 3) for the data
+//! being passed as parameter.
+template <class T>
+boost::python::dict array_interface(const T *data,const char &kind,const boost::python::tuple &shape,const boost::python::tuple &strides)
+  {
+    boost::python::dict retval;
+    retval["version"]= 3;
+    retval["typestr"]= array_typestr<T>(kind);
+    retval["data"]= boost::python::make_tuple(reinterpret_cast<size_t>(data),false);
+    retval["shape"]= shape;
+    retval["strides"]= strides;
+    return retval;
+  }
+} // end of anonymous namespace
+
+//! @brief Return the NumPy array interface of the ID so
+//! numpy.asarray can wrap its data without copying it.
+boost::python::dict XC::array_interface(const ID &id)
+  {
+    return ::array_interface(id.getDataPtr(),'i',boost::python::make_tuple(id.Size()),boost::python::make_tuple(sizeof(int)));
+  }
+
+//! @brief Return the NumPy array interface of the vector so
+//! numpy.asarray can wrap its data without copying it.
+boost::python::dict XC::array_interface(const Vector &v)
+  {
+    return ::array_interface(v.getDataPtr(),'f',boost::python::make_tuple(v.Size()),boost::python::make_tuple(sizeof(double)));
+  }
+
+//! @brief Return the NumPy array interface of the matrix so
+//! numpy.asarray can wrap its data without copying it (the matrix
+//! is stored by columns so the array is in Fortran order).
+boost::python::dict XC::array_interface(const Matrix &m)
+  {
+    const int nRows= m.noRows();
+    return ::array_interface(m.getDataPtr(),'f',boost::python::make_tuple(nRows,m.noCols()),boost::python::make_tuple(sizeof(double),nRows*sizeof(double)));
+  }
@@ -25,11 +25,14 @@
 #define XC_PYTHON_UTILS_H
 
 #include <boost/python/list.hpp>
+#include <boost/python/dict.hpp>
 #include <vector>
 #include "xc_basic/src/matrices/m_double.h"
 
 namespace XC {
   class ID;
+  class Vector;
+  class Matrix;
 
 boost::python::list xc_id_to_py_list(const XC::ID &);
 
@@ -37,5 +40,9 @@ std::vector<double> vector_double_from_py_object(const boost::python::object &);
 std::vector<int> vector_int_from_py_object(const boost::python::object &);
 m_double m_double_from_py_object(const boost::python::object &);
 
+boost::python::dict array_interface(const ID &);
+boost::python::dict array_interface(const Vector &);
+boost::python::dict array_interface(const Matrix &);
+
 } // end of XC namespace
 #endif
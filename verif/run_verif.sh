@@ -33,6 +33,8 @@ python tests/combinations/test_combination03.py
 python tests/combinations/test_combination05.py
 python tests/combinations/test_combination06.py
 python tests/combinations/test_combination07.py
+python tests/combinations/test_combination08.py
+python tests/combinations/test_combination09.py
 python tests/combinations/test_davit_01.py
 python tests/combinations/test_davit_02.py
 
@@ -166,9 +168,21 @@ python tests/elements/test_pot_bearing_02.py
 python tests/elements/test_pot_bearing_03.py
 python tests/elements/kill_elements_01.py
 python tests/elements/kill_elements_02.py
+python tests/elements/kill_elements_03.py
 
 echo "$BLEU" "Solver tests." "$NORMAL"
 python tests/solution/superlu_solver_test_01.py
+python tests/solution/superlu_solver_test_02.py
+python tests/solution/superlu_solver_test_03.py
+python tests/solution/multithreaded_solution_test_01.py
+python tests/solution/multithreaded_solution_test_02.py
+python tests/solution/multithreaded_solution_test_03.py
+python tests/solution/multifrontal_solver_test_01.py
+python tests/solution/contiguous_nodal_state_test_01.py
+python tests/solution/csr_graph_test_01.py
+python tests/solution/partitioned_domain_test_01.py
+python tests/solution/partitioned_domain_test_02.py
+python tests/solution/finite_difference_restart_test_01.py
 
 #Constraint handlers tests.
 echo "$BLEU" "  Constraint handler tests." "$NORMAL"
@@ -197,7 +211,9 @@ python tests/solution/eigenvalues/modal_analysis_test_02.py
 python tests/solution/eigenvalues/modal_analysis_test_03.py
 python tests/solution/eigenvalues/modal_analysis_test_04.py
 python tests/solution/eigenvalues/modal_analysis_test_05.py
+python tests/solution/eigenvalues/modal_analysis_test_06.py
 python tests/solution/eigenvalues/test_cqc_01.py
+python tests/solution/eigenvalues/test_response_spectrum_01.py
 python tests/solution/eigenvalues/test_band_arpackpp_solver_01.py
 
 #Preprocessor tests
@@ -254,6 +270,7 @@ python tests/preprocessor/sets/test_set_01.py
 python tests/preprocessor/sets/une_sets.py
 python tests/preprocessor/sets/sets_boolean_operations_01.py
 python tests/preprocessor/sets/sets_boolean_operations_02.py
+python tests/preprocessor/sets/sets_boolean_operations_03.py
 python tests/preprocessor/sets/test_resisting_svd01.py
 python tests/preprocessor/sets/test_get_contours_01.py
 python tests/preprocessor/sets/test_get_contours_02.py
@@ -427,6 +444,7 @@ python tests/materials/fiber_section/test_fiber_section_11.py
 python tests/materials/fiber_section/test_fiber_section_12.py
 python tests/materials/fiber_section/test_fiber_section_13.py
 python tests/materials/fiber_section/test_tangent_stiffness_01.py
+python tests/materials/fiber_section/test_packed_fibers_01.py
 python tests/materials/fiber_section/test_section_aggregator_01.py
 python tests/materials/fiber_section/test_fiber_section_shear3d_01.py
 python tests/materials/fiber_section/test_fiber_section_shear3d_02.py
@@ -436,6 +454,8 @@ python tests/materials/fiber_section/test_interaction_diagram03.py
 python tests/materials/fiber_section/test_interaction_diagram04.py
 python tests/materials/fiber_section/test_interaction_diagram05.py
 python tests/materials/fiber_section/test_interaction_diagram06.py
+python tests/materials/fiber_section/test_interaction_diagram07.py
+python tests/materials/fiber_section/test_interaction_diagram08.py
 python tests/materials/fiber_section/test_shear_01.py
 python tests/materials/fiber_section/test_shear_02.py
 python tests/materials/fiber_section/plastic_hinge_on_IPE200.py
@@ -514,15 +534,13 @@ python tests/materials/eae/test_weld_bead_strength.py
 
 #Database tests
 echo "$BLEU" "Database tests (MySQL, Berkeley db, sqlite,...)." "$NORMAL"
-# XXX sqlitepp is toooooo slooooow. Seek another solution.
-# python tests/database/test_database_01.py
-# python tests/database/test_database_02.py
-# python tests/database/test_database_03.py
-# python tests/database/test_database_04.py
-# python tests/database/test_database_05.py
-# python tests/database/test_database_06.py
-# python tests/database/test_database_07.py
-# XXX
+python tests/database/test_database_01.py
+python tests/database/test_database_02.py
+python tests/database/test_database_03.py
+python tests/database/test_database_04.py
+python tests/database/test_database_05.py
+python tests/database/test_database_06.py
+python tests/database/test_database_07.py
 python tests/database/test_database_08.py
 python tests/database/test_database_09.py
 python tests/database/test_database_10.py
@@ -531,6 +549,7 @@ python tests/database/test_database_12.py
 python tests/database/test_database_13.py
 python tests/database/test_database_14.py
 python tests/database/test_database_15.py
+python tests/database/test_domain_snapshot_01.py
 python tests/database/sqlite_test_01.py
 python tests/database/sqlite_test_02.py
 python tests/database/sqlite_test_03.py
@@ -538,6 +557,10 @@ python tests/database/readln_test_01.py
 
 echo "$BLEU" "Verifiyng misc. utilities." "$NORMAL"
 python tests/utility/rcond.py
+python tests/utility/recorder/test_prop_recorder_actions_01.py
+python tests/utility/counter_rand_generator_test_01.py
+python tests/utility/sampling_analysis_test_01.py
+python tests/utility/fixed_tensor_test_01.py
 
 echo "$BLEU" "Verifiying routines for rough calculations,..." "$NORMAL"
 python tests/rough_calculations/test_punzo01.py
@@ -559,8 +582,11 @@ python tests/rough_calculations/masonryBridgeVerif_test01_minim.py
 #Postprocess tests
 echo "$BLEU" "Verifiying routines for post processing." "$NORMAL"
 python tests/postprocess/test_export_shell_internal_forces.py
+python tests/postprocess/test_results_store.py
+python tests/postprocess/test_result_tables.py
 echo "$BLEU" "  limit state checking." "$NORMAL"
 python tests/postprocess/limit_state_checking/test_shell_normal_stresses_uls_checking.py
+python tests/postprocess/limit_state_checking/test_capacity_factor_checker.py
 python tests/postprocess/limit_state_checking/test_shear_uls_checking.py
 
 #VTK tests
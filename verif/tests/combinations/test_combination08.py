@@ -0,0 +1,140 @@
+# -*- coding: utf-8 -*-
+'''Cantilever load combinations solved by superposition of the load
+   pattern responses (the stiffness matrix is factorized once).
+   Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2015, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+
+# Load
+f= 1.5e3 # Load magnitude (kN/m)
+F= 2e3 # Load magnitude (kN)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+nodes.newNodeXYZ(0,0.0,0.0)
+nodes.newNodeXYZ(L,0.0,0.0)
+
+# Geometric transformation(s)
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,-1,0]))    
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.defaultTag= 1 #Tag for next element.
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([1,2]));
+
+# Constraints
+modelSpace.fixNode000_000(1)
+# Loads definition
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lpA= casos.newLoadPattern("default","A")
+lpB= casos.newLoadPattern("default","B")
+lpC= casos.newLoadPattern("default","C")
+eleLoad= lpA.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= xc.ID([1]) 
+eleLoad.axialComponent= f
+eleLoad= lpB.newElementalLoad("beam3d_uniform_load")
+eleLoad.elementTags= xc.ID([1]) 
+eleLoad.transComponent= -f
+lpC.newNodalLoad(2,xc.Vector([F,0,0,0,0,0]))
+
+combs= cargas.getLoadCombinations
+combFactors= {"COMB1":(1.33,1.5,0.0), "COMB2":(1.0,0.0,1.0), "COMB3":(0.0,1.35,1.5), "COMB4":(1.33,1.5,0.0)}
+combs.newLoadCombination("COMB1","1.33*A+1.5*B")
+combs.newLoadCombination("COMB2","1.0*A+1.0*C")
+combs.newLoadCombination("COMB3","1.35*B+1.5*C")
+combs.newLoadCombination("COMB4","1.33*A+1.5*B") # Already computed.
+
+# Solution procedure (reused for all the combinations).
+solution= predefined_solutions.SolutionProcedure()
+analisis= solution.simpleStaticLinearSuperposition(feProblem)
+
+nod2= nodes.getNode(2)
+elem1= elements.getElement(1)
+err= 0.0
+for key in sorted(combFactors.keys()):
+  gA,gB,gC= combFactors[key]
+  preprocessor.resetLoadCase()
+  comb= combs[key]
+  comb.addToDomain()
+  result= analisis.analyze(1)
+  deltax= nod2.getDisp[0]
+  deltay= nod2.getDisp[2] 
+  elem1.getResistingForce()
+  N1= elem1.getN1 # Axial force at the back end of the beam
+  Mz1= elem1.getMz1 # Moment at the back end of the beam
+  comb.removeFromDomain()
+  deltaxteor= gA*f*L**2/(2*E*A)+gC*F*L/(E*A)
+  N1teor= gA*f*L+gC*F
+  deltayteor= -gB*f*L**4/(8*E*Iz)
+  Mz1teor= -gB*f*L*L/2
+  err+= result**2
+  err+= ((deltax-deltaxteor)/(f*L**2/(2*E*A)))**2
+  err+= ((N1-N1teor)/(f*L))**2
+  err+= ((deltay-deltayteor)/(f*L**4/(8*E*Iz)))**2
+  err+= ((Mz1-Mz1teor)/(f*L*L/2))**2
+
+numResponses= solution.solAlgo.numResponses # One for each load pattern.
+
+# New load in an already solved load pattern (its response
+# must be computed again).
+lpC.newNodalLoad(2,xc.Vector([F,0,0,0,0,0]))
+preprocessor.resetLoadCase()
+comb= combs["COMB2"]
+comb.addToDomain()
+result= analisis.analyze(1)
+deltax= nod2.getDisp[0]
+comb.removeFromDomain()
+deltaxteor= f*L**2/(2*E*A)+2.0*F*L/(E*A)
+err+= result**2
+err+= ((deltax-deltaxteor)/(f*L**2/(2*E*A)))**2
+
+''' 
+print "err= ",err
+print "numResponses= ",numResponses
+ '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((err<1e-10) & (numResponses==3)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,131 @@
+# -*- coding: utf-8 -*-
+# home made test
+'''In-memory snapshot of the domain state (takeSnapshot and
+   restoreSnapshot methods) verification.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+
+# Load
+F= 1.5e3 # Load magnitude (kN)
+Fy= 1.0e2 # Load magnitude (kN)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXYZ(0,0.0,0.0)
+nod= nodes.newNodeXYZ(L,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+    
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+#  sintaxis: ElasticBeam3d[<tag>] 
+elements.defaultTag= 1 #Tag for next element.
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([1,2]));
+
+#Constraints
+modelSpace.fixNode000_000(1)
+
+#Loads
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([F,0,0,0,0,0]))
+lp1= casos.newLoadPattern("default","1")
+lp1.newNodalLoad(2,xc.Vector([0,Fy,0,0,0,0]))
+#We add the load case to domain.
+casos.addToDomain("0")
+
+# Solution
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(1)
+
+domain= preprocessor.getDomain
+domain.takeSnapshot(1) # State after the first load case.
+time0= domain.getTimeTracker.getCurrentTime
+
+nod2= nodes.getNode(2)
+elem1= elements.getElement(1)
+
+def getResults():
+  elem1.getResistingForce()
+  return nod2.getDisp[0], nod2.getDisp[1], elem1.getN1
+
+deltaxTeor= F*L/(E*A)
+deltayTeor= Fy*L**3/(3*E*Iz)
+
+# Branch 1: load case "1" added to the previous state.
+casos.addToDomain("1")
+result= analisis.analyze(1)
+deltax1, deltay1, N1a= getResults()
+
+# Back to the state after the first load case.
+casos.removeFromDomain("1")
+domain.restoreSnapshot(1)
+deltax2, deltay2, N1b= getResults()
+time2= domain.getTimeTracker.getCurrentTime
+
+# Branch 2: the same load case added again.
+casos.addToDomain("1")
+result= analisis.analyze(1)
+deltax3, deltay3, N1c= getResults()
+
+ratio1= abs(deltax1-deltaxTeor)/deltaxTeor+abs(deltay1-deltayTeor)/deltayTeor+abs(N1a-F)/F
+ratio2= abs(deltax2-deltaxTeor)/deltaxTeor+abs(deltay2)/deltayTeor+abs(N1b-F)/F+abs(time2-time0)
+ratio3= abs(deltax3-deltax1)/deltaxTeor+abs(deltay3-deltay1)/deltayTeor+abs(N1c-N1a)/F
+
+''' 
+print "deltax1= ",deltax1, " deltay1= ", deltay1, " N1a= ", N1a
+print "deltax2= ",deltax2, " deltay2= ", deltay2, " N1b= ", N1b
+print "deltax3= ",deltax3, " deltay3= ", deltay3, " N1c= ", N1c
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "ratio3= ",ratio3
+   '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<1e-5) & (ratio2<1e-5) & (ratio3<1e-5) & (domain.getSnapshots.numSnapshots==1):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
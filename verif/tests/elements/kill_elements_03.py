@@ -0,0 +1,109 @@
+# -*- coding: utf-8 -*-
+''' Two springs in parallel solved with the linear algorithm reusing
+    the factored stiffness matrix. One of the springs is deactivated
+    and then reactivated between the analysis steps, so the factored
+    matrix must be formed again. Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2015, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+K= 1000 # Spring constant
+F= 1 # Force magnitude
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+# Model definition
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXY(1,1)
+nod= nodes.newNodeXY(1,1)
+
+# Materials definition
+k= typical_materials.defElasticMaterial(preprocessor, "k",K)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "k"
+elements.dimElem= 2 # Dimension of element space
+elements.defaultTag= 1
+spring1= elements.newElement("ZeroLength",xc.ID([1,2]))
+spring1.clearMaterials()
+spring1.setMaterial(0,"k")
+spring2= elements.newElement("ZeroLength",xc.ID([1,2]))
+spring2.clearMaterials()
+spring2.setMaterial(0,"k")
+setSpring2= preprocessor.getSets.defSet("setSpring2")
+setSpring2.getElements.append(spring2)
+
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+spc= constraints.newSPConstraint(1,0,0.0) # Node 1
+spc= constraints.newSPConstraint(1,1,0.0)
+spc= constraints.newSPConstraint(2,1,0.0) # Node 2
+
+# Loads definition
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([F,0]))
+#We add the load case to domain.
+casos.addToDomain("0")
+
+# Solution procedure (reused for all the steps).
+solution= predefined_solutions.SolutionProcedure()
+analisis= solution.simpleStaticLinear(feProblem)
+solution.solAlgo.reuseTangent= True # Form and factor K only once.
+
+nod2= nodes.getNode(2)
+# Both springs.
+result= analisis.analyze(1)
+delta1= nod2.getDisp[0]
+tangentFormed= solution.solAlgo.tangentFormed
+# Only one spring.
+setSpring2.killElements() # deactivate the second spring.
+result+= analisis.analyze(1)
+delta2= nod2.getDisp[0]
+tangentFormed= tangentFormed and solution.solAlgo.tangentFormed
+# Both springs again.
+setSpring2.aliveElements() # reactivate the second spring.
+result+= analisis.analyze(1)
+delta3= nod2.getDisp[0]
+
+ratio1= abs(delta1-F/(2*K))/(F/(2*K))
+ratio2= abs(delta2-F/K)/(F/K)
+ratio3= abs(delta3-F/(2*K))/(F/(2*K))
+
+''' 
+print "delta1= ",delta1
+print "delta2= ",delta2
+print "delta3= ",delta3
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "ratio3= ",ratio3
+print "tangentFormed= ",tangentFormed
+   '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<1e-10) & (ratio2<1e-5) & (ratio3<1e-5) & tangentFormed & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,98 @@
+# -*- coding: utf-8 -*-
+''' Computation of interaction diagrams using several threads
+    (same results as test_interaction_diagram01.py). Home made test. '''
+from __future__ import division
+
+import xc_base
+import geom
+import xc
+
+from materials.ehe import EHE_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Partial safety factors.
+gammac= 1.5 # Partial safety factor for concrete.
+gammas= 1.15 # Partial safety factor for steel.
+
+width= 0.2 # Section width expressed in meters.
+depth= 0.4 # Section width expressed in meters.
+cover= 0.05 # Concrete cover expressed in meters.
+diam= 16e-3 # Bar diameter expressed in meters.
+areaFi16= 2.01e-4 # Rebar area expressed in square meters.
+
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Define materials
+concr= EHE_materials.HA25
+concr.alfacc=0.85    #f_maxd= 0.85*fcd concrete long term compressive strength factor (normally alfacc=1)
+concrMatTag25= concr.defDiagD(preprocessor)
+Ec= concr.getDiagD(preprocessor).getTangent
+tagB500S= EHE_materials.B500S.defDiagD(preprocessor)
+Es= EHE_materials.B500S.getDiagD(preprocessor).getTangent
+
+geomSecHA= preprocessor.getMaterialHandler.newSectionGeometry("geomSecHA")
+regions= geomSecHA.getRegions
+concrete= regions.newQuadRegion(EHE_materials.HA25.nmbDiagD)
+concrete.nDivIJ= 10
+concrete.nDivJK= 10
+concrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+concrete.pMax= geom.Pos2d(depth/2.0,width/2.0)
+reinforcement= geomSecHA.getReinfLayers
+reinforcementInf= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementInf.numReinfBars= 2
+reinforcementInf.barArea= areaFi16
+reinforcementInf.p1= geom.Pos2d(cover-depth/2.0,width/2.0-cover) # bottom layer.
+reinforcementInf.p2= geom.Pos2d(cover-depth/2.0,cover-width/2.0)
+reinforcementSup= reinforcement.newStraightReinfLayer(EHE_materials.B500S.nmbDiagD)
+reinforcementSup.numReinfBars= 2
+reinforcementSup.barArea= areaFi16
+reinforcementSup.p1= geom.Pos2d(depth/2.0-cover,width/2.0-cover) # top layer.
+reinforcementSup.p2= geom.Pos2d(depth/2.0-cover,cover-width/2.0)
+
+materiales= preprocessor.getMaterialHandler
+sectionNames= ["secHA","secHA2","secHA3"]
+for name in sectionNames:
+  sec= materiales.newMaterial("fiber_section_3d",name)
+  fiberSectionRepr= sec.getFiberSectionRepr()
+  fiberSectionRepr.setGeomNamed("geomSecHA")
+  sec.setupFibers()
+
+param= xc.InteractionDiagramParameters()
+param.concreteTag= EHE_materials.HA25.matTagD
+param.reinforcementTag= EHE_materials.B500S.matTagD
+param.numThreads= 4
+# Angles swept concurrently.
+diagrams= [materiales.calcInteractionDiagram("secHA",param)]
+# Sections computed concurrently.
+numDiagrams= materiales.calcInteractionDiagrams(sectionNames[1:],param)
+diagrams.extend([materiales.getInteractionDiagram("diagInt"+name) for name in sectionNames[1:]])
+
+ratio0= numDiagrams-2
+ratio1= 0.0; ratio2= 0.0; ratio3= 0.0; ratio4= 0.0
+for diag in diagrams:
+  ratio1= max(ratio1,abs(diag.getCapacityFactor(geom.Pos3d(352877,0,0))-1))
+  ratio2= max(ratio2,abs(diag.getCapacityFactor(geom.Pos3d(352877/2.0,0,0))-0.5))
+  ratio3= max(ratio3,abs(diag.getCapacityFactor(geom.Pos3d(-574457,41505.4,2.00089e-11))-1.0))
+  ratio4= max(ratio4,abs(diag.getCapacityFactor(geom.Pos3d(-978599,-10679.4,62804.3))-1.0))
+
+''' 
+print "ratio0= ",(ratio0)
+print "ratio1= ",(ratio1)
+print "ratio2= ",(ratio2)
+print "ratio3= ",(ratio3)
+print "ratio4= ",(ratio4)
+ '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((ratio0==0) & (abs(ratio1)<1e-5) & (abs(ratio2)<1e-5) & (abs(ratio3)<1e-5) & (abs(ratio4)<1e-5)):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,75 @@
+# -*- coding: utf-8 -*-
+''' Checks that the stress resultant and the tangent stiffness of
+   a fiber section are the same when the fibers are updated using
+   packed arrays (packedFibers= True).
+   Home made. '''
+import xc_base
+import geom
+import xc
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2015, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+width= 0.3 # Cross section width expressed in meters.
+depth= 0.5 # Cross section depth expressed in meters.
+cover= 0.05 # Steel layer cover.
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+# Define materials
+concrete= typical_materials.defConcrete01(preprocessor,"concrete",-2e-3,-30e6,-25e6,-3.5e-3)
+steel= typical_materials.defSteel01(preprocessor,"steel",200e9,500e6,0.01)
+ela= typical_materials.defElasticMaterial(preprocessor, "ela",30e9)
+
+# Section geometry
+geomScc= preprocessor.getMaterialHandler.newSectionGeometry("geomScc")
+regions= geomScc.getRegions
+regConcrete= regions.newQuadRegion("concrete")
+regConcrete.nDivIJ= 10
+regConcrete.nDivJK= 13
+regConcrete.pMin= geom.Pos2d(-depth/2.0,-width/2.0)
+regConcrete.pMax= geom.Pos2d(depth/2.0,0.0)
+regEla= regions.newQuadRegion("ela")
+regEla.nDivIJ= 10
+regEla.nDivJK= 7
+regEla.pMin= geom.Pos2d(-depth/2.0,0.0)
+regEla.pMax= geom.Pos2d(depth/2.0,width/2.0)
+reinforcement= geomScc.getReinfLayers
+layer= reinforcement.newStraightReinfLayer("steel")
+layer.numReinfBars= 5
+layer.barArea= 3.14e-4
+layer.p1= geom.Pos2d(-depth/2.0+cover,-width/2.0+cover)
+layer.p2= geom.Pos2d(-depth/2.0+cover,width/2.0-cover)
+
+sections= list()
+for name in ["scc","sccPacked"]:
+  scc= preprocessor.getMaterialHandler.newMaterial("fiber_section_3d",name)
+  fiberSectionRepr= scc.getFiberSectionRepr()
+  fiberSectionRepr.setGeomNamed("geomScc")
+  scc.setupFibers()
+  sections.append(scc)
+sections[1].packedFibers= True
+
+err= 0.0
+for deformation in [[-1e-4,2e-4,-1e-4],[-5e-4,4e-3,1e-3],[1e-3,-2e-3,5e-3]]:
+  results= list()
+  for scc in sections:
+    scc.setTrialSectionDeformation(xc.Vector(deformation))
+    results.append((scc.getStressResultant(),scc.getTangentStiffness()))
+  R0= results[0][0]; R1= results[1][0]
+  K0= results[0][1]; K1= results[1][1]
+  err+= (R1-R0).Norm()/max(R0.Norm(),1.0)
+  err+= (K1-K0).Norm()/K0.Norm()
+
+# print "err= ", err
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (sections[1].packedFibers and abs(err)<1e-10):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+'''Normal stresses checking computed with the interaction diagrams only
+   (xc.CapacityFactorChecker) must give the same results that the
+   phantom model.'''
+
+
+import xc_base
+import geom
+import xc
+from materials.ehe import EHE_materials
+from materials.sections.fiber_section import defSimpleRCSection
+from postprocess import RC_material_distribution
+from materials.sections import RCsectionsContainer as sc
+from solution import predefined_solutions
+from materials.sia262 import SIA262_limit_state_checking #Change SIA262->EHE
+from postprocess import limit_state_data as lsd
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2015, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+feProblem= xc.FEProblem()
+feProblem.logFileName= "/tmp/borrar.log" # Don't pring warnings
+feProblem.errFileName= "/tmp/borrar.err" # Ignore warning messagess about maximum error in computation of the interaction diagram.
+
+
+elementTags= [2524,2527]
+#Reinforced concrete sections on each element.
+reinfConcreteSections= RC_material_distribution.RCMaterialDistribution()
+
+for eTag in elementTags:
+  reinfConcreteSections.sectionDistribution[eTag]= ["deck2","deck1"]
+
+# deck.
+concrete= EHE_materials.HA30
+concrete.alfacc= 0.85  #f_maxd= 0.85*fcd concrete long term compressive strength factor (normally alfacc=1)
+reinfSteel= EHE_materials.B500S
+areaFi8= 0.50e-4 #XXX Rebar area expressed in square meters.
+areaFi10= 0.785e-4
+areaFi12= 1.13e-4 
+areaFi16= 2.01e-4
+areaFi20= 3.14e-4
+areaFi25= 4.608e-4
+basicCover= 0.06
+numReinfBarsT= 5
+sepT= 1.0/numReinfBarsT
+numReinfBarsL= 7
+sepL= 1.0/numReinfBarsL
+
+sections= reinfConcreteSections.sectionDefinition
+
+deckSections= defSimpleRCSection.RecordRCSlabBeamSection("deck","RC deck.",concrete, reinfSteel,0.3)
+deckSections.dir2PositvRebarRows= [defSimpleRCSection.MainReinfLayer(rebarsDiam=12e-3,areaRebar=areaFi12,rebarsSpacing=sepT,nominalCover=basicCover)]
+deckSections.dir2NegatvRebarRows= [defSimpleRCSection.MainReinfLayer(rebarsDiam=12e-3,areaRebar=areaFi12,rebarsSpacing=sepT,nominalCover=basicCover)]
+deckSections.dir1PositvRebarRows= [defSimpleRCSection.MainReinfLayer(rebarsDiam=20e-3,areaRebar=areaFi20,rebarsSpacing=sepL,nominalCover=basicCover+12e-3)]
+deckSections.dir1NegatvRebarRows= [defSimpleRCSection.MainReinfLayer(rebarsDiam=20e-3,areaRebar=areaFi20,rebarsSpacing=sepL,nominalCover=basicCover+12e-3)]
+deckSections.creaTwoSections()
+sections.append(deckSections)
+
+
+import os
+pth= os.path.dirname(__file__)
+#print "pth= ", pth
+if(not pth):
+  pth= "."
+
+#Checking normal stresses.
+lsd.normalStressesResistance.controller= SIA262_limit_state_checking.BiaxialBendingNormalStressController('ULS_normalStress')
+lsd.LimitStateData.internal_forces_results_directory= pth+'/'
+lsd.LimitStateData.check_results_directory= '/tmp/'
+# Phantom model.
+lsd.normalStressesResistance.controller.interactionDiagramChecking= False
+lsd.normalStressesResistance.outputDataBaseFileName= 'ppTN_phantom'
+meanFCsPhantom= reinfConcreteSections.internalForcesVerification3D(lsd.normalStressesResistance,"d")
+# Interaction diagrams only.
+lsd.normalStressesResistance.controller.interactionDiagramChecking= True
+lsd.normalStressesResistance.outputDataBaseFileName= 'ppTN_native'
+meanFCsNative= reinfConcreteSections.internalForcesVerification3D(lsd.normalStressesResistance,"d")
+
+ratio1= abs(meanFCsNative[0]-meanFCsPhantom[0])/meanFCsPhantom[0]
+ratio2= abs(meanFCsNative[1]-meanFCsPhantom[1])/meanFCsPhantom[1]
+
+# Direct use of the checker.
+diagram= reinfConcreteSections.sectionDefinition.mapInteractionDiagrams["deck1"]
+checker= xc.CapacityFactorChecker()
+checker.setInteractionDiagram(1,0,diagram)
+checker.setInteractionDiagram(1,1,diagram)
+checker.setInteractionDiagram(3,0,diagram) # No internal forces.
+checker.addInternalForces("A",1,0,xc.Vector([-1e6,0.0,0.0,0.0,5e4,0.0]))
+checker.addInternalForces("B",1,0,xc.Vector([-2e6,0.0,0.0,0.0,1e5,0.0]))
+checker.addInternalForces("A",1,1,xc.Vector([1e5,0.0,0.0,0.0,-1e4,0.0]))
+checker.addInternalForces("A",2,0,xc.Vector([1e5,0.0,0.0,0.0,-1e4,0.0])) # No diagram.
+checker.run(2)
+CFs= checker.getRowCapacityFactors()
+CFB= diagram.getCapacityFactor(geom.Pos3d(-2e6,1e5,0.0))
+ratio3= abs(CFs[1]-CFB)/CFB
+ratio3+= abs(checker.getCapacityFactor(0)-CFB)/CFB
+worstCombOk= (checker.getCombinationName(0)=='B') & (checker.getCombinationName(1)=='A')
+rowsOk= (checker.numRows==3) & (checker.numSkippedRows==1)
+missingOk= checker.hasResults(0) & checker.hasResults(1) & (not checker.hasResults(2))
+missingOk= missingOk & (checker.numControlPointsWithoutResults==1) & (checker.getCombinationName(2)=='nil')
+
+'''
+print "meanFCsPhantom= ", meanFCsPhantom
+print "meanFCsNative= ", meanFCsNative
+print "ratio1= ",ratio1
+print "ratio2= ",ratio2
+print "ratio3= ",ratio3
+print "worstCombOk= ",worstCombOk
+print "rowsOk= ",rowsOk
+print "missingOk= ",missingOk
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (ratio1<1e-3) & (ratio2<1e-3) & (ratio3<1e-6) & worstCombOk & rowsOk & missingOk:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,148 @@
+# -*- coding: utf-8 -*-
+''' Horizontal cantilever under vertical load at its front end. The
+    displacements, reactions, resisting forces and section internal
+    forces are retrieved as tables (one call for the whole set)
+    and compared with the values obtained node by node and element
+    by element. Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2015, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+import numpy
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+NumDiv= 5 # Number of elements.
+
+# Load
+F= 1.5e3 # Load magnitude (N)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXYZ(i*L/NumDiv,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.numSections= 3 # Number of sections along the element.
+elements.defaultTag= 1
+for i in range(1,NumDiv+1):
+  el= elements.newElement("ForceBeamColumn3d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000_000(1)
+
+# Loads definition
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(NumDiv+1,xc.Vector([0,-F,0,0,0,0]))
+#We add the load case to domain.
+casos.addToDomain("0")
+# Solution procedure
+analisis= predefined_solutions.simple_static_linear(feProblem)
+result= analisis.analyze(1)
+
+mesh= feProblem.getDomain.getMesh
+mesh.calculateNodalReactions(True,1e-7)
+
+total= preprocessor.getSets.getSet("total")
+setNodes= total.nodes
+setElements= total.elements
+
+# Node tables.
+nodeTags= setNodes.getTagsTable()
+dispTable= setNodes.getDisplacementsTable()
+reacTable= setNodes.getReactionsTable()
+err= 0.0
+for i,n in enumerate(setNodes):
+  err+= (nodeTags[i]-n.tag)**2
+  err+= (dispTable.getRow(i)-n.getDisp).Norm2()
+  err+= (reacTable.getRow(i)-n.getReaction).Norm2()/F**2
+# Same tables from the mesh.
+meshDisp= mesh.getNodeDisplacementsTable()
+meshTags= mesh.getNodeTagsTable()
+for i,tag in enumerate(meshTags):
+  err+= (meshDisp.getRow(i)-nodes.getNode(tag).getDisp).Norm2()
+
+# Element tables.
+elemTags= setElements.getTagsTable()
+forceTable= setElements.getResistingForcesTable()
+stressTable= setElements.getGeneralizedStressesTable()
+row= 0
+for i,e in enumerate(setElements):
+  err+= (elemTags[i]-e.tag)**2
+  err+= (forceTable.getRow(i)-e.getResistingForce()).Norm2()/F**2
+  for j,s in enumerate(e.getSections()):
+    tableRow= stressTable.getRow(row)
+    err+= (tableRow[0]-e.tag)**2+(tableRow[1]-j)**2
+    stressResultant= s.getStressResultant()
+    for k in range(0,len(stressResultant)):
+      err+= ((tableRow[k+2]-stressResultant[k])/(F*L))**2
+    row+= 1
+numSectionRows= (row==stressTable.noRows) and (row==3*NumDiv)
+
+# The tables are wrapped by NumPy without copying the data.
+dispArray= numpy.asarray(dispTable)
+sharedData= (not dispArray.flags['OWNDATA'])
+sharedData= sharedData and (dispArray.shape==(dispTable.noRows,dispTable.noCols))
+for i in range(0,dispTable.noRows):
+  for j in range(0,dispTable.noCols):
+    err+= (dispArray[i,j]-dispTable(i,j))**2
+tagsArray= numpy.asarray(nodeTags)
+sharedData= sharedData and (list(tagsArray)==list(nodeTags))
+
+# Reaction at the support.
+Ry= reacTable.getRow(0)[1]
+ratio1= abs((Ry-F)/F)
+
+'''
+print "err= ",err
+print "numSectionRows= ",numSectionRows
+print "sharedData= ",sharedData
+print "Ry= ",Ry
+print "ratio1= ",ratio1
+   '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-10) & (abs(ratio1)<1e-10) & numSectionRows & sharedData & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,172 @@
+# -*- coding: utf-8 -*-
+'''Binary result store (xc.ResultStore) test. The internal forces
+   and displacements read from the store must be equal to those
+   written by the text (CSV) export functions.
+   Model taken from example 2-005 of the SAP 2000 verification manual.'''
+
+# feProblem.setVerbosityLevel(0)
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumDivI= 8
+NumDivJ= 8
+CooMaxX= 10
+CooMaxY= 2
+E= 17472000 # Elastic modulus en lb/in2
+nu= 0.3 # Coeficiente de Poison
+G= 6720000
+thickness= 0.0001 # Cross section depth expressed in inches.
+unifLoad= 0.0001 # Carga uniforme en lb/in2.
+ptLoad= 100 # Carga puntual en lb.
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+from materials.sections import internal_forces
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+# Define materials
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+
+nodes.newSeedNode()
+
+# Define materials
+nmb1= typical_materials.defElasticMembranePlateSection(preprocessor, "memb1",E,nu,0.0,thickness)
+
+
+
+seedElemHandler= preprocessor.getElementHandler.seedElemHandler
+seedElemHandler.defaultMaterial= "memb1"
+seedElemHandler.defaultTag= 1
+elem= seedElemHandler.newElement("ShellMITC4",xc.ID([0,0,0,0]))
+
+
+
+points= preprocessor.getMultiBlockTopology.getPoints
+pt= points.newPntIDPos3d(1,geom.Pos3d(0.0,0.0,0.0))
+pt= points.newPntIDPos3d(2,geom.Pos3d(CooMaxX,0.0,0.0))
+pt= points.newPntIDPos3d(3,geom.Pos3d(CooMaxX,CooMaxY,0.0))
+pt= points.newPntIDPos3d(4,geom.Pos3d(0.0,CooMaxY,0.0))
+surfaces= preprocessor.getMultiBlockTopology.getSurfaces
+surfaces.defaultTag= 1
+s= surfaces.newQuadSurfacePts(1,2,3,4)
+s.nDivI= NumDivI
+s.nDivJ= NumDivJ
+
+f1= preprocessor.getSets.getSet("f1")
+f1.genMesh(xc.meshDir.I)
+sides= s.getEdges
+#Edge iterator
+for l in sides:
+  for i in l.getEdge.getNodeTags():
+    modelSpace.fixNode000_FFF(i)
+
+# Loads definition
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+#casos.currentLoadPattern= "0"
+
+
+f1= preprocessor.getSets.getSet("f1")
+nNodes= f1.getNumNodes
+ 
+node= f1.getNodeIJK(1,NumDivI/2+1,NumDivJ/2+1)
+# print "Central node: ", node.tag
+# print "Central node coordinates: ", node.getCoo
+lp0.newNodalLoad(node.tag,xc.Vector([0,0,-ptLoad,0,0,0])) # Concentrated load
+
+
+nElems= f1.getNumElements
+#We add the load case to domain.
+casos.addToDomain("0")
+
+
+# Solution procedure
+analisis= predefined_solutions.simple_static_linear(feProblem)
+analOk= analisis.analyze(1)
+
+f1= preprocessor.getSets.getSet("f1")
+
+from postprocess.reports import export_internal_forces
+setTotal= preprocessor.getSets["total"]
+fName= "/tmp/test_results_store.txt"
+f= open(fName,"w")
+export_internal_forces.exportInternalForces("test",setTotal.getElements,f)
+f.close()
+
+# Results store
+storeFileName= "/tmp/test_results_store.xcrs"
+store= feProblem.getResultStore
+store.open(storeFileName,False)
+feProblem.dumpCombinationResults("test",setTotal)
+feProblem.dumpCombinationResults("test2",setTotal) # Only to check the chunk skipping.
+store.close()
+
+# Internal forces written as text.
+refValues= dict()
+import csv
+cr = csv.reader(open(fName,"rb"))
+for row in cr:
+  refValues[(eval(row[1]),eval(row[2]))]= [eval(x) for x in row[3:9]]
+
+reader= xc.ResultStoreReader()
+reader.open(storeFileName)
+err= 0.0
+numChunks= 0
+combNames= list()
+while(reader.nextOfKind(1)):
+  numChunks+= 1
+  combNames.append(reader.combinationName)
+  tags= reader.getTags()
+  sections= reader.getSections()
+  nRows= reader.numRows
+  for i in range(0,nRows):
+    row= reader.getRow(i)
+    ref= refValues[(tags[i],sections[i])]
+    for j in range(0,6):
+      err+= (row[j]-ref[j])**2
+reader.close()
+nRowsOk= (nRows==len(refValues))
+
+# Nodal displacements.
+reader.open(storeFileName)
+reader.nextOfKind(0)
+tags= reader.getTags()
+uz= reader.getColumn(2)
+for i in range(0,reader.numRows):
+  err+= (uz[i]-nodes.getNode(tags[i]).getDisp[2])**2
+numNodesOk= (reader.numRows==setTotal.getNodes.size)
+reader.close()
+
+'''
+print "err= ", err
+print "numChunks= ", numChunks
+print "combNames= ", combNames
+print "nRowsOk= ", nRowsOk
+print "numNodesOk= ", numNodesOk
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((err<1e-15) & (numChunks==2) & (combNames==['test','test2']) & nRowsOk & numNodesOk):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,83 @@
+# -*- coding: utf-8 -*-
+''' Union, difference and intersection of node and element sets
+    with membership and tag queries.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+NumNodes= 200
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 0
+for i in range(0,NumNodes):
+  nodes.newNodeXY(float(i),0.0)
+
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",2.1e11)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 2
+elements.defaultTag= 0
+for i in range(0,NumNodes-1):
+  truss= elements.newElement("Truss",xc.ID([i,i+1]))
+  truss.area= 1e-4
+
+s1= preprocessor.getSets.defSet("S1")
+s2= preprocessor.getSets.defSet("S2")
+for i in range(0,120):
+  s1.getNodes.append(nodes.getNode(i))
+for i in range(80,NumNodes):
+  s2.getNodes.append(nodes.getNode(i))
+s2.getNodes.append(nodes.getNode(100)) # Already there.
+
+s3= s1+s2
+s4= s1-s2
+s5= s1*s2
+sz3= s3.getNodes.size
+sz4= s4.getNodes.size
+sz5= s5.getNodes.size
+
+# Membership and tag queries.
+ok= (s2.getNodes.size==NumNodes-80)
+ok= ok and (nodes.getNode(10) in s4.getNodes)
+ok= ok and not (nodes.getNode(100) in s4.getNodes)
+ok= ok and (s5.getNodes.findNode(100).tag==100)
+ok= ok and (s5.getNodes.findNode(10)==None)
+ok= ok and s3.getNodes.hasNodeTag(NumNodes-1)
+ok= ok and not s4.getNodes.hasNodeTag(80)
+# Order of insertion is kept.
+ok= ok and (s5.getNodes[0].tag==80) and (s4.getNodes[sz4-1].tag==79)
+
+# Elements and fillDownwards.
+s6= preprocessor.getSets.defSet("S6")
+for i in range(50,150):
+  s6.getElements.append(elements.getElement(i))
+s6.fillDownwards()
+sz6= s6.getNodes.size
+ok= ok and (s6.getElements.findElement(60).tag==60)
+ok= ok and (s6.getElements.findElement(10)==None)
+ok= ok and (elements.getElement(149) in s6.getElements)
+
+'''
+print 'sz3= ', sz3, 'sz4= ', sz4, 'sz5= ', sz5, 'sz6= ', sz6
+print 'ok= ', ok
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (sz3==NumNodes) and (sz4==80) and (sz5==40) and (sz6==101) and ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
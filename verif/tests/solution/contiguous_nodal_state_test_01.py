@@ -0,0 +1,96 @@
+# -*- coding: utf-8 -*-
+''' Transient analysis with the nodal state stored in contiguous
+    arrays (mesh.contiguousNodalState= True). The results must be
+    the same that with the default (per node) storage. Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e11 # Elastic modulus
+A= 4e-4 # Bar area
+l= 1.0 # Bar length
+m= 100.0 # Nodal mass
+F= 1e4 # Tip load
+NumElem= 20
+NumSteps= 50
+dT= 1e-4
+
+def solve(contiguousNodalState):
+  ''' Return the tip displacements of a truss chain under a step load.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+  nodes.defaultTag= 0
+  for i in range(0,NumElem+1):
+    n= nodes.newNodeXY(i*l,0.0)
+    n.mass= xc.Matrix([[m,0],[0,m]])
+
+  elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "elast"
+  elements.dimElem= 2
+  for i in range(0,NumElem):
+    truss= elements.newElement("Truss",xc.ID([i,i+1]))
+    truss.area= A
+
+  constraints= preprocessor.getBoundaryCondHandler
+  spc= constraints.newSPConstraint(0,0,0.0)
+  for i in range(0,NumElem+1):
+    spc= constraints.newSPConstraint(i,1,0.0)
+
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  lp0.newNodalLoad(NumElem,xc.Vector([F,0]))
+  casos.addToDomain("0")
+
+  mesh= feProblem.getDomain.getMesh
+  mesh.contiguousNodalState= contiguousNodalState
+
+  solution= predefined_solutions.SolutionProcedure()
+  analysis= solution.plainLinearNewmark(feProblem)
+  tip= nodes.getNode(NumElem)
+  retval= []
+  for i in range(0,NumSteps):
+    result= analysis.analyze(1,dT)
+    retval.append(tip.getDisp[0])
+  crd= tip.getCoo[0]
+  mesh.contiguousNodalState= False # Nodes own its data again.
+  ok= (abs(tip.getCoo[0]-crd)<1e-12) and (abs(tip.getDisp[0]-retval[-1])<1e-15)
+  return retval, ok
+
+u0, ok0= solve(False)
+u1, ok1= solve(True)
+
+err= 0.0
+for a, b in zip(u0,u1):
+  err+= (a-b)**2
+err= err**0.5
+uMax= max(abs(u) for u in u0)
+
+'''
+print 'uMax= ', uMax
+print 'err= ', err
+print 'ok0= ', ok0, 'ok1= ', ok1
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-12*uMax) and (uMax>0.0) and ok0 and ok1:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,101 @@
+# -*- coding: utf-8 -*-
+''' Numbering of the graph of a mesh of quadrilaterals stored in
+    compressed (CSR) format. The results must be the same that with
+    the Graph object. Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+
+nx= 8 # Number of quads along the long side.
+ny= 3 # Number of quads along the short side.
+
+def nodeTag(i,j):
+  ''' Nodes numbered along the long side (worst band).'''
+  return j*(nx+1)+i
+
+def quads(tags):
+  ''' Return the node cliques of the quads.'''
+  retval= list()
+  for i in range(0,nx):
+    for j in range(0,ny):
+      retval.append([tags[nodeTag(i,j)],tags[nodeTag(i+1,j)],tags[nodeTag(i+1,j+1)],tags[nodeTag(i,j+1)]])
+  return retval
+
+def buildGraph(tags):
+  ''' Return the compressed graph of the mesh.'''
+  retval= xc.CSRGraph()
+  for t in sorted(tags):
+    retval.addVertex(t)
+  for q in quads(tags):
+    retval.addClique(xc.ID(q))
+  retval.build()
+  return retval
+
+numNodes= (nx+1)*(ny+1)
+identity= range(0,numNodes)
+csr= buildGraph(identity)
+graph= csr.getGraph()
+
+# Size and band of the original numbering.
+numEdge= nx*(ny+1)+(nx+1)*ny+2*nx*ny
+ok0= (csr.numVertex==numNodes) and (graph.numVertex==numNodes)
+ok1= (csr.numEdge==numEdge) and (graph.numEdge==numEdge)
+ok2= (csr.getVertexDiffMaxima()==nx+2) and (graph.getVertexDiffMaxima()==nx+2)
+ok3= csr.hasConsecutiveTags()
+
+# Graph numberers.
+feProblem= xc.FEProblem()
+solCtrl= feProblem.getSoluProc.getSoluControl
+sm= solCtrl.getModelWrapperContainer.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+
+# Simple numbering: the same order with both representations.
+numberer.useAlgorithm("simple")
+simpleCSR= list(numberer.graphNumberer.numberCSRGraph(csr,-1))
+simpleGraph= list(numberer.graphNumberer.numberGraph(graph,-1))
+ok4= (simpleCSR==simpleGraph) and (sorted(simpleCSR)==identity)
+
+# Reverse Cuthill-McKee: same order with both representations and
+# a smaller band than the original numbering.
+numberer.useAlgorithm("rcm")
+rcmCSR= list(numberer.graphNumberer.numberCSRGraph(csr,-1))
+rcmGraph= list(numberer.graphNumberer.numberGraph(graph,-1))
+ok5= (rcmCSR==rcmGraph) and (sorted(rcmCSR)==identity)
+
+newTags= [0]*numNodes
+for pos, tag in enumerate(rcmCSR):
+  newTags[tag]= pos
+renumbered= buildGraph(newTags)
+band= renumbered.getVertexDiffMaxima()
+ok6= (band==renumbered.getGraph().getVertexDiffMaxima()) and (band<nx+2) and (band>=ny+1)
+
+# Large, non consecutive tags: same adjacency and the tags are
+# found by binary search.
+sparseTags= [1000000*t+7 for t in identity]
+sparse= buildGraph(sparseTags)
+ok7= (sparse.numVertex==numNodes) and (sparse.numEdge==numEdge) and not sparse.hasConsecutiveTags()
+for i, t in enumerate(sparseTags):
+  ok7= ok7 and (sparse.getVertexIndex(t)==i) and (sparse.getVertexTag(i)==t)
+  ok7= ok7 and (sparse.getDegree(i)==csr.getDegree(i))
+ok7= ok7 and (sparse.getVertexIndex(8)==-1) and (sparse.getVertexIndex(-1)==-1)
+
+'''
+print 'ok0= ', ok0, 'ok1= ', ok1, 'ok2= ', ok2, 'ok3= ', ok3
+print 'ok4= ', ok4, 'ok5= ', ok5, 'ok6= ', ok6, 'ok7= ', ok7
+print 'band= ', band
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok0 and ok1 and ok2 and ok3 and ok4 and ok5 and ok6 and ok7:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,175 @@
+# -*- coding: utf-8 -*-
+''' Test to verify the modal responses and the mode combinations
+computed by the response spectrum methods of the modal analysis. 
+Taken from example A87 of Solvia Verification Manual.
+This exercise is based on example E26.8 of the 
+book «Dynamics of Structures» by Clough, R. W., and Penzien, J. '''
+import xc_base
+import geom
+import xc
+
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+import math
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+masaExtremo= 1e-2 # Masa en kg.
+nodeMassMatrix= xc.Matrix([[masaExtremo,0,0,0,0,0],
+                                         [0,masaExtremo,0,0,0,0],
+                                         [0,0,masaExtremo,0,0,0],
+                                         [0,0,0,0,0,0],
+                                         [0,0,0,0,0,0],
+                                         [0,0,0,0,0,0]])
+EMat= 1 # Elastic modulus.
+nuMat= 0 # Poisson's ratio.
+GMat= EMat/(2.0*(1+nuMat)) # Shear modulus.
+
+Iyy= 1 # Flexural inertia on y axis.
+Izz= 1 # Flexural inertia on z axis.
+Ir= 4/3.0 # Inercia a torsion.
+area= 1e7 # Section area.
+Lx= 1
+Ly= 1
+Lz= 1
+
+
+# Problem type
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nod0= nodes.newNodeIDXYZ(0,0,0,0)
+nod1= nodes.newNodeXYZ(0,-Ly,0)
+nod2= nodes.newNodeXYZ(0,-Ly,-Lz)
+nod3= nodes.newNodeXYZ(Lx,-Ly,-Lz)
+nod3.mass= nodeMassMatrix
+
+constraints= preprocessor.getBoundaryCondHandler
+nod0.fix(xc.ID([0,1,2,3,4,5]),xc.Vector([0,0,0,0,0,0]))
+
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",area,EMat,GMat,Izz,Iyy,Ir)
+
+# Geometric transformation(s)
+linX= modelSpace.newLinearCrdTransf("linX",xc.Vector([1,0,0]))
+linY= modelSpace.newLinearCrdTransf("linY",xc.Vector([0,1,0]))
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "linX"
+elements.defaultMaterial= "scc"
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([0,1]))
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([1,2]))
+elements.defaultTransformation= "linY"
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([2,3]))
+
+# Set with the node that has the mass and the element connected to it.
+setNod3= preprocessor.getSets.defSet("setNod3")
+setNod3.getNodes.append(nod3)
+setNod3.getElements.append(beam3d)
+
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+
+
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+
+
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("frequency_soln_algo")
+integ= analysisAggregation.newIntegrator("eigen_integrator",xc.Vector([1.0,1,1.0,1.0]))
+
+soe= analysisAggregation.newSystemOfEqn("full_gen_eigen_soe")
+solver= soe.newSolver("full_gen_eigen_solver")
+
+analysis= solu.newAnalysis("modal_analysis","analysisAggregation","")
+analOk= analysis.analyze(3)
+periodos= analysis.getPeriods()
+angularFrequencies= analysis.getAngularFrequencies()
+aceleraciones= [2.27,2.45,6.98]
+# Spectrum that gives the accelerations of the example for the
+# computed periods (periods in increasing order).
+spectrum= geom.FunctionGraph1D()
+for i in [2,1,0]:
+  spectrum.append(periodos[i],aceleraciones[i])
+analysis.spectrum= spectrum
+
+participationFactorsX= analysis.getModalParticipationFactorsForDOFs([0])
+modalDisp= analysis.getModalDisplacements(setNod3,[0]) # one row for each mode.
+modalForces= analysis.getModalElementForces(setNod3,[0])
+maxDispCQC= analysis.getCQC(modalDisp,xc.Vector([0.05,0.05,0.05]))
+maxDispSRSS= analysis.getSRSS(modalDisp)
+
+# Theorethical values taken from the exampleE26.8 of the book: Clough, R. W., and Penzien, J., Dynamics of Structures
+participationFactorsXTeor= [-.731/1.588,.271/1.075,-1/1.678]
+ratio0= 0.0
+for i in range(0,3):
+  ratio0+= (abs(participationFactorsX[i])-abs(participationFactorsXTeor[i]))**2
+ratio0= math.sqrt(ratio0)
+# This displacements are taken from the Solvia manual.
+maxDispModTeor= [[36.202e-3,-11.549e-3,49.548e-3],
+                 [7.123e-3,26.38e-3,0.945e-3],
+                 [19.625e-3,-4.746e-3,-15.445e-3]]
+ratio1= 0.0
+for i in range(0,3):
+  for j in range(0,3):
+    ratio1+= (modalDisp(i,j)-maxDispModTeor[i][j])**2
+ratio1= math.sqrt(ratio1)
+# Forces on the mass node: K*u_i= omega_i^2*M*u_i
+ratio2= 0.0
+for i in range(0,3):
+  for j in range(0,3):
+    fTeor= angularFrequencies[i]**2*masaExtremo*modalDisp(i,j)
+    ratio2+= (modalForces(i,6+j)-fTeor)**2
+ratio2= math.sqrt(ratio2)/masaExtremo
+maxDispCQCTeor= [46.53e-3,19.18e-3,52.53e-3]
+ratio3= 0.0
+for j in range(0,3):
+  ratio3+= (maxDispCQC[j]-maxDispCQCTeor[j])**2
+ratio3= math.sqrt(ratio3)
+ratio4= 0.0
+for j in range(0,6):
+  srss= math.sqrt(modalDisp(0,j)**2+modalDisp(1,j)**2+modalDisp(2,j)**2)
+  ratio4+= (maxDispSRSS[j]-srss)**2
+ratio4= math.sqrt(ratio4)
+# 100-30 rule.
+dirComb= analysis.getDirectionalCombination(xc.Vector([1.0,-0.2]),xc.Vector([0.5,1.0]),xc.Vector([0.0,0.0]),0.3)
+ratio5= abs(dirComb[0]-1.15)+abs(dirComb[1]-1.06)
+
+''' 
+print "participationFactorsX= ",participationFactorsX
+print "ratio0= ",ratio0
+print "modalDisp= ",modalDisp
+print "ratio1= ",ratio1
+print "modalForces= ",modalForces
+print "ratio2= ",ratio2
+print "maxDispCQC= ",maxDispCQC
+print "ratio3= ",ratio3
+print "maxDispSRSS= ",maxDispSRSS
+print "ratio4= ",ratio4
+print "dirComb= ",dirComb
+print "ratio5= ",ratio5
+   '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if((analOk==0) & (ratio0<1e-3) & (ratio1<1e-6) & (ratio2<1e-6) & (ratio3<1e-5) & (ratio4<1e-12) & (ratio5<1e-12)): 
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
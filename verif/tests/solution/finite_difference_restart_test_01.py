@@ -0,0 +1,220 @@
+# -*- coding: utf-8 -*-
+''' Finite difference gradient of a limit-state function computed
+    with FiniteDifferenceGradGEvaluator repeating the whole analysis
+    and restarting the perturbed analyses from the state at the mean
+    point (domain snapshot). In a linear model both gradients must
+    agree. Checks also that the snapshot is released when an analysis
+    fails and that the snapshots of the user are not modified.
+    Home made test.'''
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+# Material properties (mean values of the random variables E and Iz).
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+
+# Load
+Fy= 1.0e2 # Load magnitude (N)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXYZ(0,0.0,0.0)
+nod= nodes.newNodeXYZ(L,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+    
+# Materials definition
+scc= typical_materials.defElasticSection3d(preprocessor, "scc",A,E,G,Iz,Iy,J)
+
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "scc"
+elements.defaultTag= 1 #Tag for next element.
+beam3d= elements.newElement("ElasticBeam3d",xc.ID([1,2]));
+
+#Constraints
+modelSpace.fixNode000_000(1)
+
+#Loads
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([0,Fy,0,0,0,0]))
+casos.addToDomain("0")
+
+domain= preprocessor.getDomain
+nod2= nodes.getNode(2)
+analisis= predefined_solutions.simple_static_linear(feProblem)
+
+deltaMax= 0.05 # Displacement limit.
+
+# Random variables and limit-state function.
+reliabilityDomain= xc.ReliabilityDomain()
+rvE= reliabilityDomain.newRandomVariable("normal",1,E,0.1*E)
+rvIz= reliabilityDomain.newRandomVariable("normal",2,Iz,0.1*Iz)
+lsf= reliabilityDomain.newLimitStateFunction(1,"{deltaMax}-{uy}")
+reliabilityDomain.tagOfActiveLimitStateFunction= 1
+meanPoint= xc.Vector([rvE.getMean(),rvIz.getMean()])
+
+def setRandomVariables(x):
+  ''' Assign the values of the random variables to the model.'''
+  sectionProperties= beam3d.sectionProperties
+  sectionProperties.E= x[0]
+  sectionProperties.Iz= x[1]
+  beam3d.sectionProperties= sectionProperties
+
+def runGFunAnalysis(x):
+  ''' Repeat the whole analysis.'''
+  domain.revertToStart()
+  setRandomVariables(x)
+  return analisis.analyze(1)
+
+numRestarts= 0
+def runGFunAnalysisFromCurrentState(x):
+  ''' Restart the analysis from the current state.'''
+  global numRestarts
+  numRestarts+= 1
+  setRandomVariables(x)
+  return analisis.analyze(1)
+
+def getResponses():
+  ''' Values of the variables of the limit-state function.'''
+  return {'deltaMax':deltaMax, 'uy':nod2.getDisp[1]}
+
+gFunEvaluator= xc.PythonGFunEvaluator(reliabilityDomain)
+gFunEvaluator.analysisCallback= runGFunAnalysis
+gFunEvaluator.restartCallback= runGFunAnalysisFromCurrentState
+gFunEvaluator.responseCallback= getResponses
+perturbationFactor= 1000.0
+gradGEvaluator= xc.FiniteDifferenceGradGEvaluator(gFunEvaluator,reliabilityDomain,perturbationFactor,False)
+
+def meanPointG():
+  ''' Run the analysis for the mean point and return the value of
+      the limit-state function.'''
+  gFunEvaluator.runGFunAnalysis(meanPoint)
+  gFunEvaluator.evaluateG(meanPoint)
+  return gFunEvaluator.getG()
+
+userSnapshotTag= 1
+g0= meanPointG()
+domain.takeSnapshot(userSnapshotTag) # Snapshot of the user.
+uy0= nod2.getDisp[1]
+
+# Gradient repeating the whole analysis.
+resultFull= gradGEvaluator.computeGradG(g0,meanPoint)
+gradFull= gradGEvaluator.getGradG()
+restartsFull= numRestarts
+
+# Gradient restarting from the mean point.
+gradGEvaluator.restartFromMeanPoint= True
+g0= meanPointG()
+resultRestart= gradGEvaluator.computeGradG(g0,meanPoint)
+gradRestart= gradGEvaluator.getGradG()
+restartsRestart= numRestarts-restartsFull # Mean point and perturbed realizations.
+g0= meanPointG()
+resultAll= gradGEvaluator.computeAllGradG(xc.Vector([g0]),meanPoint)
+allGradRestart= gradGEvaluator.getAllGradG()
+
+# Analytical gradient: g= deltaMax-Fy*L**3/(3*E*Iz) (the finite
+# difference error is of the order of 1/perturbationFactor).
+delta= Fy*L**3/(3*E*Iz)
+gradTeor= [delta/E, delta/Iz]
+
+err= 0.0
+errTeor= 0.0
+for i in range(0,len(gradTeor)):
+  err= max(err,abs(gradRestart[i]-gradFull[i])/abs(gradTeor[i]))
+  err= max(err,abs(allGradRestart(i,0)-gradFull[i])/abs(gradTeor[i]))
+  errTeor= max(errTeor,abs(gradFull[i]-gradTeor[i])/abs(gradTeor[i]))
+okResults= (resultFull==0) and (resultRestart==0) and (resultAll==0) and (restartsFull==0) and (restartsRestart==3)
+
+# Error paths: the snapshot of the mean point must be released.
+def failingRestart(x):
+  ''' The analysis of the perturbed realizations fails.'''
+  global numRestarts
+  numRestarts+= 1
+  if(numRestarts>1):
+    return -1
+  return runGFunAnalysisFromCurrentState(x)
+numRestarts= 0
+gFunEvaluator.restartCallback= failingRestart
+g0= meanPointG()
+resultAnalysisError= gradGEvaluator.computeGradG(g0,meanPoint)
+okAnalysisError= (resultAnalysisError<0) and (domain.getSnapshots.numSnapshots==1)
+okAnalysisError= okAnalysisError and (abs(nod2.getDisp[1]-uy0)<1e-12*abs(uy0)) # state at the mean point restored.
+gFunEvaluator.restartCallback= runGFunAnalysisFromCurrentState
+
+def wrongResponses():
+  ''' Invalid variable name (the limit-state function can't be evaluated).'''
+  return {'u y':nod2.getDisp[1]}
+g0= meanPointG()
+gFunEvaluator.responseCallback= wrongResponses
+resultResponseError= gradGEvaluator.computeAllGradG(xc.Vector([g0]),meanPoint)
+okResponseError= (resultResponseError<0) and (domain.getSnapshots.numSnapshots==1)
+gFunEvaluator.responseCallback= getResponses
+
+# Snapshot tag already used: the whole analysis is repeated and the
+# snapshot of the user is not modified.
+gradGEvaluator.snapshotTag= userSnapshotTag
+numRestarts= 0
+g0= meanPointG()
+resultUsedTag= gradGEvaluator.computeGradG(g0,meanPoint)
+gradUsedTag= gradGEvaluator.getGradG()
+errUsedTag= 0.0
+for i in range(0,len(gradTeor)):
+  errUsedTag= max(errUsedTag,abs(gradUsedTag[i]-gradFull[i])/abs(gradTeor[i]))
+domain.restoreSnapshot(userSnapshotTag)
+okUsedTag= (resultUsedTag==0) and (numRestarts==0) and (errUsedTag<1e-12) and (abs(nod2.getDisp[1]-uy0)<1e-12*abs(uy0))
+
+# The snapshot of the user must remain.
+okSnapshots= domain.getSnapshots.exists(userSnapshotTag) and (domain.getSnapshots.numSnapshots==1)
+
+'''
+print 'gradFull= ', gradFull
+print 'gradRestart= ', gradRestart
+print 'allGradRestart= ', allGradRestart
+print 'gradTeor= ', gradTeor
+print 'err= ', err
+print 'errTeor= ', errTeor
+print 'okResults= ', okResults
+print 'okAnalysisError= ', okAnalysisError
+print 'okResponseError= ', okResponseError
+print 'okUsedTag= ', okUsedTag
+print 'okSnapshots= ', okSnapshots
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-8) and (errTeor<2e-3) and okResults and okAnalysisError and okResponseError and okUsedTag and okSnapshots:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
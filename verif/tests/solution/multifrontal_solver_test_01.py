@@ -0,0 +1,105 @@
+# -*- coding: utf-8 -*-
+# home made test
+''' Cantilever plate (shell elements) under a load at one of its free
+    corners. The system of equations is solved using the supernodal
+    multifrontal solver (nested dissection ordering) with several
+    threads and the results are compared with those obtained with
+    the profile SPD solver.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e9 # Young modulus of the steel.
+nu= 0.3 # Poisson's ratio.
+h= .1 # Thickness.
+dens= 1.33 # Density kg/m2.
+L= 2.0 # Side length.
+NumDiv= 12 # Number of elements in each direction.
+F= 1000 # Force
+
+def solve(soeType, solverType, numThreads):
+  ''' Build the model, solve it and return the displacements
+      of the nodes and the solver.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor   
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for j in range(0,NumDiv+1):
+    for i in range(0,NumDiv+1):
+      nod= nodes.newNodeXYZ(i*L/NumDiv,j*L/NumDiv,0.0)
+  memb1= typical_materials.defElasticMembranePlateSection(preprocessor, "memb1",E,nu,dens,h)
+  elements= preprocessor.getElementHandler
+  elements.defaultMaterial= "memb1"
+  for j in range(0,NumDiv):
+    for i in range(0,NumDiv):
+      n1= j*(NumDiv+1)+i+1
+      elem= elements.newElement("ShellMITC4",xc.ID([n1,n1+1,n1+NumDiv+2,n1+NumDiv+1]))
+  # Constraints
+  for j in range(0,NumDiv+1):
+    modelSpace.fixNode000_000(j*(NumDiv+1)+1)
+  # Loads definition
+  cargas= preprocessor.getLoadHandler
+  casos= cargas.getLoadPatterns
+  ts= casos.newTimeSeries("constant_ts","ts")
+  casos.currentTimeSeries= "ts"
+  lp0= casos.newLoadPattern("default","0")
+  lp0.newNodalLoad((NumDiv+1)**2,xc.Vector([F,F,F,0,0,0]))
+  casos.addToDomain("0")
+  # Solution procedure
+  solu= feProblem.getSoluProc
+  solCtrl= solu.getSoluControl
+  solModels= solCtrl.getModelWrapperContainer
+  sm= solModels.newModelWrapper("sm")
+  numberer= sm.newNumberer("default_numberer")
+  numberer.useAlgorithm("rcm")
+  cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+  analysisAggregations= solCtrl.getAnalysisAggregationContainer
+  analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+  solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+  integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+  soe= analysisAggregation.newSystemOfEqn(soeType)
+  solver= soe.newSolver(solverType)
+  analysisAggregation.numThreads= numThreads
+  analisis= solu.newAnalysis("static_analysis","analysisAggregation","")
+  result= analisis.analyze(1)
+  disp= list()
+  for k in range(1,(NumDiv+1)**2+1):
+    d= nodes.getNode(k).getDisp
+    disp.extend([d[i] for i in range(0,6)])
+  return result, disp, solver
+
+resultRef, dispRef, solverRef= solve("profile_spd_lin_soe","profile_spd_lin_direct_solver",1)
+result1, disp1, solver1= solve("multifrontal_spd_lin_soe","multifrontal_spd_lin_solver",1)
+result4, disp4, solver4= solve("multifrontal_spd_lin_soe","multifrontal_spd_lin_solver",4)
+
+maxDisp= max([abs(d) for d in dispRef])
+err1= max([abs(a-b) for a,b in zip(dispRef,disp1)])/maxDisp
+err4= max([abs(a-b) for a,b in zip(dispRef,disp4)])/maxDisp
+
+''' 
+print "maxDisp= ", maxDisp
+print "err1= ", err1
+print "err4= ", err4
+print "numSupernodes= ", solver4.numSupernodes
+print "factorSize= ", solver4.factorSize
+print "numSymbolicFactorizations= ", solver4.numSymbolicFactorizations
+print "numNumericFactorizations= ", solver4.numNumericFactorizations
+   '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (resultRef==0) & (result1==0) & (result4==0) & (err1<1e-9) & (err4<1e-9) & (solver4.numSymbolicFactorizations==1) & (solver4.numSupernodes>0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
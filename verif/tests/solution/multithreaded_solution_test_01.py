@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+# home made test
+''' Horizontal cantilever under vertical load at his front end. The
+    state, tangent and residual of the elements are computed
+    using several threads.'''
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2015, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from solution import predefined_solutions
+from model import predefined_spaces
+from materials import typical_materials
+
+# Geometry
+width= .05
+depth= .1
+nDivIJ= 5
+nDivJK= 10
+y0= 0
+z0= 0
+L= 1.5 # Bar length (m)
+Iy= width*depth**3/12 # Cross section moment of inertia (m4)
+NumDiv= 10 # Number of elements.
+
+# Load
+F= 1.5e3 # Load magnitude en N
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXYZ(i*L/NumDiv,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+
+# Materials definition
+fy= 275e6 # Yield stress of the steel.
+E= 210e9 # Young modulus of the steel.
+steel= typical_materials.defSteel01(preprocessor, "steel",E,fy,0.001)
+
+# Secciones
+import os
+pth= os.path.dirname(__file__)
+#print "pth= ", pth
+if(not pth):
+  pth= "."
+execfile(pth+"/../aux/testQuadRegion.py")
+
+materiales= preprocessor.getMaterialHandler
+quadFibers= materiales.newMaterial("fiber_section_3d","quadFibers")
+fiberSectionRepr= quadFibers.getFiberSectionRepr()
+fiberSectionRepr.setGeomNamed("testQuadRegion")
+quadFibers.setupFibers()
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "quadFibers"
+elements.numSections= 3 # Number of sections along the element.
+elements.defaultTag= 1
+for i in range(1,NumDiv+1):
+  el= elements.newElement("ForceBeamColumn3d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000_000(1)
+
+# Loads definition
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(NumDiv+1,xc.Vector([0,-F,0,0,0,0]))
+#We add the load case to domain.
+casos.addToDomain("0")
+# Solution procedure
+solution= predefined_solutions.SolutionProcedure()
+solution.convergenceTestTol= 0.01
+analisis= solution.simpleStaticModifiedNewton(feProblem)
+solution.analysisAggregation.numThreads= 4 # Threads used to compute the element state.
+result= analisis.analyze(10)
+
+nodes.calculateNodalReactions(True,1e-7) 
+delta= nodes.getNode(NumDiv+1).getDisp[1]  # Front end displacement.
+nod1= nodes.getNode(1)
+Ry= nod1.getReaction[1] 
+RMz= nod1.getReaction[5] 
+
+deltateor= (-F*L**3/(3*E*Iy))
+ratio1= (abs((delta-deltateor)/deltateor))
+MTeor= (F*L)
+ratio2= (abs((Ry-F)/F))
+ratio3= (abs((RMz-MTeor)/MTeor))
+
+''' 
+print "delta: ",delta
+print "deltaTeor: ",deltateor
+print "ratio1= ",ratio1
+print "Ry= ",Ry
+print "ratio2= ",ratio2
+print "RMz= ",RMz
+print "ratio3= ",ratio3
+   '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (abs(ratio1)<0.02) & (abs(ratio2)<1e-10) & (abs(ratio3)<1e-10) & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
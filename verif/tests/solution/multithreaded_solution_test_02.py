@@ -0,0 +1,120 @@
+# -*- coding: utf-8 -*-
+# home made test
+''' Horizontal cantilever under vertical load at his front end. The
+    system of equations is solved using the multithreaded profile
+    SPD solver.'''
+
+__author__= "Luis C. Pérez Tato (LCPT) and Ana Ortega (AOO)"
+__copyright__= "Copyright 2015, LCPT and AOO"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+L= 1.5 # Bar length (m)
+NumDiv= 100 # Number of elements.
+F= 1.5e3 # Load magnitude (N)
+
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor   
+nodes= preprocessor.getNodeHandler
+# Problem type
+modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+nodes.defaultTag= 1 #First node number.
+for i in range(0,NumDiv+1):
+  nod= nodes.newNodeXYZ(i*L/NumDiv,0.0,0.0)
+
+lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,0,1]))
+# Materials
+sectionProperties= xc.CrossSectionProperties3d()
+sectionProperties.A= A; sectionProperties.E= E; sectionProperties.G= G;
+sectionProperties.Iz= Iz; sectionProperties.Iy= Iy; sectionProperties.J= J
+seccion= typical_materials.defElasticSectionFromMechProp3d(preprocessor, "seccion",sectionProperties)
+
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultTransformation= "lin"
+elements.defaultMaterial= "seccion"
+elements.defaultTag= 1
+for i in range(1,NumDiv+1):
+  el= elements.newElement("ElasticBeam3d",xc.ID([i,i+1]))
+
+# Constraints
+modelSpace.fixNode000_000(1)
+
+# Loads definition
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(NumDiv+1,xc.Vector([0,F,0,0,0,0]))
+#We add the load case to domain.
+casos.addToDomain("0")
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("linear_soln_algo")
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+soe= analysisAggregation.newSystemOfEqn("profile_spd_lin_soe")
+solver= soe.newSolver("profile_spd_lin_direct_thread_solver")
+solver.blockSize= 16 # Small blocks so several of them are updated in parallel.
+analysisAggregation.numThreads= 4 # Threads used to factorize the matrix.
+analisis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analisis.analyze(1)
+
+nodes.calculateNodalReactions(True,1e-7) 
+delta= nodes.getNode(NumDiv+1).getDisp[1]  # Front end displacement.
+nod1= nodes.getNode(1)
+Ry= nod1.getReaction[1] 
+RMz= nod1.getReaction[5] 
+
+deltateor= (F*L**3/(3*E*Iz))
+ratio1= (abs((delta-deltateor)/deltateor))
+ratio2= (abs((Ry+F)/F))
+MTeor= (F*L)
+ratio3= (abs((abs(RMz)-MTeor)/MTeor))
+
+''' 
+print "delta: ",delta
+print "deltaTeor: ",deltateor
+print "ratio1= ",ratio1
+print "Ry= ",Ry
+print "ratio2= ",ratio2
+print "RMz= ",RMz
+print "ratio3= ",ratio3
+   '''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (abs(ratio1)<1e-6) & (abs(ratio2)<1e-10) & (abs(ratio3)<1e-10) & (result==0):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
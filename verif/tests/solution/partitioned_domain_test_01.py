@@ -0,0 +1,122 @@
+# -*- coding: utf-8 -*-
+''' Beam split in subdomains (PartitionedDomain). The state of the
+    subdomains updated using several threads must be the same that
+    the state obtained updating them serially. Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+# Geometry
+width= .05
+depth= .1
+nDivIJ= 5
+nDivJK= 10
+L= 1.5 # Bar length (m)
+NumDiv= 16 # Number of elements.
+NumSubdomains= 4 # Number of subdomains.
+
+# Imposed displacements
+eps= 5e-4 # Axial strain.
+k= 0.04 # Curvature (beyond the elastic limit).
+
+def solve(numThreads):
+  ''' Return the resisting forces of the elements after updating
+      the subdomains with numThreads threads.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  ok= preprocessor.usePartitionedDomain()
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for i in range(0,NumDiv+1):
+    nod= nodes.newNodeXYZ(i*L/NumDiv,0.0,0.0)
+
+  lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+
+  # Materials definition
+  fy= 275e6 # Yield stress of the steel.
+  E= 210e9 # Young modulus of the steel.
+  steel= typical_materials.defSteel01(preprocessor, "steel",E,fy,0.001)
+  materiales= preprocessor.getMaterialHandler
+  quadRegion= materiales.newSectionGeometry("quadRegion")
+  steelRegion= quadRegion.getRegions.newQuadRegion("steel")
+  steelRegion.nDivIJ= nDivIJ
+  steelRegion.nDivJK= nDivJK
+  steelRegion.pMin= geom.Pos2d(-width/2.0,-depth/2.0)
+  steelRegion.pMax= geom.Pos2d(width/2.0,depth/2.0)
+  quadFibers= materiales.newMaterial("fiber_section_3d","quadFibers")
+  fiberSectionRepr= quadFibers.getFiberSectionRepr()
+  fiberSectionRepr.setGeomNamed("quadRegion")
+  quadFibers.setupFibers()
+  # The fiber section is thread safe if its materials are.
+  ok= ok and steel.isThreadSafe and quadFibers.isThreadSafe
+
+  # Elements definition
+  elements= preprocessor.getElementHandler
+  elements.defaultTransformation= "lin"
+  elements.defaultMaterial= "quadFibers"
+  elements.numSections= 3 # Number of sections along the element.
+  elements.defaultTag= 1
+  for i in range(1,NumDiv+1):
+    el= elements.newElement("ForceBeamColumn3d",xc.ID([i,i+1]))
+
+  # Partition
+  domain= preprocessor.getDomain
+  ok= ok and (domain.partition(NumSubdomains,False,0)==0)
+  ok= ok and (domain.numSubdomains==NumSubdomains)
+
+  # Imposed displacements on the nodes of the subdomains.
+  for s in range(1,NumSubdomains+1):
+    sub= domain.getSubdomain(s)
+    ok= ok and sub.isThreadSafe()
+    for i in range(0,NumDiv+1):
+      n= sub.getNode(i+1)
+      if(n):
+        x= i*L/NumDiv
+        n.setTrialDisp(xc.Vector([eps*x,k*x**2/2.0,0.0,0.0,0.0,k*x]))
+  domain.update(numThreads)
+
+  retval= dict()
+  for s in range(1,NumSubdomains+1):
+    eIter= domain.getSubdomain(s).getMesh.getElementIter
+    elem= eIter.next()
+    while not(elem is None):
+      retval[elem.tag]= [f for f in elem.getResistingForce()]
+      elem= eIter.next()
+  return ok, retval
+
+ok0, serialForces= solve(1)
+ok1, threadedForces= solve(NumSubdomains)
+
+ok2= (len(serialForces)==NumDiv) and (len(threadedForces)==NumDiv)
+err= 0.0
+fMax= 0.0
+for tag in serialForces:
+  f0= serialForces[tag]
+  f1= threadedForces[tag]
+  for a, b in zip(f0,f1):
+    err= max(err,abs(b-a))
+    fMax= max(fMax,abs(a))
+
+'''
+print 'ok0= ', ok0, 'ok1= ', ok1, 'ok2= ', ok2
+print 'fMax= ', fMax
+print 'err= ', err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok0 and ok1 and ok2 and (fMax>0.0) and (err<=1e-12*fMax):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,127 @@
+# -*- coding: utf-8 -*-
+''' Beam split in subdomains (PartitionedDomain). The stiffness of the
+    subdomains condensed on their external nodes using several threads
+    must be the same that the one obtained condensing them serially.
+    Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+# Material properties
+E= 2.1e6*9.81/1e-4 # Elastic modulus (Pa)
+nu= 0.3 # Poisson's ratio
+G= E/(2*(1+nu)) # Shear modulus
+
+# Cross section properties (IPE-80)
+A= 7.64e-4 # Cross section area (m2)
+Iy= 80.1e-8 # Cross section moment of inertia (m4)
+Iz= 8.49e-8 # Cross section moment of inertia (m4)
+J= 0.721e-8 # Cross section torsion constant (m4)
+
+# Geometry
+L= 1.5 # Bar length (m)
+NumDiv= 16 # Number of elements.
+NumSubdomains= 4 # Number of subdomains.
+
+def condense(numThreads):
+  ''' Return the stiffness matrices of the subdomains condensed
+      on their external nodes using numThreads threads.'''
+  feProblem= xc.FEProblem()
+  preprocessor=  feProblem.getPreprocessor
+  ok= preprocessor.usePartitionedDomain()
+  nodes= preprocessor.getNodeHandler
+  modelSpace= predefined_spaces.StructuralMechanics3D(nodes)
+  nodes.defaultTag= 1 #First node number.
+  for i in range(0,NumDiv+1):
+    nod= nodes.newNodeXYZ(i*L/NumDiv,0.0,0.0)
+
+  lin= modelSpace.newLinearCrdTransf("lin",xc.Vector([0,1,0]))
+
+  # Materials definition
+  sectionProperties= xc.CrossSectionProperties3d()
+  sectionProperties.A= A; sectionProperties.E= E; sectionProperties.G= G;
+  sectionProperties.Iz= Iz; sectionProperties.Iy= Iy; sectionProperties.J= J
+  seccion= typical_materials.defElasticSectionFromMechProp3d(preprocessor, "seccion",sectionProperties)
+
+  # Elements definition
+  elements= preprocessor.getElementHandler
+  elements.defaultTransformation= "lin"
+  elements.defaultMaterial= "seccion"
+  elements.defaultTag= 1
+  for i in range(1,NumDiv+1):
+    el= elements.newElement("ElasticBeam3d",xc.ID([i,i+1]))
+
+  # Partition
+  domain= preprocessor.getDomain
+  ok= ok and (domain.partition(NumSubdomains,False,0)==0)
+  ok= ok and (domain.numSubdomains==NumSubdomains)
+
+  # Static condensation of the subdomains.
+  for s in range(1,NumSubdomains+1):
+    sub= domain.getSubdomain(s)
+    ok= ok and (sub.newStaticCondensationAnalysis()==0)
+  ok= ok and (domain.condense(numThreads)==0)
+
+  retval= dict()
+  for s in range(1,NumSubdomains+1):
+    sub= domain.getSubdomain(s)
+    extNodes= [tag for tag in sub.getExternalNodes()]
+    numDOF= sub.numDOF
+    ok= ok and (numDOF==6*len(extNodes))
+    K= sub.getTang()
+    x= [sub.getNode(tag).getCoo[0] for tag in extNodes]
+    retval[s]= (x, [[K(i,j) for j in range(0,numDOF)] for i in range(0,numDOF)])
+  return ok, retval
+
+ok0, serialK= condense(1)
+ok1, threadedK= condense(NumSubdomains)
+
+# Threaded and serial condensation must give the same matrices.
+err= 0.0
+kMax= 0.0
+for s in serialK:
+  K0= serialK[s][1]
+  K1= threadedK[s][1]
+  ok1= ok1 and (len(K0)==len(K1))
+  for r0, r1 in zip(K0,K1):
+    for a, b in zip(r0,r1):
+      err= max(err,abs(b-a))
+      kMax= max(kMax,abs(a))
+
+# The axial stiffness of a subdomain between two external nodes
+# must be the one of a bar with the same length.
+numChecked= 0
+ratio= 0.0
+for s in serialK:
+  x, K= serialK[s]
+  if(len(x)==2):
+    Ls= abs(x[1]-x[0])
+    EA_L= E*A/Ls
+    ratio= max(ratio,abs(K[0][0]-EA_L)/EA_L,abs(K[0][6]+EA_L)/EA_L)
+    numChecked+= 1
+
+'''
+print 'ok0= ', ok0, 'ok1= ', ok1
+print 'kMax= ', kMax
+print 'err= ', err
+print 'numChecked= ', numChecked
+print 'ratio= ', ratio
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok0 and ok1 and (kMax>0.0) and (err<=1e-12*kMax) and (numChecked>=2) and (ratio<1e-10):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,138 @@
+# -*- coding: utf-8 -*-
+# Test from Ansys manual (SuperLU solver reusing the symbolic factorization
+# along the load steps).
+# Reference:  Strength of Material, Part I, Elementary Theory & Problems, pg. 26, problem 10
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from solution import predefined_solutions
+from materials import typical_materials
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2014, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+E= 30e6 # Young modulus (psi)
+l= 10 # Bar length in inches
+a= 0.3*l # Length of tranche a
+b= 0.3*l # Length of tranche b
+F1= 1000 # Force magnitude 1 (pounds)
+F2= 1000/2 # Force magnitude 2 (pounds)
+
+# Model definition
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+
+# Problem type
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+
+
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXY(0,0)
+nod= nodes.newNodeXY(0.0,l-a-b)
+nod= nodes.newNodeXY(0.0,l-a)
+nod= nodes.newNodeXY(0.0,l)
+
+# Materials definition
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+    
+''' We define nodes at the points where loads will be applied.
+    We will not compute stresses so we can use an arbitrary
+    cross section of unit area.'''
+    
+# Elements definition
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 2 # Dimension of element space
+#  sintaxis: truss[<tag>] 
+elements.defaultTag= 1 #Tag for the next element.
+truss= elements.newElement("Truss",xc.ID([1,2]));
+truss.area= 1
+truss= elements.newElement("Truss",xc.ID([2,3]));
+truss.area= 1
+truss= elements.newElement("Truss",xc.ID([3,4]));
+truss.area= 1
+    
+# Constraints
+constraints= preprocessor.getBoundaryCondHandler
+#
+spc= constraints.newSPConstraint(1,0,0.0) # Node 1
+spc= constraints.newSPConstraint(1,1,0.0)
+spc= constraints.newSPConstraint(4,0,0.0) # Node 4
+spc= constraints.newSPConstraint(4,1,0.0)
+spc= constraints.newSPConstraint(2,0,0.0) # Node 2
+spc= constraints.newSPConstraint(3,0,0.0) # Node 3
+
+
+# Loads definition
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+#Load modulation.
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+#Load case definition
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([0,-F2]))
+lp0.newNodalLoad(3,xc.Vector([0,-F1]))
+#We add the load case to domain.
+casos.addToDomain("0")
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+cHandler= sm.newConstraintHandler("penalty_constraint_handler")
+cHandler.alphaSP= 1.0e15
+cHandler.alphaMP= 1.0e15
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("simple")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("analysisAggregation","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+convTest= analysisAggregation.newConvergenceTest("norm_unbalance_conv_test")
+convTest.tol=1.0e-9
+convTest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("load_control_integrator",xc.Vector([]))
+integ.dLambda1= 0.25
+soe= analysisAggregation.newSystemOfEqn("sparse_gen_col_lin_soe")
+solver= soe.newSolver("super_lu_solver")
+analysis= solu.newAnalysis("static_analysis","analysisAggregation","")
+result= analysis.analyze(4) # Four load steps.
+
+# The column ordering is computed only once (the sparsity pattern
+# doesn't change) while the matrix is factorized at each step.
+numSymbolic= solver.numSymbolicFactorizations
+numNumeric= solver.numNumericFactorizations
+solver.resetCounters()
+countersReset= (solver.numSymbolicFactorizations==0) & (solver.numNumericFactorizations==0)
+
+nodes.calculateNodalReactions(True,1e-7)
+R1= nodes.getNode(4).getReaction[1] 
+R2= nodes.getNode(1).getReaction[1] 
+
+
+ratio1= R1/900/2.0
+ratio2= R2/600/2.0
+    
+''' 
+print "R1= ",R1
+print "R2= ",R2
+print "ratio1= ",(ratio1)
+print "ratio2= ",(ratio2)
+print "numSymbolic= ",numSymbolic
+print "numNumeric= ",numNumeric
+'''
+    
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (abs(ratio1-1.0)<1e-5) & (abs(ratio2-1.0)<1e-5) & (result==0) & (numSymbolic==1) & (numNumeric>=4) & countersReset:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
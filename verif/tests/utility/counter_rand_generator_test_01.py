@@ -0,0 +1,85 @@
+# -*- coding: utf-8 -*-
+''' Counter based random number generator. The samples must not depend
+    on the order in which they are generated (so the sample range can
+    be split between several workers) and each replicate of a Latin
+    hypercube design must use every stratum once for each variable.
+    Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import xc_base
+import xc
+
+seed= 7
+numRV= 3 # Number of random variables.
+lhsSize= 10 # Number of samples of the Latin hypercube design.
+numSamples= 2*lhsSize # Two replicates of the design.
+
+def getSamples(generator, sampleRange, latinHypercube):
+  ''' Return the samples with index in the range.'''
+  retval= dict()
+  generator.sampleIndex= sampleRange[0]
+  for s in sampleRange:
+    if(latinHypercube):
+      generator.generate_nLatinHypercubeStdNormalNumbers(numRV,lhsSize)
+    else:
+      generator.generate_nIndependentStdNormalNumbers(numRV,0)
+    retval[s]= [z for z in generator.getGeneratedNumbers()]
+  return retval
+
+def sameSamples(a,b):
+  ''' Return true if both sets of samples are identical.'''
+  retval= (len(a)==len(b))
+  for s in a:
+    retval= retval and (a[s]==b[s])
+  return retval
+
+# Whole run vs. the same range split in two parts (run backwards).
+ok= True
+for lhs in [False, True]:
+  wholeRun= getSamples(xc.CounterRandGenerator(seed),range(0,numSamples),lhs)
+  splitGenerator= xc.CounterRandGenerator(seed)
+  splitRun= getSamples(splitGenerator,range(numSamples/2,numSamples),lhs)
+  splitRun.update(getSamples(splitGenerator,range(0,numSamples/2),lhs))
+  ok= ok and sameSamples(wholeRun,splitRun)
+
+# Each replicate of the Latin hypercube design uses each stratum once.
+generator= xc.CounterRandGenerator(seed)
+lhsRun= getSamples(generator,range(0,numSamples),True)
+okStrata= True
+err= 0.0
+permutations= list()
+for r in range(0,numSamples/lhsSize):
+  replicate= range(r*lhsSize,(r+1)*lhsSize)
+  for j in range(0,numRV):
+    strata= list()
+    for s in replicate:
+      p= generator.getLatinHypercubeUniform(s,lhsSize,j)
+      strata.append(int(p*lhsSize))
+      # Standard normal number corresponding to p.
+      z= lhsRun[s][j]
+      err= max(err,abs(0.5*(1.0+math.erf(z/math.sqrt(2.0)))-p))
+    okStrata= okStrata and (sorted(strata)==range(0,lhsSize))
+    permutations.append(strata)
+# The replicates don't repeat the points of the design.
+okReplicates= (permutations[0:numRV]!=permutations[numRV:2*numRV])
+
+'''
+print 'ok= ', ok
+print 'okStrata= ', okStrata
+print 'okReplicates= ', okReplicates
+print 'err= ', err
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if ok and okStrata and okReplicates and (err<1e-4):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
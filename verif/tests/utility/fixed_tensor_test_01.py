@@ -0,0 +1,121 @@
+# -*- coding: utf-8 -*-
+''' Fixed size tensors (Tensor2_3d, Tensor4_3d) verification. The
+    contractions are compared with the ones computed with numpy and the
+    derivatives of the stress invariants of stresstensor (computed
+    with the fixed size tensors) with the formulas used before with
+    the BJtensor objects. Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import math
+import numpy
+import xc_base
+import xc
+
+def toNumpy(tensor, rank):
+  ''' Return the components of the fixed size tensor in a numpy array.'''
+  return numpy.array([x for x in tensor.getVector()]).reshape((3,)*rank)
+
+def fromNumpy(a):
+  ''' Return the fixed size tensor with the components of the array.'''
+  v= xc.Vector([x for x in a.flatten()])
+  if(a.ndim==2):
+    return xc.Tensor2_3d(v)
+  else:
+    return xc.Tensor4_3d(v)
+
+def relErr(a,b):
+  ''' Relative difference between both arrays.'''
+  return numpy.linalg.norm(a-b)/numpy.linalg.norm(b)
+
+d= numpy.eye(3) # Kronecker delta.
+a= numpy.array([[1.0,-2.0,0.5],[3.0,4.0,-1.0],[0.25,2.0,-3.0]])
+b= numpy.array([[-2.0,1.0,4.0],[0.5,-3.0,2.0],[1.0,1.5,2.5]])
+C= numpy.einsum('ij,kl->ijkl',a,b)+numpy.einsum('ik,jl->ijkl',b,a)
+D= numpy.einsum('il,jk->ijkl',a,a)-numpy.einsum('ij,kl->ijkl',b,d)
+A= fromNumpy(a); B= fromNumpy(b)
+CC= fromNumpy(C); DD= fromNumpy(D)
+
+err= 0.0
+# Contractions.
+err= max(err,relErr(toNumpy(A.dot(B),2),numpy.einsum('ik,kj->ij',a,b)))
+err= max(err,relErr(toNumpy(A.dyad(B),4),numpy.einsum('ij,kl->ijkl',a,b)))
+err= max(err,relErr(toNumpy(CC.ddot(A),2),numpy.einsum('ijkl,kl->ij',C,a)))
+err= max(err,relErr(toNumpy(A.ddot(CC),2),numpy.einsum('ij,ijkl->kl',a,C)))
+err= max(err,relErr(toNumpy(CC.ddot(DD),4),numpy.einsum('ijmn,mnkl->ijkl',C,D)))
+# Isotropic tensors.
+lmbd= 3.0; mu2= 5.0
+err= max(err,relErr(toNumpy(xc.Tensor4_3d.I_ijkl(),4),numpy.einsum('ij,kl->ijkl',d,d)))
+err= max(err,relErr(toNumpy(xc.Tensor4_3d.I_ikjl(),4),numpy.einsum('ik,jl->ijkl',d,d)))
+err= max(err,relErr(toNumpy(xc.Tensor4_3d.I_iljk(),4),numpy.einsum('il,jk->ijkl',d,d)))
+isotropic= lmbd*numpy.einsum('ij,kl->ijkl',d,d)+mu2*0.5*(numpy.einsum('ik,jl->ijkl',d,d)+numpy.einsum('il,jk->ijkl',d,d))
+err= max(err,relErr(toNumpy(xc.Tensor4_3d.isotropic(lmbd,mu2),4),isotropic))
+
+# Derivatives of the stress invariants; the old formulas were
+# written in terms of BJtensor contractions (p,q,m,n= i,j,k,l).
+sigma= numpy.array([[-10.0,2.0,3.0],[2.0,-5.0,1.5],[3.0,1.5,-7.0]])
+st= xc.stresstensor(fromNumpy(sigma).getBJtensor())
+J2D= st.Jinvariant2()
+q= st.q_deviatoric()
+theta= st.theta()
+s= sigma-d*(numpy.trace(sigma)*(0.333333333)) # stresstensor::deviator
+t= numpy.einsum('qk,kp->qp',s,s)-d*(J2D*(2.0/3.0))
+c3t= math.cos(3.0*theta)
+s3t= math.sin(3.0*theta)
+I_pqmn= numpy.einsum('pq,mn->pqmn',d,d)
+I_pmqn= numpy.einsum('pm,qn->pqmn',d,d) # I_pqmn.transpose0110()
+
+# dthetaoverds
+dthetaOld= s*((3.0/2.0)*(c3t/(q*q*s3t)))-t*((9.0/2.0)*(1.0/(q*q*q*s3t)))
+errDerivatives= relErr(toNumpy(xc.Tensor2_3d(st.dthetaoverds()),2),dthetaOld)
+
+# d2qoverds2
+iso1= I_pmqn-I_pqmn*(1.0/3.0)
+d2qOld= iso1*((3.0/2.0)*(1/q))-numpy.einsum('pq,mn->pqmn',s,s)*((9.0/4.0)*(1.0/(q**3)))
+errDerivatives= max(errDerivatives,relErr(toNumpy(xc.Tensor4_3d(st.d2qoverds2()),4),d2qOld))
+
+# d2thetaoverds2
+s3t3= s3t**3
+tempss= -(9.0/2.0)*(c3t)/(q**4*s3t)-(27.0/4.0)*(c3t/(s3t3*q**4))
+tempst= (81.0/4.0)*(1.0)/(s3t3*q**5)
+tempts= (81.0/4.0)*(1.0/(s3t*q**5))+(81.0/4.0)*(c3t*c3t)/(s3t3*q**5)
+temptt= -(243.0/4.0)*(c3t/(s3t3*q**6))
+tempp= +(3.0/2.0)*(c3t/(s3t*q*q))
+tempw= -(9.0/2.0)*(1.0/(s3t*q**3))
+p= I_pmqn-I_pqmn*(1.0/3.0)
+s_pq_d_mn= numpy.einsum('pq,mn->pqmn',s,d)
+s_pn_d_mq= numpy.einsum('pn,mq->pqmn',s,d) # s_pq_d_mn.transpose0101()
+d_pq_s_mn= numpy.einsum('pq,mn->pqmn',d,s)
+d_pn_s_mq= numpy.einsum('pn,mq->pqmn',d,s) # d_pq_s_mn.transpose0101()
+w= s_pn_d_mq+d_pn_s_mq-s_pq_d_mn*(2.0/3.0)-d_pq_s_mn*(2.0/3.0)
+d2thetaOld= numpy.einsum('pq,mn->pqmn',s,s)*tempss+numpy.einsum('pq,mn->pqmn',s,t)*tempst+numpy.einsum('pq,mn->pqmn',t,s)*tempts+numpy.einsum('pq,mn->pqmn',t,t)*temptt+p*tempp+w*tempw
+errDerivatives= max(errDerivatives,relErr(toNumpy(xc.Tensor4_3d(st.d2thetaoverds2()),4),d2thetaOld))
+
+# Wrong number of components (exception instead of aborting).
+numExceptions= 0
+try:
+  xc.Tensor2_3d(xc.Vector([1.0,2.0,3.0]))
+except ValueError:
+  numExceptions+= 1
+try:
+  xc.Tensor4_3d(fromNumpy(a).getBJtensor())
+except ValueError:
+  numExceptions+= 1
+
+'''
+print 'err= ', err
+print 'errDerivatives= ', errDerivatives
+print 'numExceptions= ', numExceptions
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (err<1e-14) and (errDerivatives<1e-12) and (numExceptions==2):
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
@@ -0,0 +1,125 @@
+# -*- coding: utf-8 -*-
+''' Built-in actions, compiled callbacks and batch callback
+    of the property recorders. Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import xc_base
+import geom
+import xc
+from model import predefined_spaces
+from materials import typical_materials
+
+E= 2.1e11 # Elastic modulus
+A= 4e-4 # Bar area
+l= 2.0 # Bar length
+dU= 1e-4 # Displacement increment.
+numSteps= 10
+
+# Model definition
+feProblem= xc.FEProblem()
+preprocessor=  feProblem.getPreprocessor
+nodes= preprocessor.getNodeHandler
+modelSpace= predefined_spaces.SolidMechanics2D(nodes)
+nodes.defaultTag= 1 #First node number.
+nod= nodes.newNodeXY(0,0)
+nod= nodes.newNodeXY(l,0.0)
+
+elast= typical_materials.defElasticMaterial(preprocessor, "elast",E)
+elements= preprocessor.getElementHandler
+elements.defaultMaterial= "elast"
+elements.dimElem= 2 # Dimension of element space
+truss= elements.newElement("Truss",xc.ID([1,2]))
+truss.area= A
+
+constraints= preprocessor.getBoundaryCondHandler
+spc= constraints.newSPConstraint(1,0,0.0) # Node 1
+spc= constraints.newSPConstraint(1,1,0.0)
+spc= constraints.newSPConstraint(2,1,0.0) # Node 2
+
+cargas= preprocessor.getLoadHandler
+casos= cargas.getLoadPatterns
+ts= casos.newTimeSeries("constant_ts","ts")
+casos.currentTimeSeries= "ts"
+lp0= casos.newLoadPattern("default","0")
+lp0.newNodalLoad(2,xc.Vector([1.0,0]))
+casos.addToDomain("0")
+
+# Recorders.
+x= []
+nodeRecorder= feProblem.getDomain.newRecorder("node_prop_recorder",None)
+nodeRecorder.setNodes(xc.ID([1,2]))
+nodeRecorder.callbackRecord= "x.append(self.getDisp[0])" # Compiled once.
+iMaxDisp= nodeRecorder.addAction("max","disp",0)
+iMinDisp= nodeRecorder.addAction("min","disp",0)
+iWrong= nodeRecorder.addAction("max","disp",-1) # Rejected (returns -1).
+
+steps= []
+def batch(recorder, stepValues):
+  steps.append(stepValues(0,1))
+
+elemRecorder= feProblem.getDomain.newRecorder("element_prop_recorder",None)
+elemRecorder.setElements(xc.ID([0]))
+iStore= elemRecorder.addAction("store","axialForce",0)
+iSum= elemRecorder.addAction("sum","axialForce",0)
+iAbsMax= elemRecorder.addAction("abs_max","axialForce",0)
+elemRecorder.callbackBatch= batch
+
+# Solution procedure
+solu= feProblem.getSoluProc
+solCtrl= solu.getSoluControl
+solModels= solCtrl.getModelWrapperContainer
+sm= solModels.newModelWrapper("sm")
+numberer= sm.newNumberer("default_numberer")
+numberer.useAlgorithm("rcm")
+cHandler= sm.newConstraintHandler("transformation_constraint_handler")
+analysisAggregations= solCtrl.getAnalysisAggregationContainer
+analysisAggregation= analysisAggregations.newAnalysisAggregation("ldctrl","sm")
+solAlgo= analysisAggregation.newSolutionAlgorithm("newton_raphson_soln_algo")
+ctest= analysisAggregation.newConvergenceTest("energy_inc_conv_test")
+ctest.tol= 1e-9
+ctest.maxNumIter= 10
+integ= analysisAggregation.newIntegrator("displacement_control_integrator",xc.Vector([]))
+integ.nod= 2
+integ.dof= 0
+integ.dU1= dU
+soe= analysisAggregation.newSystemOfEqn("sparse_gen_col_lin_soe")
+solver= soe.newSolver("super_lu_solver")
+analysis= solu.newAnalysis("static_analysis","ldctrl","")
+result= analysis.analyze(numSteps)
+
+k= E*A/l
+maxDisp= nodeRecorder.getActionValues(iMaxDisp)
+minDisp= nodeRecorder.getActionValues(iMinDisp)
+history= elemRecorder.getActionHistory(iStore)
+sumN= elemRecorder.getActionValues(iSum)[0]
+maxN= elemRecorder.getActionValues(iAbsMax)[0]
+sumNRef= k*dU*numSteps*(numSteps+1)/2.0
+
+ratio1= abs(maxDisp[1]-numSteps*dU)/(numSteps*dU)+abs(maxDisp[0])
+ratio2= abs(minDisp[1]-dU)/dU
+ratio3= abs(history(numSteps-1,0)-k*numSteps*dU)/(k*numSteps*dU)+abs(history(0,0)-k*dU)/(k*dU)+abs(maxN-k*numSteps*dU)/(k*numSteps*dU)
+ratio4= abs(sumN-sumNRef)/sumNRef
+ratio5= abs(steps[-1]-k*numSteps*dU)/(k*numSteps*dU)
+ok= (len(x)==2*numSteps) and (len(steps)==numSteps) and (history.noRows==numSteps)
+
+'''
+print 'maxDisp= ', maxDisp, ' ratio1= ', ratio1
+print 'minDisp= ', minDisp, ' ratio2= ', ratio2
+print 'history= ', history, ' ratio3= ', ratio3
+print 'sumN= ', sumN, ' ratio4= ', ratio4
+print 'steps= ', steps, ' ratio5= ', ratio5
+print 'ok= ', ok
+'''
+
+import os
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (abs(ratio1)<1e-10) & (abs(ratio2)<1e-10) & (abs(ratio3)<1e-10) & (abs(ratio4)<1e-10) & (abs(ratio5)<1e-10) & (iWrong==-1) & ok:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')
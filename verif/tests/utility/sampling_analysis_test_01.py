@@ -0,0 +1,112 @@
+# -*- coding: utf-8 -*-
+''' Sampling analysis with a counter based random number generator and
+    Latin hypercube sampling. The values of the limit-state function
+    must not depend on the way the sample range is split between
+    several analyses (workers), the samples must use every stratum of
+    the design once for each variable and the probability of failure
+    must approach the exact value. Home made test.'''
+
+__author__= "Luis C. Pérez Tato (LCPT)"
+__copyright__= "Copyright 2018, LCPT"
+__license__= "GPL"
+__version__= "3.0"
+__email__= "l.pereztato@gmail.com"
+
+import os
+import math
+import xc_base
+import xc
+
+seed= 7
+lhsSize= 20 # Number of samples of the Latin hypercube design.
+
+# Random variables: resistance and load effect.
+reliabilityDomain= xc.ReliabilityDomain()
+rvR= reliabilityDomain.newRandomVariable("normal",1,5.0,1.0)
+rvS= reliabilityDomain.newRandomVariable("normal",2,2.0,1.0)
+lsf= reliabilityDomain.newLimitStateFunction(1,"{r}-{s}")
+transformation= xc.NatafProbabilityTransformation(reliabilityDomain,0)
+
+samples= list()
+def runAnalysis(x):
+  ''' Store the realization of the random variables.'''
+  samples.append([x[0],x[1]])
+  return 0
+
+def getResponses():
+  ''' Values of the variables of the limit-state function.'''
+  x= samples[-1]
+  return {'r':x[0], 's':x[1]}
+
+gFunEvaluator= xc.PythonGFunEvaluator(reliabilityDomain)
+gFunEvaluator.analysisCallback= runAnalysis
+gFunEvaluator.responseCallback= getResponses
+
+fileName= "/tmp/sampling_analysis_test_01.txt"
+
+def runSampling(firstSample, numSimulations, analysisType):
+  ''' Run the sampling analysis for the samples
+      [firstSample,firstSample+numSimulations).'''
+  generator= xc.CounterRandGenerator(seed)
+  analysis= xc.SamplingAnalysis(reliabilityDomain,transformation,gFunEvaluator,generator,numSimulations,0.0,1.0,fileName,analysisType)
+  analysis.firstSample= firstSample
+  analysis.latinHypercubeSize= lhsSize
+  return analysis.analyze()
+
+def readGValues():
+  ''' Read the values of the limit-state function (by sample index).'''
+  retval= dict()
+  f= open(fileName,'r')
+  for line in f:
+    fields= line.split()
+    if(len(fields)>1):
+      retval[int(fields[0])]= fields[1]
+  f.close()
+  return retval
+
+# Whole sample range.
+result= runSampling(0,lhsSize,3)
+wholeRun= readGValues()
+wholeSamples= list(samples)
+
+# Sample range split between two analyses.
+result+= runSampling(0,8,3)
+splitRun= readGValues()
+result+= runSampling(8,lhsSize-8,3)
+splitRun.update(readGValues())
+okSplit= (len(wholeRun)==lhsSize) and (splitRun==wholeRun)
+
+# Each variable uses every stratum of the design once.
+def stratum(x,rv):
+  u= (x-rv.getMean())/rv.getStdv()
+  p= 0.5*(1.0+math.erf(u/math.sqrt(2.0)))
+  return int(p*lhsSize)
+okStrata= True
+for j, rv in enumerate([rvR,rvS]):
+  strata= sorted([stratum(x[j],rv) for x in wholeSamples[0:lhsSize]])
+  okStrata= okStrata and (strata==range(0,lhsSize))
+
+# Probability of failure.
+numSimulations= 200*lhsSize
+result+= runSampling(0,numSimulations,1)
+beta= (rvR.getMean()-rvS.getMean())/math.sqrt(rvR.getStdv()**2+rvS.getStdv()**2)
+pfTeor= 0.5*(1.0+math.erf(-beta/math.sqrt(2.0)))
+pf= lsf.simulationProbabilityOfFailure
+ratio= abs(pf-pfTeor)/pfTeor
+okPf= (ratio<0.4) and (lsf.numberOfSimulations==numSimulations)
+os.remove(fileName)
+
+'''
+print 'wholeRun= ', wholeRun
+print 'splitRun= ', splitRun
+print 'okSplit= ', okSplit
+print 'okStrata= ', okStrata
+print 'pf= ', pf, ' pfTeor= ', pfTeor, ' ratio= ', ratio
+'''
+
+from miscUtils import LogMessages as lmsg
+fname= os.path.basename(__file__)
+if (result==0) and okSplit and okStrata and okPf:
+  print "test ",fname,": ok."
+else:
+  lmsg.error(fname+' ERROR.')